@@ -0,0 +1,78 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <SDL.h>
+
+#include "AllocationProfiler.hpp"
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+
+// Length of a frame of the scripted run ( in seconds )
+static const double FRAME_TIME = 1.0 / 60.0;
+
+// Most frames played per episode, so an episode that never dies still ends
+static const int MAX_EPISODE_FRAMES = 60 * 60 * 5;
+
+// How far above the bottom of the next gap the script flaps ( in pixels )
+static const int FLAP_MARGIN = BIRD_LENGTH / 4;
+
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    if( argc > 3 || ( argc > 1 && argv[ 1 ][ 0 ] == '-' ) )
+    {
+        printUsage();
+        return 1;
+    }
+
+    int numEpisodes = argc >= 2 ? atoi( argv[ 1 ] ) : 20;
+    int firstSeed = argc >= 3 ? atoi( argv[ 2 ] ) : 0;
+
+    if( !ALLOC_isEnabled() )
+    {
+        ALLOC_printReport();
+        return 1;
+    }
+
+    // Levels are built between frames, steady play must not allocate at all
+    LevelGenerator generator;
+    HeadlessGame game;
+    ALLOC_setFrameBudget( 0, 0 );
+
+    long numFrames = 0;
+    int totalScore = 0;
+    for( int episode = 0; episode < numEpisodes; ++episode )
+    {
+        game.reset( generator, firstSeed + episode );
+
+        for( int frame = 0; frame < MAX_EPISODE_FRAMES && game.isAlive() && !game.isFinished(); ++frame )
+        {
+            ALLOC_beginFrame();
+
+            // Flap when falling to just above the bottom of the next gap
+            const std::vector<Pipe>& level = game.getLevel();
+            int next = game.getNextPipe();
+            int flapY = next < int( level.size() ) ? level[ next ].getBotRect().y - PLAYER_HEIGHT - FLAP_MARGIN : SCREEN_HEIGHT / 2;
+            game.step( generator, game.getVelY() > 0 && game.getPosY() > flapY, FRAME_TIME );
+
+            ALLOC_endFrame();
+            ++numFrames;
+        }
+
+        totalScore += game.getScore();
+    }
+
+    printf( "Played %d episodes, %ld frames, %d points\n", numEpisodes, numFrames, totalScore );
+    ALLOC_printReport();
+
+    return ALLOC_getBudgetViolations() == 0 ? 0 : 1;
+}
+
+void printUsage()
+{
+    printf( "Usage:\n" );
+    printf( "  AllocationCheck [numEpisodes] [firstSeed]\n" );
+    printf( "Plays scripted headless episodes and fails if any frame allocates ( needs a build with ALLOCATION_PROFILER )\n" );
+}
@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <SDL.h>
+
+#include "AllocationProfiler.hpp"
+
+#ifdef ALLOCATION_PROFILER
+
+// Deepest nesting of tags that is tracked, deeper tags count for the one at the limit
+static const int AL_MAX_TAG_DEPTH = 16;
+
+// Names for allocations without tag and for tags past ALLOC_MAX_TAGS
+static const char* const AL_UNTAGGED = "untagged";
+static const char* const AL_OTHER = "other";
+
+// Counts of a tag in the current frame and in all frames
+struct AL_TagStats{
+    const char* tag;
+    AllocationStats frame;
+    AllocationStats total;
+};
+
+// Everything below is only written on the frame thread and holds plain values, so counting never allocates or locks
+static thread_local bool gFrameThread = false;
+static thread_local const char* gTagStack[ AL_MAX_TAG_DEPTH ];
+static thread_local int gTagDepth = 0;
+
+static bool gInFrame = false;
+static Uint64 gNumFrames = 0;
+static AllocationStats gFrame = { 0, 0, 0 };
+static AllocationStats gTotal = { 0, 0, 0 };
+
+static AL_TagStats gTags[ ALLOC_MAX_TAGS ];
+static int gNumTags = 0;
+
+static Uint64 gMaxAllocations = ~Uint64( 0 );
+static Uint64 gMaxBytes = ~Uint64( 0 );
+static Uint64 gBudgetViolations = 0;
+
+// Gets stats of the innermost tag, adding it if it is new
+static AL_TagStats& AL_currentTag()
+{
+    const char* tag = gTagDepth > 0 ? gTagStack[ std::min( gTagDepth, AL_MAX_TAG_DEPTH ) - 1 ] : AL_UNTAGGED;
+
+    for( int i = 0; i < gNumTags; ++i )
+    {
+        if( gTags[ i ].tag == tag )
+        {
+            return gTags[ i ];
+        }
+    }
+
+    // The last slot collects every tag that does not fit
+    if( gNumTags == ALLOC_MAX_TAGS - 1 )
+    {
+        tag = AL_OTHER;
+    }
+    if( gNumTags == ALLOC_MAX_TAGS )
+    {
+        return gTags[ ALLOC_MAX_TAGS - 1 ];
+    }
+
+    gTags[ gNumTags ] = { tag, { 0, 0, 0 }, { 0, 0, 0 } };
+    return gTags[ gNumTags++ ];
+}
+
+static void* AL_allocate( const std::size_t size )
+{
+    void* memory = std::malloc( size == 0 ? 1 : size );
+
+    if( memory != nullptr && gFrameThread && gInFrame )
+    {
+        AL_TagStats& tag = AL_currentTag();
+        ++gFrame.allocations;
+        ++tag.frame.allocations;
+        gFrame.bytes += size;
+        tag.frame.bytes += size;
+    }
+
+    return memory;
+}
+
+static void AL_free( void* memory )
+{
+    if( memory == nullptr )
+    {
+        return;
+    }
+
+    if( gFrameThread && gInFrame )
+    {
+        ++gFrame.frees;
+        ++AL_currentTag().frame.frees;
+    }
+
+    std::free( memory );
+}
+
+void* operator new( std::size_t size )
+{
+    void* memory = AL_allocate( size );
+    if( memory == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[]( std::size_t size )
+{
+    void* memory = AL_allocate( size );
+    if( memory == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    return AL_allocate( size );
+}
+
+void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    return AL_allocate( size );
+}
+
+void operator delete( void* memory ) noexcept
+{
+    AL_free( memory );
+}
+
+void operator delete[]( void* memory ) noexcept
+{
+    AL_free( memory );
+}
+
+void operator delete( void* memory, std::size_t ) noexcept
+{
+    AL_free( memory );
+}
+
+void operator delete[]( void* memory, std::size_t ) noexcept
+{
+    AL_free( memory );
+}
+
+void operator delete( void* memory, const std::nothrow_t& ) noexcept
+{
+    AL_free( memory );
+}
+
+void operator delete[]( void* memory, const std::nothrow_t& ) noexcept
+{
+    AL_free( memory );
+}
+
+bool ALLOC_isEnabled()
+{
+    return true;
+}
+
+void ALLOC_beginFrame()
+{
+    gFrameThread = true;
+    gInFrame = true;
+    gFrame = { 0, 0, 0 };
+
+    for( int i = 0; i < gNumTags; ++i )
+    {
+        gTags[ i ].frame = { 0, 0, 0 };
+    }
+}
+
+AllocationStats ALLOC_endFrame( const bool checkBudget )
+{
+    gInFrame = false;
+    ++gNumFrames;
+
+    gTotal.allocations += gFrame.allocations;
+    gTotal.frees += gFrame.frees;
+    gTotal.bytes += gFrame.bytes;
+    for( int i = 0; i < gNumTags; ++i )
+    {
+        gTags[ i ].total.allocations += gTags[ i ].frame.allocations;
+        gTags[ i ].total.frees += gTags[ i ].frame.frees;
+        gTags[ i ].total.bytes += gTags[ i ].frame.bytes;
+    }
+
+    if( checkBudget && ( gFrame.allocations > gMaxAllocations || gFrame.bytes > gMaxBytes ) )
+    {
+        ++gBudgetViolations;
+
+        printf( "Frame %llu is over allocation budget: %llu allocations, %llu bytes\n", static_cast<unsigned long long>( gNumFrames ),
+                static_cast<unsigned long long>( gFrame.allocations ), static_cast<unsigned long long>( gFrame.bytes ) );
+        for( int i = 0; i < gNumTags; ++i )
+        {
+            if( gTags[ i ].frame.allocations > 0 )
+            {
+                printf( "  %-24s %8llu allocations %10llu bytes\n", gTags[ i ].tag,
+                        static_cast<unsigned long long>( gTags[ i ].frame.allocations ),
+                        static_cast<unsigned long long>( gTags[ i ].frame.bytes ) );
+            }
+        }
+    }
+
+    return gFrame;
+}
+
+void ALLOC_setFrameBudget( const Uint64 maxAllocations, const Uint64 maxBytes )
+{
+    gMaxAllocations = maxAllocations;
+    gMaxBytes = maxBytes;
+}
+
+Uint64 ALLOC_getBudgetViolations()
+{
+    return gBudgetViolations;
+}
+
+AllocationStats ALLOC_getTotal()
+{
+    return gTotal;
+}
+
+void ALLOC_printReport()
+{
+    printf( "Allocations in %llu frames: %llu allocations, %llu frees, %llu bytes, %llu frames over budget\n",
+            static_cast<unsigned long long>( gNumFrames ), static_cast<unsigned long long>( gTotal.allocations ),
+            static_cast<unsigned long long>( gTotal.frees ), static_cast<unsigned long long>( gTotal.bytes ),
+            static_cast<unsigned long long>( gBudgetViolations ) );
+    for( int i = 0; i < gNumTags; ++i )
+    {
+        if( gTags[ i ].total.allocations > 0 || gTags[ i ].total.frees > 0 )
+        {
+            printf( "  %-24s %8llu allocations %8llu frees %10llu bytes\n", gTags[ i ].tag,
+                    static_cast<unsigned long long>( gTags[ i ].total.allocations ),
+                    static_cast<unsigned long long>( gTags[ i ].total.frees ),
+                    static_cast<unsigned long long>( gTags[ i ].total.bytes ) );
+        }
+    }
+}
+
+AllocationTag::AllocationTag( const char* tag )
+{
+    if( gTagDepth < AL_MAX_TAG_DEPTH )
+    {
+        gTagStack[ gTagDepth ] = tag;
+    }
+    ++gTagDepth;
+}
+
+AllocationTag::~AllocationTag()
+{
+    --gTagDepth;
+}
+
+#else // ALLOCATION_PROFILER
+
+bool ALLOC_isEnabled()
+{
+    return false;
+}
+
+void ALLOC_beginFrame()
+{
+}
+
+AllocationStats ALLOC_endFrame( const bool )
+{
+    return { 0, 0, 0 };
+}
+
+void ALLOC_setFrameBudget( const Uint64, const Uint64 )
+{
+}
+
+Uint64 ALLOC_getBudgetViolations()
+{
+    return 0;
+}
+
+AllocationStats ALLOC_getTotal()
+{
+    return { 0, 0, 0 };
+}
+
+void ALLOC_printReport()
+{
+    printf( "Allocations are not counted in this build ( define ALLOCATION_PROFILER )\n" );
+}
+
+AllocationTag::AllocationTag( const char* )
+{
+}
+
+AllocationTag::~AllocationTag()
+{
+}
+
+#endif // ALLOCATION_PROFILER
@@ -0,0 +1,55 @@
+#ifndef _ALLOCATIONPROFILER_HPP_INCLUDED
+#define _ALLOCATIONPROFILER_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Counts of heap allocations made with operator new
+struct AllocationStats{
+    Uint64 allocations;
+    Uint64 frees;
+    Uint64 bytes;
+};
+
+// Opt-in allocation profiler. Builds defining ALLOCATION_PROFILER replace the global operator new and delete with
+// counting versions; in all other builds the functions below do nothing and report no allocations. Allocations are counted
+// per frame on the thread that begins frames, and per tag of the innermost AllocationTag alive on that thread
+
+// Most tags reported separately, later tags are counted as "other"
+const int ALLOC_MAX_TAGS = 64;
+
+// Gets whether allocations are counted in this build
+bool ALLOC_isEnabled();
+
+// Starts counting a frame on the calling thread
+void ALLOC_beginFrame();
+
+// Ends the frame, checks it against the budget unless checkBudget is cleared and returns its counts. Frames over budget
+// are reported
+AllocationStats ALLOC_endFrame( const bool checkBudget = true );
+
+// Sets the most allocations and bytes a frame may allocate before it is reported as over budget
+void ALLOC_setFrameBudget( const Uint64 maxAllocations, const Uint64 maxBytes );
+
+// Gets number of frames that went over budget
+Uint64 ALLOC_getBudgetViolations();
+
+// Gets counts of all frames so far
+AllocationStats ALLOC_getTotal();
+
+// Prints counts of every tag with allocations
+void ALLOC_printReport();
+
+// Attributes allocations during its lifetime on the calling thread to tag ( a string literal, tags are told apart by address )
+class AllocationTag{
+
+public:
+
+    explicit AllocationTag( const char* tag );
+
+    ~AllocationTag();
+
+    AllocationTag( const AllocationTag& ) = delete;
+    AllocationTag& operator=( const AllocationTag& ) = delete;
+};
+
+#endif // _ALLOCATIONPROFILER_HPP_INCLUDED
@@ -0,0 +1,41 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <SDL.h>
+
+#include "AssetBundle.hpp"
+
+const BundledAsset* AB_findAsset( const std::string& path )
+{
+    const BundledAsset* end = AB_ASSETS + AB_NUM_ASSETS;
+    const BundledAsset* asset = std::lower_bound( AB_ASSETS, end, path, []( const BundledAsset& a, const std::string& p )
+    {
+        return strcmp( a.path, p.c_str() ) < 0;
+    } );
+
+    if( asset == end || path != asset->path )
+    {
+        return nullptr;
+    }
+
+    return asset;
+}
+
+SDL_RWops* AB_openAsset( const std::string& path )
+{
+    const BundledAsset* asset = AB_findAsset( path );
+    if( asset != nullptr )
+    {
+        return SDL_RWFromConstMem( asset->data, asset->size );
+    }
+
+    SDL_RWops* file = SDL_RWFromFile( path.c_str(), "rb" );
+    if( file == nullptr )
+    {
+        printf( "Asset %s is neither bundled nor a file! SDL_Error: %s\n", path.c_str(), SDL_GetError() );
+    }
+
+    return file;
+}
@@ -0,0 +1,27 @@
+#ifndef _ASSETBUNDLE_HPP_INCLUDED
+#define _ASSETBUNDLE_HPP_INCLUDED
+
+#include <string>
+
+#include <SDL.h>
+
+// Asset file compiled into the executable
+struct BundledAsset{
+    // Path the asset is loaded by, relative to the project directory
+    const char* path;
+    const Uint8* data;
+    int size;
+};
+
+// Bundled assets sorted by path, generated by AssetBundler into AssetBundleData.cpp
+extern const BundledAsset AB_ASSETS[];
+extern const int AB_NUM_ASSETS;
+
+// Gets bundled asset loaded by path, nullptr if it is not in the bundle
+const BundledAsset* AB_findAsset( const std::string& path );
+
+// Opens asset for reading. Bundled assets are read straight from the executable's memory without touching the file
+// system, anything else is opened as a file. Returns nullptr if asset can not be opened
+SDL_RWops* AB_openAsset( const std::string& path );
+
+#endif // _ASSETBUNDLE_HPP_INCLUDED
@@ -0,0 +1,4506 @@
+// Generated by AssetBundler, do not edit
+
+#include <SDL.h>
+
+#include "AssetBundle.hpp"
+
+// assets/dead.png
+static const Uint8 AB_DATA_0[] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,2,128,0,0,1,224,
+    8,3,0,0,0,2,15,44,214,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,
+    0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,3,0,80,76,84,69,1,1,
+    1,2,2,2,3,3,3,5,5,5,6,6,6,7,7,7,8,8,8,9,9,9,10,10,
+    10,11,11,11,12,12,12,13,13,13,14,14,14,15,15,15,16,16,16,17,17,17,18,18,
+    18,19,19,19,20,20,20,21,21,21,22,22,22,23,23,23,24,24,24,25,25,25,26,26,
+    26,27,27,27,28,28,28,29,29,29,30,30,30,31,31,31,32,32,32,33,33,33,34,34,
+    34,35,35,35,36,36,36,37,37,37,38,38,38,39,39,39,40,40,40,41,41,41,42,42,
+    42,43,43,43,44,44,44,45,45,45,46,46,46,47,47,47,48,48,48,49,49,49,50,50,
+    50,51,51,51,52,52,52,53,53,53,54,54,54,55,55,55,56,56,56,57,57,57,58,58,
+    58,60,60,60,61,61,61,62,62,62,63,63,63,64,64,64,65,65,65,66,66,66,67,67,
+    67,68,68,68,69,69,69,72,72,72,75,75,75,76,76,76,77,77,77,78,78,78,79,79,
+    79,80,80,80,81,81,81,82,82,82,83,83,83,84,84,84,85,85,85,86,86,86,87,87,
+    87,88,88,88,89,89,89,90,90,90,91,91,91,92,92,92,93,93,93,94,94,94,95,95,
+    95,97,97,97,98,98,98,99,99,99,100,100,100,101,101,101,102,102,102,103,103,103,104,104,
+    104,105,105,105,106,106,106,107,107,107,108,108,108,109,109,109,110,110,110,111,111,111,112,112,
+    112,113,113,113,115,115,115,116,116,116,117,117,117,118,118,118,119,119,119,120,120,120,121,121,
+    121,122,122,122,123,123,123,124,124,124,128,128,128,129,129,129,131,131,131,133,133,133,134,134,
+    134,135,135,135,137,137,137,138,138,138,139,139,139,140,140,140,141,141,141,143,143,143,144,144,
+    144,145,145,145,146,146,146,147,147,147,148,148,148,149,149,149,150,150,150,151,151,151,152,152,
+    152,153,153,153,154,154,154,155,155,155,156,156,156,157,157,157,158,158,158,159,159,159,160,160,
+    160,161,161,161,162,162,162,163,163,163,164,164,164,165,165,165,166,166,166,167,167,167,168,168,
+    168,169,169,169,170,170,170,171,171,171,172,172,172,173,173,173,175,175,175,177,177,177,183,183,
+    183,184,184,184,186,186,186,187,187,187,194,194,194,195,195,195,196,196,196,197,197,197,198,198,
+    198,199,199,199,200,200,200,201,201,201,202,202,202,203,203,203,204,204,204,205,205,205,206,206,
+    206,207,207,207,208,208,208,209,209,209,210,210,210,213,213,213,215,215,215,216,216,216,217,217,
+    217,218,218,218,219,219,219,220,220,220,222,222,222,223,223,223,224,224,224,225,225,225,226,226,
+    226,227,227,227,232,232,232,233,233,233,238,238,238,239,239,239,240,240,240,241,241,241,242,242,
+    242,243,243,243,244,244,244,245,245,245,246,246,246,247,247,247,248,248,248,249,249,249,250,250,
+    250,251,251,251,252,252,252,253,253,253,254,254,254,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,214,105,
+    189,103,0,0,0,9,112,72,89,115,0,0,14,195,0,0,14,195,1,199,111,168,100,0,
+    0,0,24,116,69,88,116,83,111,102,116,119,97,114,101,0,112,97,105,110,116,46,110,101,
+    116,32,52,46,48,46,53,101,133,50,101,0,0,28,54,73,68,65,84,120,94,237,221,249,
+    95,28,247,125,199,113,91,78,82,91,78,45,142,133,101,47,238,5,148,219,135,36,215,137,
+    45,41,77,155,54,150,152,217,5,22,57,113,108,201,135,100,75,17,86,236,36,141,211,166,
+    226,16,2,118,151,61,4,72,72,194,109,147,212,182,164,180,21,135,219,166,77,246,80,43,
+    69,97,211,212,245,119,216,255,167,187,48,192,2,187,236,204,236,241,249,14,243,126,254,162,
+    47,60,252,48,70,251,242,156,223,249,206,3,73,0,66,8,16,72,33,64,32,133,0,129,
+    20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,
+    0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,
+    32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,
+    33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,
+    16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,
+    82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,
+    2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,
+    129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,
+    133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,233,
+    50,192,196,181,132,60,2,189,211,101,128,19,214,9,121,4,122,167,203,0,125,149,62,121,
+    4,122,135,0,129,20,2,4,82,8,16,72,233,49,64,233,124,133,87,30,130,222,233,49,
+    192,59,130,201,47,15,65,239,244,24,224,76,135,16,147,135,160,119,122,12,48,228,24,150,
+    228,33,232,157,46,3,180,135,228,17,232,158,14,3,148,46,56,16,224,142,161,195,0,99,
+    98,219,117,121,8,186,167,195,0,167,236,98,84,30,130,238,233,48,192,128,121,128,201,195,
+    34,146,226,129,75,152,99,83,126,186,12,48,32,143,138,135,197,2,71,62,91,129,57,54,
+    229,135,0,211,216,237,158,118,203,167,246,92,146,191,132,242,65,128,41,108,214,221,113,244,
+    217,199,94,94,148,191,134,242,209,95,128,172,191,174,200,1,74,243,199,62,239,254,81,69,
+    37,54,128,4,244,23,96,180,179,97,74,30,22,7,155,239,122,242,216,7,47,85,28,199,
+    6,144,128,254,2,188,218,34,20,243,42,12,139,135,58,109,93,55,94,195,6,144,134,254,
+    2,12,90,7,139,121,21,38,214,221,177,215,157,234,175,226,53,108,0,41,232,47,192,128,
+    181,152,135,128,236,130,245,72,48,58,92,177,7,253,209,48,120,128,108,78,176,13,179,184,
+    88,125,2,253,209,48,120,128,81,207,151,187,35,44,176,87,196,4,67,34,198,14,48,113,
+    186,209,53,247,241,156,208,17,196,4,67,34,134,14,48,113,218,108,241,126,60,235,118,118,
+    99,118,3,21,35,7,200,188,22,243,233,223,206,245,126,201,61,91,130,217,13,160,136,238,
+    2,100,3,214,160,60,44,84,172,179,229,204,98,180,231,137,99,183,209,31,25,221,5,24,
+    19,27,47,203,195,2,73,163,54,33,154,120,221,34,206,161,63,58,186,11,240,106,171,24,
+    145,135,5,138,139,214,225,251,167,170,170,70,208,31,33,221,5,24,180,15,21,41,152,153,
+    118,241,95,83,253,157,196,21,64,74,58,12,176,72,135,128,210,197,250,161,225,106,244,71,
+    204,176,1,74,243,71,218,127,234,54,227,14,28,49,195,6,24,119,217,190,121,100,127,47,
+    46,0,18,51,108,128,51,237,71,222,50,187,113,2,76,205,168,1,178,11,142,31,117,90,
+    134,209,31,53,163,6,24,21,91,254,194,137,231,139,233,25,53,192,169,134,39,106,109,62,
+    108,0,201,25,52,64,214,111,250,74,243,25,156,1,211,51,104,128,145,175,63,106,239,41,
+    210,29,21,40,132,49,3,148,254,250,209,207,126,19,83,16,120,96,204,0,35,79,126,234,
+    169,127,70,127,60,48,100,128,210,15,62,253,200,187,232,143,11,70,12,144,45,60,189,235,
+    43,191,150,191,0,90,6,12,144,205,246,54,62,242,67,108,0,249,96,192,0,163,238,246,
+    3,37,88,225,13,52,49,94,128,137,211,77,157,63,180,21,126,32,9,69,97,184,0,153,
+    215,108,25,29,192,50,231,188,48,92,128,49,161,254,205,127,19,58,102,228,47,129,152,209,
+    2,148,198,157,98,36,80,35,196,229,175,129,152,193,2,76,140,60,223,62,206,124,149,253,
+    88,9,129,19,198,10,144,141,84,153,123,162,73,127,21,94,118,200,11,67,5,200,22,220,
+    181,39,162,18,2,228,136,161,2,140,246,238,247,164,151,193,66,128,252,48,82,128,137,83,
+    117,238,249,244,29,16,4,200,15,3,5,200,70,77,166,209,229,59,112,8,144,31,198,9,
+    144,205,137,54,249,41,116,4,200,15,195,4,200,230,142,61,222,37,207,129,70,128,252,48,
+    74,128,210,172,251,203,199,86,151,1,68,128,252,48,72,128,210,130,167,101,125,25,74,4,
+    200,15,131,4,24,243,28,240,172,63,3,130,0,249,161,191,0,173,39,85,191,214,87,138,
+    31,55,185,23,214,250,67,128,28,209,93,128,211,86,235,180,60,84,138,45,244,212,86,102,
+    46,67,137,0,249,161,187,0,23,79,170,94,35,58,218,251,148,107,36,243,33,116,4,200,
+    15,221,5,168,122,31,204,162,167,29,238,185,13,179,95,16,32,63,244,23,224,180,213,114,
+    70,77,129,177,238,198,186,149,27,32,107,16,32,63,244,23,224,226,105,139,205,191,49,168,
+    109,176,232,155,141,223,26,219,180,8,12,2,228,135,254,2,76,46,158,117,10,74,95,237,
+    38,205,123,28,117,99,155,115,69,128,252,208,97,128,201,168,203,252,154,178,157,176,52,239,
+    218,231,26,221,178,8,22,2,228,135,30,3,100,23,171,171,94,9,198,243,239,134,19,227,
+    71,45,217,86,225,69,128,252,208,99,128,201,197,147,213,85,117,158,140,43,203,89,177,120,
+    159,189,205,53,159,229,233,15,4,200,15,93,6,152,92,156,56,239,58,224,30,152,218,102,
+    71,204,162,99,162,211,214,151,117,59,137,0,249,161,207,0,83,125,205,121,44,213,166,87,
+    115,38,200,102,187,29,54,193,155,125,13,84,4,200,15,189,6,152,218,194,133,94,49,165,
+    18,12,100,109,48,225,115,125,169,115,56,146,99,39,141,0,249,161,219,0,83,22,39,95,
+    49,165,188,26,8,76,196,50,82,75,92,13,133,78,90,155,122,114,175,128,138,231,130,249,
+    161,231,0,211,9,250,83,13,214,152,236,194,133,208,154,147,86,171,205,106,61,19,205,125,
+    142,18,168,17,177,50,2,39,244,29,96,74,170,65,127,191,224,180,219,214,88,173,175,7,
+    2,87,178,31,253,173,136,185,62,23,204,157,39,148,147,238,3,76,99,209,107,193,192,186,
+    109,227,75,147,130,237,162,210,123,41,80,90,59,34,64,213,162,162,109,82,30,2,45,99,
+    6,200,6,204,222,37,121,12,164,140,25,96,114,210,241,118,190,253,52,148,133,65,3,252,
+    199,63,121,250,31,112,26,194,3,131,6,184,248,78,189,27,87,98,120,96,208,0,147,191,
+    22,247,6,113,49,154,3,70,13,144,5,59,4,188,46,157,3,70,13,48,25,115,215,227,
+    133,253,28,48,108,128,108,214,253,184,7,111,76,39,103,216,0,211,5,54,109,121,90,4,
+    202,205,184,1,38,153,175,229,232,198,231,133,161,252,12,28,96,50,226,118,246,126,132,2,
+    105,25,57,64,54,219,187,223,61,162,236,249,58,40,17,35,7,152,100,11,158,170,61,39,
+    226,216,8,18,50,116,128,73,22,59,177,167,186,39,223,227,117,80,66,198,14,48,153,92,
+    188,232,218,215,53,150,125,246,244,31,62,248,131,60,130,146,49,122,128,233,199,235,28,13,
+    194,104,230,67,37,171,126,254,204,207,229,17,148,140,225,3,76,178,200,136,208,210,32,6,
+    98,155,14,5,89,236,77,123,88,30,67,201,32,192,100,242,147,136,87,116,182,139,253,193,
+    204,205,32,187,237,110,177,93,145,191,128,146,65,128,105,44,226,23,204,85,102,113,56,188,
+    102,88,104,236,204,241,92,59,20,17,2,92,33,69,131,253,98,135,195,190,198,209,214,149,
+    251,193,98,40,26,4,184,134,197,175,135,130,107,66,51,217,206,75,160,216,16,32,144,66,
+    128,64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,
+    144,66,128,64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,
+    16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,
+    8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,
+    41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,
+    1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,144,66,128,
+    64,10,1,2,41,4,8,164,16,32,144,66,128,64,10,1,2,41,4,8,164,16,32,144,
+    66,128,64,10,1,2,41,4,8,164,16,160,42,137,233,240,178,201,15,62,150,191,3,133,
+    65,128,202,165,234,59,101,181,218,211,154,254,236,182,252,77,40,12,2,84,104,165,62,171,
+    245,100,40,109,226,253,255,149,191,15,133,65,128,74,72,119,102,228,250,166,23,229,111,65,
+    113,32,192,252,18,19,3,174,14,27,234,43,9,4,152,143,20,63,81,177,199,36,12,163,
+    190,146,64,128,121,36,198,133,170,61,47,251,99,76,254,26,138,11,1,110,75,138,159,181,
+    183,137,23,75,181,241,75,92,9,133,175,25,187,109,4,152,27,139,92,25,116,181,218,250,
+    238,72,242,55,138,141,249,236,86,91,75,207,172,145,11,68,128,57,177,219,93,13,102,187,
+    232,45,221,177,95,76,108,61,53,40,126,209,61,87,170,194,117,0,1,230,192,98,65,215,
+    23,132,129,201,72,9,55,79,151,172,98,148,221,118,183,118,199,229,111,24,16,2,204,138,
+    197,135,196,118,103,207,237,146,238,28,89,191,105,128,37,217,172,232,60,155,144,191,101,60,
+    8,48,27,182,224,49,215,137,254,104,105,15,206,226,162,37,148,250,131,121,109,246,113,195,
+    238,132,17,224,86,44,54,226,222,239,190,80,228,157,111,98,98,98,211,118,238,122,187,24,
+    77,255,185,216,215,38,24,118,39,140,0,183,96,115,221,86,179,103,174,216,91,191,137,74,
+    203,53,121,40,11,213,15,173,252,144,184,104,10,44,15,12,8,1,110,17,237,125,92,28,
+    42,254,222,215,87,241,242,166,243,233,160,35,184,50,96,253,21,199,141,122,20,136,0,55,
+    97,177,51,141,93,37,184,50,39,157,175,240,202,195,85,107,1,166,182,142,21,35,6,61,
+    10,68,128,27,73,183,221,45,214,177,226,247,151,188,35,152,252,242,112,213,122,128,139,39,
+    106,196,59,242,216,96,16,224,6,9,191,216,218,89,146,75,207,51,29,66,76,30,174,90,
+    15,48,25,115,117,4,75,80,189,14,32,192,13,166,237,173,221,165,185,51,22,114,12,111,
+    222,201,102,4,40,5,219,93,69,63,237,209,5,4,152,41,113,202,250,102,137,230,6,132,
+    236,233,107,126,27,100,4,152,140,246,116,116,109,222,66,26,2,2,204,52,109,181,93,149,
+    135,197,150,39,64,118,187,179,121,211,85,26,99,64,128,153,194,214,83,165,154,122,144,39,
+    192,228,39,131,150,65,35,238,131,17,96,134,196,41,91,88,30,22,221,214,0,165,11,142,
+    204,111,77,53,136,70,220,7,115,22,96,226,26,229,5,217,18,238,129,179,4,24,19,59,
+    102,228,97,90,212,229,52,226,62,152,179,0,39,172,19,242,136,64,226,85,75,201,246,192,
+    89,2,12,153,197,204,59,192,108,104,235,121,178,1,112,22,160,175,210,39,143,182,72,76,
+    47,63,145,27,10,191,23,47,209,231,228,223,93,89,178,61,112,150,0,253,166,254,13,7,
+    125,51,242,220,4,99,209,75,128,137,233,83,182,21,246,14,97,32,86,146,4,95,122,112,
+    79,201,246,192,89,3,220,120,107,36,230,170,189,96,188,211,16,190,2,76,188,92,145,53,
+    192,116,126,22,235,201,96,218,5,193,100,114,133,226,37,248,168,94,120,240,96,233,166,223,
+    231,15,80,26,172,53,224,172,44,190,2,156,168,168,184,36,15,51,49,159,61,149,223,244,
+    74,29,82,108,72,232,104,119,141,22,253,108,37,241,220,174,23,228,97,9,228,15,48,181,
+    9,220,107,188,251,113,124,5,184,117,202,210,178,168,216,242,134,156,95,26,139,7,5,139,
+    233,141,98,23,56,177,123,215,75,242,176,4,20,4,200,66,29,198,59,10,228,44,192,172,
+    135,128,137,55,237,155,62,24,22,57,101,170,41,242,156,21,233,39,159,217,61,38,143,75,
+    64,65,128,201,152,104,45,221,89,16,167,116,16,32,243,154,205,163,155,99,91,124,195,254,
+    188,175,168,219,192,59,7,30,172,40,221,57,136,162,0,217,64,237,198,19,99,3,224,63,
+    64,54,219,217,112,122,235,142,57,210,213,98,57,83,204,121,203,51,117,15,127,187,116,231,
+    32,91,3,100,253,213,155,3,76,78,56,182,204,217,218,233,184,15,80,154,63,246,185,174,
+    44,71,70,44,122,166,174,209,83,196,169,83,161,170,138,205,219,168,98,218,18,96,76,88,
+    126,38,110,131,168,224,244,25,108,19,200,125,128,241,238,167,142,205,126,34,127,177,193,226,
+    152,235,113,119,209,38,209,73,23,170,74,120,25,58,75,128,171,207,196,101,98,190,102,193,
+    96,167,33,220,7,24,50,231,156,169,201,102,221,13,61,11,69,186,38,29,19,205,85,101,
+    13,48,100,207,114,217,249,55,98,243,180,60,52,8,222,3,76,28,175,28,200,153,24,155,
+    237,62,80,172,9,204,83,246,125,117,101,14,112,203,30,56,245,27,13,88,51,166,104,25,
+    1,239,1,78,86,86,109,51,61,129,205,119,59,220,197,57,108,15,152,123,236,244,1,38,
+    131,54,131,205,10,228,61,192,241,202,19,219,157,154,178,185,163,237,129,162,124,98,1,243,
+    139,60,4,120,213,105,176,243,96,206,3,100,253,85,91,174,85,108,192,252,78,87,81,118,
+    194,156,4,24,19,109,132,19,210,8,112,30,96,92,172,201,115,76,20,233,249,66,81,158,
+    35,231,36,64,54,80,99,172,85,58,56,15,240,189,142,124,243,212,217,109,119,91,79,17,
+    246,90,156,4,152,28,175,49,214,205,16,190,3,76,156,178,13,231,251,56,216,191,184,90,
+    207,21,190,138,46,47,1,134,45,198,154,147,197,119,128,87,173,182,43,242,48,55,230,117,
+    180,185,62,42,176,64,214,95,199,71,128,17,177,227,242,146,60,54,2,190,3,12,42,122,
+    76,114,113,252,136,185,208,165,85,162,157,13,199,185,8,144,249,156,231,238,201,99,35,224,
+    58,64,54,180,225,193,197,156,216,252,145,189,193,194,54,129,87,91,132,191,45,107,128,108,
+    48,123,128,201,27,135,15,222,146,135,70,192,117,128,81,161,93,217,147,138,82,176,93,44,
+    236,84,56,104,29,12,150,53,192,152,216,146,125,242,215,189,179,245,147,242,208,8,184,14,
+    112,194,234,82,120,107,62,218,211,230,46,232,46,126,192,26,8,151,53,192,203,141,57,102,
+    63,47,141,89,6,139,116,127,91,15,184,14,48,80,51,160,112,179,198,102,133,150,130,38,
+    50,149,61,192,96,206,149,56,166,91,58,13,52,35,134,239,0,107,21,95,148,101,99,141,
+    238,249,2,10,44,127,128,57,103,29,68,58,27,242,159,250,239,24,59,37,192,100,164,247,
+    201,2,174,71,47,141,242,19,32,27,48,27,104,66,2,207,1,178,193,90,229,115,147,216,
+    156,171,46,239,69,235,156,210,71,254,188,4,152,156,52,210,196,124,158,3,140,9,14,21,
+    231,131,108,168,206,181,160,181,192,155,135,14,221,226,38,192,136,203,121,93,30,238,124,60,
+    7,120,221,41,68,228,161,18,81,207,1,143,214,45,199,116,235,185,187,220,4,200,134,54,
+    253,179,59,25,207,1,134,108,242,139,92,148,97,115,110,205,59,225,176,195,43,113,19,224,
+    150,127,118,39,227,57,192,237,62,163,108,216,69,155,214,131,167,244,71,142,0,41,236,164,
+    0,147,81,161,109,92,219,38,144,175,0,195,118,227,172,20,200,87,128,222,138,243,25,127,
+    243,170,3,100,254,214,163,227,154,86,185,47,123,128,219,62,125,52,211,177,97,233,202,29,
+    141,175,0,253,38,33,99,86,139,234,0,147,209,158,102,103,182,167,216,243,42,123,128,145,
+    206,214,220,235,128,196,12,244,242,66,190,2,140,9,153,203,38,171,15,144,69,188,207,219,
+    71,53,236,190,202,30,224,149,6,49,247,25,190,116,190,98,68,30,238,120,124,5,40,13,
+    103,206,191,82,31,96,42,193,97,171,150,221,87,217,3,12,212,109,55,243,222,111,234,51,
+    202,219,51,249,10,112,227,199,164,37,192,100,84,108,207,92,123,94,161,242,7,104,222,110,
+    39,251,203,175,62,123,67,30,238,116,59,46,64,54,84,175,225,98,32,103,1,222,127,167,
+    233,178,60,220,233,120,11,208,225,95,127,32,66,83,128,169,83,200,163,115,170,143,2,57,
+    11,112,201,103,29,51,200,131,33,156,5,56,213,244,227,245,131,31,109,1,198,93,22,151,
+    234,163,64,206,2,76,78,214,159,53,200,131,33,156,5,248,139,125,158,255,144,135,90,3,
+    100,179,157,78,181,135,240,44,253,214,44,158,2,76,79,142,144,135,59,28,103,1,254,202,
+    179,239,23,242,80,107,128,73,201,111,183,249,213,29,6,198,132,246,235,92,5,120,239,45,
+    167,65,150,105,227,44,192,196,95,53,79,201,67,205,1,38,23,191,215,170,114,181,249,176,
+    69,140,149,58,64,135,55,243,168,46,79,128,146,215,81,202,255,24,142,112,22,224,146,63,
+    227,47,62,168,245,72,60,42,214,111,89,213,124,91,227,166,1,198,134,75,250,153,79,183,
+    188,149,121,84,151,39,192,84,175,6,57,11,225,44,192,13,27,138,169,198,62,109,71,226,
+    204,219,164,110,165,219,113,211,120,50,46,238,213,112,1,81,177,155,135,51,143,234,150,198,
+    242,4,56,221,218,119,87,30,238,108,188,5,56,221,186,190,46,128,246,35,241,136,208,164,
+    234,141,11,233,0,3,53,37,157,1,112,175,175,57,227,210,222,253,179,121,246,247,55,141,
+    242,120,58,111,1,126,120,248,185,181,191,248,187,125,173,26,31,15,99,131,22,165,15,116,
+    46,75,7,232,171,44,233,178,84,75,94,123,198,17,237,141,67,235,191,102,86,119,251,26,
+    141,113,41,154,183,0,239,245,217,215,22,104,92,26,83,182,50,71,22,83,13,170,246,193,
+    233,0,253,121,150,194,44,84,48,51,192,171,173,231,182,223,195,46,121,53,158,129,233,13,
+    111,1,46,141,213,173,31,28,109,248,204,84,137,138,109,106,22,139,81,28,32,139,205,92,
+    10,135,195,83,115,255,39,127,67,185,13,191,76,200,238,203,115,142,161,245,18,128,222,240,
+    22,96,50,80,148,0,89,64,213,156,78,5,1,178,200,84,48,24,28,20,219,29,118,187,
+    189,229,216,175,228,111,43,183,41,192,124,219,118,163,172,86,190,67,3,76,198,196,90,21,
+    187,239,84,128,82,127,85,230,227,0,235,88,244,106,56,20,10,13,137,246,218,218,218,26,
+    171,56,152,234,112,114,182,224,45,96,190,255,186,107,206,78,67,60,28,204,97,128,235,167,
+    15,5,4,152,179,167,172,82,1,198,133,77,171,81,47,45,222,156,94,41,175,217,154,98,
+    107,237,236,31,31,31,191,164,249,245,116,42,3,140,170,122,40,90,191,184,11,240,114,227,
+    250,147,109,5,4,152,244,111,125,21,96,110,169,0,223,235,88,251,185,44,26,246,251,253,
+    99,125,7,155,237,182,148,102,97,48,16,8,4,175,105,122,216,100,157,202,0,217,128,138,
+    117,73,116,140,187,0,35,66,243,218,154,128,229,12,48,36,63,137,198,98,87,135,93,117,
+    213,41,181,207,158,243,166,203,187,90,156,119,114,134,236,25,51,205,242,7,168,106,97,28,
+    29,227,46,192,79,134,214,95,34,89,214,0,109,169,31,155,170,111,72,108,181,183,139,231,
+    125,62,223,248,205,223,22,243,110,216,149,166,119,127,47,15,17,224,58,238,2,76,6,45,
+    107,119,65,203,29,96,98,84,104,177,54,10,67,215,11,220,219,102,245,139,125,158,255,148,
+    135,8,112,29,127,1,78,52,172,205,197,44,111,128,99,151,95,171,173,239,28,152,138,148,
+    160,190,148,127,239,121,98,125,166,25,2,92,197,95,128,183,14,30,190,41,15,203,25,224,
+    88,197,161,218,154,218,55,126,83,154,250,82,254,231,199,182,181,219,191,74,150,31,66,128,
+    68,238,157,115,174,78,36,40,99,128,190,99,15,126,182,246,213,169,18,190,179,127,201,183,
+    126,133,51,234,114,230,93,125,29,1,18,89,242,214,175,206,200,42,95,128,213,63,216,183,
+    235,80,41,243,75,201,184,196,62,229,200,63,99,54,80,155,251,69,201,59,8,127,1,38,
+    175,58,87,167,194,149,47,192,202,3,77,15,255,141,252,69,169,100,4,24,82,176,8,239,
+    132,213,101,132,91,33,28,6,120,243,208,225,95,174,140,202,22,224,197,63,218,189,175,228,
+    111,169,220,16,96,222,67,64,141,79,216,235,14,135,1,222,237,91,125,42,187,108,1,190,
+    248,192,195,189,214,252,77,40,240,241,237,143,229,209,22,42,3,100,23,28,151,228,225,78,
+    198,97,128,210,216,234,76,164,2,2,100,106,238,5,39,158,125,224,107,163,233,11,209,5,
+    75,188,251,167,239,203,195,45,130,117,107,83,176,148,4,88,226,135,164,120,193,97,128,201,
+    160,77,62,11,41,32,192,184,160,226,36,114,226,145,7,190,179,124,39,164,96,211,182,134,
+    156,235,139,79,214,191,189,250,184,50,2,92,195,99,128,87,154,223,185,191,60,208,30,32,
+    11,118,168,120,50,211,247,200,103,134,138,179,48,120,200,122,50,231,169,244,135,95,125,230,
+    195,149,17,27,68,128,171,120,12,240,131,231,190,246,79,203,3,237,1,70,197,142,160,242,
+    75,202,190,71,30,253,137,152,255,202,92,126,210,240,54,25,47,158,91,125,237,73,84,104,
+    80,240,216,57,2,164,242,187,183,228,79,74,115,128,108,88,241,107,14,211,46,237,121,244,
+    37,5,87,230,242,146,62,122,62,115,129,205,205,70,171,229,195,82,101,111,131,67,128,84,
+    150,198,170,199,151,7,90,3,100,115,130,99,68,197,61,181,197,227,85,47,100,204,131,213,
+    236,142,88,187,221,139,179,215,78,204,131,150,129,79,86,70,219,65,128,100,252,213,43,55,
+    1,180,6,24,245,124,169,91,205,43,110,88,191,233,133,245,107,36,218,189,215,113,116,126,
+    155,187,23,107,1,6,44,74,126,24,2,36,19,170,91,153,157,172,49,64,230,111,117,171,
+    122,125,117,76,176,245,212,105,220,219,103,72,156,178,93,220,238,238,25,2,204,130,203,0,
+    99,98,251,242,197,12,109,1,166,215,103,83,247,186,144,235,109,127,254,141,166,130,87,163,
+    146,252,54,219,182,255,18,127,149,188,155,71,128,235,184,12,144,13,173,148,167,41,64,233,
+    35,79,147,202,183,167,135,237,223,86,185,152,76,22,137,209,35,173,103,183,157,206,16,52,
+    203,143,138,34,192,117,92,6,152,12,218,52,7,40,205,117,239,247,168,218,1,167,118,249,
+    182,239,90,6,21,156,22,108,235,114,173,181,123,251,136,99,98,199,123,233,63,217,144,69,
+    193,239,149,218,161,35,64,42,5,4,24,117,217,186,231,84,158,208,134,108,47,42,73,98,
+    59,44,242,90,205,137,60,115,169,217,240,202,221,221,152,160,100,221,151,171,54,155,170,5,
+    150,116,138,211,0,237,203,207,133,104,8,144,5,218,143,170,220,254,165,3,244,20,120,14,
+    194,110,119,215,215,229,173,74,222,169,94,107,221,230,37,53,107,194,182,83,165,157,159,200,
+    7,62,3,188,220,188,188,50,160,250,0,165,57,87,155,202,229,121,83,66,230,125,245,235,
+    11,179,106,17,243,124,177,115,36,111,47,114,128,138,94,67,43,93,52,196,100,24,78,3,
+    188,121,104,249,185,16,213,1,178,89,215,23,122,212,159,77,132,42,107,11,186,15,194,162,
+    125,205,174,219,249,163,90,11,80,193,157,224,213,3,198,157,142,207,0,239,190,213,154,190,
+    160,161,54,64,105,161,183,221,165,122,7,156,92,242,86,86,170,122,53,246,38,137,81,193,
+    105,247,42,248,23,168,8,80,26,50,25,227,141,153,124,6,40,121,151,247,63,42,3,148,
+    22,220,251,122,213,247,151,188,215,87,85,89,192,84,24,54,82,109,17,124,74,142,215,86,
+    2,92,242,41,152,120,19,23,107,177,58,22,161,176,35,125,79,65,93,128,236,163,46,179,
+    91,237,9,112,218,205,103,106,234,115,206,226,203,139,45,184,204,175,40,91,189,99,37,192,
+    223,158,107,201,187,240,107,162,207,89,132,201,17,122,192,105,128,51,29,233,187,250,170,2,
+    100,179,189,251,187,182,187,21,155,211,116,237,238,191,212,250,252,15,139,141,116,237,247,40,
+    108,37,236,72,191,198,238,214,179,135,86,31,124,206,133,249,108,118,191,150,95,69,127,56,
+    13,240,142,152,190,111,170,34,64,22,243,118,182,245,46,104,250,208,194,149,187,251,53,126,
+    218,108,174,219,82,231,89,80,184,217,157,105,79,111,214,66,150,190,149,249,182,57,177,57,
+    87,203,247,126,39,127,177,195,113,26,32,235,175,240,170,10,48,214,221,212,226,86,112,34,
+    154,77,112,207,110,21,15,48,173,91,74,220,24,235,122,92,28,82,188,122,86,76,180,134,
+    83,191,90,77,190,87,128,68,187,246,246,168,153,205,163,103,156,6,152,244,86,156,151,84,
+    4,200,2,173,71,189,90,23,117,57,255,240,31,171,57,214,92,37,253,250,237,231,154,154,
+    213,220,246,75,181,55,158,140,9,235,203,176,103,197,162,167,27,58,53,254,191,164,63,188,
+    6,232,55,9,119,148,7,200,230,142,182,171,155,0,147,233,245,135,246,169,63,4,100,177,
+    128,80,247,204,59,97,85,213,7,106,2,201,107,206,245,21,56,179,144,226,33,151,189,78,
+    221,139,158,244,140,215,0,99,66,199,140,226,0,165,133,158,250,2,150,17,248,238,46,143,
+    234,207,155,205,245,180,119,136,63,187,159,103,103,186,73,58,192,109,87,31,151,226,131,98,
+    135,83,24,51,194,77,184,21,188,6,40,13,59,66,74,3,76,157,9,28,232,209,112,253,
+    111,213,139,187,94,148,71,74,177,232,136,176,215,53,30,83,123,234,18,168,29,184,255,122,
+    174,121,15,137,233,112,248,162,88,83,35,4,138,179,36,171,62,240,26,224,242,10,122,138,
+    2,100,49,223,209,122,207,124,1,159,217,137,135,78,200,35,69,150,238,223,244,137,13,77,
+    93,26,14,211,38,29,194,5,139,101,243,85,192,165,123,183,174,134,195,225,83,54,155,195,
+    209,145,58,167,49,198,245,23,25,191,1,58,46,72,74,2,100,179,61,173,109,74,110,196,
+    230,166,248,80,115,25,251,213,59,7,91,219,68,77,167,60,49,193,249,130,229,245,245,253,
+    43,139,205,132,66,33,111,223,225,86,135,195,97,181,158,12,134,103,226,6,218,250,165,113,
+    27,224,245,54,49,170,224,85,93,210,92,215,23,221,254,194,246,89,139,127,175,248,144,75,
+    186,251,75,175,208,252,236,247,39,181,157,113,179,159,62,214,212,52,157,76,76,141,175,24,
+    16,156,233,117,248,155,14,246,141,6,131,193,105,227,28,249,173,227,54,192,168,104,247,245,
+    229,125,109,184,52,239,105,213,48,253,64,155,165,123,55,47,157,59,212,216,234,250,153,198,
+    213,203,19,227,159,127,112,151,243,39,227,175,86,87,155,86,216,132,244,123,111,46,223,186,
+    107,168,221,110,38,110,3,100,3,230,119,14,30,190,33,127,149,67,98,212,189,191,167,76,
+    151,204,88,116,162,239,176,211,121,248,236,164,230,37,204,103,76,187,30,248,84,133,201,84,
+    93,125,194,183,66,251,123,111,118,10,110,3,76,6,234,60,245,27,94,50,190,149,52,82,
+    81,93,208,233,135,98,82,108,114,64,104,109,56,120,46,124,227,158,182,173,95,218,162,239,
+    197,23,135,210,221,77,26,113,103,155,29,191,1,78,53,60,81,187,237,61,43,22,11,28,
+    169,254,110,41,222,168,176,209,210,253,27,215,134,69,187,185,161,243,226,77,227,238,42,75,
+    133,223,0,163,66,109,197,118,103,167,236,118,79,219,222,110,237,151,159,149,97,145,43,190,
+    190,67,78,71,155,88,178,247,55,24,27,191,1,178,193,138,61,219,4,152,240,10,29,174,
+    64,73,183,127,169,147,142,201,33,161,201,108,63,120,206,91,232,155,226,32,7,126,3,76,
+    6,182,9,144,69,222,172,211,116,41,88,41,22,191,126,201,247,253,131,245,150,102,161,63,
+    124,235,174,246,227,62,216,158,62,3,148,230,123,29,230,51,145,66,159,37,207,97,41,241,
+    254,228,128,216,238,112,180,30,238,27,155,46,213,79,129,101,122,12,144,197,135,92,79,185,
+    71,75,116,38,201,162,193,183,159,182,215,90,196,161,224,116,33,167,188,160,136,14,3,100,
+    11,158,218,90,143,150,135,63,242,74,223,149,29,22,173,214,167,223,246,170,155,103,5,90,
+    233,47,192,196,168,251,128,171,4,119,236,151,126,255,225,21,239,91,135,91,235,219,133,225,
+    247,23,177,229,43,19,189,5,200,162,111,84,215,21,239,226,115,194,127,252,130,127,197,216,
+    91,207,53,89,27,158,235,243,206,224,132,183,140,116,22,96,194,39,216,76,175,23,111,239,
+    120,173,114,215,163,149,178,234,103,222,25,155,192,165,230,50,211,87,128,137,211,214,22,177,
+    152,103,31,139,222,151,47,120,87,140,249,110,253,14,59,222,178,227,56,192,145,221,143,109,
+    12,240,227,15,191,101,174,251,158,225,111,223,239,44,28,7,120,124,215,99,27,230,14,255,
+    119,143,253,211,149,167,113,27,127,103,225,56,192,239,236,58,156,81,91,34,252,229,93,15,
+    213,191,139,254,118,24,174,3,252,142,60,74,187,82,177,107,215,147,239,231,124,21,37,232,
+    20,199,1,190,252,208,203,242,40,237,138,249,177,111,252,151,60,134,157,131,227,0,3,214,
+    204,181,228,23,47,95,193,238,119,7,226,56,192,197,191,67,113,59,31,199,1,130,17,32,
+    64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,
+    72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,
+    8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,
+    4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,
+    20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,
+    0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,
+    32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,
+    33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,
+    16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,
+    82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,
+    2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,
+    129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,
+    133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,
+    64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,8,16,
+    72,33,64,32,133,0,129,20,2,4,82,8,16,72,33,64,32,133,0,129,20,2,4,82,
+    8,16,72,33,64,32,133,0,129,80,50,249,255,95,164,242,34,202,163,227,187,0,0,0,
+    0,73,69,78,68,174,66,96,130,
+};
+
+// assets/pause_screen.png
+static const Uint8 AB_DATA_1[] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,2,128,0,0,1,224,
+    8,3,0,0,0,2,15,44,214,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,
+    0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,3,0,80,76,84,69,1,1,
+    1,2,2,2,3,3,3,4,4,4,6,6,6,7,7,7,8,8,8,9,9,9,10,10,
+    10,11,11,11,12,12,12,13,13,13,14,14,14,15,15,15,16,16,16,17,17,17,18,18,
+    18,19,19,19,20,20,20,21,21,21,22,22,22,23,23,23,24,24,24,25,25,25,26,26,
+    26,27,27,27,28,28,28,29,29,29,30,30,30,31,31,31,32,32,32,33,33,33,34,34,
+    34,35,35,35,36,36,36,37,37,37,38,38,38,39,39,39,40,40,40,41,41,41,42,42,
+    42,43,43,43,44,44,44,45,45,45,46,46,46,47,47,47,48,48,48,49,49,49,50,50,
+    50,51,51,51,52,52,52,53,53,53,54,54,54,55,55,55,56,56,56,57,57,57,58,58,
+    58,59,59,59,60,60,60,61,61,61,62,62,62,63,63,63,64,64,64,65,65,65,66,66,
+    66,67,67,67,68,68,68,69,69,69,71,71,71,72,72,72,76,76,76,81,81,81,82,82,
+    82,83,83,83,84,84,84,85,85,85,86,86,86,87,87,87,88,88,88,89,89,89,90,90,
+    90,91,91,91,92,92,92,93,93,93,94,94,94,95,95,95,96,96,96,97,97,97,98,98,
+    98,99,99,99,100,100,100,101,101,101,102,102,102,103,103,103,104,104,104,105,105,105,106,106,
+    106,107,107,107,108,108,108,109,109,109,110,110,110,111,111,111,112,112,112,113,113,113,114,114,
+    114,115,115,115,116,116,116,117,117,117,118,118,118,119,119,119,120,120,120,121,121,121,122,122,
+    122,123,123,123,124,124,124,125,125,125,126,126,126,127,127,127,128,128,128,129,129,129,130,130,
+    130,131,131,131,133,133,133,134,134,134,135,135,135,136,136,136,137,137,137,138,138,138,139,139,
+    139,140,140,140,141,141,141,142,142,142,143,143,143,144,144,144,145,145,145,146,146,146,147,147,
+    147,148,148,148,149,149,149,150,150,150,151,151,151,152,152,152,153,153,153,154,154,154,155,155,
+    155,156,156,156,157,157,157,158,158,158,159,159,159,160,160,160,161,161,161,162,162,162,163,163,
+    163,164,164,164,165,165,165,166,166,166,167,167,167,168,168,168,169,169,169,170,170,170,171,171,
+    171,172,172,172,173,173,173,174,174,174,178,178,178,179,179,179,182,182,182,183,183,183,184,184,
+    184,185,185,185,186,186,186,189,189,189,190,190,190,191,191,191,192,192,192,193,193,193,194,194,
+    194,195,195,195,196,196,196,197,197,197,198,198,198,199,199,199,200,200,200,201,201,201,202,202,
+    202,204,204,204,205,205,205,206,206,206,207,207,207,208,208,208,209,209,209,210,210,210,213,213,
+    213,215,215,215,216,216,216,217,217,217,218,218,218,219,219,219,220,220,220,221,221,221,222,222,
+    222,223,223,223,224,224,224,225,225,225,226,226,226,227,227,227,231,231,231,232,232,232,233,233,
+    233,235,235,235,236,236,236,237,237,237,238,238,238,239,239,239,240,240,240,241,241,241,242,242,
+    242,243,243,243,244,244,244,245,245,245,246,246,246,247,247,247,248,248,248,249,249,249,250,250,
+    250,251,251,251,252,252,252,253,253,253,254,254,254,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,144,
+    143,242,0,0,0,9,112,72,89,115,0,0,14,195,0,0,14,195,1,199,111,168,100,0,
+    0,0,24,116,69,88,116,83,111,102,116,119,97,114,101,0,112,97,105,110,116,46,110,101,
+    116,32,52,46,48,46,53,101,133,50,101,0,0,54,13,73,68,65,84,120,94,237,157,137,
+    123,27,233,121,216,83,59,109,214,78,186,75,18,247,197,11,4,72,57,107,59,235,61,179,
+    151,14,167,233,106,57,3,94,82,18,59,94,173,14,74,187,146,9,234,88,199,110,29,215,
+    73,28,241,20,137,27,60,69,138,146,219,212,118,156,38,182,142,117,76,74,110,236,216,53,
+    7,80,210,52,210,74,128,147,216,254,6,248,63,138,1,134,36,142,57,190,1,6,243,97,
+    200,247,247,60,122,248,129,18,15,1,63,124,231,251,190,223,175,100,1,128,32,32,32,64,
+    20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,
+    64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,
+    1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,
+    4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,
+    32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,
+    40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,
+    128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,
+    2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,
+    8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,
+    64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,
+    81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,
+    1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,
+    4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,
+    16,32,10,8,8,16,5,4,4,136,162,153,128,40,17,13,71,120,194,241,36,203,127,26,
+    216,227,104,34,32,74,94,159,159,166,77,45,219,88,232,233,149,52,255,151,192,158,70,11,
+    1,211,179,190,110,151,171,135,30,11,241,92,166,186,29,142,145,4,226,255,30,216,195,104,
+    32,96,250,140,209,74,77,204,221,72,110,11,199,38,214,134,237,110,58,196,128,130,123,30,
+    13,4,92,54,25,134,43,84,75,5,169,182,78,106,114,25,6,226,61,142,6,2,70,77,
+    39,82,124,179,8,196,204,244,118,88,44,167,150,160,27,220,211,104,33,160,57,202,183,74,
+    65,204,213,19,22,75,43,29,130,94,112,15,67,80,192,28,169,229,113,218,237,240,195,166,
+    204,222,133,172,128,92,55,56,226,240,210,119,193,192,189,10,105,1,115,189,96,232,176,229,
+    205,248,206,18,25,216,83,144,23,48,203,222,237,235,233,166,3,48,19,220,147,104,33,160,
+    241,184,180,92,40,25,165,108,230,0,244,129,123,17,13,4,92,50,154,150,249,166,24,104,
+    115,216,249,6,172,134,247,34,26,8,152,58,97,146,30,131,57,54,251,221,182,115,176,37,
+    184,247,208,64,192,108,204,60,33,107,22,98,206,217,218,41,232,4,247,28,90,8,184,232,
+    162,18,124,83,130,84,128,238,176,251,33,66,97,143,161,133,128,155,148,103,141,111,74,129,
+    152,179,118,15,53,11,157,224,158,66,11,1,209,164,35,206,55,165,73,5,41,187,113,22,
+    250,192,189,132,22,2,102,99,246,24,223,146,1,49,39,44,111,132,161,15,220,67,52,150,
+    128,217,44,51,224,105,141,192,193,220,222,65,19,1,227,118,249,101,48,15,74,156,247,82,
+    235,48,10,239,25,52,17,112,165,211,199,240,77,121,146,253,174,190,13,48,112,175,160,137,
+    128,155,116,231,10,223,148,7,109,244,125,106,8,223,87,64,223,104,34,32,154,192,159,4,
+    114,6,250,218,206,194,66,100,143,160,137,128,217,152,99,82,193,160,138,2,86,91,16,6,
+    225,189,129,54,2,94,243,82,74,6,213,212,185,14,69,255,30,208,47,218,8,200,80,206,
+    69,190,137,197,38,213,118,149,111,2,187,27,109,4,68,227,166,8,223,196,2,141,155,79,
+    192,44,112,79,160,141,128,217,136,105,76,209,164,110,217,12,1,170,123,3,141,4,156,179,
+    83,73,190,137,69,234,140,131,198,136,160,1,116,143,70,2,110,210,222,235,124,19,143,77,
+    95,119,28,78,228,246,0,26,9,136,38,93,120,1,49,91,160,232,62,250,62,223,198,132,
+    77,46,10,84,96,0,26,27,141,4,204,198,156,10,182,162,57,238,211,45,199,148,173,67,
+    238,15,184,22,248,38,160,27,180,18,48,238,154,86,54,162,162,43,79,53,41,242,137,141,
+    237,131,105,163,254,208,74,192,181,30,101,171,144,220,58,228,173,167,46,43,112,22,173,211,
+    221,49,152,53,234,14,173,4,76,208,166,73,133,122,132,141,148,130,89,32,211,231,29,132,
+    211,19,253,161,149,128,104,210,66,43,244,35,65,239,195,239,210,80,168,243,133,63,138,65,
+    74,147,238,208,74,192,44,67,117,43,219,136,201,77,234,186,241,39,117,9,218,248,235,45,
+    182,126,152,4,234,13,109,4,76,45,38,127,49,229,84,182,17,147,115,150,118,46,241,77,
+    57,80,196,243,92,211,208,27,222,8,116,129,58,67,27,1,23,92,3,247,227,152,169,113,
+    59,160,113,139,124,73,133,2,9,202,187,223,16,10,119,249,160,11,212,25,218,8,152,160,
+    122,174,199,157,216,137,33,91,68,173,152,39,200,104,218,250,98,147,97,145,161,91,223,133,
+    24,6,125,161,141,128,236,21,87,112,181,11,167,62,66,9,75,109,189,120,11,151,36,101,
+    233,111,57,158,66,1,171,117,33,195,127,174,62,164,151,161,174,186,170,104,180,8,89,113,
+    143,254,128,110,147,43,146,85,14,67,185,87,249,166,52,55,122,168,63,50,70,114,115,205,
+    119,219,46,61,226,63,87,31,150,205,22,165,255,11,64,10,141,4,188,125,232,224,173,9,
+    219,132,194,157,64,220,92,146,76,176,245,191,246,90,185,41,230,205,253,175,124,171,202,221,
+    232,244,53,140,174,13,141,63,249,36,238,188,20,192,65,35,1,31,250,59,151,87,220,152,
+    3,234,14,81,59,214,171,253,192,223,245,110,119,126,155,49,117,222,226,83,24,195,176,197,
+    130,29,227,228,47,65,53,131,128,170,162,145,128,153,160,107,234,39,84,187,210,209,11,79,
+    192,204,223,28,218,79,57,167,243,235,149,159,80,61,177,234,182,98,66,205,33,190,37,14,
+    27,247,62,103,4,1,213,68,35,1,179,215,186,169,205,113,171,210,215,14,79,192,199,95,
+    220,119,216,230,40,100,30,163,72,161,43,84,12,123,185,41,200,55,197,73,210,251,254,0,
+    123,107,8,192,65,43,1,25,202,26,143,90,3,10,151,168,120,2,190,255,218,254,211,142,
+    51,124,44,32,67,187,112,119,175,75,184,79,25,195,124,83,20,118,220,64,125,13,4,84,
+    21,173,4,68,151,91,2,113,231,136,194,37,42,158,128,17,211,177,195,61,91,231,124,104,
+    194,170,120,191,145,227,122,143,252,46,209,125,95,203,88,24,4,84,21,173,4,204,70,205,
+    254,191,220,127,240,22,255,8,19,60,1,67,45,71,173,244,118,176,215,213,246,170,198,96,
+    156,128,197,27,61,116,34,10,2,170,138,102,2,190,255,250,129,111,158,239,194,47,17,147,
+    7,91,192,162,164,59,166,215,29,174,162,11,140,99,28,85,207,185,174,176,32,160,186,104,
+    38,224,7,23,221,115,33,215,148,178,77,58,60,1,103,91,104,110,23,154,231,151,179,109,
+    125,63,82,124,28,194,78,97,36,173,196,115,255,6,4,84,23,205,4,204,196,59,252,113,
+    175,194,209,17,75,192,244,168,241,57,251,60,255,32,199,230,192,39,191,244,1,223,198,38,
+    65,123,229,235,88,131,128,234,163,153,128,217,219,7,15,125,157,86,86,161,3,79,192,155,
+    175,118,187,138,75,201,160,191,56,248,250,29,190,141,205,146,19,227,189,1,2,170,143,118,
+    2,254,179,191,107,105,92,230,218,184,114,112,4,204,196,219,126,199,81,178,240,125,228,183,
+    41,141,252,202,121,53,46,59,113,204,13,211,115,32,160,202,104,39,96,38,212,58,29,81,
+    246,234,165,79,218,228,255,253,7,126,251,115,165,49,11,153,128,89,89,33,144,28,56,94,
+    49,220,48,13,2,170,139,118,2,114,137,113,127,102,149,239,103,138,184,106,181,201,31,222,
+    221,62,248,49,91,217,240,185,232,162,126,168,108,25,130,198,48,78,105,22,185,97,26,4,
+    84,23,13,5,76,210,230,99,173,138,234,254,69,173,195,178,181,14,50,11,158,223,181,150,
+    149,191,76,244,63,253,133,135,124,27,15,166,183,77,254,252,36,106,206,189,125,64,64,117,
+    209,80,64,52,214,242,223,40,247,53,254,17,6,104,28,35,26,235,193,168,231,15,203,167,
+    124,232,27,159,254,244,55,21,109,248,172,186,49,222,25,121,247,64,64,117,209,80,192,108,
+    184,37,136,163,212,54,9,26,35,124,230,206,193,67,239,217,203,215,28,15,190,244,236,128,
+    162,60,248,24,198,69,18,40,31,76,1,2,170,139,150,2,6,91,198,34,88,59,203,60,
+    171,93,244,38,223,20,37,19,119,251,175,84,8,152,249,81,159,89,54,180,160,24,156,229,
+    54,67,181,94,5,1,213,70,75,1,99,22,250,207,148,8,24,115,202,151,54,127,116,193,
+    29,153,176,207,241,143,182,65,19,230,243,10,114,55,176,6,251,107,110,234,167,106,11,200,
+    38,35,161,48,199,194,94,205,52,209,82,64,198,231,61,110,159,197,94,158,34,156,211,177,
+    247,95,63,112,131,234,170,204,28,185,249,202,43,55,249,38,6,88,131,125,204,206,45,225,
+    85,20,48,189,58,119,133,50,54,53,231,104,106,58,181,71,13,212,82,64,118,218,249,86,
+    155,31,123,121,154,160,186,229,79,199,98,214,145,136,208,210,250,241,197,214,24,254,78,12,
+    206,96,207,15,211,42,9,200,38,215,230,78,219,237,174,30,234,114,48,199,91,10,75,129,
+    237,30,180,20,48,27,119,92,58,120,8,247,148,12,77,91,229,47,248,66,99,198,64,196,
+    34,176,237,156,137,186,252,248,193,135,56,131,189,170,2,162,245,65,175,203,110,31,142,95,
+    191,159,95,173,167,78,218,138,78,179,247,18,26,11,120,101,212,131,27,145,149,164,44,242,
+    86,36,40,231,66,84,240,124,239,206,129,67,255,19,123,39,6,171,124,166,106,2,34,230,
+    234,100,175,151,158,140,175,236,236,114,166,174,237,209,234,174,26,11,24,8,184,42,22,12,
+    194,164,253,56,161,51,107,30,154,17,22,240,193,151,158,57,242,99,204,65,24,107,182,153,
+    153,85,73,192,116,136,110,183,187,251,225,74,208,60,154,10,120,181,195,127,5,227,165,230,
+    64,97,167,51,36,251,18,101,66,206,169,95,8,71,56,176,63,28,232,250,34,102,175,130,
+    53,219,124,232,111,227,66,121,106,21,16,37,70,237,157,244,196,10,3,254,229,209,84,192,
+    91,7,15,190,231,10,98,117,75,9,202,51,34,175,207,195,145,142,165,36,229,16,156,191,
+    163,255,241,242,75,255,11,175,11,156,195,152,109,102,239,28,58,120,59,247,161,70,1,209,
+    93,159,199,113,14,236,219,70,83,1,31,140,186,135,187,252,15,248,71,146,204,217,112,106,
+    3,230,164,184,181,38,54,84,167,46,58,46,60,230,219,210,132,13,151,229,141,88,237,26,
+    229,126,243,154,4,68,201,56,229,234,13,237,209,233,158,32,154,10,200,6,156,239,29,58,
+    192,245,35,114,164,79,24,112,226,102,86,186,70,255,57,232,18,91,171,220,124,253,0,94,
+    18,84,216,128,113,108,50,239,12,113,139,154,90,4,68,27,253,61,251,72,76,254,216,251,
+    55,230,231,182,88,109,168,29,71,77,5,204,173,54,167,253,237,24,105,187,104,214,96,196,
+    248,103,153,96,107,240,193,121,129,109,232,2,92,26,10,214,24,140,37,224,156,51,191,124,
+    170,65,64,180,209,215,78,69,53,47,35,204,50,115,151,233,30,151,147,199,225,240,39,181,
+    127,11,136,162,173,128,113,87,96,22,227,208,11,109,80,246,83,24,227,212,195,243,93,43,
+    119,14,28,18,235,230,50,241,78,188,109,111,109,4,68,235,71,158,233,211,188,251,67,137,
+    176,207,210,98,166,38,99,60,195,78,15,21,104,156,78,80,91,1,87,186,206,79,203,11,
+    200,189,82,253,242,171,130,252,94,223,237,121,215,136,168,100,119,14,230,215,13,178,104,34,
+    32,187,238,251,196,209,13,205,187,191,141,65,111,55,117,57,182,179,236,73,133,104,171,73,
+    89,106,78,61,209,86,192,91,7,247,127,65,246,242,116,252,87,106,193,229,127,40,85,239,
+    227,193,168,103,30,103,12,214,66,64,116,111,200,237,251,190,198,254,33,102,166,247,105,95,
+    180,116,209,141,54,143,21,101,177,146,70,91,1,31,249,157,167,60,50,69,218,210,97,10,
+    243,149,202,4,109,65,54,100,19,239,81,51,115,222,81,140,49,24,141,99,8,136,166,92,
+    249,195,178,106,5,76,14,189,48,164,241,248,203,222,143,249,92,109,2,163,126,68,217,237,
+    205,117,69,91,1,51,179,150,63,161,92,146,253,63,138,180,122,6,240,94,169,212,165,246,
+    229,244,197,118,137,111,119,235,208,129,111,200,159,199,37,41,139,252,188,52,65,23,202,207,
+    84,41,96,250,132,209,119,79,83,255,216,228,132,111,159,151,14,8,236,57,238,93,1,179,
+    17,75,72,186,244,61,123,239,77,239,121,204,133,226,237,87,94,251,46,247,135,127,40,192,
+    195,47,236,235,147,79,79,186,209,131,113,232,55,103,45,108,76,86,39,32,59,211,212,60,
+    163,169,127,232,7,131,6,3,93,54,250,242,236,105,1,35,194,71,183,60,233,112,175,205,
+    135,27,76,31,53,157,79,71,37,3,79,51,127,215,231,121,79,182,74,194,156,107,74,222,
+    141,176,177,16,115,83,157,128,73,218,120,92,211,237,231,116,160,255,69,122,34,33,216,253,
+    167,79,238,217,57,160,140,128,40,49,226,244,210,216,43,197,217,230,217,108,168,69,178,172,
+    36,250,198,1,249,138,92,56,117,137,114,2,22,230,137,85,9,136,98,61,218,222,228,137,
+    2,22,251,145,123,34,179,143,69,35,206,38,171,70,52,144,128,40,17,164,187,28,35,194,
+    239,90,1,82,126,99,152,29,107,145,46,172,251,224,130,252,66,184,254,2,50,180,55,138,
+    251,223,82,3,180,209,235,58,189,41,246,70,142,104,220,27,75,66,66,64,225,112,4,180,
+    222,215,209,70,7,177,159,154,204,95,237,127,237,206,125,218,36,237,67,102,206,147,63,194,
+    149,66,137,128,153,144,21,35,116,176,12,52,235,194,152,101,170,7,186,123,244,227,253,162,
+    33,222,13,53,2,107,45,96,212,26,140,219,133,66,149,185,45,131,143,245,206,136,190,107,
+    43,121,248,94,207,151,30,201,175,31,248,32,22,41,148,8,152,186,212,170,124,248,98,168,
+    142,0,254,127,172,102,208,70,223,179,71,197,55,178,26,106,4,214,90,192,69,215,133,111,
+    239,23,8,17,72,207,208,221,222,161,245,95,242,15,113,184,115,232,211,127,147,153,119,21,
+    138,227,139,243,112,212,29,151,30,131,51,1,156,24,197,96,65,192,155,47,191,170,32,217,
+    137,103,181,67,81,65,136,26,97,239,13,182,246,137,79,164,211,39,13,13,52,2,107,45,
+    224,119,95,126,249,27,23,202,163,7,210,11,145,183,155,77,116,84,65,247,151,99,181,235,
+    252,3,140,206,43,19,119,95,144,94,7,63,240,99,20,110,253,217,165,66,210,70,204,114,
+    94,249,171,23,183,78,42,121,107,213,6,218,24,120,113,80,98,35,181,177,58,64,173,5,
+    76,93,180,68,67,101,210,164,79,183,180,180,52,31,103,20,206,210,231,92,65,22,103,244,
+    188,121,96,191,244,58,152,59,81,230,155,226,124,231,165,223,254,14,247,49,100,152,205,63,
+    86,68,172,138,121,99,213,48,190,214,161,187,162,254,161,196,241,134,234,0,181,22,48,27,
+    52,132,203,239,109,253,186,171,229,88,104,65,241,147,146,119,15,67,192,199,23,91,47,73,
+    6,127,44,183,97,196,200,46,56,47,228,127,195,144,81,254,58,155,10,52,20,16,37,252,
+    158,55,37,14,50,147,253,14,83,35,117,128,154,11,24,174,20,48,189,188,88,197,91,50,
+    63,115,203,4,229,167,111,153,111,255,246,75,223,150,154,5,198,237,33,217,195,146,108,212,
+    82,88,187,55,186,128,204,64,167,51,40,222,255,49,254,174,195,87,26,169,3,108,4,1,
+    171,35,63,115,123,48,218,117,149,127,44,78,250,11,237,23,165,82,132,227,21,165,101,4,
+    216,218,189,108,112,1,81,176,243,112,64,84,48,180,49,212,238,16,215,147,8,122,21,48,
+    243,157,67,7,111,113,117,167,229,131,238,51,223,57,32,153,6,160,68,192,204,172,161,161,
+    5,100,40,137,59,42,216,245,190,79,248,240,55,90,181,65,175,2,62,250,226,190,247,30,
+    102,151,58,70,100,166,111,232,31,31,176,15,47,116,73,93,99,173,68,192,199,35,213,28,
+    132,104,38,96,250,140,171,87,244,200,143,189,55,228,214,62,34,91,14,237,5,12,197,113,
+    234,96,200,241,254,171,7,254,42,147,141,57,102,197,214,206,236,253,235,92,6,206,212,249,
+    213,7,153,121,183,84,88,160,18,1,111,239,87,94,128,95,59,1,217,89,147,121,86,228,
+    185,101,147,83,190,23,135,180,142,136,149,71,107,1,35,166,47,47,121,84,56,151,138,24,
+    253,143,179,217,153,166,223,203,23,55,19,96,220,151,207,195,113,117,127,225,31,179,183,36,
+    79,67,148,8,184,210,121,81,241,21,36,218,9,152,160,237,167,197,70,216,228,128,217,52,
+    164,109,68,34,22,90,11,248,205,79,246,127,155,174,226,52,171,156,80,203,108,38,155,121,
+    235,67,31,225,138,155,9,209,100,164,166,227,57,214,24,196,173,85,36,34,18,148,8,24,
+    115,224,229,213,151,162,141,128,108,242,188,71,172,200,23,74,140,122,14,79,104,158,144,135,
+    129,214,2,254,253,224,167,190,169,252,222,224,10,216,49,238,122,233,71,231,76,159,229,138,
+    155,9,17,8,239,60,221,153,57,207,121,241,142,75,129,128,153,128,146,18,195,219,104,35,
+    96,114,192,219,42,82,205,36,29,160,221,220,190,125,3,162,181,128,255,242,149,214,197,136,
+    181,230,104,140,36,109,206,189,166,239,191,118,0,239,96,246,214,193,253,226,83,55,28,1,
+    51,193,188,128,15,177,178,154,43,208,68,64,118,220,112,56,44,56,0,167,175,158,178,56,
+    169,70,91,254,242,104,45,96,38,108,143,169,32,224,141,252,189,232,49,11,55,17,196,224,
+    145,223,33,94,126,15,71,192,71,254,252,63,186,141,87,215,161,156,88,117,87,24,43,2,
+    221,243,25,5,127,10,98,206,89,204,150,51,130,177,249,13,128,214,2,114,85,246,84,16,
+    48,238,188,146,27,80,194,70,204,43,216,51,1,137,221,19,28,1,111,29,200,119,161,43,
+    152,149,109,202,88,106,173,127,60,52,115,228,133,33,129,31,130,152,89,170,221,114,114,185,
+    49,187,191,28,36,4,140,218,170,153,201,23,147,9,230,207,128,183,162,148,229,137,89,197,
+    143,219,112,4,92,233,186,192,109,228,196,49,107,123,149,193,248,234,30,16,157,62,227,20,
+    10,193,74,135,104,87,71,175,248,217,8,121,72,8,184,216,118,177,198,103,228,161,191,115,
+    37,247,238,30,195,73,40,207,179,232,18,255,145,56,2,198,93,121,129,177,42,169,86,130,
+    162,221,59,55,186,215,135,101,139,192,14,32,155,244,219,221,130,137,153,141,3,9,1,111,
+    190,246,74,21,187,185,197,220,62,196,69,80,37,40,236,91,49,191,243,242,111,139,158,217,
+    97,9,152,239,113,241,66,87,5,72,208,230,99,117,221,3,73,159,52,159,40,123,135,177,
+    137,232,24,229,113,126,190,161,245,35,32,96,204,30,72,141,26,107,220,135,89,118,115,115,
+    177,181,252,74,4,139,212,5,171,168,58,248,2,62,244,123,228,99,31,132,96,103,154,141,
+    202,174,110,82,6,154,181,152,75,239,153,64,201,184,207,212,108,162,132,215,197,13,132,230,
+    2,46,180,142,60,12,72,231,82,202,146,9,229,231,98,113,39,70,62,47,79,80,124,189,
+    130,47,160,68,37,46,25,82,51,111,238,139,213,175,43,74,80,109,239,148,152,150,14,208,
+    61,251,168,63,143,97,167,24,18,67,115,1,111,31,56,120,39,36,147,75,41,199,7,231,
+    243,65,244,24,209,168,219,72,236,216,224,11,184,216,138,127,203,73,25,40,214,141,159,240,
+    172,152,107,157,84,241,17,8,98,206,24,109,84,180,145,202,0,138,162,185,128,15,207,119,
+    173,214,42,224,251,175,115,61,17,154,80,32,224,157,215,68,171,165,98,8,152,9,231,127,
+    84,110,250,80,205,34,56,15,211,239,150,200,20,170,13,52,97,43,74,58,65,76,136,118,
+    154,135,149,101,216,16,67,115,1,51,65,215,92,176,121,172,166,161,97,222,49,250,136,139,
+    125,235,194,191,251,245,131,75,110,177,227,96,12,1,211,95,238,224,78,64,98,18,149,184,
+    228,64,223,231,130,241,234,83,24,146,41,186,105,12,37,162,116,103,87,239,108,163,207,253,
+    182,208,92,64,174,206,94,216,88,219,174,68,200,194,221,56,183,220,142,113,191,214,22,153,
+    120,167,88,33,75,12,1,127,52,248,252,183,114,31,106,17,48,139,214,135,218,109,103,235,
+    97,32,27,245,250,10,207,4,74,204,141,83,94,55,29,106,240,165,111,17,68,4,76,208,
+    61,55,248,71,213,240,175,95,201,31,172,197,108,74,14,184,110,137,94,18,134,33,224,183,
+    158,31,250,251,220,135,154,4,204,13,141,103,45,150,145,58,236,198,36,168,238,8,247,93,
+    217,100,140,182,25,29,189,58,210,143,144,128,236,52,238,125,73,130,252,184,255,147,223,200,
+    125,136,41,138,76,121,48,42,150,253,27,151,173,217,154,93,234,252,114,174,235,202,4,107,
+    18,48,183,22,62,107,175,71,76,114,204,66,39,114,122,207,141,209,251,122,168,177,121,61,
+    233,71,72,64,69,235,215,74,190,249,113,223,143,56,29,20,9,40,158,64,119,205,35,91,
+    183,160,112,16,242,248,189,14,249,75,93,37,73,5,222,236,160,98,133,251,9,85,3,93,
+    110,185,204,166,195,62,171,193,66,199,26,49,228,79,18,2,2,186,130,153,218,4,12,26,
+    254,248,231,217,236,163,247,58,20,237,10,207,137,85,241,96,122,157,114,49,86,133,35,184,
+    247,95,221,175,188,44,71,41,104,125,160,123,31,61,165,52,9,95,146,36,109,254,179,213,
+    211,14,15,125,89,251,43,32,106,71,123,1,185,27,135,106,18,240,231,95,206,103,166,125,
+    239,213,253,18,181,81,43,185,46,86,162,15,9,95,54,87,76,65,192,176,97,180,230,181,
+    37,74,196,40,147,197,87,20,45,91,43,104,214,254,91,191,219,101,183,215,99,118,169,1,
+    218,11,120,251,208,193,59,115,162,183,27,97,240,195,190,143,115,75,210,176,209,175,72,135,
+    36,109,18,25,178,249,112,123,113,248,51,224,96,115,21,101,57,42,64,204,36,213,237,165,
+    84,218,145,65,204,236,115,31,126,178,157,154,40,186,250,85,87,104,47,224,3,127,251,242,
+    53,175,175,250,0,185,111,253,214,192,143,115,31,66,45,129,194,99,76,114,83,37,17,127,
+    100,5,124,88,88,192,132,184,52,0,21,64,76,148,110,181,125,229,103,85,111,106,111,147,
+    94,153,242,185,12,79,12,44,233,100,215,89,0,237,5,204,45,30,226,140,207,81,253,85,
+    41,139,174,175,254,107,238,67,184,5,55,22,139,39,98,30,253,25,223,44,37,106,30,151,
+    158,147,221,217,207,101,213,177,151,155,106,59,194,222,1,49,231,218,94,25,189,149,170,77,
+    65,246,190,223,238,240,80,71,107,79,177,33,136,246,2,114,251,110,24,211,46,81,50,65,
+    107,152,123,225,20,11,120,235,149,215,132,215,16,243,118,153,125,241,194,25,240,125,10,59,
+    254,85,158,127,254,47,175,152,94,121,79,217,150,73,122,33,188,176,61,112,231,30,140,251,
+    188,142,225,181,191,59,165,74,169,19,82,144,17,176,202,90,243,121,30,249,11,87,22,41,
+    22,48,117,81,36,163,136,161,187,243,87,128,136,18,181,113,39,47,215,123,40,245,2,235,
+    51,143,191,235,127,189,163,131,86,178,112,189,102,111,106,58,198,167,61,135,143,53,53,53,
+    25,169,72,42,187,234,116,200,151,55,108,92,136,9,136,115,27,171,32,183,15,238,231,18,
+    131,10,137,153,74,200,136,93,170,132,38,100,246,197,163,54,238,237,18,119,77,171,185,123,
+    146,73,223,156,165,61,61,244,36,118,208,74,106,254,173,166,38,62,237,185,185,169,233,173,
+    66,230,105,220,41,154,140,174,7,72,8,232,8,101,150,36,106,152,200,176,234,57,207,37,
+    6,229,6,68,165,157,168,104,118,164,220,174,16,47,96,77,155,151,66,32,38,76,91,45,
+    190,240,157,135,152,147,193,212,60,159,245,156,99,158,215,78,253,95,75,83,8,8,120,181,
+    243,226,163,205,94,5,145,44,165,196,93,1,174,35,250,186,242,155,55,26,78,192,156,130,
+    155,83,212,62,207,161,243,75,213,111,226,129,128,74,185,185,255,245,239,161,113,135,136,12,
+    114,108,29,169,97,93,111,84,74,204,42,146,211,38,122,72,194,83,63,1,115,10,38,22,
+    71,15,116,120,125,27,213,14,239,32,160,82,30,251,205,177,108,204,94,229,36,240,225,168,
+    59,63,231,174,226,121,159,119,9,93,16,145,67,244,144,164,64,38,104,207,9,200,78,85,
+    153,145,36,7,251,224,246,236,155,238,170,143,136,65,64,165,100,102,13,225,236,114,71,149,
+    185,218,119,14,230,75,138,243,153,193,138,16,173,70,46,126,72,146,231,241,69,46,222,51,
+    65,123,215,248,79,148,195,38,175,213,182,14,40,28,17,95,174,42,133,3,4,84,12,119,
+    63,244,166,207,93,221,36,112,185,51,95,156,224,33,78,113,222,50,30,156,23,153,120,138,
+    31,146,228,185,243,10,23,132,176,228,20,205,193,75,14,122,170,157,209,242,160,68,140,54,
+    53,155,7,197,203,219,139,2,2,42,134,19,16,77,57,170,10,9,228,19,226,178,183,49,
+    111,227,47,134,203,6,224,155,101,136,30,146,228,137,24,70,211,185,137,160,232,206,17,138,
+    117,215,112,178,200,131,152,232,159,251,158,235,11,41,94,141,128,128,138,225,4,204,86,89,
+    168,247,131,11,133,184,210,149,142,42,170,180,196,197,102,113,183,94,21,57,36,201,19,108,
+    230,78,157,197,247,206,25,159,55,162,198,14,33,187,113,164,181,147,154,88,82,22,81,10,
+    2,42,166,22,1,223,223,95,168,200,22,175,166,82,164,104,105,151,212,37,169,178,107,133,
+    32,4,81,1,209,108,155,130,228,20,41,208,230,21,170,221,214,122,244,174,18,157,227,202,
+    183,3,26,9,18,2,230,111,27,170,82,192,152,173,176,146,173,234,203,175,138,21,183,202,
+    132,172,18,9,151,50,2,38,168,14,213,174,62,64,204,213,241,190,231,124,19,73,124,5,
+    215,186,171,92,206,53,6,36,4,140,89,206,167,171,21,48,98,202,155,146,41,191,239,11,
+    139,91,7,15,138,36,38,205,187,252,226,37,84,243,2,162,49,145,160,19,20,236,40,201,
+    10,175,21,180,49,104,50,249,226,216,115,193,36,109,175,37,193,134,52,36,4,252,238,43,
+    175,220,204,77,93,170,138,73,141,152,242,181,5,115,83,193,42,170,180,60,240,119,138,140,
+    180,119,14,136,175,105,216,113,46,12,139,233,109,19,252,218,116,232,176,107,70,213,49,144,
+    101,38,233,158,30,122,22,51,198,15,141,21,158,18,157,66,66,192,199,151,90,151,179,215,
+    188,213,140,28,153,144,57,255,108,223,217,47,127,19,127,37,108,64,172,188,218,131,11,30,
+    209,11,94,238,251,184,57,235,170,91,56,117,105,213,233,30,80,179,3,228,64,201,168,207,
+    238,162,66,120,65,211,81,153,59,187,27,27,18,2,230,111,29,103,104,187,120,213,92,81,
+    126,118,209,177,192,125,140,243,83,65,133,136,118,187,153,69,241,153,212,141,252,57,73,204,
+    46,152,133,204,78,57,235,81,253,22,49,211,189,110,219,57,172,239,28,53,87,29,89,212,
+    0,144,16,48,191,165,134,198,171,184,56,62,243,215,47,190,148,191,53,53,106,174,170,74,
+    203,154,87,108,51,153,161,69,99,180,231,92,92,57,224,40,119,28,87,14,155,152,248,207,
+    61,210,177,132,213,130,18,103,173,109,52,78,230,200,188,83,207,171,16,34,2,46,186,114,
+    79,89,164,10,1,255,237,79,219,10,87,175,202,166,113,8,147,16,237,118,209,184,101,76,
+    164,31,41,236,30,10,10,120,191,223,96,26,168,215,171,159,10,82,29,182,17,249,104,193,
+    77,202,147,47,140,160,79,136,8,184,201,29,171,86,35,224,143,6,158,249,139,124,207,87,
+    165,128,18,69,125,151,90,197,226,157,197,5,68,177,125,135,39,234,87,130,15,49,103,237,
+    110,122,86,174,19,68,97,183,10,87,79,145,130,136,128,104,50,247,154,86,35,224,183,158,
+    29,228,106,180,112,107,145,234,162,185,196,203,154,111,82,93,171,124,179,12,113,1,19,116,
+    79,29,171,78,230,200,117,130,54,195,137,200,146,180,131,12,237,22,185,160,70,7,16,17,
+    48,27,115,197,114,2,138,141,121,226,44,183,127,37,127,102,155,190,228,204,175,69,20,35,
+    46,32,154,20,94,101,112,97,88,220,62,155,128,128,233,211,182,218,186,30,244,79,114,207,
+    0,218,60,101,204,113,70,210,64,20,246,84,29,95,78,28,114,2,198,109,202,107,180,197,
+    29,249,132,184,236,205,23,95,250,235,252,39,148,34,113,177,195,114,135,240,24,204,20,194,
+    176,42,5,68,179,38,99,109,59,128,155,95,148,223,192,73,45,134,143,27,140,210,181,67,
+    24,74,252,214,208,70,135,140,128,92,126,15,67,119,139,197,215,137,177,125,85,219,188,253,
+    34,198,242,80,0,9,1,55,125,93,130,3,217,98,33,12,171,66,64,180,78,57,207,212,
+    22,6,184,216,46,221,181,241,164,142,27,142,75,119,129,211,246,195,225,234,158,16,226,144,
+    17,112,173,135,186,143,38,91,149,158,166,61,28,105,47,236,149,68,77,226,247,206,72,34,
+    33,32,138,120,5,187,64,126,155,173,92,64,180,113,244,19,253,53,238,64,47,91,204,239,
+    226,120,179,104,148,233,2,55,7,60,173,170,4,228,104,15,25,1,147,84,110,53,202,141,
+    195,202,184,125,144,63,255,168,102,1,147,39,108,120,91,244,21,79,208,182,43,149,93,96,
+    250,68,97,193,93,38,32,218,232,123,166,230,235,159,83,239,152,177,12,76,29,23,127,223,
+    228,65,201,243,222,195,138,98,104,26,6,50,2,178,227,205,193,42,4,220,138,102,65,99,
+    213,10,184,96,48,136,214,4,65,147,86,170,114,86,186,108,46,220,192,81,42,32,123,111,
+    176,93,133,154,227,184,6,134,77,210,2,230,222,210,125,142,62,197,225,212,191,248,241,47,
+    248,22,57,200,8,152,15,48,137,187,166,148,189,103,51,193,214,194,200,155,164,109,85,6,
+    128,228,166,83,226,47,37,67,123,252,21,54,68,249,43,136,74,5,76,12,189,56,160,70,
+    169,83,76,3,229,5,204,245,200,207,245,7,48,92,46,230,222,103,239,241,45,114,16,20,
+    80,38,23,173,146,135,126,126,171,238,58,254,21,73,229,72,76,2,179,40,228,112,134,203,
+    222,19,91,35,112,169,128,233,19,22,229,253,141,32,88,6,162,49,89,1,179,236,198,144,
+    203,130,53,163,220,134,157,237,170,177,226,171,10,16,18,48,216,52,198,38,105,139,178,85,
+    200,251,7,249,139,138,170,200,9,222,66,74,192,108,202,239,41,123,79,160,89,126,4,46,
+    22,16,49,39,91,90,212,10,193,226,12,60,181,34,25,253,199,222,235,195,232,241,17,147,
+    251,78,120,225,11,60,252,6,19,89,8,9,24,49,250,238,231,102,114,178,239,235,18,150,
+    218,70,11,55,45,212,144,6,33,41,96,110,113,100,57,89,210,137,48,148,139,191,3,43,
+    106,227,255,6,37,34,62,139,97,184,182,13,152,34,82,239,88,44,237,190,169,248,154,136,
+    132,233,197,241,190,23,135,112,122,252,212,59,214,14,106,22,91,193,244,105,123,3,28,225,
+    17,18,48,127,81,131,180,12,21,100,194,118,62,165,163,38,1,165,206,95,208,76,75,203,
+    233,34,3,211,159,239,160,126,90,104,46,219,44,195,49,142,9,218,211,77,95,81,205,191,
+    156,55,203,227,116,151,211,209,77,143,47,86,142,160,233,197,227,45,45,22,204,116,205,84,
+    160,183,173,213,135,153,225,158,235,220,77,149,55,188,106,14,33,1,217,43,174,57,165,2,
+    254,203,87,218,248,21,108,13,2,198,132,86,186,59,164,134,139,13,68,1,171,45,192,191,
+    70,169,179,86,171,61,79,59,29,169,190,146,139,32,136,89,137,79,82,214,230,150,227,145,
+    114,142,183,52,183,188,29,199,237,213,16,19,164,189,251,232,123,56,6,238,116,238,68,33,
+    36,96,222,33,133,2,254,184,255,83,220,245,32,57,106,16,144,161,164,227,247,138,13,68,
+    27,190,182,119,183,95,163,212,213,104,129,250,212,195,69,76,60,215,215,25,202,105,105,121,
+    123,81,137,38,136,137,189,105,121,243,202,117,217,183,8,138,184,183,58,119,162,16,19,208,
+    53,197,42,20,240,91,159,28,248,81,161,85,131,128,168,16,90,32,14,103,224,241,124,248,
+    73,122,150,254,212,144,218,209,246,82,164,22,249,226,147,197,40,210,143,131,189,235,235,113,
+    117,211,114,91,50,9,186,163,1,6,96,114,2,114,151,77,43,20,48,108,254,202,191,229,
+    27,53,93,180,36,154,156,190,69,106,216,208,98,56,158,235,233,142,183,216,6,234,119,195,
+    106,253,96,147,215,39,105,187,233,132,84,130,123,122,229,76,167,74,201,204,53,66,74,64,
+    134,118,46,42,19,48,117,222,26,45,172,65,146,116,79,245,219,7,139,110,185,242,232,169,
+    197,183,13,6,163,209,104,48,156,82,178,169,209,72,32,230,180,217,220,74,139,102,53,165,
+    207,217,108,78,213,146,153,107,130,148,128,104,220,18,81,38,224,119,94,126,153,79,132,139,
+    89,36,23,18,210,124,175,239,123,124,75,28,126,44,84,60,250,53,16,169,165,203,148,104,
+    86,19,231,223,169,6,185,88,132,148,128,217,136,82,1,23,157,23,249,167,44,108,80,30,
+    202,186,205,207,255,247,207,249,214,46,7,49,231,172,109,190,136,128,130,40,232,176,157,109,
+    148,55,23,57,1,173,151,131,138,4,140,90,182,66,176,242,181,101,0,89,82,65,170,203,
+    91,153,83,130,54,222,116,143,52,76,231,78,76,192,229,54,234,171,138,4,204,117,153,124,
+    11,4,196,4,49,161,124,78,9,199,86,94,9,74,198,40,87,237,213,228,84,131,152,128,
+    63,237,117,31,83,34,96,102,22,4,84,14,98,78,25,12,166,28,70,99,193,195,200,56,
+    221,211,83,135,59,139,171,134,152,128,104,220,254,25,37,2,62,242,111,87,180,12,228,111,
+    203,4,176,72,45,134,56,114,11,123,206,195,28,86,58,134,125,51,137,6,16,19,48,27,
+    179,247,41,17,240,206,129,3,124,249,160,244,121,75,117,57,153,123,25,222,195,28,216,231,
+    122,218,64,78,192,165,246,231,154,21,8,184,218,117,161,16,10,147,189,249,242,203,138,46,
+    10,6,26,25,114,2,110,210,166,255,136,47,32,154,118,21,50,50,179,104,198,117,241,113,
+    190,5,236,2,200,9,136,38,155,127,29,255,250,211,157,224,201,4,237,154,227,247,99,0,
+    253,67,78,192,236,154,229,63,124,149,111,202,179,212,186,21,60,185,230,241,53,196,33,38,
+    160,10,4,5,76,188,240,225,183,248,166,44,153,144,117,171,8,94,13,241,248,64,227,65,
+    80,64,116,25,127,59,37,253,222,86,129,220,76,168,134,80,24,160,225,32,40,96,54,117,
+    29,251,64,232,214,203,91,23,121,60,188,224,17,169,98,5,232,17,146,2,42,32,110,62,
+    207,203,122,231,64,53,213,161,129,70,69,39,2,134,12,220,101,69,28,243,206,170,170,67,
+    3,13,138,62,4,204,4,90,182,182,12,99,150,42,174,72,2,26,22,125,8,152,242,111,
+    93,69,128,198,225,28,110,87,161,15,1,111,237,127,237,253,66,139,161,184,187,123,129,93,
+    131,62,4,188,218,113,137,159,248,173,136,220,23,3,232,20,125,8,24,219,190,27,51,102,
+    27,255,101,161,5,236,10,244,33,224,118,101,32,52,105,131,41,224,174,66,103,2,38,104,
+    152,2,238,46,116,33,32,26,231,139,147,103,215,186,32,18,97,119,161,11,1,25,170,179,
+    208,239,161,41,39,68,34,236,46,116,33,224,234,86,25,137,164,175,251,90,190,1,236,22,
+    116,33,224,214,85,169,104,202,10,155,48,187,12,157,8,88,152,2,38,105,115,85,215,172,
+    3,141,139,158,4,68,49,165,101,205,129,134,71,79,2,38,168,58,95,78,9,104,143,142,
+    4,68,211,214,6,42,41,1,168,131,142,4,76,210,118,129,171,180,0,125,163,31,1,211,
+    35,122,190,24,28,16,65,55,2,166,207,90,236,250,189,23,28,16,67,47,2,230,252,179,
+    52,76,81,69,64,61,244,33,160,237,216,48,248,183,59,209,133,128,87,237,54,91,227,20,
+    149,5,212,68,23,2,166,86,98,177,171,224,223,174,68,23,2,2,187,23,16,16,32,10,
+    8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,
+    32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,
+    0,81,52,23,16,49,107,241,29,86,202,239,147,7,246,24,26,11,152,94,28,167,186,157,
+    142,45,236,246,51,215,18,144,105,180,151,209,84,64,148,56,105,104,177,81,83,177,45,134,
+    109,246,174,190,72,99,221,160,12,104,138,134,2,162,100,140,182,180,28,159,43,242,45,117,
+    117,146,238,112,247,127,31,12,220,179,104,39,96,122,134,238,233,161,102,202,82,59,208,230,
+    108,175,199,23,134,169,224,94,69,43,1,81,226,180,193,66,199,146,149,125,29,250,219,129,
+    46,199,231,193,192,61,138,70,2,166,67,148,205,112,74,120,178,135,152,17,155,205,127,159,
+    229,31,2,123,10,109,4,76,159,117,116,209,229,163,239,14,169,115,78,239,96,146,127,0,
+    236,41,52,17,16,5,237,214,17,169,181,110,42,114,184,101,28,186,192,189,136,38,2,50,
+    116,199,57,233,188,114,52,102,56,28,129,121,224,30,68,11,1,81,168,67,182,176,90,98,
+    192,235,244,195,158,244,222,67,3,1,211,129,55,186,100,11,171,161,228,136,163,107,112,93,
+    169,129,233,107,208,109,234,155,250,11,200,6,44,174,1,140,202,146,169,32,221,221,167,180,
+    2,229,130,125,129,111,1,250,164,254,2,38,41,251,233,77,156,158,13,173,247,186,195,10,
+    187,192,80,115,136,111,1,250,164,238,2,178,177,110,220,202,186,191,156,109,87,122,13,3,
+    8,168,119,234,46,96,210,247,177,40,110,183,182,233,115,143,40,155,211,129,128,122,71,101,
+    1,43,23,5,81,19,141,189,197,140,66,118,135,178,65,24,4,212,59,42,11,88,177,40,
+    96,47,55,93,198,87,42,53,226,161,20,157,136,128,128,122,71,101,1,43,132,184,79,153,
+    34,124,19,7,134,178,42,186,143,21,4,212,59,245,22,240,70,15,165,100,93,129,38,45,
+    74,186,192,92,255,26,228,155,128,62,169,183,128,113,215,180,162,51,222,4,237,85,176,14,
+    185,79,25,195,124,19,208,39,117,22,16,77,57,227,124,19,15,20,118,58,35,216,131,240,
+    117,101,253,43,208,120,212,89,64,198,231,89,227,155,152,164,252,30,252,75,169,149,246,175,
+    64,195,81,103,1,151,90,125,74,79,215,18,62,219,52,110,23,24,87,216,191,2,13,71,
+    157,5,140,89,11,151,237,43,0,77,59,123,113,199,85,16,80,247,212,93,192,252,85,211,
+    138,216,164,189,152,179,192,244,176,29,4,212,57,13,40,32,10,225,222,203,186,98,183,175,
+    240,77,64,167,52,160,128,89,134,110,63,139,181,21,19,183,15,195,5,94,58,167,17,5,
+    68,1,155,13,171,103,131,41,160,254,105,68,1,179,169,83,54,172,47,3,1,245,79,67,
+    10,152,141,57,112,22,207,236,148,171,158,2,166,23,194,225,5,136,248,175,51,141,41,224,
+    53,15,206,78,76,130,246,42,220,229,86,64,122,225,88,83,83,179,253,26,255,16,168,19,
+    141,41,32,67,185,22,249,166,4,75,78,220,88,107,197,176,201,183,155,158,106,122,43,56,
+    15,139,156,58,211,152,2,162,113,115,148,111,74,16,181,140,43,221,229,198,131,77,198,105,
+    195,83,111,129,125,26,208,152,2,102,163,120,2,98,252,163,42,64,235,131,221,251,168,43,
+    186,209,175,206,185,169,233,133,122,206,132,65,192,10,208,122,159,151,142,234,168,88,82,157,
+    115,83,23,154,109,117,156,9,131,128,101,160,68,212,247,116,191,226,12,121,146,148,63,233,
+    234,146,126,235,169,183,234,56,24,232,88,64,52,102,85,95,64,116,215,215,227,81,94,161,
+    129,40,245,21,112,161,169,105,158,111,214,3,149,5,12,54,207,242,173,2,245,20,144,233,
+    109,91,226,155,170,129,238,13,184,122,195,58,43,90,93,95,1,67,77,245,236,0,85,239,
+    1,13,254,159,241,205,60,85,10,152,62,97,146,23,112,213,141,31,185,138,9,218,24,124,
+    113,64,95,221,95,142,58,11,88,215,239,174,182,128,119,94,221,127,139,111,230,169,74,64,
+    150,25,54,154,150,249,7,226,196,236,138,99,13,101,64,27,125,237,131,27,122,243,15,4,
+    44,226,241,123,237,37,195,98,21,2,166,87,38,105,155,233,180,124,183,31,181,171,60,5,
+    68,235,71,158,233,211,93,255,7,2,22,147,9,217,75,140,83,42,32,123,255,250,25,135,
+    163,219,39,94,206,119,7,181,5,100,215,125,159,56,170,191,254,15,4,44,161,204,138,109,
+    1,31,45,70,112,24,163,123,28,142,211,88,183,39,161,241,82,215,107,5,221,27,114,251,
+    116,121,99,73,93,21,169,119,234,181,70,2,162,5,71,11,22,38,122,122,5,111,209,149,
+    160,219,229,231,137,248,176,247,250,95,24,210,225,248,155,67,53,1,133,142,84,234,157,122,
+    93,95,1,211,167,44,124,47,245,193,66,8,135,96,20,123,11,100,181,139,222,228,155,106,
+    144,244,217,250,239,137,253,108,54,17,111,224,192,44,213,4,20,58,82,169,119,234,117,125,
+    5,92,182,88,174,242,77,213,137,57,39,85,236,175,80,172,231,176,248,252,47,209,111,53,
+    96,132,231,16,66,53,1,133,190,81,189,83,175,235,43,96,204,114,162,110,155,152,49,167,
+    138,83,64,180,65,123,163,226,79,244,90,247,179,205,141,91,3,68,45,1,5,167,123,245,
+    142,58,175,179,128,213,108,3,98,162,166,128,104,189,111,223,160,196,174,118,204,217,111,216,
+    253,2,10,78,247,64,64,49,84,20,144,189,119,244,99,82,27,128,104,210,241,251,123,64,
+    64,193,233,30,8,40,134,122,2,162,187,125,207,31,93,255,37,255,72,0,134,234,122,75,
+    93,1,217,100,100,94,181,85,141,90,2,10,78,247,64,64,49,212,19,48,217,103,239,147,
+    220,128,94,105,167,255,155,186,2,222,31,48,170,23,100,167,154,128,66,174,129,128,34,32,
+    213,82,226,114,11,224,222,13,201,149,94,204,54,17,84,85,192,180,223,251,134,122,17,215,
+    32,96,17,154,9,152,160,186,213,73,137,75,207,190,217,29,147,222,208,137,217,162,99,106,
+    10,200,134,28,206,136,122,155,27,42,9,40,152,229,90,231,212,87,29,11,56,103,85,92,
+    248,77,16,52,107,182,73,45,128,57,98,182,175,209,22,21,95,135,4,237,249,188,138,219,
+    83,42,9,40,152,229,90,215,212,87,14,221,10,24,54,40,168,190,47,14,218,160,156,34,
+    23,105,239,16,179,157,236,81,122,133,142,4,233,51,14,85,243,73,85,18,80,48,203,181,
+    142,169,175,5,116,44,160,42,99,34,51,244,137,1,217,19,189,152,237,15,93,216,69,51,
+    101,201,245,185,230,89,213,190,91,14,149,4,20,204,114,173,91,234,235,22,123,93,192,149,
+    78,159,124,4,66,204,246,89,21,103,66,76,175,235,140,170,231,67,170,9,88,252,210,241,
+    212,43,245,117,27,189,10,152,9,168,34,96,122,216,134,17,86,29,179,13,186,230,248,118,
+    205,164,207,117,168,156,74,160,142,128,194,57,94,32,160,8,143,253,56,137,155,114,160,32,
+    86,33,184,152,249,89,149,150,220,57,174,90,109,1,156,81,141,77,44,197,10,44,201,108,
+    89,171,35,160,112,142,151,190,5,68,19,117,19,240,246,129,215,238,240,205,26,96,40,55,
+    206,114,52,246,212,83,106,173,65,16,115,210,130,81,85,147,77,222,152,244,57,204,22,14,
+    179,249,140,180,129,234,8,40,156,227,165,111,1,19,84,71,189,162,177,86,58,47,126,192,
+    55,107,96,17,111,57,26,125,242,55,212,202,127,74,12,180,218,101,227,104,217,228,36,221,
+    211,218,77,141,229,163,196,143,155,204,210,207,162,58,2,10,231,120,233,91,192,213,78,74,
+    205,152,209,98,226,206,80,134,111,86,15,186,108,26,195,17,235,107,191,166,86,110,118,250,
+    92,231,225,128,108,7,120,127,192,104,160,167,175,241,187,67,169,147,102,233,113,68,29,1,
+    75,39,79,91,232,78,192,152,61,176,35,70,220,54,46,113,196,95,19,113,135,10,203,210,
+    36,101,199,89,91,160,63,248,240,115,42,45,27,86,236,246,160,156,242,40,49,218,125,120,
+    188,40,45,38,182,21,86,46,130,42,2,138,164,216,232,78,192,133,86,255,67,190,153,123,
+    230,240,42,237,86,131,26,2,178,241,110,172,168,126,230,249,15,255,62,78,71,41,15,154,
+    114,200,78,0,209,247,7,187,92,161,226,159,167,137,128,34,41,54,186,19,240,246,129,131,
+    59,139,131,6,23,48,73,237,147,57,4,206,131,194,166,95,251,83,190,93,35,24,7,216,
+    104,189,175,199,23,44,177,84,19,1,69,82,108,116,39,224,195,243,93,171,124,179,209,5,
+    100,39,77,88,107,91,134,50,63,169,206,171,128,166,101,15,176,217,187,71,127,179,175,44,
+    57,84,19,1,69,82,108,116,39,96,38,88,180,101,219,216,2,50,180,5,43,173,105,169,
+    245,89,153,85,0,46,73,74,238,39,162,187,253,207,30,253,126,233,196,25,141,107,35,160,
+    224,15,209,157,128,217,57,167,94,4,92,235,198,59,145,136,90,6,108,193,218,151,220,57,
+    147,98,251,228,58,192,100,159,163,191,60,54,54,209,219,42,93,5,12,4,44,70,63,2,
+    198,157,83,56,29,96,54,106,254,92,199,165,199,252,131,90,72,208,61,81,153,14,48,182,
+    175,119,189,60,80,240,154,91,102,51,11,4,44,70,63,2,198,28,88,191,93,250,164,233,
+    194,254,87,223,231,31,213,194,156,77,122,206,137,152,217,195,61,21,203,162,244,41,185,227,
+    106,16,176,152,221,38,96,102,206,104,138,140,170,17,249,128,198,141,210,38,37,250,29,246,
+    129,36,255,96,11,20,180,90,101,142,147,64,192,98,118,155,128,143,70,108,167,82,51,205,
+    51,252,195,26,72,80,78,233,98,226,107,158,55,166,54,203,21,77,208,109,239,202,108,29,
+    170,33,160,88,138,13,8,40,130,102,2,222,58,176,255,78,54,108,240,215,158,68,185,230,
+    145,94,244,160,41,71,229,164,20,133,229,75,224,168,33,160,216,14,37,8,40,130,86,2,
+    162,176,231,226,195,236,251,175,238,191,201,127,162,122,230,100,22,61,12,221,89,25,26,198,
+    96,220,222,173,134,128,98,41,54,32,160,48,106,220,149,142,37,32,227,243,46,102,42,10,
+    191,86,133,204,123,70,240,158,110,52,109,147,223,43,82,67,64,177,20,27,16,80,152,21,
+    91,237,119,165,227,8,136,130,109,220,8,88,94,248,181,26,208,164,180,128,137,94,79,184,
+    220,1,246,94,159,85,126,175,72,29,1,133,151,89,32,160,48,113,91,237,119,165,99,8,
+    136,214,169,142,124,92,128,10,5,209,25,218,189,115,72,89,9,59,235,168,236,235,18,71,
+    94,56,34,219,1,130,128,37,20,9,136,38,234,39,96,237,83,64,28,1,19,67,61,253,
+    63,229,26,75,237,53,151,105,92,233,148,12,126,77,210,246,138,196,187,244,73,139,116,205,
+    144,2,32,96,49,69,2,38,104,245,111,146,225,209,70,64,54,234,165,11,57,115,155,116,
+    81,140,69,117,200,116,162,215,43,67,195,208,108,75,203,12,70,199,11,2,22,83,36,224,
+    53,79,221,146,154,181,17,240,39,189,91,103,103,104,82,120,159,86,1,49,201,105,36,123,
+    165,181,98,178,151,160,172,167,112,38,26,42,8,136,198,119,163,128,113,135,154,69,116,75,
+    208,68,192,212,5,171,111,107,224,141,187,166,106,43,230,130,38,36,127,92,146,234,41,223,
+    135,67,17,47,222,27,88,5,1,147,148,72,196,141,206,5,172,221,18,17,180,16,48,243,
+    87,7,94,254,230,150,117,107,221,189,181,77,2,55,169,46,169,122,108,49,51,93,118,8,
+    135,214,251,186,42,150,197,130,168,32,224,141,30,17,215,65,64,97,180,16,240,225,165,125,
+    95,124,196,183,177,131,7,69,89,114,245,74,116,103,236,88,115,249,62,28,211,255,244,160,
+    220,25,72,1,21,4,156,115,137,236,246,128,128,194,212,95,64,54,249,181,253,159,254,155,
+    237,48,64,118,210,66,149,199,9,40,66,186,200,74,229,16,200,6,90,41,204,107,115,84,
+    16,80,180,10,160,14,5,116,109,7,111,54,154,128,233,27,63,41,126,69,99,246,97,137,
+    3,222,196,96,143,231,11,15,248,7,57,18,116,207,13,190,89,21,210,175,100,110,13,92,
+    218,63,178,63,232,115,93,193,243,15,4,44,97,181,107,116,235,101,171,167,128,246,227,113,
+    49,86,5,170,173,165,87,114,127,49,220,113,238,31,248,199,28,43,118,137,211,20,52,101,
+    126,35,250,127,139,214,29,232,74,107,77,5,178,164,95,201,242,242,204,236,189,254,23,49,
+    182,160,11,128,128,197,220,62,180,157,22,87,71,1,87,28,54,135,24,157,244,68,193,196,
+    34,134,109,54,187,221,102,47,233,83,82,167,237,162,211,58,116,151,182,149,249,118,29,51,
+    130,95,4,25,1,75,5,72,135,123,45,226,247,54,149,83,187,128,226,245,142,245,39,224,
+    3,255,118,126,105,29,5,76,45,71,197,24,167,59,236,21,216,108,39,115,127,117,181,116,
+    87,109,181,75,236,120,3,173,31,253,212,64,153,110,9,186,166,243,96,201,87,18,77,237,
+    204,156,115,160,144,203,235,187,139,221,223,202,11,248,120,149,145,220,68,18,79,23,213,159,
+    128,153,224,118,156,74,29,5,148,0,109,10,201,89,230,94,30,134,106,23,142,53,102,215,
+    251,62,126,180,188,108,32,154,182,95,172,33,40,80,242,149,100,104,79,209,65,11,90,247,
+    185,71,113,46,12,229,145,21,48,125,210,82,190,203,82,122,47,161,120,178,64,212,138,85,
+    188,164,122,84,23,48,55,61,227,181,83,35,100,170,174,160,9,203,41,33,165,210,33,159,
+    183,60,55,55,199,119,95,122,233,187,124,179,10,36,5,92,202,199,220,240,160,141,190,238,
+    242,238,87,18,57,1,211,195,77,79,216,202,122,184,210,123,9,163,70,177,37,250,82,155,
+    212,238,145,10,212,81,192,85,187,189,110,55,21,170,195,178,197,252,110,165,129,108,212,213,
+    53,40,80,54,53,117,209,113,165,250,211,16,73,1,163,69,121,71,236,198,145,167,49,170,
+    182,22,33,35,96,122,184,185,249,181,178,193,40,253,153,143,78,241,77,142,168,73,236,151,
+    99,40,201,24,158,218,169,163,128,113,59,198,189,251,68,73,189,99,174,52,48,61,115,216,
+    43,56,0,102,162,142,242,211,10,5,72,10,24,177,69,248,86,174,255,243,61,123,164,44,
+    53,93,6,105,1,57,255,134,3,101,123,158,215,158,252,149,3,69,255,113,113,1,209,132,
+    186,215,130,87,80,79,1,137,76,1,21,81,105,32,155,60,254,148,161,34,53,173,0,67,
+    119,95,231,155,202,193,21,48,217,231,148,186,182,78,8,73,1,243,254,165,202,55,221,83,
+    251,127,229,137,157,49,24,141,27,69,127,57,225,170,109,234,177,183,5,204,27,120,118,103,
+    133,136,18,49,159,225,169,99,34,11,0,52,229,144,169,85,42,1,166,128,40,182,143,146,
+    190,182,169,18,41,1,11,254,85,156,250,164,255,224,223,63,177,243,69,82,249,122,32,96,
+    125,73,189,99,237,232,221,222,55,156,240,121,247,209,226,119,104,173,58,108,231,170,53,16,
+    75,64,148,152,17,72,77,151,67,66,64,222,191,10,1,23,154,158,248,232,206,23,73,229,
+    235,233,80,192,173,32,44,93,8,152,77,5,122,219,242,165,152,243,184,232,168,196,254,71,
+    234,156,173,106,3,113,4,68,27,253,14,219,128,226,168,27,113,1,209,76,193,191,10,1,
+    67,77,175,53,237,124,145,84,190,94,78,64,244,143,74,223,18,10,80,95,192,107,30,126,
+    123,87,31,2,102,17,115,53,198,111,22,70,163,139,21,137,225,37,212,96,32,134,128,104,
+    227,232,51,244,164,244,111,32,132,168,128,232,94,159,185,112,101,125,133,128,205,71,138,190,
+    72,234,149,154,105,250,204,248,231,255,15,255,160,14,168,47,32,67,59,23,185,143,13,191,
+    13,88,13,156,129,167,87,171,81,16,67,192,196,192,111,85,108,127,227,32,42,32,115,228,
+    133,161,66,103,80,165,128,233,149,248,161,15,61,101,119,215,20,134,33,141,250,2,162,177,
+    194,154,190,241,183,1,171,33,117,206,97,115,156,158,203,177,180,254,11,254,115,88,200,10,
+    200,50,195,78,170,26,255,68,5,68,211,182,62,254,64,175,58,1,211,103,173,214,39,63,
+    116,72,240,24,73,45,212,23,48,27,49,229,39,52,141,191,13,88,21,169,171,167,29,14,
+    103,14,247,145,31,242,159,194,66,78,64,246,222,144,205,140,147,130,84,137,152,128,73,218,
+    177,21,125,33,41,160,112,198,50,98,86,135,45,150,83,191,223,116,133,255,68,125,168,163,
+    128,250,152,2,42,39,117,53,127,127,209,162,186,61,224,221,129,23,250,102,171,123,199,138,
+    8,136,34,158,237,194,130,146,2,10,101,44,167,87,39,169,78,155,237,221,148,254,86,193,
+    57,1,199,185,141,172,93,43,96,117,72,11,104,253,189,55,29,3,216,241,87,101,8,11,
+    136,54,250,220,219,197,246,37,5,20,200,88,78,159,181,219,221,244,68,110,236,213,161,128,
+    115,182,124,240,58,8,88,130,164,128,51,31,109,242,248,48,82,208,133,225,4,68,255,80,
+    254,213,137,129,79,14,109,123,37,41,160,64,198,242,85,187,109,120,37,31,216,27,181,157,
+    172,122,243,29,135,58,8,184,153,63,177,98,167,197,130,108,247,38,81,243,9,209,23,18,
+    253,222,135,158,26,73,84,29,232,192,9,248,147,243,63,225,31,21,40,91,210,200,8,88,
+    250,151,220,172,208,190,85,250,100,217,38,87,31,179,54,234,32,32,154,228,162,43,25,90,
+    189,11,38,119,3,75,102,99,64,88,177,244,213,137,103,62,252,159,106,88,176,229,4,68,
+    51,238,210,34,20,137,129,146,37,141,66,1,19,189,222,173,28,210,212,176,208,45,174,234,
+    81,7,1,11,213,94,227,22,21,47,185,223,5,164,134,109,125,130,147,188,244,187,22,75,
+    243,19,127,194,63,170,134,156,128,12,213,89,210,79,177,241,238,195,197,75,26,25,1,163,
+    255,148,46,185,6,96,161,168,80,82,157,39,129,117,19,48,216,50,86,245,152,178,43,97,
+    134,94,232,191,87,241,148,32,230,156,217,124,242,115,102,225,194,24,120,132,154,167,206,117,
+    148,86,150,73,248,74,47,129,146,17,240,207,255,248,47,75,230,7,97,227,78,28,180,14,
+    5,228,202,88,164,223,110,169,229,57,221,133,160,123,253,182,55,195,165,243,64,196,204,82,
+    237,150,119,82,81,91,45,129,239,161,230,207,217,75,47,193,102,39,76,165,89,204,21,2,
+    22,159,5,199,236,159,249,205,47,253,63,254,65,158,176,105,231,197,211,161,128,107,61,84,
+    114,161,185,37,127,32,7,108,131,54,104,143,179,228,36,57,29,162,93,29,189,129,84,118,
+    197,93,75,225,143,80,211,1,107,73,185,68,116,207,103,46,77,248,43,23,112,190,56,26,
+    38,102,121,190,44,4,71,231,2,38,105,243,236,219,205,199,106,152,86,239,78,216,196,136,
+    205,54,204,29,227,241,156,182,187,233,0,183,217,193,80,237,53,20,124,13,124,228,169,210,
+    75,176,153,35,207,13,150,238,236,149,11,152,122,235,137,143,108,11,24,121,170,169,44,28,
+    171,88,192,152,93,170,164,67,205,212,67,64,52,214,242,89,232,0,133,72,157,179,219,185,
+    99,60,30,187,227,243,133,36,122,52,97,173,190,2,43,122,239,87,141,35,37,29,224,108,
+    91,95,89,80,107,185,128,217,208,71,118,4,156,248,141,242,50,132,197,2,46,183,215,117,
+    53,89,15,1,179,225,230,215,161,3,20,36,197,85,104,216,97,101,235,73,90,106,197,171,
+    196,38,68,242,249,127,87,114,159,54,218,232,237,40,191,21,187,66,192,249,166,157,75,224,
+    175,117,149,223,5,86,44,160,10,181,57,165,168,139,128,243,205,31,253,245,157,255,1,32,
+    207,38,237,30,169,242,192,33,237,55,253,234,165,34,223,216,187,71,122,250,202,203,106,85,
+    8,152,154,159,223,238,33,210,255,189,188,152,73,177,128,42,212,230,148,162,46,2,166,78,
+    193,8,172,12,20,116,56,195,85,109,91,177,17,71,211,71,2,252,3,142,228,224,243,71,
+    42,162,186,42,4,148,38,108,124,123,231,237,32,114,137,151,74,212,69,192,108,106,113,231,
+    253,5,224,144,242,123,15,207,84,209,7,166,103,15,123,127,167,40,186,158,219,129,17,56,
+    85,142,217,223,251,55,190,137,195,162,209,176,147,126,21,23,171,29,168,10,245,17,16,80,
+    76,178,223,216,52,163,180,15,100,19,39,90,76,3,95,221,217,83,206,162,31,248,140,19,
+    149,223,102,165,109,255,86,201,40,28,82,167,13,59,6,174,117,215,124,67,128,4,32,96,
+    131,192,38,62,103,220,138,95,198,5,221,29,176,180,156,100,2,69,2,38,134,182,162,240,
+    75,72,93,251,246,191,242,77,44,56,3,103,249,95,134,241,89,139,43,39,169,12,8,216,
+    48,36,134,94,236,159,21,168,109,40,10,90,63,242,172,111,38,197,157,5,243,159,201,162,
+    43,14,165,22,11,147,58,101,125,131,63,182,65,151,69,42,232,171,2,8,216,48,228,150,
+    175,142,86,252,164,76,196,204,244,62,157,95,110,236,8,136,214,105,87,117,97,253,21,48,
+    3,30,39,159,126,21,54,212,113,43,26,4,108,28,16,51,253,134,251,116,33,14,84,14,
+    246,126,140,118,181,245,231,107,120,109,11,136,54,142,126,162,191,124,7,166,74,80,98,196,
+    110,119,156,158,203,57,24,171,177,60,182,36,32,96,35,129,2,118,107,199,144,124,106,28,
+    123,127,140,218,231,165,2,133,28,226,109,1,19,253,207,12,97,22,54,199,32,181,50,156,
+    83,48,231,224,215,94,242,214,47,47,19,4,108,40,82,43,227,190,103,232,241,57,201,242,
+    148,108,50,78,183,24,232,248,86,87,185,37,96,110,2,72,85,29,215,47,68,106,37,150,
+    115,208,233,180,185,234,119,22,2,2,54,24,104,99,192,110,180,210,211,95,79,138,236,201,
+    160,205,0,221,189,143,30,223,9,225,231,5,100,239,249,108,170,239,216,229,28,204,177,125,
+    100,168,62,32,96,163,129,152,249,203,84,143,171,155,30,139,68,194,243,101,93,33,98,86,
+    38,233,86,39,29,185,95,164,103,65,64,180,62,240,194,78,22,146,110,0,1,27,16,148,
+    184,62,77,89,12,57,108,244,20,31,183,80,96,138,110,183,187,169,233,210,250,49,121,1,
+    209,221,62,231,128,42,59,48,218,2,2,54,38,136,137,133,195,225,203,148,151,191,123,130,
+    199,217,69,143,95,43,47,95,20,108,186,204,162,141,35,207,226,220,45,220,112,128,128,141,
+    12,98,174,229,171,48,108,35,120,11,79,216,72,49,235,253,79,31,209,163,127,32,224,46,
+    32,65,121,143,249,186,5,234,250,235,1,16,80,255,176,17,151,195,51,248,183,186,244,15,
+    4,220,13,164,86,226,107,74,14,145,27,9,16,16,32,10,8,8,16,5,4,4,136,2,
+    2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,
+    8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,
+    64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,
+    81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,
+    1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,
+    4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,128,40,32,32,64,20,16,
+    16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,162,128,128,0,81,64,64,
+    128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,136,2,2,2,68,1,1,1,
+    162,128,128,0,81,64,64,128,40,32,32,64,20,16,16,32,10,8,8,16,5,4,4,8,
+    146,205,254,127,160,56,157,33,108,33,138,97,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+// assets/sounds/sfx_die.ogg
+static const Uint8 AB_DATA_2[] = {
+    79,103,103,83,0,2,0,0,0,0,0,0,0,0,210,174,103,13,0,0,0,0,73,30,
+    137,21,1,30,1,118,111,114,98,105,115,0,0,0,0,2,68,172,0,0,0,0,0,0,
+    0,238,2,0,0,0,0,0,184,1,79,103,103,83,0,0,0,0,0,0,0,0,0,0,
+    210,174,103,13,1,0,0,0,233,194,90,86,16,61,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,113,3,118,111,114,98,105,115,45,0,0,0,88,105,112,104,46,79,114,103,
+    32,108,105,98,86,111,114,98,105,115,32,73,32,50,48,49,48,49,49,48,49,32,40,83,
+    99,104,97,117,102,101,110,117,103,103,101,116,41,0,0,0,0,1,5,118,111,114,98,105,
+    115,43,66,67,86,1,0,8,0,0,0,49,76,32,197,128,208,144,85,0,0,16,0,0,
+    96,36,41,14,147,102,73,41,165,148,161,40,121,152,148,72,73,41,165,148,197,48,137,152,
+    148,137,197,24,99,140,49,198,24,99,140,49,198,24,99,140,32,52,100,21,0,0,4,0,
+    128,40,9,142,163,230,73,106,206,57,103,24,39,142,114,160,57,105,78,56,167,32,7,138,
+    81,224,57,9,194,245,38,99,110,166,180,166,107,110,206,41,37,8,13,89,5,0,0,2,
+    0,64,72,33,133,20,82,72,33,133,20,98,136,33,134,24,98,136,33,135,28,114,200,33,
+    167,156,114,10,42,168,160,130,10,50,200,32,131,76,50,233,164,147,78,58,233,168,163,142,
+    58,234,40,180,208,66,11,45,180,210,74,76,49,213,86,99,174,189,6,93,124,115,206,57,
+    231,156,115,206,57,231,156,115,206,9,66,67,86,1,0,32,0,0,4,66,6,25,100,16,
+    66,8,33,133,20,82,136,41,166,152,114,10,50,200,128,208,144,85,0,0,32,0,128,0,
+    0,0,0,71,145,20,73,177,20,203,177,28,205,209,36,79,242,44,81,19,53,209,51,69,
+    83,84,77,85,85,85,85,117,93,87,118,101,215,118,117,215,118,125,89,152,133,91,184,125,
+    89,184,133,91,216,133,93,247,133,97,24,134,97,24,134,97,24,134,97,248,125,223,247,125,
+    223,247,125,32,52,100,21,0,32,1,0,160,35,57,150,227,41,162,34,26,162,226,57,162,
+    3,132,134,172,2,0,100,0,0,4,0,32,9,146,34,41,146,163,73,166,102,106,174,105,
+    155,182,104,171,182,109,203,178,44,203,178,12,132,134,172,2,0,0,1,0,4,0,0,0,
+    0,0,160,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,102,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,64,104,200,42,0,64,2,0,64,199,113,
+    28,199,113,36,69,82,36,199,114,44,7,8,13,89,5,0,200,0,0,8,0,64,82,44,
+    197,114,52,71,115,52,199,115,60,199,115,60,71,116,68,201,148,76,205,244,76,15,8,13,
+    89,5,0,0,2,0,8,0,0,0,0,0,64,49,28,197,113,28,201,209,36,79,82,45,
+    211,114,53,87,115,61,215,115,77,215,117,93,87,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,129,
+    208,144,85,0,0,4,0,0,33,157,102,150,106,128,8,51,144,97,32,52,100,21,0,128,
+    0,0,0,24,161,8,67,12,8,13,89,5,0,0,4,0,0,136,161,228,32,154,208,154,
+    243,205,57,14,154,229,160,169,20,155,211,193,137,84,155,39,185,169,152,155,115,206,57,231,
+    156,108,206,25,227,156,115,206,41,202,153,197,160,153,208,154,115,206,73,12,154,165,160,153,
+    208,154,115,206,121,18,155,7,173,169,210,154,115,206,25,231,156,14,198,25,97,156,115,206,
+    105,210,154,7,169,217,88,155,115,206,89,208,154,230,168,185,20,155,115,206,137,148,155,39,
+    181,185,84,155,115,206,57,231,156,115,206,57,231,156,115,206,169,94,156,206,193,57,225,156,
+    115,206,137,218,155,107,185,9,93,156,115,206,249,100,156,238,205,9,225,156,115,206,57,231,
+    156,115,206,57,231,156,115,206,9,66,67,86,1,0,64,0,0,4,97,216,24,198,157,130,
+    32,125,142,6,98,20,33,166,33,147,30,116,143,14,147,160,49,200,41,164,30,141,142,70,
+    74,169,131,80,82,25,39,165,116,130,208,144,85,0,0,32,0,0,132,16,82,72,33,133,
+    20,82,72,33,133,20,82,72,33,134,24,98,136,33,167,156,114,10,42,168,164,146,138,42,
+    202,40,179,204,50,203,44,179,204,50,203,172,195,206,58,235,176,195,16,67,12,49,180,210,
+    74,44,53,213,86,99,141,181,230,158,115,174,57,72,107,165,181,214,90,43,165,148,82,74,
+    41,165,32,52,100,21,0,0,2,0,64,32,100,144,65,6,25,133,20,82,72,33,134,152,
+    114,202,41,167,160,130,10,8,13,89,5,0,0,2,0,8,0,0,0,240,36,207,17,29,
+    209,17,29,209,17,29,209,17,29,209,17,29,207,241,28,81,18,37,81,18,37,209,50,45,
+    83,51,61,85,84,85,87,118,109,89,151,117,219,183,133,93,216,117,223,215,125,223,215,141,
+    95,23,134,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,9,66,67,86,1,
+    0,32,0,0,0,66,8,33,132,20,82,72,33,133,148,98,140,49,199,156,131,78,66,9,
+    129,208,144,85,0,0,32,0,128,0,0,0,0,71,113,20,199,145,28,201,145,36,75,178,
+    36,77,210,44,205,242,52,79,243,52,209,19,69,81,52,77,83,21,93,209,21,117,211,22,
+    101,83,54,93,211,53,101,211,85,101,213,118,101,217,182,101,91,183,125,89,182,125,223,247,
+    125,223,247,125,223,247,125,223,247,125,223,215,117,32,52,100,21,0,32,1,0,160,35,57,
+    146,34,41,146,34,57,142,227,72,146,4,132,134,172,2,0,100,0,0,4,0,160,40,142,
+    226,56,142,35,73,146,36,89,146,38,121,150,103,137,154,169,153,158,233,169,162,10,132,134,
+    172,2,0,0,1,0,4,0,0,0,0,0,160,104,138,167,152,138,167,136,138,231,136,142,
+    40,137,150,105,137,154,170,185,162,108,202,174,235,186,174,235,186,174,235,186,174,235,186,174,
+    235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,64,
+    104,200,42,0,64,2,0,64,71,114,36,71,114,36,69,82,36,69,114,36,7,8,13,89,
+    5,0,200,0,0,8,0,192,49,28,67,82,36,199,178,44,77,243,52,79,243,52,209,19,
+    61,209,51,61,85,116,69,23,8,13,89,5,0,0,2,0,8,0,0,0,0,0,192,144,
+    12,75,177,28,205,209,36,81,82,45,213,82,53,213,82,45,85,84,61,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,213,52,77,211,52,129,208,144,149,0,0,25,0,0,2,41,197,154,132,80,
+    146,65,78,74,236,69,105,198,32,7,173,6,229,41,132,24,147,216,139,233,152,66,200,81,
+    80,42,100,12,25,228,64,201,212,49,134,16,243,98,99,167,20,66,204,139,241,165,115,140,
+    65,47,198,184,82,66,40,193,8,66,67,86,4,0,81,0,0,6,73,34,73,36,73,242,
+    52,162,72,244,36,205,35,138,60,17,128,36,122,60,143,231,73,158,200,243,120,30,0,73,
+    20,121,30,207,147,68,145,231,241,60,1,0,0,1,14,0,0,1,22,66,161,33,43,2,
+    128,56,1,0,139,36,121,30,73,242,60,146,228,121,52,77,20,33,138,146,166,137,34,207,
+    51,77,158,102,138,76,83,85,161,170,146,166,137,34,207,51,77,154,39,154,76,83,85,161,
+    170,158,40,170,42,85,117,93,170,233,186,100,219,182,97,203,158,40,170,42,85,117,93,166,
+    234,186,108,217,182,33,219,0,0,0,36,79,83,77,154,102,154,52,205,52,137,162,106,66,
+    85,37,205,51,85,154,102,154,52,205,52,137,162,169,66,85,61,83,116,93,166,233,186,76,
+    211,117,185,174,44,67,150,61,209,116,93,166,169,186,76,211,117,185,174,44,67,150,1,0,
+    0,72,158,167,170,52,205,52,105,154,105,18,69,83,133,106,74,158,167,170,52,205,52,105,
+    154,105,18,69,85,133,169,122,166,233,186,76,211,117,153,166,235,114,101,89,134,45,123,166,
+    233,186,76,211,117,153,166,235,146,93,89,134,44,3,0,0,208,76,211,150,137,162,236,18,
+    69,215,101,154,174,11,215,213,76,83,182,137,162,43,19,69,215,101,154,174,11,215,21,85,
+    213,150,169,166,45,83,85,89,230,186,178,12,89,22,85,85,182,153,170,108,83,85,89,230,
+    186,178,12,89,6,0,0,0,0,0,0,0,0,128,168,170,182,77,85,101,153,106,202,50,
+    215,149,101,200,178,168,170,182,77,85,101,153,169,202,50,215,181,101,200,178,0,0,128,1,
+    7,0,128,0,19,202,64,161,33,43,1,128,40,0,0,135,226,88,150,166,137,34,199,177,
+    44,77,19,77,142,99,89,154,102,138,36,73,211,60,207,52,161,89,158,103,154,208,52,81,
+    84,85,104,154,40,170,42,0,0,2,0,0,10,28,0,0,2,108,208,148,88,28,160,208,
+    144,149,0,64,72,0,128,195,113,44,75,211,60,207,243,68,81,52,77,147,227,88,150,231,
+    137,162,40,154,166,105,170,42,199,177,44,207,19,69,81,52,77,211,84,85,150,165,105,158,
+    39,138,162,104,154,170,170,170,208,52,207,19,69,81,52,77,85,85,85,104,154,40,154,166,
+    105,170,170,170,186,46,52,77,20,77,211,52,85,85,85,93,23,154,230,121,162,104,154,170,
+    234,186,174,11,60,79,20,77,83,85,93,215,117,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,4,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,9,23,
+    30,128,66,67,86,4,0,81,0,0,128,49,136,49,197,152,81,10,66,41,37,52,74,65,
+    9,37,148,10,66,105,169,164,148,73,72,173,181,214,50,41,169,181,214,90,37,165,180,150,
+    90,203,160,164,214,90,107,153,132,214,90,107,173,0,0,176,3,7,0,176,3,11,161,208,
+    144,149,0,64,30,0,0,130,140,82,140,57,231,28,53,70,41,198,156,115,142,26,163,20,
+    99,206,57,71,149,82,202,57,231,32,164,148,42,197,156,115,14,82,74,25,115,206,57,231,
+    40,165,140,57,231,156,115,148,82,231,156,115,206,57,74,169,148,206,57,231,28,165,84,74,
+    231,156,115,142,82,42,37,99,206,57,39,0,0,168,192,1,0,32,192,70,145,205,9,70,
+    130,10,13,89,9,0,164,2,0,24,28,199,178,60,207,243,76,209,52,45,73,210,52,81,
+    20,69,211,84,85,75,146,52,77,20,77,81,53,85,149,101,105,154,40,154,166,170,186,46,
+    77,211,52,81,52,77,85,117,93,170,234,121,166,169,170,174,235,186,84,87,244,76,83,85,
+    93,87,150,1,0,0,0,0,0,0,0,0,0,1,0,224,9,14,0,64,5,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,3,0,0,49,6,33,100,12,66,200,24,132,20,66,
+    8,41,165,16,18,0,0,48,224,0,0,16,96,66,25,40,52,100,37,0,144,10,0,0,
+    24,163,148,115,206,73,73,165,66,136,49,231,32,148,210,82,133,16,99,206,65,40,165,165,
+    168,49,198,32,148,146,82,107,81,99,140,65,40,37,165,214,162,107,33,148,146,82,74,173,
+    69,215,66,40,37,165,214,90,139,82,170,84,74,106,173,197,24,165,84,169,148,214,90,139,
+    49,74,169,115,74,173,197,24,99,148,82,247,148,90,139,177,214,40,165,116,50,198,24,99,
+    173,205,57,231,100,140,49,198,90,11,0,64,104,112,0,0,59,176,97,117,132,147,162,177,
+    192,66,67,86,2,0,121,0,0,8,66,74,49,198,24,99,16,33,165,24,99,204,49,135,
+    144,82,140,49,198,24,84,138,49,198,28,99,14,66,200,24,99,140,49,7,33,100,140,49,
+    231,156,131,16,50,198,24,99,206,65,8,157,115,142,49,231,32,132,208,57,199,152,115,16,
+    66,231,156,99,204,57,8,161,115,140,49,230,156,0,0,160,2,7,0,128,0,27,69,54,
+    39,24,9,42,52,100,37,0,16,14,0,0,24,195,152,115,140,57,6,157,132,10,33,231,
+    32,116,14,66,42,169,84,8,57,7,161,115,16,74,73,169,120,14,58,41,33,148,82,74,
+    42,197,115,16,74,9,161,148,148,90,43,46,134,82,74,40,165,164,212,82,145,49,132,82,
+    74,41,37,165,214,138,49,166,132,144,82,74,169,181,86,140,49,161,132,84,82,74,41,182,
+    98,140,141,165,164,212,90,107,173,21,99,108,44,37,149,214,90,107,173,24,99,140,107,41,
+    181,22,99,172,197,24,99,92,75,169,165,24,107,44,198,24,227,123,106,45,198,88,99,49,
+    198,24,159,91,106,41,166,92,11,0,48,121,112,0,128,74,176,113,134,149,164,179,194,209,
+    224,66,67,86,2,0,185,1,0,8,66,74,49,198,152,99,206,57,231,156,115,206,73,165,
+    24,115,206,57,231,32,132,16,66,8,33,148,74,49,230,156,115,206,65,7,33,132,16,66,
+    40,25,115,206,57,7,33,132,16,66,8,33,132,80,82,234,152,115,14,66,8,33,132,16,
+    66,8,33,165,212,57,231,32,132,16,66,8,33,132,16,66,74,169,115,206,65,8,33,132,
+    16,66,8,33,132,148,82,8,33,132,16,66,8,33,132,16,66,8,41,165,148,66,8,33,
+    132,16,66,8,33,148,18,82,74,41,133,16,66,8,37,132,18,74,8,37,164,148,82,10,
+    33,132,16,66,41,165,132,82,66,73,41,165,20,66,8,165,148,80,74,41,161,148,144,82,
+    74,41,165,16,66,40,165,148,80,74,41,37,165,148,82,74,37,148,82,74,41,37,148,80,
+    74,74,41,165,148,74,40,161,148,80,74,41,165,148,148,82,74,41,149,82,74,41,37,148,
+    82,74,9,41,165,148,82,74,169,148,82,74,41,165,148,82,82,74,41,165,148,82,41,165,
+    148,82,74,41,165,164,148,82,74,41,165,82,74,41,165,148,18,74,73,41,165,148,82,74,
+    165,148,80,74,41,165,148,82,82,74,41,165,148,74,10,165,148,82,74,41,165,0,0,160,
+    3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,133,134,172,4,0,
+    82,1,0,0,66,40,165,148,82,74,41,53,140,81,74,41,165,148,82,138,28,164,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,149,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,1,192,221,23,14,128,62,19,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,21,0,0,48,134,49,198,152,114,206,57,165,148,115,
+    206,57,6,157,148,72,41,231,32,116,78,74,41,61,132,16,66,8,157,132,148,122,7,33,
+    132,16,66,41,41,245,24,67,40,33,148,148,82,235,177,134,78,58,8,165,180,212,107,15,
+    33,132,148,90,106,169,247,30,50,168,40,165,146,82,239,61,181,80,82,106,41,198,222,123,
+    75,37,179,210,90,107,189,231,222,75,42,41,198,218,122,239,57,183,146,82,76,45,22,0,
+    96,18,225,0,128,184,96,195,234,8,39,69,99,129,133,134,172,2,0,98,0,0,8,67,
+    12,66,72,41,165,148,82,74,41,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,
+    198,24,99,140,49,1,0,128,9,14,0,0,1,86,176,43,179,180,106,163,184,169,147,188,
+    232,131,192,39,116,196,102,100,200,165,84,204,228,68,208,35,53,212,98,37,216,161,21,220,
+    224,5,96,161,33,43,1,0,50,0,0,196,81,172,53,198,94,43,98,24,132,146,106,44,
+    13,65,140,65,137,185,101,198,40,229,36,230,214,41,165,148,147,88,83,200,148,82,204,89,
+    138,37,116,76,41,70,41,166,18,66,198,148,164,24,99,140,41,116,210,90,206,61,183,84,
+    74,11,0,0,128,32,0,192,64,132,204,4,2,5,80,96,32,3,0,14,16,18,164,0,
+    128,194,2,67,199,112,17,16,144,75,200,40,48,40,28,19,206,73,167,13,0,64,16,34,
+    51,68,34,98,49,72,76,168,6,138,138,233,0,96,113,129,33,31,0,50,52,54,210,46,
+    46,160,203,0,23,116,113,215,129,16,130,16,132,32,22,7,80,64,2,14,78,184,225,137,
+    55,60,225,6,39,232,20,149,58,16,0,0,0,0,0,8,0,120,0,0,72,54,128,136,
+    104,102,230,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,4,0,0,0,0,0,
+    16,0,62,0,0,146,21,32,34,154,153,57,142,14,143,15,144,16,145,17,146,18,147,19,
+    148,20,149,0,0,64,0,1,0,0,0,0,16,64,0,2,2,2,0,0,0,0,0,1,
+    0,0,0,2,2,79,103,103,83,0,0,64,38,0,0,0,0,0,0,210,174,103,13,2,
+    0,0,0,186,81,43,252,21,66,255,155,255,164,255,178,255,194,255,167,255,175,255,193,255,
+    177,255,178,255,192,252,248,138,247,193,215,177,125,155,20,217,252,248,138,247,193,215,177,125,
+    155,20,217,20,179,109,195,204,4,1,128,136,49,45,164,69,41,234,35,59,114,33,178,35,
+    26,146,208,200,212,101,24,92,198,233,200,56,225,13,9,127,55,96,124,248,41,38,0,250,
+    5,84,138,20,0,51,231,50,28,207,200,23,77,81,249,2,42,69,10,128,201,185,12,219,
+    51,242,69,83,80,110,33,42,148,169,134,200,106,25,105,90,201,43,203,172,20,11,0,232,
+    149,128,40,170,170,138,18,106,14,85,206,57,186,73,206,196,98,25,41,2,71,138,20,73,
+    146,146,73,74,18,2,44,165,184,128,197,69,33,164,133,68,192,226,2,129,64,84,130,43,
+    81,156,178,12,88,150,106,129,0,0,51,32,164,16,130,137,201,241,98,114,37,143,149,46,
+    134,204,92,215,53,195,12,143,131,107,0,0,174,215,235,26,48,17,69,19,29,205,113,12,
+    215,139,71,142,192,76,30,206,240,135,223,17,32,226,10,170,160,42,174,152,126,236,173,206,
+    6,162,8,10,0,0,24,157,5,227,189,35,151,119,133,63,252,145,35,187,104,104,88,156,
+    142,84,213,180,170,197,129,157,169,134,41,194,8,136,33,134,238,32,116,116,117,12,102,88,
+    129,56,205,117,205,64,184,94,215,16,225,167,112,1,128,1,0,50,175,107,102,102,44,232,
+    40,0,227,0,174,107,38,1,174,79,175,79,175,235,117,133,153,131,139,139,70,11,45,140,
+    137,9,125,100,23,0,29,90,236,8,29,29,161,141,17,77,76,116,12,113,136,38,12,116,
+    4,26,196,49,225,2,8,116,22,188,215,139,227,224,53,129,192,181,200,20,20,0,24,145,
+    22,140,9,65,71,71,7,180,193,136,68,1,0,37,198,2,208,16,59,6,45,180,17,131,
+    214,66,1,24,11,4,222,140,56,1,38,96,24,212,134,184,66,18,64,235,128,142,0,96,
+    162,141,9,38,38,160,35,24,136,250,212,229,245,17,212,51,202,145,121,93,228,72,2,49,
+    65,71,0,77,104,163,77,116,140,22,198,68,235,232,232,208,58,58,16,160,163,67,104,129,
+    8,62,103,164,134,241,75,229,2,132,40,118,125,114,69,98,102,206,72,13,227,151,206,5,
+    16,197,174,79,174,4,193,28,180,155,194,38,216,87,90,44,173,22,0,208,103,129,172,22,
+    9,212,100,59,112,142,139,81,57,244,24,155,36,150,36,201,88,160,68,8,139,10,4,98,
+    226,148,80,148,18,16,166,32,16,210,96,166,152,38,2,34,202,19,224,80,1,62,64,8,
+    24,74,89,14,40,151,5,229,48,124,1,3,16,80,0,9,102,81,113,154,22,21,16,166,
+    117,97,244,12,44,160,46,215,107,152,76,225,169,250,42,12,12,0,92,67,62,132,128,75,
+    23,234,132,129,71,96,184,146,57,114,228,224,208,35,164,119,81,160,138,24,138,216,57,105,
+    53,109,84,74,191,48,74,60,0,0,122,160,0,224,236,247,67,231,110,68,29,58,110,63,
+    157,173,1,106,2,160,131,71,72,2,32,71,0,96,152,79,1,218,183,108,17,55,122,87,
+    72,175,15,25,210,33,156,158,82,106,1,190,163,141,142,22,2,15,2,16,31,126,211,222,
+    161,21,195,6,135,98,99,43,118,74,12,208,49,65,141,137,208,233,1,68,10,9,226,97,
+    24,34,123,70,157,147,58,193,240,58,96,102,0,214,17,98,140,3,192,73,25,93,46,10,
+    226,200,81,248,141,5,170,131,83,175,103,212,1,65,236,99,116,1,198,232,35,244,52,212,
+    229,210,209,72,212,184,134,14,152,136,177,163,3,26,161,49,90,51,33,14,130,6,19,208,
+    32,70,68,90,120,222,209,32,148,145,130,0,98,164,97,116,4,26,208,134,64,108,34,26,
+    161,3,29,13,253,160,53,29,29,3,81,48,132,137,104,34,26,67,64,140,177,75,191,197,
+    209,17,67,236,24,141,184,28,25,157,78,167,235,232,8,64,211,24,65,103,34,67,239,180,
+    200,16,59,76,232,232,104,29,173,163,3,0,62,151,28,0,179,176,47,199,252,152,230,162,
+    114,126,27,165,200,92,114,0,204,194,190,28,243,99,154,139,202,249,109,148,34,171,88,123,
+    202,76,0,162,168,201,43,43,87,2,0,244,250,156,4,25,123,237,204,99,146,132,71,98,
+    133,206,37,22,155,36,82,98,69,92,148,41,49,129,168,128,102,129,152,8,69,49,195,99,
+    8,203,50,160,148,80,86,40,16,10,18,190,140,0,165,0,37,148,128,10,136,48,19,74,
+    76,72,0,6,0,136,138,139,16,66,17,17,161,168,152,128,1,150,124,186,14,120,205,245,
+    224,193,145,121,205,48,12,147,143,66,72,24,2,0,192,245,122,88,212,51,120,31,217,97,
+    248,28,122,6,157,209,195,229,4,161,206,144,22,139,141,197,106,218,88,237,212,20,212,80,
+    19,86,61,8,0,28,215,227,2,0,0,0,128,1,224,250,244,234,61,163,15,245,206,8,
+    31,201,233,4,116,145,67,41,101,0,28,133,164,14,25,13,15,233,242,140,78,99,188,67,
+    226,156,24,93,152,160,64,168,139,193,5,49,108,176,152,78,216,91,28,55,213,98,53,132,
+    130,132,85,15,216,129,110,23,243,74,0,0,128,228,56,200,197,204,227,120,29,199,245,158,
+    65,15,0,240,36,2,4,158,134,161,46,24,170,115,28,201,135,227,113,204,53,143,204,117,
+    250,253,16,90,63,130,209,2,0,48,17,68,143,48,7,71,2,51,225,13,181,232,116,72,
+    61,1,68,70,36,208,68,99,111,71,136,93,15,192,68,16,223,194,232,32,118,0,161,77,
+    76,76,196,214,33,130,209,105,224,9,137,68,96,0,0,35,0,16,7,58,98,232,134,104,
+    180,96,208,2,76,48,49,98,11,19,141,129,17,136,104,140,102,32,246,25,77,136,77,108,
+    193,68,196,136,132,192,136,198,131,1,240,68,71,236,24,29,253,137,216,209,209,161,5,112,
+    185,92,17,46,170,131,35,227,132,195,176,70,6,94,231,204,18,85,88,187,55,231,49,164,
+    202,201,55,10,7,117,206,44,89,133,117,91,179,31,67,201,202,39,223,40,80,6,183,16,
+    39,0,128,189,75,48,3,0,16,69,69,58,175,105,160,221,153,92,168,116,54,230,182,40,
+    44,73,18,75,44,38,66,123,203,41,15,6,196,203,61,67,132,6,0,17,85,21,68,140,
+    42,146,128,6,24,66,34,46,137,132,32,102,128,4,179,96,48,51,1,40,64,156,197,40,
+    74,56,144,66,32,23,33,23,48,32,8,149,119,62,135,42,63,237,109,197,98,88,236,236,
+    237,1,19,195,180,202,49,215,144,215,28,199,28,92,131,215,121,79,92,17,200,149,199,12,
+    92,147,131,25,134,100,94,175,48,9,0,16,171,130,130,157,3,91,241,129,76,66,14,2,
+    64,78,213,113,4,102,102,102,102,0,0,163,179,96,239,200,94,84,5,5,64,196,100,38,
+    51,201,12,225,5,14,17,146,68,134,119,92,51,92,71,152,23,15,114,104,228,200,225,119,
+    1,136,136,236,130,161,0,0,0,161,97,17,48,173,38,226,192,98,107,181,81,199,236,92,
+    199,117,188,194,76,6,152,26,90,136,29,33,154,64,131,133,200,142,76,36,202,200,104,134,
+    55,128,153,24,177,233,8,19,145,22,76,76,56,66,72,6,70,134,48,22,199,8,29,93,
+    97,2,196,101,34,235,93,46,3,1,32,201,145,227,145,100,46,142,199,76,184,50,24,8,
+    33,148,2,140,56,0,10,239,136,186,40,136,55,17,122,61,250,253,129,40,68,208,1,24,
+    157,206,132,212,69,214,19,61,209,83,103,31,125,81,40,40,0,111,66,152,152,32,106,208,
+    49,8,64,19,232,8,205,48,38,58,194,68,235,119,251,70,63,136,221,9,77,71,12,68,
+    140,137,137,9,90,48,68,45,160,133,56,186,24,24,19,19,19,116,208,225,1,6,234,9,
+    186,145,6,154,104,98,98,98,162,117,140,137,70,191,59,58,186,177,223,31,45,246,219,232,
+    240,198,67,103,129,0,254,215,204,130,202,247,189,216,175,227,89,132,127,254,70,138,4,54,
+    67,80,248,191,27,231,181,61,155,80,123,176,53,82,100,112,150,12,0,0,46,53,36,0,
+    100,248,224,12,206,133,38,50,128,232,50,27,155,113,36,73,98,137,89,38,1,228,76,178,
+    194,151,132,192,77,40,226,18,19,5,128,40,69,74,226,222,157,72,18,72,146,96,8,153,
+    193,66,154,69,61,68,220,220,40,46,23,41,4,2,148,137,11,104,194,0,33,25,38,144,
+    16,20,1,76,32,242,34,176,225,197,23,99,16,171,141,213,16,245,125,172,131,207,132,197,
+    167,76,134,9,73,52,112,128,248,72,206,21,48,185,174,99,80,17,230,200,162,83,231,67,
+    186,72,132,132,249,244,105,30,121,101,142,132,247,4,68,167,11,133,83,103,193,92,173,113,
+    81,120,234,245,189,107,8,19,99,98,162,139,129,1,64,151,217,85,151,97,0,188,15,245,
+    186,24,114,205,53,73,102,110,248,66,58,45,82,71,128,15,227,138,204,232,144,145,128,154,
+    166,154,86,91,199,236,17,113,136,97,111,99,53,176,40,130,136,128,14,58,3,56,35,38,
+    70,107,253,208,215,58,140,54,213,34,5,133,137,112,25,16,39,24,116,158,182,72,71,11,
+    205,2,40,3,245,14,45,8,4,66,63,132,22,24,0,113,185,24,117,58,132,129,209,83,
+    32,84,79,137,11,0,163,5,145,209,157,136,45,232,24,99,104,1,194,8,186,180,48,196,
+    214,76,76,116,12,35,180,33,12,226,8,68,12,6,6,64,195,48,130,142,214,12,140,33,
+    118,32,38,2,62,36,76,8,208,2,208,97,180,14,49,160,181,16,129,0,128,11,8,37,
+    58,38,98,152,104,193,0,161,0,32,0,99,76,96,98,2,22,60,163,5,151,142,246,91,
+    28,253,32,232,15,98,164,163,35,152,152,208,49,186,163,27,58,244,67,3,222,231,204,144,
+    73,0,124,59,246,242,118,240,49,67,159,51,224,162,0,120,55,236,229,109,162,39,254,129,
+    242,1,0,104,74,136,162,162,214,168,44,18,20,53,115,204,149,227,74,216,152,37,51,82,
+    82,36,2,0,50,235,66,32,8,169,244,165,207,84,4,192,21,108,236,236,28,154,86,27,
+    181,179,181,136,227,1,33,195,8,1,163,64,205,199,219,252,188,164,62,135,64,165,250,178,
+    254,197,111,21,135,192,113,133,99,50,217,56,233,139,41,29,130,17,0,194,192,131,17,197,
+    12,138,126,172,244,4,209,17,166,75,247,211,126,125,36,135,161,20,46,111,63,197,129,109,
+    238,7,5,76,6,209,80,135,142,235,8,107,104,98,100,212,159,111,29,3,129,162,8,98,
+    90,109,28,183,177,87,139,173,157,45,130,137,136,128,96,210,14,132,132,203,17,116,33,67,
+    65,8,147,13,116,97,161,225,131,211,48,70,7,29,196,233,195,226,242,17,22,13,204,48,
+    215,235,117,189,94,243,248,192,167,199,12,215,113,1,67,80,232,61,13,31,241,122,227,17,
+    146,18,98,184,200,235,154,73,134,227,154,216,111,97,34,70,132,26,234,52,33,137,192,12,
+    147,225,32,15,56,50,94,167,135,119,50,144,72,0,0,61,116,0,76,40,116,58,66,28,
+    133,113,134,97,36,78,167,211,33,90,107,12,77,79,129,48,196,232,8,241,96,48,158,161,
+    171,197,209,33,210,17,209,53,0,133,161,17,45,116,135,216,128,34,164,7,49,99,132,209,
+    2,198,24,160,49,49,58,152,208,161,107,0,46,31,254,200,142,64,12,49,116,196,72,4,
+    32,4,52,140,142,16,133,209,129,48,24,58,198,208,48,162,208,129,38,118,16,131,22,155,
+    38,66,48,49,49,49,161,163,99,80,157,55,46,6,189,119,72,64,13,0,141,49,49,198,
+    196,104,29,38,58,38,218,8,113,104,221,46,173,197,40,70,104,0,254,231,36,45,41,128,
+    222,22,239,122,27,133,126,146,223,116,42,127,78,78,21,2,232,3,222,221,211,44,10,253,
+    178,149,134,24,28,58,225,4,0,216,220,0,165,40,42,106,44,51,0,212,26,236,100,70,
+    23,47,197,137,25,179,89,76,18,27,75,96,154,176,80,8,154,34,162,2,17,113,202,11,
+    64,214,5,116,11,28,224,135,126,89,241,151,147,20,12,72,145,2,204,76,128,51,160,12,
+    32,25,32,226,65,101,57,37,128,17,192,40,66,226,79,159,194,124,210,230,210,121,106,115,
+    13,151,170,201,113,205,228,138,16,128,234,16,218,199,200,116,79,213,132,1,17,33,87,10,
+    246,89,43,167,190,63,68,5,10,162,230,7,189,221,57,224,252,99,75,129,222,65,79,97,
+    64,195,239,203,20,7,234,203,169,213,80,17,81,81,3,151,51,108,244,79,195,162,113,156,
+    101,135,205,165,147,153,153,36,115,189,194,193,49,136,232,166,52,162,43,24,153,244,158,48,
+    91,48,147,131,33,204,55,43,193,172,126,137,171,62,78,69,12,68,65,244,145,244,70,167,
+    163,46,234,210,121,11,64,4,66,194,12,147,15,185,6,136,163,8,194,24,225,39,90,71,
+    51,58,248,32,224,252,5,233,115,133,161,38,204,165,232,65,24,252,37,240,68,103,203,19,
+    189,221,27,157,203,135,36,55,234,17,210,22,245,68,234,136,110,8,58,132,142,77,117,103,
+    184,136,129,214,23,197,240,59,70,71,191,1,79,1,70,16,113,116,140,40,184,34,123,175,
+    35,161,48,196,16,29,28,154,137,33,4,177,17,79,65,233,82,157,97,202,192,0,5,5,
+    9,213,17,175,55,215,6,122,68,114,58,61,128,218,6,12,24,2,16,187,35,8,48,180,
+    11,29,29,97,162,141,216,111,49,180,214,237,70,4,81,11,231,235,116,112,209,144,158,50,
+    132,113,234,244,17,145,250,12,1,29,29,90,71,71,135,119,133,116,234,137,222,217,186,253,
+    190,216,197,0,140,200,32,50,17,26,190,247,36,67,44,0,124,13,182,33,55,201,125,235,
+    155,30,143,187,167,21,50,254,167,176,243,145,72,254,101,109,54,156,12,206,116,221,100,2,
+    0,56,115,55,94,122,0,240,207,0,106,129,132,143,205,89,85,110,170,112,88,28,73,146,
+    196,22,146,4,9,176,184,152,40,37,46,44,137,137,139,65,132,6,136,216,33,225,17,125,
+    239,129,24,132,2,65,84,164,76,148,16,0,64,55,116,85,67,224,110,12,8,32,201,168,
+    79,223,206,21,10,192,92,18,151,93,242,161,36,15,33,145,86,108,16,192,64,195,51,116,
+    249,231,208,183,133,45,3,189,207,61,131,161,230,42,244,64,8,129,131,25,30,31,30,237,
+    127,212,234,72,185,142,201,220,20,117,48,24,61,188,201,28,125,252,248,165,78,125,25,166,
+    0,0,192,244,208,110,233,47,210,151,43,140,110,152,145,20,134,232,207,255,143,129,154,54,
+    147,76,40,231,150,4,151,147,108,115,205,192,170,12,99,191,49,140,151,152,99,85,144,235,
+    152,99,38,195,34,198,212,193,84,181,104,139,213,98,178,18,174,169,22,99,14,142,139,59,
+    104,60,114,0,23,195,165,172,30,161,132,80,151,69,195,72,28,233,136,43,36,137,236,61,
+    9,217,66,235,135,24,251,87,184,66,234,9,136,75,71,161,35,142,12,8,33,30,145,141,
+    233,8,58,250,13,103,4,64,140,11,45,196,110,140,29,125,125,194,232,106,58,194,24,221,
+    198,0,10,226,61,161,134,50,82,70,132,97,160,68,239,61,117,181,24,66,108,134,22,129,
+    129,22,91,36,64,132,17,58,162,14,35,182,17,39,130,198,132,9,64,55,136,76,52,130,
+    56,128,1,19,19,141,48,38,58,66,12,49,180,174,126,191,31,128,9,19,46,87,100,189,
+    206,51,90,112,17,125,36,93,24,61,69,23,205,232,116,58,226,29,25,11,46,157,55,212,
+    105,186,70,63,244,181,209,12,16,1,94,248,4,10,22,0,95,43,148,60,148,91,116,165,
+    95,3,207,7,35,31,35,10,159,88,129,2,224,109,132,18,155,180,69,87,250,181,233,249,
+    96,123,27,49,56,180,45,0,0,246,237,1,156,35,64,68,81,81,81,198,2,152,113,105,
+    219,13,224,166,114,18,103,198,146,36,37,22,145,0,24,180,146,18,37,42,46,174,180,144,
+    34,66,0,85,1,202,150,31,30,248,90,149,18,16,154,137,23,32,146,76,0,73,11,123,
+    57,35,35,13,80,128,33,73,196,28,143,174,247,85,110,109,231,33,233,16,6,0,99,132,
+    128,81,42,118,108,100,189,170,227,93,3,51,157,230,243,55,83,13,85,80,0,80,92,1,
+    4,24,159,247,62,247,189,124,60,181,110,57,155,59,181,0,240,219,214,116,54,93,4,128,
+    214,154,3,250,44,78,5,111,84,102,54,64,64,81,223,134,95,154,158,155,135,32,158,144,
+    103,78,17,225,198,44,174,87,38,103,166,231,94,191,136,118,93,0,164,190,224,157,2,30,
+    29,18,71,7,65,48,196,98,103,103,177,218,26,22,91,75,108,145,134,211,80,80,132,186,
+    8,213,195,101,209,120,139,58,39,244,140,78,79,44,58,157,134,26,61,67,97,147,57,164,
+    39,12,174,48,70,199,200,232,114,46,219,232,224,52,225,247,122,31,18,38,130,194,204,228,
+    200,204,204,245,129,99,50,140,196,27,10,136,35,182,24,98,24,56,161,115,81,19,66,95,
+    191,223,7,93,129,7,92,32,46,11,221,126,208,12,26,104,49,104,125,12,33,16,65,3,
+    152,136,194,68,135,208,162,209,15,26,226,64,140,131,1,253,16,209,34,130,56,112,185,116,
+    58,26,210,27,234,36,97,244,122,189,222,3,198,187,34,83,151,43,252,122,11,17,212,2,
+    163,195,48,46,135,208,235,187,93,134,16,12,72,72,93,100,71,33,35,140,51,212,229,212,
+    133,233,210,98,164,3,173,3,98,160,1,222,247,36,66,38,32,48,116,35,233,196,16,146,
+    255,220,28,236,108,238,123,194,0,10,192,143,52,74,232,212,150,218,148,254,142,110,116,217,
+    60,88,216,13,0,81,59,30,59,163,219,122,233,11,156,3,81,212,174,181,213,10,120,182,
+    3,109,18,221,76,140,75,21,211,141,77,18,91,76,2,9,10,20,17,17,150,68,68,37,
+    32,46,41,149,105,6,8,97,181,217,204,171,174,82,249,125,183,214,219,172,235,85,197,255,
+    239,215,29,21,16,51,192,229,5,40,25,118,206,37,127,223,1,198,52,51,8,161,92,162,
+    162,132,102,1,170,51,93,122,124,130,35,18,0,38,90,41,145,243,242,250,193,88,47,51,
+    35,198,168,5,0,53,12,131,197,50,147,25,166,169,161,78,74,64,29,124,208,231,91,166,
+    155,40,28,216,139,97,2,144,170,8,113,207,246,153,229,126,53,101,209,254,90,114,132,185,
+    238,57,151,107,156,153,78,188,2,24,134,165,204,252,8,73,196,21,112,118,233,213,151,189,
+    134,179,31,44,166,27,162,168,170,184,116,244,140,191,6,51,137,148,91,1,188,233,154,5,
+    189,67,11,212,195,233,10,99,34,19,39,28,58,116,18,134,96,36,84,47,86,101,97,87,
+    7,48,97,152,107,27,50,140,55,4,4,12,132,92,120,205,29,129,25,152,48,73,227,47,
+    37,24,172,115,153,131,99,114,101,142,121,168,77,52,130,65,239,73,72,244,187,161,219,23,
+    232,140,203,232,116,174,240,155,33,204,12,121,145,11,221,208,134,16,59,92,0,101,4,129,
+    24,35,1,52,0,240,198,17,0,189,203,48,48,18,218,239,107,93,173,99,4,186,58,38,
+    90,135,136,126,67,108,104,17,34,29,29,163,219,49,17,186,163,47,2,141,225,93,46,163,
+    139,160,58,234,48,140,119,66,175,239,118,141,216,4,16,93,72,226,210,19,23,131,197,72,
+    198,34,117,58,116,58,137,1,188,137,161,133,209,66,12,177,31,34,253,0,16,161,1,64,
+    27,0,79,103,103,83,0,0,64,74,0,0,0,0,0,0,210,174,103,13,3,0,0,0,
+    217,11,144,30,18,255,177,255,199,255,199,255,181,255,196,255,219,255,228,255,229,255,232,126,
+    231,68,89,33,0,252,68,162,172,90,149,250,97,1,202,247,206,201,101,181,128,0,81,36,
+    60,156,40,37,85,197,75,185,65,20,226,196,130,174,209,247,197,141,55,16,85,101,0,0,
+    52,54,193,198,202,24,166,135,157,107,137,148,216,216,76,146,160,16,139,181,188,78,142,233,
+    94,103,110,47,198,111,171,241,236,155,158,105,229,6,58,220,217,86,101,0,32,206,42,217,
+    164,213,100,102,116,0,80,106,30,79,117,157,71,53,182,68,104,201,219,162,204,147,8,196,
+    68,193,96,2,49,113,104,231,200,126,98,122,7,206,71,215,181,195,84,5,155,19,223,110,
+    68,7,128,165,158,229,223,113,39,1,124,177,47,133,199,101,102,166,83,187,6,98,56,219,
+    216,248,55,109,29,216,58,157,20,16,51,6,109,88,134,45,89,252,29,65,194,197,12,234,
+    127,134,179,134,13,87,24,137,8,106,241,134,56,196,89,8,30,208,27,139,37,75,40,207,
+    15,54,106,181,168,168,1,20,145,136,69,175,35,212,248,30,192,41,40,13,117,145,192,142,
+    26,116,39,130,72,225,212,25,234,178,232,53,36,51,15,56,38,19,198,8,29,193,160,46,
+    6,2,151,227,145,161,115,103,9,163,55,166,141,217,36,206,68,120,163,119,121,70,82,10,
+    236,190,24,208,19,215,76,120,204,49,22,13,200,73,140,222,33,44,50,0,134,99,24,30,
+    51,67,30,48,92,71,2,153,92,92,153,87,46,114,77,38,65,152,232,136,101,180,142,24,
+    59,154,56,49,129,24,59,218,104,253,238,136,49,182,24,1,12,0,99,232,232,104,33,152,
+    232,24,109,132,174,48,134,0,188,203,69,141,46,130,18,234,212,211,72,4,140,62,77,28,
+    163,117,140,137,142,200,161,46,135,97,168,211,233,208,233,4,0,96,196,142,1,198,27,139,
+    222,73,134,49,66,3,52,28,221,26,93,64,141,36,195,224,26,163,2,3,6,8,0,94,
+    215,228,7,180,128,32,18,153,88,62,181,40,185,173,48,183,117,77,110,192,8,8,38,149,
+    9,225,119,13,233,43,181,171,76,231,15,148,149,53,215,36,99,68,126,187,124,189,156,253,
+    2,130,192,45,162,194,225,3,9,64,1,206,7,126,196,186,15,160,169,116,231,136,149,88,
+    34,99,153,36,73,0,152,18,186,98,198,197,205,166,178,236,141,208,152,39,32,134,254,238,
+    146,144,149,239,119,199,226,37,255,134,98,240,203,21,156,157,4,208,219,199,112,162,246,36,
+    2,216,156,250,226,107,230,179,141,204,89,108,124,140,96,248,136,32,254,193,149,238,232,243,
+    59,2,139,130,128,35,146,150,107,67,157,249,241,14,231,109,82,21,148,166,78,50,83,210,
+    131,171,116,171,84,252,174,165,147,102,78,103,102,39,237,150,243,61,99,17,120,31,122,245,
+    68,123,243,6,178,135,17,206,100,109,81,81,89,116,228,107,221,167,7,187,27,240,40,182,
+    197,59,40,32,154,82,131,197,98,177,120,187,184,134,173,229,197,169,20,41,202,48,75,41,
+    172,196,134,78,81,116,216,116,249,217,106,75,175,247,10,168,39,220,118,122,41,172,41,113,
+    17,68,56,116,58,114,132,25,242,202,53,1,226,216,44,5,26,33,16,56,120,228,128,43,
+    12,167,82,51,33,211,181,29,212,233,116,66,215,171,131,11,189,86,11,156,153,129,145,50,
+    149,43,225,215,101,132,220,122,207,101,114,206,77,36,215,178,69,239,140,180,188,92,156,129,
+    12,193,13,0,51,80,19,208,207,72,189,147,235,61,153,200,235,61,136,14,240,22,226,68,
+    8,29,77,8,77,191,17,117,61,128,64,7,87,108,173,133,160,9,226,137,163,49,120,67,
+    244,78,157,137,99,136,209,160,163,163,35,140,168,243,97,188,209,123,135,24,125,132,214,209,
+    97,66,199,68,199,68,232,198,126,191,63,250,1,196,168,137,162,56,66,235,118,187,145,208,
+    104,244,33,68,209,8,190,32,247,12,98,19,233,173,205,232,63,15,13,37,3,30,199,84,
+    135,138,128,160,49,109,85,52,114,118,140,148,107,209,56,166,58,80,5,4,178,101,41,191,
+    25,170,22,129,82,45,58,120,160,120,240,180,26,54,100,78,170,143,92,167,145,46,179,175,
+    78,96,136,16,177,183,9,140,30,5,192,189,6,152,221,68,119,73,177,34,137,37,73,18,
+    1,0,227,68,144,74,152,120,210,166,91,196,17,220,188,239,11,6,34,208,147,131,174,255,
+    127,48,211,241,39,249,255,108,37,122,63,119,183,121,47,49,154,48,64,138,66,54,229,193,
+    105,195,215,17,121,178,245,155,2,31,108,219,207,80,115,83,71,95,57,27,76,218,228,230,
+    200,232,82,80,17,195,201,253,134,115,2,15,94,135,171,100,169,177,44,66,70,131,122,86,
+    31,39,119,158,87,97,247,20,255,154,234,13,166,79,145,223,181,137,144,14,90,131,187,195,
+    73,7,238,110,125,123,2,22,250,221,96,28,43,127,19,53,74,131,69,164,94,213,205,16,
+    67,150,242,237,228,45,190,119,154,157,57,32,26,79,216,143,6,204,2,158,79,148,125,37,
+    16,128,165,28,25,254,173,15,55,105,81,74,93,83,200,14,59,193,251,122,193,159,179,21,
+    193,88,41,169,90,9,199,55,65,191,62,178,62,160,98,255,222,136,210,28,71,170,200,241,
+    237,18,48,114,173,153,36,11,224,221,137,150,143,185,200,240,140,214,172,198,39,105,112,14,
+    6,119,75,125,130,88,173,146,86,98,102,38,69,186,30,178,78,18,233,59,38,224,237,208,
+    15,9,110,209,42,212,208,86,57,44,51,129,210,66,84,39,143,1,194,200,112,9,2,206,
+    8,39,0,32,148,64,211,90,67,104,136,125,154,22,38,98,199,232,134,166,223,167,175,105,
+    76,68,173,99,196,126,183,31,194,88,164,48,6,24,38,38,38,98,11,19,173,223,70,191,
+    219,141,180,136,166,133,209,109,163,141,102,208,24,65,136,232,27,65,139,65,108,49,132,16,
+    24,66,127,140,48,208,244,83,123,106,17,6,230,104,13,26,0,50,0,30,167,84,6,186,
+    224,227,45,17,126,55,229,176,171,194,181,88,156,50,200,117,193,39,143,193,167,17,99,232,
+    39,135,90,108,176,28,3,16,37,21,104,50,182,241,249,54,2,64,32,18,32,100,102,251,
+    22,26,96,242,181,9,122,26,67,12,61,142,21,73,198,18,201,38,146,4,192,233,173,168,
+    80,199,124,90,10,38,108,91,146,70,218,141,229,132,77,240,121,188,217,144,123,191,244,223,
+    243,197,37,202,109,192,151,97,13,204,66,155,176,248,249,32,23,103,128,94,231,168,95,203,
+    107,244,49,90,160,138,107,206,136,113,166,215,244,180,171,33,134,90,102,226,199,80,33,209,
+    238,219,219,47,215,184,141,198,157,170,163,227,211,2,229,124,200,2,0,134,107,158,169,196,
+    140,75,67,198,51,117,120,26,0,66,239,232,190,236,146,187,253,179,120,61,87,197,46,69,
+    97,189,191,179,30,190,0,80,217,84,195,253,105,114,255,211,35,96,152,80,99,194,201,169,
+    105,59,97,248,113,186,221,50,14,189,222,47,88,164,233,111,29,212,190,8,91,56,157,151,
+    114,59,252,115,218,250,235,246,170,123,222,85,32,117,209,181,231,98,107,178,58,101,248,162,
+    234,154,161,144,152,3,128,56,191,119,107,193,226,226,207,244,172,121,229,81,249,236,50,94,
+    114,243,44,173,204,101,150,213,241,175,180,96,184,1,2,56,238,227,64,237,145,171,86,173,
+    170,45,54,30,91,168,109,90,207,123,199,51,227,164,0,178,20,0,19,248,239,229,99,68,
+    98,250,116,184,58,114,67,199,8,98,116,161,122,143,137,72,163,131,209,17,25,3,193,8,
+    161,25,49,140,22,251,186,221,46,48,40,140,14,140,161,174,208,70,191,31,140,62,194,132,
+    14,157,215,235,92,14,169,239,15,45,246,17,48,4,226,16,25,125,34,125,32,64,32,118,
+    117,17,64,24,16,234,225,35,0,157,14,29,195,68,35,192,192,96,24,13,26,3,0,222,
+    102,204,100,186,128,128,177,44,225,195,108,53,212,151,35,181,104,155,49,204,117,1,129,162,
+    217,74,96,140,26,254,190,184,22,165,220,136,147,70,194,60,200,207,173,55,0,26,139,4,
+    68,20,81,93,100,215,60,109,0,85,83,42,102,145,100,50,201,100,18,1,0,51,183,122,
+    190,78,24,158,136,131,236,3,11,46,60,105,167,45,145,103,194,114,162,96,35,149,135,134,
+    77,67,136,198,11,110,30,230,166,62,102,32,189,68,13,115,242,181,72,0,181,55,173,56,
+    251,120,131,97,157,96,194,42,0,242,185,244,234,251,247,213,229,230,110,188,254,165,255,199,
+    251,92,102,57,68,71,81,141,85,109,245,72,110,47,19,40,73,179,231,98,122,230,165,194,
+    84,21,55,54,234,13,142,203,25,51,251,146,49,43,74,0,144,138,140,104,87,151,159,92,
+    10,183,42,47,71,135,209,235,229,103,111,108,26,186,167,251,121,108,113,189,237,227,197,245,
+    125,85,15,99,154,105,82,206,88,84,139,155,156,211,131,160,119,199,223,156,2,242,242,56,
+    163,39,234,47,125,210,94,176,88,98,221,167,148,101,98,190,15,247,233,157,183,254,165,176,
+    184,167,83,14,157,157,1,118,208,15,173,250,26,83,199,111,116,255,101,151,133,234,65,100,
+    37,33,186,72,19,176,128,142,116,251,80,93,248,137,30,192,37,253,147,9,35,250,71,145,
+    232,140,133,200,122,162,11,207,104,82,199,30,29,125,42,86,200,245,45,211,139,75,59,33,
+    1,116,20,112,220,5,151,171,207,25,139,8,75,183,75,99,130,61,77,156,8,94,25,161,
+    207,8,8,194,158,49,58,134,161,219,213,186,221,1,66,64,116,12,62,134,137,208,29,253,
+    62,253,0,140,216,49,218,48,22,189,211,233,116,130,160,129,168,219,15,45,234,106,0,116,
+    35,226,192,73,193,8,23,72,127,16,232,160,27,105,19,205,104,197,4,10,120,106,34,163,
+    9,65,153,24,221,126,19,71,208,232,142,22,13,104,116,1,4,34,94,22,180,135,39,1,
+    65,214,101,251,128,114,91,66,253,134,234,46,11,102,6,138,128,192,221,164,37,255,46,181,
+    62,212,71,107,105,123,21,11,162,93,77,181,183,155,236,69,122,93,190,255,227,97,6,0,
+    0,89,29,137,5,160,167,118,241,170,227,98,38,38,198,36,113,36,73,80,238,217,120,202,
+    237,134,102,138,164,28,132,103,121,40,67,5,145,135,235,124,164,79,219,158,215,74,227,156,
+    162,237,52,215,85,74,239,46,85,75,203,100,57,206,72,165,88,150,211,53,138,138,41,106,
+    191,18,159,13,143,202,32,117,151,155,8,4,209,183,231,213,190,101,184,231,122,111,29,182,
+    221,85,238,235,174,113,229,238,36,249,135,29,87,192,34,53,184,78,185,105,135,213,57,91,
+    26,102,55,112,177,125,209,215,57,105,92,34,246,39,58,199,93,119,198,57,154,171,246,170,
+    95,163,176,41,5,223,77,180,248,188,188,181,203,210,245,222,171,19,206,82,187,148,172,143,
+    64,142,13,32,161,253,186,117,73,73,242,222,151,58,119,115,153,171,45,121,131,23,61,143,
+    36,15,135,125,237,119,100,49,153,45,83,246,62,223,99,16,150,204,191,86,163,116,133,177,
+    221,10,199,92,60,89,86,173,106,34,35,154,64,6,217,163,222,201,72,129,8,189,175,156,
+    32,95,136,58,116,136,172,150,39,113,161,90,91,84,211,209,20,137,204,71,118,177,6,80,
+    82,117,207,224,102,92,49,201,130,224,36,48,57,232,63,133,208,162,131,172,93,166,78,204,
+    9,117,229,28,71,187,116,7,86,110,56,213,152,52,38,232,174,77,229,86,253,201,205,48,
+    1,68,81,136,151,165,174,93,243,88,88,105,36,167,147,24,184,92,174,200,46,198,144,78,
+    70,6,139,145,72,88,195,106,177,219,5,82,153,212,70,119,232,66,3,131,68,162,246,131,
+    225,161,48,161,156,17,150,110,236,135,85,131,126,131,158,68,64,231,116,122,231,182,171,174,
+    196,90,24,111,188,65,15,33,132,190,56,61,142,31,79,50,166,7,81,250,239,44,239,5,
+    250,64,6,2,4,20,88,140,2,160,96,1,62,214,11,7,139,128,64,210,93,13,191,227,
+    17,225,163,233,50,99,189,204,64,23,16,36,167,104,173,40,120,68,255,242,122,89,137,160,
+    220,105,178,36,102,50,207,230,232,207,99,135,7,13,96,2,50,179,253,237,106,39,216,0,
+    170,15,0,128,110,231,226,42,145,56,101,146,20,150,36,130,112,188,67,26,39,155,28,226,
+    201,176,71,11,27,21,70,95,49,83,251,93,61,180,229,245,158,209,46,106,186,250,211,65,
+    231,39,42,32,88,75,148,80,126,248,116,255,136,222,60,111,92,253,134,131,101,110,208,242,
+    16,159,172,149,183,207,217,199,58,18,80,85,194,120,207,120,122,201,195,125,63,138,166,159,
+    44,159,226,247,191,126,108,206,197,178,250,190,124,236,87,252,234,176,195,244,191,56,225,47,
+    229,29,216,252,54,189,26,233,245,106,221,91,12,103,122,58,56,49,92,50,162,107,59,178,
+    124,95,99,137,104,206,151,176,167,98,183,121,152,252,22,98,78,26,140,130,119,91,70,81,
+    6,216,59,238,17,160,154,104,181,190,144,246,48,12,180,197,77,223,225,50,68,88,15,69,
+    127,169,78,239,212,183,143,158,104,201,137,99,8,174,54,93,104,121,73,185,251,8,230,206,
+    46,226,77,238,121,233,220,87,3,17,160,223,71,91,81,15,241,189,11,193,75,206,70,0,
+    215,152,211,110,225,116,120,213,87,127,185,212,86,86,90,1,232,139,119,161,32,2,4,16,
+    64,121,116,238,143,72,173,38,168,53,82,79,46,161,213,235,86,54,11,211,131,129,54,167,
+    1,35,174,105,97,34,236,29,193,28,6,224,93,46,115,126,228,48,81,99,244,145,194,231,
+    116,22,43,133,46,60,44,8,115,23,36,215,28,121,37,215,33,244,20,158,24,157,142,192,
+    101,28,90,212,186,253,126,8,86,46,32,0,160,141,30,243,224,89,119,140,182,58,183,106,
+    168,213,83,111,247,244,169,205,9,158,183,238,104,177,43,131,8,83,164,229,91,137,49,206,
+    146,140,135,43,76,110,35,238,25,131,14,99,8,139,190,213,239,134,245,22,239,57,161,195,
+    128,214,16,38,11,192,1,8,4,56,13,32,64,0,0,30,214,203,14,107,2,2,140,104,
+    140,223,236,241,25,241,147,110,57,172,151,25,170,2,2,148,214,240,50,202,71,196,253,206,
+    18,201,131,101,43,176,42,165,193,144,205,146,83,209,63,23,239,0,0,50,243,72,213,69,
+    2,22,106,224,245,212,233,118,109,92,178,176,36,73,98,150,72,0,254,76,119,66,231,197,
+    124,107,40,68,107,173,135,118,20,217,35,175,247,140,1,103,91,101,247,158,135,21,75,93,
+    252,158,204,181,76,78,42,77,42,175,203,178,127,221,218,124,151,0,64,36,116,187,145,219,
+    23,239,108,215,45,28,124,96,27,51,142,241,137,94,198,253,252,179,214,92,51,203,239,225,
+    222,185,132,70,125,118,74,103,254,70,241,69,83,159,191,109,42,14,205,16,39,218,32,114,
+    238,97,125,238,144,201,107,250,127,190,86,92,23,174,81,82,159,172,223,50,226,167,245,232,
+    255,4,207,167,191,69,205,84,162,158,122,17,6,26,176,229,249,107,247,216,212,145,193,45,
+    117,233,165,172,162,62,247,79,211,138,242,252,126,203,223,231,185,155,83,64,31,7,185,172,
+    199,170,122,163,159,210,84,246,16,89,31,29,235,200,185,63,198,215,203,56,50,245,253,234,
+    183,206,65,186,230,165,45,199,115,114,57,109,126,174,215,42,157,9,115,58,159,214,216,10,
+    213,6,51,166,174,149,105,102,118,181,229,56,47,171,232,84,217,251,34,219,156,28,107,93,
+    60,148,57,70,102,54,181,216,65,57,51,0,239,168,189,151,235,109,143,22,141,76,214,89,
+    49,7,116,76,174,9,255,116,238,217,183,245,125,58,133,20,228,186,194,27,234,236,111,254,
+    23,67,211,233,136,103,236,160,91,199,220,213,65,2,55,130,56,49,49,49,209,194,132,206,
+    229,208,88,171,7,68,198,137,194,232,164,223,186,180,6,16,7,48,96,103,186,217,126,12,
+    221,190,206,2,26,152,0,163,19,130,85,182,91,236,71,76,116,99,24,2,131,63,141,232,
+    246,71,104,63,180,104,68,227,154,129,19,18,17,78,162,117,133,218,115,175,7,161,237,160,
+    180,115,183,245,67,139,253,174,53,98,16,33,143,129,54,46,104,68,0,222,196,219,96,99,
+    85,176,97,107,236,203,222,47,103,22,182,120,153,13,18,231,23,93,14,139,185,95,17,246,
+    182,116,176,25,44,29,104,15,15,36,16,139,17,62,255,225,189,6,0,136,162,172,46,18,
+    8,102,26,12,168,221,221,157,166,71,10,75,146,69,44,73,34,149,122,19,213,185,210,36,
+    101,47,147,241,90,100,197,59,116,68,140,120,110,20,156,175,216,150,17,207,43,113,234,133,
+    204,174,183,131,130,132,135,79,189,111,197,239,35,82,194,200,2,67,73,24,191,138,186,164,
+    226,66,73,23,177,228,246,231,253,200,172,172,243,249,37,131,163,222,183,251,211,158,243,58,
+    95,244,182,203,252,227,161,244,108,149,219,182,108,80,224,77,182,184,208,191,198,125,139,14,
+    53,214,74,117,133,103,158,203,59,168,124,233,14,221,203,254,116,199,63,171,31,173,247,233,
+    74,214,101,253,114,251,153,123,182,130,143,134,130,12,17,111,193,229,138,156,50,207,149,93,
+    255,149,209,29,215,220,253,158,122,202,131,61,86,121,242,250,157,75,222,56,89,236,242,169,
+    151,127,93,244,80,127,90,78,46,232,122,47,150,176,229,101,234,122,209,88,162,37,207,157,
+    123,207,19,114,235,181,179,167,94,177,153,63,248,104,19,85,217,63,93,206,185,27,178,76,
+    92,184,120,198,107,117,153,235,101,29,85,59,69,76,71,91,88,138,93,70,87,123,122,136,
+    101,119,14,157,66,183,99,205,151,106,183,70,77,108,92,186,27,183,222,150,210,175,168,244,
+    138,105,14,214,70,91,189,151,81,77,196,54,213,237,121,187,221,13,177,65,188,203,229,216,
+    79,11,81,12,141,96,184,52,107,233,198,188,81,249,91,186,164,207,101,129,49,82,31,6,
+    113,104,67,152,25,125,34,32,16,64,3,173,195,244,121,98,191,47,90,210,101,79,23,218,
+    43,26,44,152,21,24,88,163,71,89,0,13,22,64,100,7,140,209,111,45,118,116,163,209,
+    141,67,195,179,249,108,107,69,117,6,80,75,136,193,200,72,12,206,116,212,31,56,50,185,
+    245,60,133,17,54,53,207,218,68,24,211,222,187,237,88,173,9,105,9,81,13,26,17,56,
+    192,5,79,103,103,83,0,0,64,110,0,0,0,0,0,0,210,174,103,13,4,0,0,0,
+    175,76,62,41,18,255,225,255,212,255,203,255,215,255,230,255,223,255,211,255,184,255,156,222,
+    213,11,134,87,158,207,143,56,22,115,124,70,226,129,1,188,116,241,194,13,42,255,23,83,
+    46,151,61,62,34,49,130,179,177,1,80,81,73,26,140,97,217,154,83,151,64,81,81,29,
+    9,128,155,65,90,233,6,157,42,112,61,117,117,187,114,21,87,38,41,22,99,147,36,193,
+    225,92,53,33,20,21,197,130,22,197,187,186,241,254,188,83,122,147,185,118,255,105,129,60,
+    223,62,255,182,87,102,186,86,191,44,0,32,44,161,94,247,172,214,90,66,20,146,170,211,
+    106,16,26,121,228,3,227,119,140,105,241,178,27,210,175,42,177,205,28,248,245,98,100,129,
+    61,198,172,234,247,250,175,109,153,98,250,90,42,107,34,14,255,159,209,167,222,113,19,199,
+    162,159,111,243,206,222,1,214,253,178,94,214,159,203,67,244,206,151,125,214,203,114,138,167,
+    222,231,123,220,141,235,79,15,147,189,151,251,117,168,195,72,155,190,100,234,251,221,148,160,
+    232,111,103,111,232,229,196,44,31,254,128,193,229,80,114,232,133,217,103,41,223,221,158,81,
+    9,158,142,122,121,178,192,170,95,39,95,191,174,196,144,133,45,145,25,25,49,145,239,13,
+    146,190,195,220,170,245,253,5,163,126,24,247,144,182,144,247,34,210,27,97,245,238,197,113,
+    11,187,188,38,115,7,184,126,174,213,179,21,205,213,219,102,237,100,14,84,123,3,160,14,
+    179,138,138,184,9,149,197,34,72,114,86,53,57,103,229,100,213,186,12,75,76,178,194,7,
+    235,138,206,20,65,66,50,56,178,198,69,44,173,88,105,146,2,204,74,215,220,9,199,19,
+    174,249,229,130,235,88,3,97,107,2,158,46,116,155,145,88,140,196,245,29,245,115,25,22,
+    145,201,253,187,50,7,12,34,104,172,36,10,70,104,93,70,0,32,26,128,51,146,193,133,
+    223,20,144,178,201,123,228,20,233,228,217,204,5,128,59,5,192,172,96,201,185,209,179,34,
+    223,175,239,7,33,208,127,54,144,221,189,217,202,185,100,5,2,78,0,215,0,242,73,36,
+    44,175,214,20,56,16,106,57,64,205,40,64,195,55,23,53,72,8,0,235,8,25,0,222,
+    5,12,134,207,130,7,117,39,92,158,251,51,82,25,26,119,10,221,2,134,195,103,193,5,
+    99,103,92,238,241,17,97,61,82,236,224,137,4,16,21,81,9,77,232,196,16,114,189,127,
+    5,0,17,21,9,216,21,5,122,158,157,231,117,199,113,210,18,75,132,144,204,36,8,220,
+    141,102,56,186,192,44,149,198,104,247,236,87,110,41,236,245,182,122,245,142,151,24,116,225,
+    157,198,20,193,255,171,42,153,0,20,206,42,204,242,104,1,7,194,76,133,217,52,124,205,
+    37,253,217,105,23,63,95,185,17,146,31,223,136,172,81,242,218,164,246,126,121,13,7,246,
+    143,14,242,179,19,204,220,210,215,194,192,195,108,59,104,87,31,243,156,183,108,93,115,233,
+    200,243,245,222,220,24,251,75,226,86,198,126,235,33,241,36,230,213,243,120,98,117,103,219,
+    237,47,135,39,219,60,231,37,138,39,159,69,125,46,196,68,223,27,219,101,58,141,21,153,
+    125,44,254,63,244,220,225,137,159,32,22,246,255,135,189,140,14,155,253,164,244,199,82,99,
+    204,51,40,88,223,206,245,97,202,40,191,28,199,48,188,217,42,119,208,87,70,46,217,111,
+    43,225,19,199,190,103,40,246,231,91,225,246,213,137,126,146,98,246,201,153,69,130,8,85,
+    123,86,249,94,42,133,9,91,230,26,70,70,39,219,48,183,173,220,67,11,177,85,127,139,
+    82,59,191,232,23,47,233,114,117,18,84,29,115,202,224,80,3,217,166,117,132,141,186,60,
+    175,151,24,169,114,239,238,18,157,145,66,2,239,144,184,73,79,175,225,10,191,43,44,145,
+    195,230,120,248,28,10,128,8,43,113,205,181,238,170,172,148,92,162,68,94,143,181,91,15,
+    11,45,100,49,76,220,153,158,125,66,63,46,164,6,136,134,200,223,187,5,26,43,61,0,
+    144,32,192,138,92,24,88,185,195,232,75,10,0,122,245,3,163,203,123,207,62,100,60,205,
+    132,62,116,116,192,0,192,204,194,52,192,153,130,61,140,7,194,222,59,218,94,102,129,133,
+    139,24,129,200,80,9,208,0,3,46,190,245,203,14,77,130,15,207,131,135,187,92,17,159,
+    51,187,11,152,29,54,9,222,214,111,213,47,247,92,35,125,230,126,1,128,88,15,58,44,
+    134,190,203,111,187,108,122,174,23,125,72,128,168,146,59,128,15,208,179,235,57,206,21,187,
+    102,73,146,20,147,137,4,224,15,146,151,67,30,107,169,68,110,58,240,194,27,250,36,127,
+    235,105,115,35,186,149,217,18,47,176,238,220,249,33,234,221,113,0,96,91,230,243,28,113,
+    211,255,14,199,100,69,79,187,35,245,185,166,77,65,226,25,77,194,111,21,70,28,51,253,
+    238,141,107,87,91,41,195,115,215,115,239,158,207,99,61,236,219,213,228,207,59,9,68,157,
+    86,216,92,119,61,61,121,44,127,69,166,238,118,83,231,47,238,100,49,69,55,101,183,68,
+    184,79,221,120,88,103,143,155,242,34,238,123,253,145,104,120,149,185,34,158,148,229,4,63,
+    218,249,147,163,226,212,239,123,50,247,36,28,80,148,118,95,184,22,123,230,147,123,255,34,
+    152,51,241,196,164,105,244,137,250,164,246,2,61,207,216,100,241,169,2,3,132,27,249,204,
+    199,242,158,151,153,47,58,248,144,119,80,170,67,136,95,57,91,15,174,206,116,237,31,127,
+    73,160,75,194,80,3,88,44,44,159,94,230,137,238,61,215,107,126,183,165,47,245,98,126,
+    115,101,23,107,218,154,195,40,236,15,3,64,119,172,110,41,254,153,187,35,23,158,239,45,
+    93,193,156,206,27,8,162,52,178,153,187,114,77,30,185,230,195,214,220,142,173,87,28,87,
+    11,16,146,234,218,169,58,152,107,114,204,245,200,235,184,193,159,42,235,22,93,55,37,212,
+    137,78,187,85,138,82,234,231,77,97,144,219,180,240,100,113,135,135,175,99,12,32,94,232,
+    24,121,213,142,14,63,104,54,89,221,8,232,55,2,90,7,160,69,208,50,160,2,224,204,
+    32,0,192,4,1,55,10,67,61,37,138,217,189,103,195,5,86,71,7,25,35,92,93,183,
+    113,215,19,42,32,54,7,168,80,63,16,0,190,5,12,55,88,4,95,172,131,151,123,214,
+    136,91,53,102,88,23,48,28,90,4,119,172,131,135,123,228,72,93,190,197,140,253,1,64,
+    69,89,29,67,236,144,125,237,126,177,242,197,99,0,136,72,102,207,243,125,128,43,175,157,
+    51,139,137,128,93,36,150,36,145,0,148,204,181,193,40,74,189,183,223,243,133,12,42,87,
+    217,170,248,188,146,221,146,187,4,163,221,75,205,70,22,18,128,38,46,228,197,98,31,121,
+    252,194,133,76,54,136,197,122,214,161,120,242,219,213,107,21,150,231,159,170,158,253,238,137,
+    118,151,249,125,124,226,243,49,14,186,169,39,90,15,242,73,189,206,135,30,232,206,159,174,
+    203,19,143,32,11,183,202,93,185,232,225,18,237,254,162,196,149,125,79,110,167,163,177,2,
+    227,115,141,71,41,247,165,122,124,176,193,89,46,223,172,220,171,139,190,92,126,20,250,211,
+    27,95,23,217,156,152,75,95,122,61,55,21,195,26,163,156,174,155,221,211,175,103,215,198,
+    219,107,203,227,24,54,37,133,203,183,203,9,60,244,55,62,117,191,158,159,135,249,67,139,
+    130,125,251,109,46,238,169,165,190,151,121,69,13,69,241,98,245,166,237,114,255,229,219,86,
+    114,203,107,191,122,247,210,7,83,43,216,85,65,207,230,249,208,240,118,149,37,135,211,117,
+    215,153,123,6,167,40,21,131,120,235,110,67,252,47,255,94,240,39,130,122,40,185,19,183,
+    75,34,57,101,126,238,212,129,200,250,18,244,81,88,125,244,3,123,171,149,240,235,25,86,
+    81,66,24,234,230,164,9,65,236,241,67,23,86,6,211,178,137,24,78,19,34,167,127,94,
+    148,211,25,224,121,59,99,181,89,172,243,212,116,56,178,30,7,51,10,146,138,10,25,218,
+    209,65,172,51,170,7,101,186,97,229,74,93,232,78,48,34,132,22,59,130,68,8,19,38,
+    128,46,127,219,47,42,3,0,39,69,235,202,129,165,15,79,232,167,17,154,95,90,63,164,
+    66,45,66,215,30,173,219,82,79,91,88,12,49,50,126,251,109,136,2,53,74,159,69,253,
+    196,10,190,21,12,134,22,238,47,110,198,98,15,145,122,135,91,54,195,182,130,246,224,194,
+    243,251,142,151,211,68,226,227,116,53,195,125,1,0,147,34,217,251,3,183,213,250,1,151,
+    209,95,54,103,3,4,176,227,131,121,1,88,0,38,106,119,218,185,72,145,89,88,4,146,
+    4,0,96,147,41,172,29,66,85,74,120,134,167,27,171,156,162,183,45,223,252,254,98,210,
+    92,126,236,104,147,216,16,241,119,226,82,105,135,248,102,6,21,221,73,245,125,103,249,188,
+    161,93,149,75,206,169,229,83,83,111,154,244,141,158,7,213,200,199,249,116,92,156,119,67,
+    159,52,205,98,199,7,163,238,242,222,91,145,167,214,133,247,214,114,95,222,151,149,195,58,
+    14,189,168,236,231,35,31,179,93,87,22,197,115,158,203,113,72,49,22,247,172,229,111,110,
+    188,53,171,221,182,142,159,65,100,85,116,40,185,89,120,201,10,179,220,15,181,2,29,92,
+    215,248,204,202,37,226,188,239,151,75,127,200,218,138,11,217,16,146,55,25,185,114,144,108,
+    60,117,217,239,249,141,44,37,102,213,197,18,203,167,247,77,169,185,63,127,61,119,221,221,
+    225,92,110,101,122,125,169,107,68,22,60,247,188,88,66,164,158,25,112,126,52,243,143,122,
+    83,125,247,137,47,229,184,101,238,141,200,91,83,41,67,139,70,223,183,134,72,38,0,30,
+    220,43,113,231,38,79,181,8,0,119,133,32,43,230,151,139,74,77,194,114,213,89,99,33,
+    44,106,183,66,117,92,7,215,185,113,150,194,90,74,7,124,151,219,87,159,64,87,98,165,
+    167,80,148,49,17,98,191,119,97,165,23,248,226,97,54,249,45,7,17,136,147,195,88,21,
+    4,0,132,200,216,45,215,45,147,186,237,45,71,161,210,35,175,205,77,43,239,61,187,67,
+    90,71,125,184,208,211,142,103,253,208,29,207,58,83,19,102,244,131,49,212,95,15,251,142,
+    228,138,104,19,38,202,208,140,139,2,171,247,145,80,148,9,237,133,136,9,26,19,21,107,
+    162,85,26,92,66,220,139,182,39,204,254,247,85,98,136,86,28,161,163,35,13,97,220,17,
+    158,104,93,49,54,130,15,190,21,12,134,45,130,59,214,131,135,51,69,220,246,186,95,86,
+    208,30,90,5,39,172,27,15,187,136,248,82,89,82,222,15,128,40,170,42,3,25,189,145,
+    191,91,23,186,251,62,179,161,12,0,80,239,0,62,184,241,102,207,77,163,139,235,50,102,
+    51,138,197,17,129,4,0,64,218,37,202,41,10,18,106,10,197,3,204,116,216,26,53,29,
+    207,238,45,166,220,191,129,211,31,187,100,159,44,149,146,4,80,232,147,110,216,8,250,133,
+    192,106,123,94,123,37,214,46,204,230,197,206,168,91,20,159,39,82,226,22,93,163,192,108,
+    247,81,57,85,60,89,235,119,172,205,71,177,208,159,155,251,223,222,246,139,6,43,115,242,
+    121,223,23,245,222,1,211,161,197,56,183,169,177,142,172,28,230,62,15,253,169,138,251,248,
+    55,126,155,245,61,254,214,162,89,135,207,133,250,88,66,98,25,215,201,40,136,140,207,101,
+    194,226,140,146,139,91,49,127,23,199,197,126,236,157,37,47,229,163,236,149,26,103,159,184,
+    207,156,206,243,188,198,130,140,125,220,173,149,243,177,244,67,35,247,175,103,87,137,54,219,
+    92,158,235,225,250,110,66,93,175,27,200,224,151,107,251,47,90,52,160,222,236,51,225,194,
+    219,204,242,68,182,92,141,189,73,129,50,196,143,170,185,148,223,61,156,161,153,97,46,220,
+    87,56,25,175,214,246,225,185,40,29,23,104,57,142,83,173,231,197,93,28,199,59,190,123,
+    69,170,84,78,77,173,46,116,235,220,178,184,186,181,151,234,188,84,95,173,190,124,109,169,
+    109,48,181,242,239,69,31,107,241,98,146,13,165,0,0,187,89,89,102,203,68,143,147,49,
+    235,242,183,35,70,122,52,58,49,88,1,184,72,187,201,10,158,237,109,69,60,223,226,143,
+    148,77,63,62,1,128,72,127,217,214,146,229,0,188,11,136,213,58,91,17,253,209,183,58,
+    79,199,19,117,158,110,81,186,193,233,9,88,93,57,83,158,215,137,73,206,25,219,29,246,
+    234,104,237,94,11,60,15,95,55,132,25,173,164,73,45,196,208,219,115,62,142,47,244,71,
+    167,33,16,180,11,190,37,12,135,118,193,79,231,143,15,223,185,67,175,73,161,87,194,204,
+    240,195,111,52,136,15,239,51,157,242,73,209,63,0,169,230,130,96,101,204,214,79,202,140,
+    184,142,121,3,88,120,0,159,27,44,5,176,0,120,11,64,85,186,77,22,73,146,216,140,
+    4,0,73,188,164,84,26,9,213,12,8,219,130,51,38,178,248,230,170,223,144,231,205,20,
+    77,133,131,210,185,78,197,230,166,14,23,154,87,255,58,27,24,31,108,162,89,31,154,96,
+    199,215,78,23,245,143,69,147,182,61,10,210,252,144,33,179,106,72,130,113,212,0,90,86,
+    149,149,124,58,11,98,48,163,247,134,162,123,139,176,46,178,81,110,254,157,152,189,29,131,
+    223,152,172,90,215,175,119,119,98,199,252,233,4,209,246,204,203,114,190,237,203,63,247,203,
+    2,167,158,142,247,231,34,107,213,129,85,139,20,184,244,156,201,193,114,121,198,230,179,185,
+    125,48,26,249,120,18,151,206,215,102,241,22,165,116,225,69,173,157,157,239,242,114,196,233,
+    198,34,118,100,54,75,118,246,82,250,90,35,214,67,174,63,93,148,68,207,255,76,110,222,
+    92,246,222,22,199,194,82,185,63,79,113,174,75,197,10,106,20,217,86,212,53,19,44,197,
+    77,71,91,93,110,99,143,47,107,195,224,30,91,184,37,196,110,20,181,75,69,53,187,110,
+    134,91,91,15,168,80,221,85,191,202,138,235,104,213,85,243,24,214,22,115,87,71,180,156,
+    219,46,93,57,110,233,171,210,109,178,33,129,198,109,69,196,53,209,13,67,191,33,87,148,
+    200,121,199,10,161,31,59,158,50,236,253,191,220,11,65,182,216,218,218,74,142,231,105,0,
+    0,7,155,113,221,9,16,8,214,89,219,179,156,241,79,125,158,71,23,120,122,2,253,219,
+    2,30,184,79,21,40,140,208,81,73,115,192,27,161,62,210,239,247,195,214,104,77,221,106,
+    237,136,33,182,158,35,180,120,250,82,39,12,15,167,167,97,8,3,96,92,140,208,250,49,
+    116,52,134,225,58,194,16,61,186,125,198,49,194,128,10,222,229,179,194,173,111,114,33,124,
+    250,54,17,159,242,93,217,242,89,3,187,63,233,74,250,52,154,8,159,33,226,7,64,89,
+    131,200,140,3,99,172,199,181,175,53,122,222,183,87,223,2,240,236,141,4,54,64,189,3,
+    248,0,30,117,234,196,121,21,150,88,130,136,197,34,1,0,128,114,78,178,80,162,130,117,
+    117,126,45,184,240,30,141,202,230,105,251,81,67,57,15,58,116,238,96,114,32,193,54,182,
+    229,241,239,124,249,132,134,170,241,29,85,69,232,99,42,187,145,199,227,216,56,13,46,228,
+    23,13,150,155,33,53,144,173,5,73,14,82,144,113,0,182,117,254,2,235,221,95,34,185,
+    254,150,239,116,118,237,206,115,191,118,28,29,150,215,86,73,143,132,158,121,102,127,30,146,
+    24,251,164,147,188,182,189,71,245,209,105,14,193,178,181,95,120,207,223,221,111,190,234,47,
+    199,253,189,99,135,111,191,169,125,123,213,24,231,7,165,47,43,162,143,141,38,239,53,151,
+    165,151,154,223,220,47,59,172,147,205,176,243,89,93,205,40,150,251,180,247,109,234,78,180,
+    47,60,239,12,53,214,98,243,36,233,75,223,200,124,116,117,243,133,103,223,160,217,248,3,
+    37,44,45,85,86,99,2,106,174,235,44,35,235,112,117,89,156,217,49,0,116,244,55,167,
+    241,150,190,179,120,44,107,11,6,179,84,160,251,166,49,79,12,147,229,127,53,78,233,95,
+    221,190,0,210,125,234,122,134,117,174,146,226,189,138,177,180,96,137,118,78,105,65,212,197,
+    235,138,177,46,249,239,115,61,59,245,54,252,253,201,42,144,93,223,34,223,7,116,56,251,
+    191,234,247,43,78,12,0,112,18,192,77,2,161,24,128,234,21,16,163,168,21,14,9,166,
+    107,234,229,142,208,157,20,250,253,209,100,140,87,64,12,18,131,81,69,142,213,212,134,25,
+    2,151,120,19,217,169,103,140,136,109,52,70,24,0,68,167,137,162,32,2,3,0,190,20,
+    204,109,112,241,77,77,240,233,96,149,117,43,200,103,78,191,208,21,191,204,38,194,115,117,
+    207,63,0,25,21,153,57,59,31,250,30,145,189,123,255,44,238,219,159,184,2,224,106,184,
+    129,29,96,7,232,5,192,115,213,113,29,147,73,34,69,16,3,0,0,128,151,144,13,69,
+    124,52,24,180,242,238,95,115,135,223,63,123,248,215,44,190,44,16,151,116,230,100,186,235,
+    24,28,208,125,189,231,75,215,119,235,37,8,136,63,212,209,121,177,60,228,64,42,143,235,
+    144,253,70,206,143,127,108,36,73,146,48,48,171,255,129,244,179,211,40,203,60,228,130,68,
+    196,162,250,207,156,141,171,254,107,233,90,99,109,150,249,7,251,67,177,159,61,90,188,254,
+    189,60,23,187,243,238,125,79,134,160,225,188,31,205,54,217,51,251,238,173,140,11,151,229,
+    221,67,221,126,50,143,224,121,159,206,207,160,233,176,165,84,47,212,27,34,131,58,108,169,
+    159,231,158,225,141,140,107,255,122,242,186,217,164,216,155,23,149,49,246,101,243,149,123,198,
+    62,239,107,165,59,228,137,237,249,250,37,97,39,231,49,94,219,185,206,112,137,159,45,151,
+    156,136,40,14,167,19,218,193,23,5,185,221,63,82,255,68,244,199,175,189,128,117,102,165,
+    211,213,238,171,172,143,87,112,235,45,202,3,103,22,43,103,153,240,51,185,158,159,203,226,
+    148,122,81,66,9,37,194,178,161,205,228,213,111,214,23,78,177,26,190,38,213,27,246,51,
+    64,22,30,127,167,189,79,10,103,43,121,185,163,236,244,230,215,61,247,198,245,232,51,238,
+    220,245,253,234,63,109,79,7,243,128,11,172,12,156,4,140,22,105,35,130,33,2,24,1,
+    208,7,116,170,64,140,209,36,20,234,28,139,118,117,153,105,7,86,98,237,142,233,64,12,
+    136,79,103,103,83,0,4,51,129,0,0,0,0,0,0,210,174,103,13,5,0,0,0,118,
+    18,22,56,10,255,177,255,176,255,186,255,190,255,220,222,53,36,135,93,69,98,218,132,223,
+    237,38,252,83,42,108,13,173,129,167,136,205,139,242,225,110,66,109,244,225,1,1,101,89,
+    180,62,253,125,69,127,184,175,242,22,226,151,30,28,227,136,0,225,81,131,5,20,104,220,
+    192,219,1,168,237,249,168,33,93,149,162,115,36,138,57,36,0,0,0,0,72,78,132,108,
+    234,146,247,112,201,97,12,133,181,137,116,56,215,76,239,190,15,167,9,144,220,54,109,190,
+    206,103,232,250,195,11,45,211,64,155,125,43,218,132,76,107,58,138,163,189,122,65,138,44,
+    136,77,224,195,141,210,139,225,235,143,29,197,19,109,20,185,189,129,61,177,61,55,170,106,
+    161,239,70,69,3,221,52,112,254,221,100,228,15,235,112,181,140,135,235,35,51,243,167,101,
+    148,190,253,9,33,155,207,47,123,116,243,139,139,133,8,100,213,142,71,123,243,215,241,37,
+    214,190,138,247,238,88,150,181,14,76,75,222,115,246,223,229,89,3,47,58,149,6,178,18,
+    88,46,185,213,162,249,244,164,113,239,228,207,149,51,202,211,93,121,89,215,225,157,241,91,
+    206,194,250,121,56,186,19,27,233,251,149,162,185,253,164,209,147,185,247,62,29,247,228,183,
+    25,46,184,251,88,124,233,92,97,57,211,36,109,151,81,216,114,127,105,210,242,159,109,205,
+    47,226,90,113,115,174,101,245,26,175,77,4,36,1,76,167,34,147,62,77,102,115,183,34,
+    72,254,100,118,111,186,62,41,102,38,127,237,112,8,84,168,195,229,236,9,166,214,177,214,
+    47,26,229,184,118,18,68,70,148,155,120,11,100,233,155,166,0,117,196,144,145,241,73,6,
+    213,35,167,217,209,243,110,140,165,252,41,123,210,106,119,238,13,0,0,238,39,164,59,0,
+    12,208,208,186,113,3,56,125,248,0,18,0,212,96,192,152,72,209,128,114,24,198,21,169,
+    43,161,112,18,61,186,151,90,129,186,140,168,213,12,94,53,84,135,238,34,23,95,202,47,
+    167,53,171,120,163,134,193,240,135,136,181,22,15,167,36,103,22,223,21,64,22,243,248,28,
+    205,140,121,93,26,214,167,184,172,150,120,223,46,11,128,190,21,192,134,15,124,128,29,96,
+    3,160,78,27,64,199,243,168,196,20,75,146,4,0,0,0,32,153,118,98,228,77,176,94,
+    252,242,86,196,60,38,142,12,222,61,196,63,43,172,230,251,119,109,108,233,20,224,151,203,
+    238,127,75,240,227,23,27,89,43,221,184,221,46,172,221,218,210,22,237,214,123,246,186,73,
+    65,139,157,182,146,80,153,11,167,253,6,218,180,24,192,79,234,67,253,176,38,211,242,184,
+    216,193,220,27,4,79,179,57,182,53,111,54,73,26,153,139,150,144,231,218,104,105,218,221,
+    233,90,71,20,118,229,247,156,226,185,249,103,30,200,129,86,127,22,229,32,205,202,70,60,
+    115,107,124,229,245,92,31,47,135,251,206,109,138,117,244,1,202,34,255,118,165,158,12,42,
+    231,95,82,38,218,247,110,136,92,127,11,106,165,216,211,217,41,254,39,103,10,202,253,229,
+    26,65,231,119,52,211,16,109,175,15,193,236,36,243,228,147,29,105,75,49,166,248,36,83,
+    247,251,115,98,32,83,40,15,175,92,110,118,155,128,115,34,127,38,53,145,203,112,71,115,
+    9,178,70,190,21,137,121,254,118,49,158,14,193,116,86,41,149,107,0,177,14,31,170,92,
+    112,75,206,131,108,235,119,82,26,251,106,73,201,92,95,190,221,254,110,124,138,28,78,78,
+    103,159,236,56,255,76,31,76,171,249,88,78,126,120,86,230,177,155,167,84,158,254,23,147,
+    145,57,151,109,219,22,248,43,11,52,207,202,191,84,47,3,136,221,129,130,28,255,215,54,
+    239,222,67,177,92,166,194,245,238,23,100,199,247,159,149,88,86,202,79,157,102,41,199,142,
+    74,181,163,176,144,78,239,103,7,139,87,224,2,62,53,84,135,61,68,102,186,120,184,71,
+    73,181,103,254,241,77,13,173,161,135,200,216,151,244,203,158,69,147,138,247,10,96,79,211,
+    56,122,116,231,206,57,151,62,46,35,155,29,227,232,47,128,94,20,106,14,128,27,48,109,
+    0,7,0,128,203,228,210,83,85,177,83,76,18,0,0,0,0,0,73,111,159,67,43,44,
+    193,222,179,194,60,255,91,158,237,190,140,157,221,30,180,158,93,123,128,234,20,16,117,202,
+    250,242,222,248,55,195,159,248,254,84,132,63,241,146,7,243,134,174,143,82,135,161,171,107,
+    223,236,121,182,111,149,183,227,182,150,107,174,191,235,230,35,187,113,41,134,29,130,207,8,
+    32,45,76,165,1,104,62,229,201,88,140,117,221,125,7,46,172,232,174,183,53,108,62,168,
+    122,244,18,93,46,128,240,246,170,86,207,235,180,108,59,111,151,73,125,174,112,157,122,201,
+    205,211,101,244,217,121,58,105,227,129,15,75,78,70,169,84,215,89,100,2,125,134,39,166,
+    180,62,166,71,175,71,229,7,15,92,226,104,61,120,143,92,221,217,31,234,190,245,92,46,
+    191,185,95,127,197,222,187,248,138,220,208,4,196,143,253,232,117,205,214,99,31,139,244,228,
+    5,125,60,185,131,38,241,230,160,54,191,215,182,45,218,222,36,120,140,11,111,155,236,60,
+    116,100,1,155,9,134,172,38,200,199,18,29,194,161,114,133,68,9,16,131,34,231,87,188,
+    57,39,56,87,32,24,22,207,223,31,44,212,252,41,255,238,253,78,203,72,93,181,73,221,
+    241,221,106,125,153,247,255,30,194,226,211,240,200,246,174,251,209,124,20,24,219,117,175,147,
+    199,100,202,19,55,134,63,128,222,193,142,203,46,249,11,0,52,192,0,240,35,56,28,170,
+    125,229,9,14,44,36,103,3,66,147,63,130,111,79,218,60,221,146,153,241,186,227,230,253,
+    180,181,227,97,214,228,138,55,241,212,239,37,223,30,124,86,65,194,229,117,145,1,126,53,
+    36,6,174,34,65,95,202,195,212,156,183,208,53,228,194,135,136,37,150,252,176,219,12,255,
+    43,118,115,197,184,134,222,187,105,68,28,12,60,69,142,253,245,125,139,62,238,254,55,123,
+    195,64,239,161,90,160,222,0,60,111,166,182,231,85,103,12,59,51,197,20,18,0,0,24,
+    92,221,196,50,132,189,17,242,239,30,127,26,67,203,59,246,173,131,35,139,14,23,14,174,
+    42,207,220,133,221,46,154,144,10,171,223,159,191,111,169,203,240,171,39,128,179,249,98,201,
+    252,134,228,252,179,212,37,201,231,29,150,171,93,238,115,215,170,228,145,253,203,50,135,80,
+    66,118,254,174,219,51,69,141,122,201,85,215,62,74,79,114,63,114,32,27,250,254,165,213,
+    198,138,139,144,149,203,254,189,174,199,235,80,209,241,33,63,203,216,135,241,171,139,232,207,
+    190,35,30,18,68,100,8,38,125,40,231,255,35,33,168,171,247,232,229,129,206,63,231,247,
+    222,17,39,185,231,140,237,117,184,62,127,54,115,205,104,102,2,77,198,103,242,112,24,114,
+    225,194,103,71,119,72,246,178,46,5,228,135,14,104,227,162,110,90,27,121,101,101,46,233,
+    54,137,230,240,154,243,0,195,132,164,103,122,92,250,223,13,197,166,79,146,223,2,186,121,
+    18,138,250,154,44,157,121,61,235,68,63,185,44,203,115,121,68,47,224,71,205,70,92,107,
+    233,199,187,128,150,142,226,139,161,185,154,229,91,122,58,104,209,106,73,234,96,23,186,201,
+    38,220,220,30,45,153,112,118,210,127,219,237,118,23,209,165,227,202,106,185,47,243,140,59,
+    224,199,34,53,1,116,255,207,230,208,60,126,76,100,163,86,185,191,82,38,109,213,22,160,
+    73,224,41,171,188,98,131,199,199,100,247,60,72,173,212,194,141,241,81,155,148,1,238,153,
+    250,145,230,158,111,85,185,46,20,107,222,225,111,12,100,63,23,234,157,95,210,98,38,113,
+    231,104,147,158,230,175,183,57,174,90,0,222,53,148,234,205,63,74,195,203,25,39,252,115,
+    235,99,11,136,51,207,251,215,137,240,178,163,176,107,199,60,198,249,37,231,207,111,172,113,
+    62,95,49,110,215,142,113,187,159,107,94,84,22,123,157,215,125,62,247,218,107,143,158,49,
+    141,158,235,10,192,188,3,208,0,70,215,237,92,37,49,102,153,55,164,144,0,0,192,140,
+    62,147,62,220,208,78,157,192,121,75,76,187,182,109,132,91,72,154,188,207,180,54,170,251,
+    196,87,234,245,247,105,51,33,112,201,225,80,78,16,151,128,155,147,215,179,37,133,169,129,
+    48,25,169,52,205,152,119,179,139,249,102,251,121,122,181,30,29,170,217,204,61,137,243,179,
+    230,254,245,254,221,143,66,139,34,227,112,88,231,247,215,189,43,67,101,52,204,65,41,61,
+    190,123,103,123,135,187,135,239,139,183,191,156,159,171,168,248,56,221,233,219,186,255,145,171,
+    61,111,216,63,155,5,210,163,115,199,116,201,31,255,159,157,145,113,189,124,121,125,13,76,
+    6,38,139,126,126,251,4,68,246,115,127,148,145,49,231,253,9,187,127,255,182,20,229,229,
+    76,79,147,196,217,189,56,149,245,228,114,189,100,198,153,172,207,2,119,205,152,186,92,191,
+    190,123,145,17,101,145,28,49,107,125,127,254,69,65,156,253,123,238,147,42,235,57,151,210,
+    177,142,12,166,247,121,103,144,81,123,219,213,255,191,103,234,247,111,171,116,25,217,108,45,
+    239,115,145,122,86,18,106,164,127,252,44,179,15,229,148,173,229,229,99,253,254,60,43,202,
+    14,62,46,0,36,81,219,226,29,173,109,57,151,173,244,10,227,247,171,17,86,139,113,203,
+    92,238,249,108,117,43,0,0,245,93,149,157,179,149,156,180,178,162,116,57,101,71,217,28,
+    224,173,192,197,241,56,126,207,255,223,121,155,79,149,167,58,234,229,190,83,203,125,127,98,
+    126,251,4,235,37,89,174,11,235,235,189,112,125,189,151,88,31,247,102,61,236,53,170,101,
+    230,111,166,149,79,50,7,248,238,147,183,50,22,56,62,51,251,80,250,254,140,120,51,57,
+    61,10,108,153,115,0,
+};
+
+// assets/sounds/sfx_hit.ogg
+static const Uint8 AB_DATA_3[] = {
+    79,103,103,83,0,2,0,0,0,0,0,0,0,0,51,199,31,43,0,0,0,0,2,60,
+    218,151,1,30,1,118,111,114,98,105,115,0,0,0,0,2,68,172,0,0,0,0,0,0,
+    0,238,2,0,0,0,0,0,184,1,79,103,103,83,0,0,0,0,0,0,0,0,0,0,
+    51,199,31,43,1,0,0,0,115,99,165,179,16,61,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,113,3,118,111,114,98,105,115,45,0,0,0,88,105,112,104,46,79,114,103,
+    32,108,105,98,86,111,114,98,105,115,32,73,32,50,48,49,48,49,49,48,49,32,40,83,
+    99,104,97,117,102,101,110,117,103,103,101,116,41,0,0,0,0,1,5,118,111,114,98,105,
+    115,43,66,67,86,1,0,8,0,0,0,49,76,32,197,128,208,144,85,0,0,16,0,0,
+    96,36,41,14,147,102,73,41,165,148,161,40,121,152,148,72,73,41,165,148,197,48,137,152,
+    148,137,197,24,99,140,49,198,24,99,140,49,198,24,99,140,32,52,100,21,0,0,4,0,
+    128,40,9,142,163,230,73,106,206,57,103,24,39,142,114,160,57,105,78,56,167,32,7,138,
+    81,224,57,9,194,245,38,99,110,166,180,166,107,110,206,41,37,8,13,89,5,0,0,2,
+    0,64,72,33,133,20,82,72,33,133,20,98,136,33,134,24,98,136,33,135,28,114,200,33,
+    167,156,114,10,42,168,160,130,10,50,200,32,131,76,50,233,164,147,78,58,233,168,163,142,
+    58,234,40,180,208,66,11,45,180,210,74,76,49,213,86,99,174,189,6,93,124,115,206,57,
+    231,156,115,206,57,231,156,115,206,9,66,67,86,1,0,32,0,0,4,66,6,25,100,16,
+    66,8,33,133,20,82,136,41,166,152,114,10,50,200,128,208,144,85,0,0,32,0,128,0,
+    0,0,0,71,145,20,73,177,20,203,177,28,205,209,36,79,242,44,81,19,53,209,51,69,
+    83,84,77,85,85,85,85,117,93,87,118,101,215,118,117,215,118,125,89,152,133,91,184,125,
+    89,184,133,91,216,133,93,247,133,97,24,134,97,24,134,97,24,134,97,248,125,223,247,125,
+    223,247,125,32,52,100,21,0,32,1,0,160,35,57,150,227,41,162,34,26,162,226,57,162,
+    3,132,134,172,2,0,100,0,0,4,0,32,9,146,34,41,146,163,73,166,102,106,174,105,
+    155,182,104,171,182,109,203,178,44,203,178,12,132,134,172,2,0,0,1,0,4,0,0,0,
+    0,0,160,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,102,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,64,104,200,42,0,64,2,0,64,199,113,
+    28,199,113,36,69,82,36,199,114,44,7,8,13,89,5,0,200,0,0,8,0,64,82,44,
+    197,114,52,71,115,52,199,115,60,199,115,60,71,116,68,201,148,76,205,244,76,15,8,13,
+    89,5,0,0,2,0,8,0,0,0,0,0,64,49,28,197,113,28,201,209,36,79,82,45,
+    211,114,53,87,115,61,215,115,77,215,117,93,87,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,129,
+    208,144,85,0,0,4,0,0,33,157,102,150,106,128,8,51,144,97,32,52,100,21,0,128,
+    0,0,0,24,161,8,67,12,8,13,89,5,0,0,4,0,0,136,161,228,32,154,208,154,
+    243,205,57,14,154,229,160,169,20,155,211,193,137,84,155,39,185,169,152,155,115,206,57,231,
+    156,108,206,25,227,156,115,206,41,202,153,197,160,153,208,154,115,206,73,12,154,165,160,153,
+    208,154,115,206,121,18,155,7,173,169,210,154,115,206,25,231,156,14,198,25,97,156,115,206,
+    105,210,154,7,169,217,88,155,115,206,89,208,154,230,168,185,20,155,115,206,137,148,155,39,
+    181,185,84,155,115,206,57,231,156,115,206,57,231,156,115,206,169,94,156,206,193,57,225,156,
+    115,206,137,218,155,107,185,9,93,156,115,206,249,100,156,238,205,9,225,156,115,206,57,231,
+    156,115,206,57,231,156,115,206,9,66,67,86,1,0,64,0,0,4,97,216,24,198,157,130,
+    32,125,142,6,98,20,33,166,33,147,30,116,143,14,147,160,49,200,41,164,30,141,142,70,
+    74,169,131,80,82,25,39,165,116,130,208,144,85,0,0,32,0,0,132,16,82,72,33,133,
+    20,82,72,33,133,20,82,72,33,134,24,98,136,33,167,156,114,10,42,168,164,146,138,42,
+    202,40,179,204,50,203,44,179,204,50,203,172,195,206,58,235,176,195,16,67,12,49,180,210,
+    74,44,53,213,86,99,141,181,230,158,115,174,57,72,107,165,181,214,90,43,165,148,82,74,
+    41,165,32,52,100,21,0,0,2,0,64,32,100,144,65,6,25,133,20,82,72,33,134,152,
+    114,202,41,167,160,130,10,8,13,89,5,0,0,2,0,8,0,0,0,240,36,207,17,29,
+    209,17,29,209,17,29,209,17,29,209,17,29,207,241,28,81,18,37,81,18,37,209,50,45,
+    83,51,61,85,84,85,87,118,109,89,151,117,219,183,133,93,216,117,223,215,125,223,215,141,
+    95,23,134,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,9,66,67,86,1,
+    0,32,0,0,0,66,8,33,132,20,82,72,33,133,148,98,140,49,199,156,131,78,66,9,
+    129,208,144,85,0,0,32,0,128,0,0,0,0,71,113,20,199,145,28,201,145,36,75,178,
+    36,77,210,44,205,242,52,79,243,52,209,19,69,81,52,77,83,21,93,209,21,117,211,22,
+    101,83,54,93,211,53,101,211,85,101,213,118,101,217,182,101,91,183,125,89,182,125,223,247,
+    125,223,247,125,223,247,125,223,247,125,223,215,117,32,52,100,21,0,32,1,0,160,35,57,
+    146,34,41,146,34,57,142,227,72,146,4,132,134,172,2,0,100,0,0,4,0,160,40,142,
+    226,56,142,35,73,146,36,89,146,38,121,150,103,137,154,169,153,158,233,169,162,10,132,134,
+    172,2,0,0,1,0,4,0,0,0,0,0,160,104,138,167,152,138,167,136,138,231,136,142,
+    40,137,150,105,137,154,170,185,162,108,202,174,235,186,174,235,186,174,235,186,174,235,186,174,
+    235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,64,
+    104,200,42,0,64,2,0,64,71,114,36,71,114,36,69,82,36,69,114,36,7,8,13,89,
+    5,0,200,0,0,8,0,192,49,28,67,82,36,199,178,44,77,243,52,79,243,52,209,19,
+    61,209,51,61,85,116,69,23,8,13,89,5,0,0,2,0,8,0,0,0,0,0,192,144,
+    12,75,177,28,205,209,36,81,82,45,213,82,53,213,82,45,85,84,61,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,213,52,77,211,52,129,208,144,149,0,0,25,0,0,2,41,197,154,132,80,
+    146,65,78,74,236,69,105,198,32,7,173,6,229,41,132,24,147,216,139,233,152,66,200,81,
+    80,42,100,12,25,228,64,201,212,49,134,16,243,98,99,167,20,66,204,139,241,165,115,140,
+    65,47,198,184,82,66,40,193,8,66,67,86,4,0,81,0,0,6,73,34,73,36,73,242,
+    52,162,72,244,36,205,35,138,60,17,128,36,122,60,143,231,73,158,200,243,120,30,0,73,
+    20,121,30,207,147,68,145,231,241,60,1,0,0,1,14,0,0,1,22,66,161,33,43,2,
+    128,56,1,0,139,36,121,30,73,242,60,146,228,121,52,77,20,33,138,146,166,137,34,207,
+    51,77,158,102,138,76,83,85,161,170,146,166,137,34,207,51,77,154,39,154,76,83,85,161,
+    170,158,40,170,42,85,117,93,170,233,186,100,219,182,97,203,158,40,170,42,85,117,93,166,
+    234,186,108,217,182,33,219,0,0,0,36,79,83,77,154,102,154,52,205,52,137,162,106,66,
+    85,37,205,51,85,154,102,154,52,205,52,137,162,169,66,85,61,83,116,93,166,233,186,76,
+    211,117,185,174,44,67,150,61,209,116,93,166,169,186,76,211,117,185,174,44,67,150,1,0,
+    0,72,158,167,170,52,205,52,105,154,105,18,69,83,133,106,74,158,167,170,52,205,52,105,
+    154,105,18,69,85,133,169,122,166,233,186,76,211,117,153,166,235,114,101,89,134,45,123,166,
+    233,186,76,211,117,153,166,235,146,93,89,134,44,3,0,0,208,76,211,150,137,162,236,18,
+    69,215,101,154,174,11,215,213,76,83,182,137,162,43,19,69,215,101,154,174,11,215,21,85,
+    213,150,169,166,45,83,85,89,230,186,178,12,89,22,85,85,182,153,170,108,83,85,89,230,
+    186,178,12,89,6,0,0,0,0,0,0,0,0,128,168,170,182,77,85,101,153,106,202,50,
+    215,149,101,200,178,168,170,182,77,85,101,153,169,202,50,215,181,101,200,178,0,0,128,1,
+    7,0,128,0,19,202,64,161,33,43,1,128,40,0,0,135,226,88,150,166,137,34,199,177,
+    44,77,19,77,142,99,89,154,102,138,36,73,211,60,207,52,161,89,158,103,154,208,52,81,
+    84,85,104,154,40,170,42,0,0,2,0,0,10,28,0,0,2,108,208,148,88,28,160,208,
+    144,149,0,64,72,0,128,195,113,44,75,211,60,207,243,68,81,52,77,147,227,88,150,231,
+    137,162,40,154,166,105,170,42,199,177,44,207,19,69,81,52,77,211,84,85,150,165,105,158,
+    39,138,162,104,154,170,170,170,208,52,207,19,69,81,52,77,85,85,85,104,154,40,154,166,
+    105,170,170,170,186,46,52,77,20,77,211,52,85,85,85,93,23,154,230,121,162,104,154,170,
+    234,186,174,11,60,79,20,77,83,85,93,215,117,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,4,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,9,23,
+    30,128,66,67,86,4,0,81,0,0,128,49,136,49,197,152,81,10,66,41,37,52,74,65,
+    9,37,148,10,66,105,169,164,148,73,72,173,181,214,50,41,169,181,214,90,37,165,180,150,
+    90,203,160,164,214,90,107,153,132,214,90,107,173,0,0,176,3,7,0,176,3,11,161,208,
+    144,149,0,64,30,0,0,130,140,82,140,57,231,28,53,70,41,198,156,115,142,26,163,20,
+    99,206,57,71,149,82,202,57,231,32,164,148,42,197,156,115,14,82,74,25,115,206,57,231,
+    40,165,140,57,231,156,115,148,82,231,156,115,206,57,74,169,148,206,57,231,28,165,84,74,
+    231,156,115,142,82,42,37,99,206,57,39,0,0,168,192,1,0,32,192,70,145,205,9,70,
+    130,10,13,89,9,0,164,2,0,24,28,199,178,60,207,243,76,209,52,45,73,210,52,81,
+    20,69,211,84,85,75,146,52,77,20,77,81,53,85,149,101,105,154,40,154,166,170,186,46,
+    77,211,52,81,52,77,85,117,93,170,234,121,166,169,170,174,235,186,84,87,244,76,83,85,
+    93,87,150,1,0,0,0,0,0,0,0,0,0,1,0,224,9,14,0,64,5,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,3,0,0,49,6,33,100,12,66,200,24,132,20,66,
+    8,41,165,16,18,0,0,48,224,0,0,16,96,66,25,40,52,100,37,0,144,10,0,0,
+    24,163,148,115,206,73,73,165,66,136,49,231,32,148,210,82,133,16,99,206,65,40,165,165,
+    168,49,198,32,148,146,82,107,81,99,140,65,40,37,165,214,162,107,33,148,146,82,74,173,
+    69,215,66,40,37,165,214,90,139,82,170,84,74,106,173,197,24,165,84,169,148,214,90,139,
+    49,74,169,115,74,173,197,24,99,148,82,247,148,90,139,177,214,40,165,116,50,198,24,99,
+    173,205,57,231,100,140,49,198,90,11,0,64,104,112,0,0,59,176,97,117,132,147,162,177,
+    192,66,67,86,2,0,121,0,0,8,66,74,49,198,24,99,16,33,165,24,99,204,49,135,
+    144,82,140,49,198,24,84,138,49,198,28,99,14,66,200,24,99,140,49,7,33,100,140,49,
+    231,156,131,16,50,198,24,99,206,65,8,157,115,142,49,231,32,132,208,57,199,152,115,16,
+    66,231,156,99,204,57,8,161,115,140,49,230,156,0,0,160,2,7,0,128,0,27,69,54,
+    39,24,9,42,52,100,37,0,16,14,0,0,24,195,152,115,140,57,6,157,132,10,33,231,
+    32,116,14,66,42,169,84,8,57,7,161,115,16,74,73,169,120,14,58,41,33,148,82,74,
+    42,197,115,16,74,9,161,148,148,90,43,46,134,82,74,40,165,164,212,82,145,49,132,82,
+    74,41,37,165,214,138,49,166,132,144,82,74,169,181,86,140,49,161,132,84,82,74,41,182,
+    98,140,141,165,164,212,90,107,173,21,99,108,44,37,149,214,90,107,173,24,99,140,107,41,
+    181,22,99,172,197,24,99,92,75,169,165,24,107,44,198,24,227,123,106,45,198,88,99,49,
+    198,24,159,91,106,41,166,92,11,0,48,121,112,0,128,74,176,113,134,149,164,179,194,209,
+    224,66,67,86,2,0,185,1,0,8,66,74,49,198,152,99,206,57,231,156,115,206,73,165,
+    24,115,206,57,231,32,132,16,66,8,33,148,74,49,230,156,115,206,65,7,33,132,16,66,
+    40,25,115,206,57,7,33,132,16,66,8,33,132,80,82,234,152,115,14,66,8,33,132,16,
+    66,8,33,165,212,57,231,32,132,16,66,8,33,132,16,66,74,169,115,206,65,8,33,132,
+    16,66,8,33,132,148,82,8,33,132,16,66,8,33,132,16,66,8,41,165,148,66,8,33,
+    132,16,66,8,33,148,18,82,74,41,133,16,66,8,37,132,18,74,8,37,164,148,82,10,
+    33,132,16,66,41,165,132,82,66,73,41,165,20,66,8,165,148,80,74,41,161,148,144,82,
+    74,41,165,16,66,40,165,148,80,74,41,37,165,148,82,74,37,148,82,74,41,37,148,80,
+    74,74,41,165,148,74,40,161,148,80,74,41,165,148,148,82,74,41,149,82,74,41,37,148,
+    82,74,9,41,165,148,82,74,169,148,82,74,41,165,148,82,82,74,41,165,148,82,41,165,
+    148,82,74,41,165,164,148,82,74,41,165,82,74,41,165,148,18,74,73,41,165,148,82,74,
+    165,148,80,74,41,165,148,82,82,74,41,165,148,74,10,165,148,82,74,41,165,0,0,160,
+    3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,133,134,172,4,0,
+    82,1,0,0,66,40,165,148,82,74,41,53,140,81,74,41,165,148,82,138,28,164,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,149,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,1,192,221,23,14,128,62,19,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,21,0,0,48,134,49,198,152,114,206,57,165,148,115,
+    206,57,6,157,148,72,41,231,32,116,78,74,41,61,132,16,66,8,157,132,148,122,7,33,
+    132,16,66,41,41,245,24,67,40,33,148,148,82,235,177,134,78,58,8,165,180,212,107,15,
+    33,132,148,90,106,169,247,30,50,168,40,165,146,82,239,61,181,80,82,106,41,198,222,123,
+    75,37,179,210,90,107,189,231,222,75,42,41,198,218,122,239,57,183,146,82,76,45,22,0,
+    96,18,225,0,128,184,96,195,234,8,39,69,99,129,133,134,172,2,0,98,0,0,8,67,
+    12,66,72,41,165,148,82,74,41,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,
+    198,24,99,140,49,1,0,128,9,14,0,0,1,86,176,43,179,180,106,163,184,169,147,188,
+    232,131,192,39,116,196,102,100,200,165,84,204,228,68,208,35,53,212,98,37,216,161,21,220,
+    224,5,96,161,33,43,1,0,50,0,0,196,81,172,53,198,94,43,98,24,132,146,106,44,
+    13,65,140,65,137,185,101,198,40,229,36,230,214,41,165,148,147,88,83,200,148,82,204,89,
+    138,37,116,76,41,70,41,166,18,66,198,148,164,24,99,140,41,116,210,90,206,61,183,84,
+    74,11,0,0,128,32,0,192,64,132,204,4,2,5,80,96,32,3,0,14,16,18,164,0,
+    128,194,2,67,199,112,17,16,144,75,200,40,48,40,28,19,206,73,167,13,0,64,16,34,
+    51,68,34,98,49,72,76,168,6,138,138,233,0,96,113,129,33,31,0,50,52,54,210,46,
+    46,160,203,0,23,116,113,215,129,16,130,16,132,32,22,7,80,64,2,14,78,184,225,137,
+    55,60,225,6,39,232,20,149,58,16,0,0,0,0,0,8,0,120,0,0,72,54,128,136,
+    104,102,230,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,4,0,0,0,0,0,
+    16,0,62,0,0,146,21,32,34,154,153,57,142,14,143,15,144,16,145,17,146,18,147,19,
+    148,20,149,0,0,64,0,1,0,0,0,0,16,64,0,2,2,2,0,0,0,0,0,1,
+    0,0,0,2,2,79,103,103,83,0,0,128,23,0,0,0,0,0,0,51,199,31,43,2,
+    0,0,0,34,19,231,202,42,71,69,64,75,67,71,71,75,121,117,255,129,69,115,123,122,
+    67,67,61,68,115,114,119,67,70,69,123,121,121,68,69,69,72,122,136,130,122,113,116,119,
+    115,113,172,217,24,17,93,146,142,36,33,56,205,198,49,175,150,116,164,8,142,246,149,36,
+    204,75,166,76,63,75,44,151,24,170,206,107,10,115,71,113,69,173,139,134,37,66,79,204,
+    92,215,228,47,234,64,72,11,240,142,3,242,56,88,212,58,116,4,105,146,225,199,198,64,
+    0,116,233,104,44,49,10,0,116,233,104,44,49,114,0,148,87,22,73,98,65,153,153,178,
+    92,161,32,202,19,240,28,186,34,133,212,185,192,96,44,58,35,165,71,117,155,100,49,85,
+    194,9,212,27,136,205,137,142,17,181,137,216,122,52,29,65,99,228,166,25,178,3,148,233,
+    10,29,163,23,233,0,202,116,133,129,209,27,0,56,42,35,147,16,188,49,51,35,198,151,
+    92,162,51,136,197,165,240,3,5,126,74,81,26,30,44,205,197,92,121,244,204,212,21,201,
+    0,14,114,151,190,209,34,208,162,70,67,195,64,0,180,229,4,34,217,3,43,180,41,224,
+    93,211,105,80,50,11,50,132,77,164,182,229,213,21,82,34,189,26,83,186,149,161,146,39,
+    48,178,22,194,68,19,194,16,14,71,22,91,73,32,91,204,167,36,225,45,80,155,144,196,
+    199,151,216,188,162,140,50,2,174,54,12,253,9,104,29,98,79,164,233,52,69,150,14,18,
+    224,76,167,41,166,101,144,0,147,168,177,42,4,50,40,19,18,160,172,20,0,65,30,7,
+    215,36,211,133,6,28,121,12,178,48,188,53,30,33,252,178,69,128,14,81,171,31,226,68,
+    183,55,140,62,67,4,228,49,140,104,25,0,132,237,124,10,224,216,98,48,97,95,59,191,
+    97,20,203,12,211,32,28,237,83,4,188,9,102,198,51,17,42,204,143,66,144,24,230,49,
+    25,230,120,16,86,97,113,50,70,34,78,151,61,100,144,153,152,26,76,72,11,136,70,137,
+    90,71,48,49,121,76,104,193,136,131,14,204,241,52,3,148,235,8,36,112,142,167,25,32,
+    132,143,64,180,172,150,202,136,178,66,154,20,202,76,5,49,67,130,44,58,93,142,188,171,
+    47,130,58,10,169,119,211,91,179,90,42,221,194,43,186,163,53,202,232,25,24,12,156,161,
+    117,141,62,68,35,132,14,26,244,1,188,229,68,12,140,170,0,187,55,156,128,129,85,85,
+    98,8,230,242,202,178,200,128,12,22,4,165,172,158,1,95,49,76,248,67,35,155,200,122,
+    102,234,32,201,173,189,38,132,151,154,241,132,204,44,81,70,107,58,240,81,108,247,139,0,
+    6,96,101,70,48,17,113,65,164,31,171,40,0,68,5,253,204,88,50,68,2,41,42,232,
+    99,182,22,16,9,148,179,50,51,163,164,83,200,83,84,139,123,153,140,179,116,50,158,230,
+    153,56,15,2,74,69,202,36,165,78,5,33,20,45,89,78,196,105,22,21,17,18,17,66,
+    81,226,34,68,84,68,132,80,132,80,44,202,178,64,132,18,23,18,169,192,205,161,31,123,
+    215,118,135,191,49,29,24,182,54,78,56,180,247,105,38,240,233,26,54,142,76,35,20,199,
+    49,215,124,115,145,227,120,28,97,142,152,17,50,0,148,253,0,52,202,12,10,216,178,31,
+    128,70,25,160,128,189,149,149,66,70,24,209,162,147,86,114,185,74,66,120,10,62,225,115,
+    217,64,40,46,2,55,154,65,172,108,116,247,203,184,84,238,8,133,66,38,32,52,37,46,
+    16,210,236,127,186,233,166,78,148,189,191,172,22,39,28,168,3,211,206,71,129,227,58,174,
+    79,123,211,112,232,64,44,86,143,15,115,240,97,142,189,69,237,28,90,44,34,195,39,38,
+    243,97,174,99,114,29,111,193,51,68,13,146,119,227,181,4,38,0,64,222,141,215,18,232,
+    0,0,119,22,17,66,69,141,69,45,149,89,81,85,21,75,232,98,106,23,87,221,156,74,
+    146,208,195,177,72,146,36,128,89,8,98,72,201,66,10,8,242,16,163,197,196,137,40,97,
+    136,66,32,16,194,180,26,34,54,14,44,136,157,179,157,216,88,204,193,28,51,31,94,147,
+    57,62,93,104,228,1,28,97,194,53,71,120,205,192,227,193,48,232,1,58,11,240,46,151,
+    153,33,215,235,218,32,24,39,164,133,144,225,17,150,101,163,67,168,46,130,178,6,115,221,
+    64,92,189,167,145,176,98,128,185,238,106,48,19,170,229,197,43,88,204,132,92,4,29,67,
+    40,113,57,125,3,146,239,106,57,146,204,28,1,94,147,48,51,51,73,14,84,71,102,54,
+    134,97,102,12,30,213,13,184,88,140,49,76,188,105,17,6,186,77,172,156,58,10,67,25,
+    92,8,67,66,2,30,58,7,115,1,51,240,96,142,195,8,79,105,116,24,2,87,128,145,
+    184,116,208,233,188,97,208,121,48,130,194,235,66,35,60,136,119,228,242,128,211,130,225,148,
+    122,23,117,18,226,73,40,12,224,10,227,2,116,32,161,14,195,192,162,30,6,17,62,164,
+    67,10,3,0,18,230,69,134,28,19,142,58,90,139,97,244,163,83,239,161,15,105,64,9,
+    9,68,6,69,183,117,232,0,34,123,39,96,76,165,78,226,244,136,128,206,232,195,132,116,
+    69,242,158,192,105,17,8,49,180,22,5,207,224,78,0,2,192,120,111,17,62,140,216,129,
+    32,68,154,17,58,128,142,8,132,48,33,210,98,104,109,2,52,138,137,54,208,132,126,3,
+    192,128,216,152,16,99,164,65,131,6,24,36,242,80,4,20,126,148,204,150,200,67,80,208,
+    248,81,50,91,185,138,144,48,19,172,204,124,34,224,242,248,92,38,114,56,192,51,134,116,
+    134,132,147,193,213,78,24,29,70,62,223,68,106,130,8,23,165,67,127,24,19,29,176,142,
+    16,163,209,130,137,8,66,4,60,10,77,0,128,10,227,163,208,68,0,200,48,174,172,177,
+    162,204,8,136,108,68,13,49,41,149,34,140,103,8,22,12,193,66,161,8,161,197,88,40,
+    100,81,161,64,76,38,110,66,25,142,185,139,50,37,42,41,201,144,128,58,97,56,240,111,
+    227,111,123,167,168,225,47,123,171,83,67,240,165,226,192,129,225,199,222,111,211,98,197,214,
+    112,136,170,157,129,189,173,213,42,14,212,227,241,123,93,143,48,143,12,76,214,82,79,130,
+    78,58,0,68,6,149,18,181,176,131,192,71,241,68,145,65,165,68,45,236,32,240,81,60,
+    201,141,26,20,33,197,236,164,84,146,237,102,108,79,100,156,131,81,142,0,124,161,80,192,
+    136,131,6,37,0,11,68,169,112,68,105,64,148,225,41,34,202,30,132,208,146,148,16,82,
+    89,210,37,9,26,22,211,129,225,0,91,71,142,76,39,212,1,142,217,91,28,168,67,211,
+    198,198,234,152,88,44,206,86,3,159,30,31,174,57,120,109,197,129,97,69,4,14,97,33,
+    252,161,222,48,17,1,76,14,93,36,52,177,100,28,58,232,228,208,5,66,147,164,89,6,
+    115,222,51,171,178,148,116,142,152,24,57,143,84,49,169,103,100,44,14,165,92,30,161,2,
+    30,43,2,1,93,134,10,81,158,238,45,33,66,154,2,93,120,122,10,69,153,8,153,42,
+    132,116,1,154,148,224,11,73,137,69,8,17,37,34,51,17,27,59,215,113,199,28,168,31,
+    127,44,54,78,152,106,135,169,214,25,236,116,166,86,49,28,249,87,21,193,222,78,213,116,
+    13,15,50,207,24,49,210,1,52,238,40,2,220,142,17,208,184,163,8,112,59,70,192,52,
+    43,42,162,136,76,41,140,5,51,65,72,72,34,39,0,81,21,226,114,196,104,120,48,225,
+    83,199,243,24,6,112,134,116,228,17,234,138,68,186,145,212,33,16,162,75,199,232,91,36,
+    64,3,1,84,10,17,110,68,106,1,33,74,149,66,132,27,145,134,0,98,169,172,204,202,
+    234,140,32,85,50,83,176,128,20,82,34,172,158,193,135,129,5,135,102,86,109,68,40,137,
+    76,67,71,28,145,105,40,119,48,121,198,20,167,5,221,49,56,45,210,198,32,1,116,54,
+    49,182,97,149,236,224,117,54,49,182,97,149,236,224,29,74,21,16,28,99,6,248,12,7,
+    12,135,80,143,100,102,50,240,122,133,153,227,113,28,132,4,230,145,16,99,215,2,9,69,
+    132,161,212,152,104,186,173,67,55,4,3,188,66,165,209,86,211,113,142,192,125,133,74,163,
+    173,166,227,28,129,91,22,69,85,101,100,240,222,88,41,32,136,37,75,118,20,57,164,94,
+    46,174,235,195,4,39,99,72,47,6,102,102,44,234,61,0,6,195,232,73,140,161,63,250,
+    99,16,11,64,183,97,0,180,94,83,116,176,104,175,68,187,139,86,107,10,14,22,237,149,
+    104,119,254,77,245,64,228,206,176,169,186,20,148,153,82,70,36,133,180,36,101,185,28,69,
+    130,5,2,34,38,70,139,138,210,2,17,6,33,96,38,1,226,10,134,168,152,0,112,104,
+    107,107,235,208,180,179,17,113,100,99,216,25,98,248,21,246,166,97,181,55,76,91,135,54,
+    54,168,225,132,105,81,43,34,22,199,156,176,115,232,56,234,192,34,134,97,181,113,24,9,
+    74,3,180,78,163,3,70,161,194,178,117,154,44,176,10,21,150,211,172,37,171,170,178,40,
+    107,27,142,26,116,169,6,81,131,83,33,77,176,20,174,105,113,113,81,81,129,168,136,128,
+    22,8,88,32,34,78,83,98,180,148,18,39,226,132,130,64,32,66,212,206,73,139,223,126,
+    124,196,161,56,176,98,111,39,54,86,171,24,134,216,57,112,100,171,246,106,107,138,233,200,
+    222,52,197,22,139,96,117,194,222,16,91,91,171,168,189,157,65,152,80,3,228,110,123,3,
+    213,51,19,208,197,205,221,182,14,186,103,38,160,139,123,138,26,50,147,212,217,173,100,179,
+    51,165,146,137,84,8,133,92,8,44,56,148,34,34,162,160,5,44,2,34,160,68,105,138,
+    133,98,34,20,51,161,32,20,21,37,132,118,194,94,102,176,181,58,180,88,28,83,39,156,
+    112,104,58,52,237,29,179,177,181,117,2,211,161,225,108,107,216,88,173,142,25,34,134,3,
+    181,51,156,176,181,179,154,234,193,188,94,143,15,179,232,41,67,35,0,220,74,49,230,24,
+    185,76,200,222,173,20,99,142,17,105,66,118,143,140,234,72,4,97,198,4,32,228,178,60,
+    30,67,89,153,131,240,186,194,109,31,96,194,113,171,114,220,254,196,64,136,119,68,45,2,
+    198,17,53,140,148,56,9,181,64,98,8,66,100,0,188,58,5,0,0,29,180,87,167,0,
+    0,160,131,54,173,37,179,170,8,101,34,84,102,10,9,41,37,164,176,19,139,3,108,21,
+    181,17,211,222,48,13,212,222,52,237,212,218,109,109,152,235,122,205,117,161,12,68,199,232,
+    142,209,213,141,70,140,221,214,31,145,24,2,220,70,1,10,0,29,132,219,40,64,1,160,
+    131,112,100,20,149,9,87,84,89,41,248,132,195,21,48,124,30,142,228,250,244,122,92,159,
+    120,29,228,177,26,226,192,98,152,130,67,81,85,208,233,25,117,33,61,165,209,132,16,250,
+    196,200,161,35,227,26,132,14,1,228,62,141,0,6,103,101,131,94,230,62,141,0,6,103,
+    101,131,95,174,162,168,46,202,178,20,58,53,156,234,154,206,149,90,16,131,163,96,201,128,
+    36,22,210,2,49,113,161,136,56,45,70,139,10,132,226,68,12,52,132,98,44,94,198,20,
+    45,16,161,196,137,0,132,65,76,255,166,99,230,140,246,51,17,49,173,86,71,118,118,242,
+    33,175,60,248,176,26,22,59,59,123,27,7,14,16,53,109,197,206,206,226,184,105,39,86,
+    139,124,120,92,28,209,33,48,84,215,61,1,220,86,25,1,221,70,80,82,238,182,202,8,
+    232,54,50,37,229,206,42,81,145,65,141,77,41,179,153,134,89,85,72,33,48,87,0,150,
+    195,229,112,196,9,4,162,44,16,163,136,136,16,66,17,1,88,82,84,84,41,1,129,36,
+    75,8,117,104,136,141,19,142,217,216,91,177,177,56,230,184,197,113,139,88,236,12,139,99,
+    134,197,106,177,199,98,107,177,117,194,6,196,234,132,13,142,28,115,22,12,127,129,83,139,
+    56,155,227,224,122,76,94,87,46,184,162,105,0,172,98,185,192,86,195,198,196,218,163,92,
+    197,114,129,173,134,141,137,181,71,249,43,167,132,42,34,42,68,175,12,27,91,233,228,181,
+    42,169,131,110,151,8,202,74,11,72,74,243,184,90,76,144,196,32,22,48,136,152,168,24,
+    139,3,226,16,21,19,129,40,37,70,137,82,20,152,166,196,133,2,138,6,77,137,137,136,
+    11,105,113,136,138,137,48,40,161,136,144,18,37,106,99,235,152,173,105,167,118,22,83,28,
+    88,21,3,181,88,176,115,66,236,80,67,17,129,0,164,62,53,20,0,44,32,245,169,161,
+    0,96,65,40,175,42,75,129,224,29,101,10,2,158,128,79,120,156,240,51,234,35,227,186,
+    50,199,241,202,135,153,215,113,29,19,94,33,194,68,32,84,102,30,199,53,250,221,54,225,
+    4,97,136,77,127,104,93,66,8,52,140,34,117,180,162,134,2,38,140,34,117,180,162,134,
+    2,38,148,21,101,85,81,4,196,142,42,51,0,146,82,176,8,11,13,195,24,38,130,145,
+    26,118,136,138,45,142,215,228,130,59,38,98,215,19,98,113,180,209,44,18,248,126,20,233,
+    119,184,19,145,209,162,8,140,26,5,0,140,38,44,4,227,168,81,0,192,104,34,1,193,
+    147,204,234,234,204,72,233,152,50,1,202,76,16,196,66,56,120,128,200,122,87,248,133,249,
+    144,132,79,132,201,60,109,180,16,41,124,198,2,9,171,103,244,52,18,134,22,69,67,152,
+    8,90,128,1,20,18,119,0,35,146,5,217,37,90,72,220,1,140,72,22,100,151,104,89,
+    101,149,170,146,240,222,152,153,128,96,144,16,146,245,78,195,232,53,92,23,185,58,23,24,
+    188,18,46,136,145,234,92,145,92,17,48,97,8,233,182,126,99,162,69,49,134,214,98,199,
+    232,211,196,8,212,70,179,116,168,118,100,120,89,27,205,210,161,218,145,225,229,45,42,10,
+    17,114,55,213,216,152,148,109,70,77,43,153,242,192,114,136,144,240,32,32,44,66,68,104,
+    113,81,22,17,21,167,105,38,16,19,19,66,84,132,166,32,78,17,162,86,199,29,137,69,
+    29,57,50,109,76,171,19,58,138,35,172,234,75,157,112,220,116,220,222,214,20,177,183,154,
+    86,21,245,196,106,90,196,214,129,3,59,91,199,212,198,145,218,58,98,136,8,141,208,19,
+    87,72,66,117,163,5,196,126,17,4,72,89,157,142,84,32,246,139,32,64,202,234,116,164,
+    2,183,178,90,25,82,116,59,185,221,212,45,34,35,51,231,212,64,74,46,70,32,96,132,
+    172,0,204,98,226,34,34,226,162,226,226,162,44,38,66,17,33,51,69,152,197,132,52,1,
+    139,82,2,48,45,78,196,40,33,45,198,16,1,40,139,67,83,45,54,246,142,57,194,42,
+    6,182,182,166,173,157,227,98,10,166,197,145,157,141,129,168,61,118,54,142,28,87,135,86,
+    135,78,168,3,59,139,88,213,129,141,34,120,28,159,174,199,1,123,199,76,84,4,204,122,
+    81,2,128,192,132,89,47,74,0,16,152,176,106,41,42,170,178,50,83,136,58,177,81,99,
+    15,53,39,165,20,130,148,66,10,64,66,156,22,17,8,32,2,90,28,98,34,68,84,40,
+    74,196,88,64,211,98,96,81,138,162,197,108,109,236,212,129,157,189,24,216,57,102,177,88,
+    237,108,13,212,14,123,195,198,214,106,103,107,99,239,184,67,11,134,45,54,106,139,3,135,
+    134,97,53,12,123,7,182,98,177,53,92,7,175,7,12,7,175,15,115,229,241,137,228,211,
+    113,124,122,48,143,107,62,0,204,118,81,11,36,161,176,152,237,162,22,72,66,97,113,43,
+    138,138,16,153,196,86,135,200,67,164,56,26,123,134,203,227,83,174,128,21,21,21,136,9,
+    133,12,66,137,138,65,148,197,68,133,162,204,52,45,106,90,45,142,219,90,12,113,228,152,
+    90,29,89,157,176,96,53,68,45,14,109,44,106,111,216,217,162,134,88,213,48,28,90,28,
+    159,56,242,130,5,123,139,141,213,106,137,112,194,162,97,53,237,212,214,48,204,144,227,186,
+    30,124,202,113,205,1,97,34,66,2,180,114,169,19,100,130,79,4,54,173,92,234,4,153,
+    224,19,129,205,141,34,107,76,236,177,170,56,34,213,19,41,145,129,199,227,9,25,80,174,
+    56,17,21,19,136,137,64,68,40,164,88,32,20,23,131,151,22,8,197,68,237,176,195,222,
+    113,199,196,49,7,22,71,106,107,107,99,181,177,19,91,79,213,138,225,80,29,168,157,216,
+    99,171,86,83,28,218,217,26,22,71,216,139,3,176,53,28,183,117,100,49,197,176,10,230,
+    122,4,36,220,82,73,34,40,50,21,252,91,42,73,4,69,166,130,127,139,42,145,41,236,
+    108,157,179,205,148,82,114,192,163,92,1,225,48,66,81,81,34,70,32,46,160,104,17,129,
+    80,84,68,220,206,112,40,134,189,141,26,166,35,211,9,108,212,226,192,234,132,213,113,139,
+    189,189,226,64,76,83,13,139,97,111,139,141,5,171,173,56,48,76,123,211,98,39,246,246,
+    106,103,103,216,59,108,7,118,216,219,139,157,13,182,86,121,28,115,23,57,253,137,14,148,
+    106,117,155,134,122,185,36,251,97,169,86,119,104,168,87,94,146,253,240,91,151,200,48,121,
+    232,201,112,232,244,0,153,82,114,192,16,42,41,35,41,20,17,10,104,136,10,68,32,46,
+    46,6,136,2,226,2,66,209,226,132,69,89,156,18,17,21,21,10,4,238,20,161,100,218,
+    30,113,210,115,210,206,86,236,237,173,136,141,216,24,134,218,218,58,166,54,22,139,3,181,
+    154,14,237,219,176,113,220,113,27,49,237,77,85,139,97,120,204,92,215,160,35,0,212,86,
+    173,100,112,221,78,196,123,181,85,43,25,92,183,19,241,222,45,170,83,74,185,171,103,6,
+    153,41,165,228,128,229,114,65,120,4,98,162,132,176,40,161,1,74,64,9,105,154,18,101,
+    81,74,32,34,162,182,226,132,3,83,236,76,59,236,29,56,52,76,91,195,94,76,211,98,
+    107,167,98,49,109,76,12,123,7,182,6,14,45,14,81,91,27,123,27,172,142,108,109,196,
+    234,192,222,48,173,54,14,45,166,122,92,15,56,174,163,31,0,204,90,29,5,2,76,152,
+    102,173,142,2,1,38,76,183,172,137,72,228,204,166,148,178,33,57,16,48,124,194,80,33,
+    17,17,23,21,10,68,137,80,200,2,154,8,69,137,136,227,226,132,67,39,112,96,216,59,
+    97,224,184,141,225,132,67,27,199,109,68,29,179,183,115,100,167,106,53,13,59,177,181,154,
+    98,216,88,237,77,139,69,196,214,22,7,134,154,134,3,7,234,152,67,7,118,118,88,29,
+    179,58,48,240,154,107,142,204,101,68,79,103,103,83,0,0,192,61,0,0,0,0,0,0,
+    51,199,31,43,3,0,0,0,123,85,69,205,26,114,116,255,112,255,114,255,126,255,124,70,
+    72,69,120,113,115,255,105,255,122,255,114,255,107,255,106,228,94,19,74,96,185,126,224,231,
+    94,19,74,96,185,126,224,223,168,206,76,73,71,107,131,115,85,76,170,236,89,167,157,150,
+    1,134,8,121,224,48,226,2,74,156,38,2,90,76,68,20,44,16,163,133,180,152,152,56,
+    8,11,196,68,104,17,129,128,128,128,65,137,8,196,68,197,69,69,10,113,216,89,108,172,
+    182,98,107,154,14,29,154,246,96,154,86,91,139,69,236,212,222,20,171,105,181,26,142,44,
+    170,182,6,18,186,29,65,71,0,228,102,21,150,169,44,7,198,220,172,194,50,149,229,192,
+    120,86,87,148,69,162,119,7,209,214,93,82,74,1,12,35,16,178,96,41,139,49,37,36,
+    32,98,98,180,8,13,161,168,24,129,24,211,2,118,204,52,157,48,157,176,56,102,239,152,
+    61,78,56,52,197,161,24,246,166,141,97,53,12,181,113,96,136,49,41,142,169,173,3,211,
+    206,176,197,113,211,180,136,189,69,28,179,218,216,90,236,173,78,24,86,171,88,189,194,235,
+    200,145,7,33,0,58,219,37,188,128,224,7,128,222,108,151,240,2,130,31,0,122,175,33,
+    43,145,4,41,106,44,21,101,100,133,140,164,140,169,58,174,170,139,19,99,177,201,196,146,
+    204,0,0,34,92,17,25,17,49,9,70,138,35,35,32,38,41,32,69,144,68,66,48,36,
+    73,72,130,67,195,170,138,227,160,182,118,226,72,29,186,62,92,115,113,101,174,131,28,199,
+    227,193,245,152,25,174,129,153,215,99,193,130,5,170,131,5,90,49,0,51,195,76,46,142,
+    153,7,199,227,202,49,28,19,132,223,101,193,165,163,122,2,48,80,93,88,93,148,56,180,
+    224,98,136,160,144,79,132,201,113,188,120,37,195,76,50,215,35,51,9,192,56,169,19,17,
+    198,24,174,153,192,48,143,185,62,208,51,134,26,23,131,103,116,17,128,99,46,242,226,49,
+    199,112,133,57,94,199,48,19,174,235,200,241,152,215,132,227,98,56,116,25,67,9,49,177,
+    223,250,130,96,44,26,18,25,198,132,79,231,200,80,234,25,73,36,163,135,62,34,164,203,
+    48,134,116,68,188,1,113,193,51,208,72,6,198,33,194,71,8,186,19,130,110,8,49,70,
+    136,142,122,194,8,140,174,208,8,66,12,163,131,17,71,107,19,129,211,132,113,1,32,0,
+    156,122,6,26,185,35,234,143,214,111,221,168,63,90,27,109,140,208,186,93,20,132,145,16,
+    131,22,35,180,160,197,126,127,244,87,164,63,250,6,29,196,0,10,74,169,62,116,66,8,
+    186,244,197,96,232,142,8,194,24,136,24,253,160,47,32,132,209,16,234,29,18,167,193,208,
+    140,97,132,4,53,112,233,32,116,163,102,0,158,219,69,190,70,97,0,104,115,187,200,215,
+    40,12,0,237,75,168,40,50,0,57,79,27,172,229,85,151,227,36,108,198,38,150,196,146,
+    0,0,160,28,62,195,19,128,203,130,199,225,114,8,139,66,132,22,165,33,164,32,16,21,
+    48,12,171,58,166,166,85,237,29,57,97,181,115,220,214,222,34,54,42,34,182,246,134,168,
+    105,11,78,96,103,154,86,91,211,214,106,131,85,80,177,24,160,118,166,19,216,136,33,106,
+    224,250,240,248,192,228,128,153,15,215,193,228,195,235,186,94,112,125,250,116,61,142,60,174,
+    153,107,224,56,62,205,149,236,77,65,13,16,19,193,16,19,15,14,38,3,51,153,43,74,
+    117,158,193,235,28,122,101,30,129,131,73,142,129,139,48,115,49,201,235,74,134,201,53,15,
+    224,184,230,186,178,240,35,50,1,194,162,243,46,167,78,23,234,164,194,60,142,0,188,230,
+    49,8,177,163,27,186,97,88,136,112,133,133,18,189,158,232,35,156,136,96,112,209,72,132,
+    88,240,161,145,193,24,217,132,164,78,170,183,232,35,116,240,46,139,58,29,116,78,31,97,
+    33,84,23,74,137,197,240,117,76,196,24,218,24,222,59,17,18,222,232,117,122,67,45,234,
+    232,32,8,145,158,82,128,132,33,49,132,24,250,45,54,129,190,225,98,0,12,64,168,211,
+    27,208,200,68,35,244,251,173,27,162,32,24,154,9,1,145,49,26,16,161,51,198,163,233,
+    199,214,237,55,198,104,77,136,180,238,16,1,45,210,90,183,143,160,197,126,235,162,27,129,
+    11,112,70,50,204,45,246,25,77,63,104,13,49,4,104,81,0,17,244,1,34,62,91,229,
+    98,13,24,0,124,179,85,46,214,128,1,192,247,16,89,170,168,165,82,20,65,80,84,42,
+    42,82,86,16,114,39,119,134,37,108,156,41,231,185,186,93,179,75,100,74,36,137,197,34,
+    1,64,64,130,137,132,100,98,201,36,25,12,8,1,8,38,48,11,74,148,18,167,197,4,
+    34,98,52,196,69,133,148,128,22,66,68,32,34,206,34,52,17,18,49,1,81,181,53,48,
+    44,38,182,34,136,141,35,43,6,106,168,173,157,157,225,152,67,59,211,80,69,212,112,40,
+    98,49,76,123,139,197,176,51,29,56,38,86,83,13,59,211,198,86,45,34,86,171,90,77,
+    139,138,189,168,170,33,34,234,0,195,98,42,24,96,193,117,124,34,143,79,240,200,149,11,
+    17,58,24,132,234,34,3,46,184,62,48,76,194,245,154,97,56,194,145,201,28,153,153,79,
+    25,6,96,194,60,102,200,144,139,144,57,22,17,17,106,140,39,78,175,64,134,144,12,57,
+    146,23,192,100,94,132,144,71,134,64,46,32,140,22,39,66,136,163,195,69,188,139,17,122,
+    139,8,117,233,65,168,67,12,192,131,199,53,147,129,203,192,123,135,128,222,19,227,16,94,
+    71,157,78,56,137,5,227,212,49,194,16,56,91,87,223,68,24,35,48,49,68,15,56,244,
+    112,50,118,196,54,33,118,195,16,98,212,21,186,134,22,39,64,117,32,122,48,128,82,18,
+    1,128,209,34,213,27,67,189,143,128,1,168,129,198,232,51,24,136,130,9,161,219,208,186,
+    134,190,54,104,177,139,134,208,39,162,117,181,17,90,183,219,165,233,169,211,161,147,26,232,
+    247,135,126,136,24,12,16,193,168,55,30,6,208,7,208,8,34,0,150,90,13,210,18,40,
+    0,184,169,213,32,45,129,2,128,251,38,42,34,66,153,153,68,30,73,10,123,74,150,101,
+    141,110,217,57,16,230,74,146,76,21,89,36,99,177,36,145,0,192,225,128,8,121,66,30,
+    225,241,132,32,44,21,17,17,39,52,24,16,208,34,132,197,8,11,88,76,76,64,9,137,
+    56,152,98,74,140,136,81,162,76,11,69,69,196,65,17,8,68,33,74,24,148,80,32,164,
+    89,84,92,148,136,226,152,141,97,99,139,24,106,99,152,54,246,246,166,213,176,160,136,141,
+    3,59,171,225,80,28,89,212,106,99,152,166,88,44,22,53,172,182,14,173,14,49,45,106,
+    111,177,90,176,136,218,26,182,106,98,58,178,168,136,33,136,137,57,114,29,57,242,32,201,
+    43,11,67,245,97,245,122,132,244,206,80,103,36,232,160,55,206,8,67,25,24,60,92,46,
+    80,71,222,48,82,66,117,6,158,128,145,128,18,23,33,134,132,116,200,224,140,208,123,125,
+    132,11,78,151,183,16,210,59,137,7,213,235,161,103,36,22,140,247,17,208,43,160,170,42,
+    134,67,84,77,12,129,188,114,93,31,94,188,30,60,142,132,204,204,145,97,24,60,140,119,
+    104,60,161,78,195,224,137,147,50,56,164,46,32,52,116,163,48,33,208,157,48,17,7,97,
+    132,231,84,79,180,166,67,99,66,189,11,208,3,6,46,167,9,245,8,19,226,16,70,7,
+    81,208,141,129,248,172,141,254,96,120,111,1,30,196,5,66,24,35,138,51,173,35,186,186,
+    41,161,32,46,1,136,98,52,2,8,163,117,1,105,192,8,143,38,10,45,66,32,16,87,
+    65,28,76,48,48,68,208,104,2,48,0,52,0,132,54,253,18,8,162,254,193,15,109,250,
+    37,16,68,253,131,191,106,204,106,153,69,142,52,81,77,192,11,193,20,130,136,65,12,1,
+    68,9,32,46,144,66,0,2,192,235,10,204,1,153,92,143,116,250,200,100,116,24,58,157,
+    183,16,154,6,86,234,71,212,103,16,50,76,62,203,12,16,76,255,193,98,242,89,102,128,
+    96,234,15,42,228,173,142,16,228,228,177,81,239,24,3,124,129,144,101,133,148,33,162,34,
+    66,136,209,180,233,16,193,2,12,250,240,184,246,130,108,228,82,71,158,120,16,6,54,162,
+    97,12,3,8,181,64,39,186,140,22,22,108,54,139,2,0,44,88,108,58,139,2,0,44,
+    88,222,154,35,69,160,53,142,9,65,72,193,50,28,80,33,43,16,210,66,33,17,161,224,
+    211,227,56,142,185,94,161,35,234,28,129,232,35,81,63,209,98,63,66,71,252,208,154,158,
+    226,146,168,65,120,1,112,1,116,86,253,13,216,107,95,182,64,114,59,171,254,6,236,181,
+    15,91,252,188,91,67,25,145,196,156,157,110,229,4,81,35,82,197,86,108,77,19,20,4,
+    44,75,56,124,190,184,168,0,66,161,80,40,46,16,17,21,19,16,113,113,90,156,136,208,
+    14,45,20,138,34,9,129,40,17,133,0,236,11,132,148,56,41,39,33,6,16,74,148,150,
+    101,122,39,236,28,57,176,218,139,202,244,106,55,61,166,117,250,208,25,44,78,88,177,55,
+    125,12,27,155,142,137,169,1,84,58,75,58,48,142,88,132,31,43,157,37,29,24,71,44,
+    194,143,87,101,73,176,185,219,51,147,66,151,234,56,100,73,141,201,32,3,203,82,190,128,
+    242,41,17,103,22,136,128,197,196,105,90,64,139,137,131,105,33,97,138,134,168,168,0,34,
+    2,1,37,66,196,4,52,68,69,197,69,41,34,36,226,78,216,136,88,109,197,226,132,227,
+    138,105,58,174,246,118,134,154,86,139,14,10,182,198,12,14,213,16,172,14,76,171,7,19,
+    6,116,102,125,39,209,228,17,27,9,205,184,157,90,223,73,52,121,196,137,132,102,188,87,
+    84,68,136,144,101,85,70,81,173,74,147,106,135,204,72,10,46,135,8,9,159,203,130,33,
+    165,36,18,8,41,136,139,137,130,16,194,52,132,46,2,8,0,209,10,177,65,237,156,112,
+    194,176,113,204,198,214,138,19,142,236,177,90,28,138,32,142,217,89,196,226,71,28,115,66,
+    76,83,76,139,29,86,53,45,22,59,195,33,142,13,232,16,65,4,4,0,90,9,29,230,
+    247,12,194,129,9,247,171,132,14,243,123,6,225,192,132,251,61,161,102,45,17,101,181,172,
+    20,34,34,171,138,168,204,12,69,165,40,114,158,231,46,231,232,174,19,201,36,41,98,145,
+    18,9,0,16,66,144,128,100,150,82,16,164,148,146,89,72,9,34,2,145,48,76,193,161,
+    157,90,108,29,216,98,49,77,83,177,96,177,58,82,177,96,170,24,98,154,86,171,97,99,
+    53,5,68,77,135,22,11,106,216,89,77,27,91,49,76,27,84,236,81,43,142,16,91,195,
+    106,99,216,91,29,55,113,66,212,98,216,90,213,170,134,218,168,107,94,143,225,74,94,51,
+    143,28,60,230,122,28,36,25,184,50,23,71,30,192,235,21,152,201,194,120,19,217,235,73,
+    72,15,162,15,171,247,17,46,50,143,12,33,215,73,199,133,46,178,206,59,35,233,93,129,
+    99,142,27,30,243,202,16,200,197,49,147,3,230,117,76,232,104,221,137,254,112,72,64,117,
+    212,24,132,99,142,139,235,145,48,115,112,101,62,113,12,7,67,94,87,152,131,153,28,7,
+    92,215,107,68,239,157,94,231,200,73,221,24,45,88,36,140,196,73,45,130,129,134,213,130,
+    139,48,82,56,50,6,81,112,116,12,163,139,54,132,38,210,198,0,156,196,33,188,7,136,
+    29,8,104,250,129,72,139,48,62,68,48,16,104,253,198,128,94,81,232,94,130,9,139,50,
+    130,58,61,188,142,17,6,134,250,200,96,136,163,1,98,104,1,79,137,137,8,105,8,65,
+    48,98,235,106,180,63,2,232,98,104,2,194,141,6,168,130,175,13,0,34,30,10,205,198,
+    61,244,2,245,158,144,186,80,104,54,238,161,23,168,247,132,212,29,50,218,89,210,116,200,
+    121,129,197,228,58,229,172,82,198,49,41,44,150,36,0,0,17,241,105,81,136,50,196,105,
+    154,136,10,40,1,45,38,34,74,83,66,74,72,68,5,20,37,70,137,3,162,44,74,51,
+    5,74,156,1,195,180,183,17,197,98,107,49,44,86,7,106,138,97,181,216,99,181,152,130,
+    105,24,166,98,90,173,134,189,69,173,14,108,45,98,96,226,152,138,218,90,173,134,189,162,
+    166,9,114,240,58,56,184,142,43,215,241,58,29,50,132,154,48,70,239,152,12,7,76,224,
+    49,48,28,175,28,64,230,184,56,38,48,153,235,113,113,28,112,228,9,140,161,33,137,139,
+    32,194,64,15,143,153,227,202,112,113,144,73,6,222,73,193,0,18,193,160,103,12,105,128,
+    79,76,230,10,48,215,28,33,252,81,57,114,232,138,164,11,19,45,78,116,251,29,174,240,
+    152,139,99,230,49,195,204,97,168,247,145,92,97,9,171,119,82,189,137,236,157,22,245,148,
+    186,224,36,142,1,174,0,175,28,19,122,56,137,97,136,112,234,67,189,14,128,211,232,11,
+    66,139,58,153,8,173,133,213,80,120,39,53,30,12,122,67,156,78,106,66,169,135,1,34,
+    193,59,225,116,141,238,51,26,97,162,13,86,136,109,194,165,9,226,244,110,12,67,140,253,
+    72,68,191,119,57,1,189,254,124,139,240,240,206,216,58,90,139,48,120,108,128,96,244,155,
+    110,87,155,24,163,33,160,95,52,32,70,79,28,122,231,24,113,130,216,67,189,49,246,66,
+    48,21,24,34,66,6,19,136,0,136,201,0,3,62,202,204,140,123,152,14,186,231,129,212,
+    141,50,51,227,26,86,128,238,121,32,109,135,140,13,8,196,152,39,215,29,215,174,187,100,
+    108,226,200,152,69,32,18,0,104,66,68,33,38,38,34,20,99,66,83,132,18,37,52,45,
+    20,80,34,98,34,162,98,16,178,184,189,103,218,59,178,136,105,152,216,96,181,179,138,173,
+    227,86,67,108,176,96,216,136,21,91,27,139,56,240,165,88,5,195,70,172,98,227,202,99,
+    114,60,38,87,30,67,22,225,116,164,51,240,222,60,102,146,192,204,60,18,96,14,200,100,
+    142,57,224,245,58,114,145,153,112,133,28,144,79,60,102,46,174,25,114,113,12,57,242,226,
+    224,58,56,200,161,222,9,167,147,232,157,122,139,12,102,68,142,100,40,34,3,145,28,26,
+    120,113,101,24,146,153,227,58,194,28,87,50,243,224,32,7,3,170,134,48,1,58,24,79,
+    28,25,61,166,149,12,112,29,12,48,92,121,37,51,201,53,19,174,3,99,53,114,132,235,
+    81,3,109,194,16,38,188,248,46,140,25,12,228,142,208,176,66,162,77,134,99,70,8,65,
+    132,116,50,244,219,232,247,199,165,67,96,160,33,61,113,82,248,218,125,54,161,223,250,67,
+    187,19,35,34,78,32,130,193,51,232,12,12,131,49,84,49,154,24,81,126,187,77,27,125,
+    33,34,14,205,32,196,3,22,1,128,154,243,9,168,69,15,130,107,99,86,28,35,244,67,
+    63,6,163,197,190,112,122,2,16,208,32,76,210,6,244,67,19,1,80,98,17,198,132,8,
+    128,15,5,167,132,216,198,76,191,13,97,8,68,16,227,32,54,211,6,16,192,0,126,153,
+    28,138,151,212,238,192,189,33,117,151,201,161,120,73,237,14,220,27,82,119,216,24,48,58,
+    210,60,151,43,122,202,185,56,51,153,201,36,73,18,9,0,162,162,66,17,161,8,5,81,
+    90,0,22,50,37,42,164,69,197,133,98,68,40,146,98,98,44,16,90,13,135,136,173,141,
+    173,47,71,98,218,88,69,12,171,26,162,86,49,172,106,227,152,90,172,42,98,53,17,123,
+    11,136,170,8,98,26,246,130,152,42,2,0,94,16,94,28,215,227,96,166,167,84,167,51,
+    225,35,97,141,164,131,67,103,24,234,130,43,47,128,112,61,224,34,199,149,43,115,61,174,
+    9,33,146,67,170,11,213,67,2,16,56,174,131,121,220,208,17,196,214,208,144,17,22,169,
+    49,78,66,65,40,69,100,28,51,121,101,30,67,102,120,25,66,35,160,15,25,62,194,192,
+    136,62,99,4,228,154,188,12,50,48,204,104,88,169,210,59,52,122,144,235,113,145,201,28,
+    204,156,80,70,39,137,96,0,116,142,60,113,20,1,234,13,35,96,12,149,132,23,115,133,
+    129,4,117,180,98,2,122,74,141,22,9,40,16,234,171,67,18,8,132,54,209,186,109,140,
+    110,20,116,103,186,53,160,82,187,103,36,216,19,7,68,195,12,72,80,208,72,185,77,220,
+    24,180,22,67,96,76,140,166,247,198,39,70,29,180,126,160,223,49,209,239,116,194,233,182,
+    246,197,9,113,207,232,246,198,62,161,122,246,7,34,77,16,116,8,225,67,99,15,109,34,
+    4,70,139,193,24,136,226,42,209,248,152,22,174,49,48,6,52,66,108,49,34,70,168,0,
+    126,105,204,79,143,112,19,96,67,22,119,105,204,207,143,112,19,96,67,150,119,16,211,201,
+    69,23,186,157,93,121,46,177,208,189,68,50,54,99,177,36,9,0,132,204,132,208,98,148,
+    208,131,130,236,46,139,80,20,45,66,139,72,58,46,73,161,84,234,8,97,98,138,143,141,
+    141,105,43,54,106,197,47,49,12,223,152,134,213,214,98,152,96,138,225,50,93,166,163,12,
+    22,245,30,147,199,92,48,115,12,87,8,23,71,184,242,58,8,8,67,66,41,165,78,167,
+    99,224,152,7,51,31,62,229,224,195,192,176,51,49,4,212,16,172,74,60,92,58,24,6,
+    225,10,31,94,51,115,64,114,9,188,137,100,193,233,245,222,68,248,80,90,45,50,134,33,
+    70,88,52,17,58,16,70,24,79,92,94,239,212,187,66,118,155,22,103,66,151,193,192,19,
+    86,27,234,16,17,68,81,68,200,113,1,67,30,74,36,235,79,24,224,58,133,92,112,228,
+    226,193,235,152,42,86,59,85,65,81,64,61,13,171,62,148,234,64,168,11,38,50,117,8,
+    56,4,12,69,165,34,194,59,141,17,39,66,139,107,141,209,141,24,113,24,173,61,15,221,
+    64,127,98,239,50,160,130,25,6,173,5,154,24,247,212,54,15,74,16,1,67,177,208,195,
+    27,135,86,8,55,26,211,14,157,35,131,72,30,136,129,73,38,120,12,61,70,184,209,132,
+    98,184,224,41,236,29,98,19,34,126,71,144,52,193,35,5,156,142,123,248,161,79,212,21,
+    53,145,86,219,175,6,49,136,99,2,26,166,119,236,165,79,229,160,47,16,35,16,35,22,
+    0,79,103,103,83,0,4,186,93,0,0,0,0,0,0,51,199,31,43,4,0,0,0,209,
+    149,155,66,23,255,103,255,98,68,65,69,71,68,70,123,122,121,255,125,255,114,255,122,255,
+    126,255,129,30,41,12,198,51,236,16,44,38,84,103,164,48,24,207,176,67,176,152,80,157,
+    135,141,132,193,50,123,151,27,134,106,231,98,22,179,82,98,204,145,88,98,145,0,32,20,
+    8,4,44,34,16,33,116,185,16,2,48,45,20,23,128,18,81,161,40,45,16,39,66,134,
+    168,8,19,17,90,156,16,161,40,83,66,118,96,53,76,196,106,53,197,52,81,49,12,159,
+    230,58,152,235,152,25,62,188,78,23,147,209,25,163,195,53,23,175,35,92,143,33,97,230,
+    83,174,3,50,121,37,112,122,61,116,22,140,119,17,38,147,43,23,175,28,211,81,194,160,
+    115,81,135,94,243,98,164,3,194,113,12,226,2,66,93,14,245,78,110,17,206,225,245,140,
+    161,17,78,24,99,186,19,35,132,126,127,64,7,29,117,133,209,119,199,232,104,113,116,97,
+    64,42,163,222,123,18,134,82,56,35,66,41,0,3,34,154,24,195,112,90,52,97,136,30,
+    97,109,221,49,209,141,97,26,152,215,49,153,225,211,169,72,2,189,65,231,1,157,223,180,
+    9,1,49,182,219,148,49,62,194,134,16,162,191,6,138,122,83,232,52,22,64,109,188,45,
+    16,3,226,225,89,44,82,143,101,180,56,8,99,148,208,111,113,111,236,2,240,214,153,176,
+    19,70,63,78,140,0,131,209,78,105,209,233,35,81,3,67,8,163,139,196,34,131,52,67,
+    104,250,250,253,58,196,30,145,206,125,244,25,70,232,246,70,67,7,78,184,195,45,164,179,
+    182,38,50,64,4,191,19,184,85,76,75,163,137,13,24,65,64,129,50,224,52,253,8,20,
+    0,54,39,28,230,111,97,66,0,248,231,132,195,252,45,76,8,0,255,83,179,40,139,138,
+    178,204,44,171,178,162,44,83,17,50,106,86,100,128,216,19,144,238,234,112,210,46,50,153,
+    76,98,73,18,0,64,116,1,65,78,196,146,101,7,36,73,41,8,80,44,165,32,73,32,
+    70,49,37,20,208,52,152,136,177,40,6,88,237,172,162,98,21,195,42,18,41,146,46,18,
+    113,58,9,16,41,164,163,240,57,132,227,21,242,58,24,32,147,129,92,143,79,199,64,24,
+    2,153,12,0,243,184,38,25,242,58,120,29,87,46,142,171,196,60,6,114,5,134,144,62,
+    148,122,99,209,248,17,224,154,121,74,115,48,1,114,29,115,92,48,201,188,138,0,244,14,
+    195,132,85,231,114,130,129,129,145,134,117,207,232,142,190,209,41,12,165,134,80,232,44,26,
+    10,135,222,43,44,21,206,176,234,225,59,208,23,157,49,93,132,94,23,9,78,6,91,145,
+    8,38,195,48,144,121,12,28,215,28,175,92,49,150,50,164,195,78,17,186,91,116,98,134,
+    9,141,97,85,215,193,34,160,215,123,39,0,210,46,17,132,105,70,36,136,65,91,142,137,
+    189,225,6,80,18,55,116,135,142,16,25,18,65,19,154,156,133,0,18,211,219,16,208,24,
+    250,205,80,116,244,161,151,3,240,110,52,54,225,186,177,137,19,200,125,38,194,152,20,20,
+    116,252,40,26,240,137,211,0,15,152,240,109,162,131,16,135,77,232,140,116,3,52,208,31,
+    225,101,12,69,107,80,59,154,194,17,70,16,135,190,223,0,23,0,116,225,188,4,0,50,
+    100,161,235,230,229,0,144,65,60,106,44,74,32,77,149,41,116,17,28,150,229,27,89,111,
+    197,131,132,44,154,212,39,55,112,74,167,18,202,16,68,58,50,187,116,222,92,200,78,209,
+    243,48,224,116,132,24,67,135,216,177,246,148,62,0,68,225,252,12,24,94,156,128,39,92,
+    17,7,66,180,0,124,76,22,64,48,19,76,49,195,239,98,128,184,241,169,151,168,113,210,
+    76,248,166,90,66,109,131,71,222,223,232,242,20,221,182,176,136,140,168,8,198,170,227,124,
+    232,73,71,12,12,17,239,108,233,60,4,24,97,51,49,183,91,58,15,3,70,46,149,168,
+    29,53,171,12,144,66,8,166,144,12,141,41,194,225,134,119,49,27,203,144,78,18,70,105,
+    109,120,213,154,224,168,131,66,51,17,250,103,67,119,70,111,14,17,214,234,209,54,61,123,
+    239,33,35,0,108,221,252,14,168,217,220,96,106,32,111,217,124,6,8,247,160,6,19,190,
+    160,138,8,48,73,168,76,33,43,143,149,210,112,228,36,172,58,198,48,250,110,157,158,232,
+    29,134,78,0,164,171,225,1,199,114,90,126,158,168,26,128,192,160,179,114,9,70,92,221,
+    16,38,0,60,225,138,57,144,220,116,16,170,112,133,146,27,64,175,33,124,60,32,18,164,
+    84,22,20,103,162,50,102,45,185,46,180,6,225,136,144,81,145,128,144,99,94,220,14,135,
+    53,12,52,174,252,174,25,143,72,205,230,30,29,122,103,94,166,250,6,136,240,88,14,76,
+    221,60,12,24,150,12,114,148,77,143,89,51,128,152,33,22,12,32,189,170,0,106,64,241,
+    170,212,238,93,120,72,116,116,181,166,85,164,75,92,97,32,115,241,203,92,215,11,216,178,
+    18,161,88,221,68,81,223,201,141,107,220,230,11,109,136,140,189,81,223,129,2,52,245,104,
+    73,14,74,148,185,81,139,77,61,90,146,205,81,214,98,173,209,173,57,133,76,155,178,57,
+    83,151,106,46,41,75,147,20,26,183,44,160,61,163,103,66,12,164,241,244,16,120,230,228,
+    148,196,178,174,88,182,114,167,76,148,192,166,197,40,119,89,68,82,204,229,38,165,205,58,
+    205,183,76,115,210,243,181,109,58,139,211,113,240,156,156,58,154,78,85,166,96,245,239,227,
+    43,156,52,124,60,245,153,122,236,216,52,215,176,245,28,148,98,23,103,228,98,39,97,0,
+    148,241,24,194,12,150,228,69,220,89,101,60,134,50,131,97,248,144,160,179,110,141,178,68,
+    232,86,79,50,199,72,53,50,50,37,134,32,204,18,8,184,66,49,90,196,172,220,9,98,
+    20,161,196,42,88,188,66,156,136,75,144,164,56,124,145,172,240,116,183,51,29,78,103,49,
+    157,45,211,44,54,211,198,169,182,182,174,85,253,171,61,83,167,248,219,146,94,76,88,213,
+    217,180,119,22,203,224,57,152,156,209,156,110,23,251,193,244,203,49,111,122,44,211,58,166,
+    197,1,108,245,80,7,38,155,22,111,184,197,67,44,108,151,210,228,78,223,154,20,72,162,
+    237,105,56,114,4,113,220,65,136,228,128,17,144,54,28,57,206,241,54,57,45,194,98,174,
+    218,145,247,36,167,69,70,47,85,120,228,232,81,38,78,57,110,162,45,161,8,25,203,43,
+    220,104,74,92,16,156,238,82,117,193,226,212,206,143,50,97,117,176,251,132,67,113,246,227,
+    219,227,44,174,139,191,77,215,116,242,140,105,78,157,244,23,190,183,181,79,183,112,42,129,
+    92,149,6,186,21,68,218,4,32,72,152,105,159,130,60,144,0,63,0,116,223,6,0,16,
+    97,86,30,142,66,148,5,185,229,17,88,83,117,185,78,42,101,146,88,146,136,44,9,0,
+    112,72,100,0,32,130,18,195,69,215,183,126,223,16,185,94,218,74,120,230,101,164,194,101,
+    90,94,12,65,167,230,55,139,58,63,77,78,235,205,52,171,116,91,85,170,50,137,141,244,
+    114,148,196,248,176,149,83,85,152,235,248,116,106,159,43,74,197,180,88,211,222,153,193,32,
+    193,28,76,224,169,8,96,92,73,222,193,204,208,152,181,177,233,61,35,37,87,65,16,32,
+    155,54,115,172,54,223,145,198,170,30,180,146,91,53,47,206,226,1,204,124,167,229,142,8,
+    149,133,184,4,222,152,101,253,133,241,161,161,33,22,153,65,122,192,181,113,61,152,35,48,
+    112,193,72,28,33,73,174,204,241,105,68,194,178,142,6,41,103,36,26,9,94,90,208,235,
+    156,84,93,157,167,214,237,77,116,125,17,214,120,249,14,109,164,163,177,193,177,176,83,98,
+    24,195,238,56,165,52,36,110,28,192,173,212,83,26,5,138,150,188,181,43,203,145,48,51,
+    58,183,132,161,14,61,194,136,254,156,224,22,161,59,250,122,137,113,162,37,45,81,156,120,
+    71,107,97,147,17,219,164,177,70,171,154,16,147,97,141,102,52,165,12,150,71,144,142,133,
+    44,155,17,52,196,184,39,220,240,214,212,47,140,131,65,108,90,105,33,214,122,186,201,8,
+    116,117,114,199,43,35,116,141,72,63,26,127,79,45,29,24,67,3,90,188,24,218,97,12,
+    177,13,10,58,49,5,48,101,164,140,38,172,79,79,20,49,248,55,252,86,201,0,104,222,
+    38,140,198,64,23,47,72,17,116,109,194,104,12,116,241,130,16,89,232,238,234,32,178,136,
+    36,16,140,140,52,143,25,233,163,151,184,164,100,146,73,70,148,36,18,0,36,75,18,36,
+    37,17,57,51,83,185,168,40,197,180,40,37,38,66,177,8,237,184,212,38,29,51,44,154,
+    83,196,183,24,118,178,142,211,183,103,127,176,132,89,4,78,38,162,19,34,22,236,77,27,
+    67,172,134,153,98,214,173,99,101,8,165,164,203,122,166,167,214,154,94,83,92,204,105,247,
+    136,27,68,68,77,3,21,21,165,152,122,126,228,75,167,146,25,14,226,184,6,6,227,181,
+    110,17,186,218,212,222,142,168,166,184,97,162,146,82,109,175,214,137,29,12,95,183,43,17,
+    75,203,193,40,189,174,70,130,90,164,20,115,68,241,12,31,223,42,171,25,39,34,60,136,
+    49,37,49,118,218,77,188,49,142,174,93,58,39,67,170,58,198,77,8,96,162,224,65,89,
+    245,99,109,160,164,210,11,244,88,40,65,167,72,20,24,136,62,84,9,167,135,39,97,34,
+    88,73,53,100,117,18,100,28,121,10,164,174,37,201,47,4,56,81,216,239,67,55,237,209,
+    108,86,99,66,163,221,17,6,136,19,36,36,98,232,212,202,138,163,77,74,185,99,116,135,
+    54,141,135,202,48,33,168,237,119,17,98,149,231,83,103,222,84,104,164,137,17,233,232,41,
+    140,142,18,69,133,220,70,139,33,153,11,18,239,245,20,23,192,29,42,34,167,27,133,61,
+    32,0,12,175,12,16,10,99,240,19,13,73,108,241,229,62,31,209,16,163,70,107,13,99,
+    131,1,144,8,185,51,24,0,126,38,116,218,64,241,146,128,16,122,103,66,167,13,20,47,
+    5,8,162,119,169,37,50,51,100,16,133,10,59,1,38,215,174,227,218,37,50,19,179,73,
+    44,73,0,0,41,77,68,2,3,96,8,72,150,74,76,136,65,232,73,123,137,186,76,197,
+    176,78,181,177,76,245,63,3,126,251,101,88,108,156,110,100,176,9,231,178,78,109,207,247,
+    132,127,27,167,42,218,154,166,189,103,1,140,54,133,121,93,22,92,13,116,182,126,193,88,
+    212,235,157,12,200,2,171,34,183,236,52,199,68,155,41,28,192,153,144,199,10,23,115,84,
+    96,82,34,175,97,5,13,3,139,1,43,29,175,99,73,20,36,179,224,88,35,223,37,43,
+    11,195,53,23,28,115,114,168,90,186,73,112,41,198,82,133,133,146,168,41,134,29,28,81,
+    0,157,56,152,11,146,10,84,204,180,80,98,32,163,12,8,35,218,49,100,126,234,134,85,
+    49,114,39,195,112,221,136,176,44,181,7,226,28,212,161,139,203,82,56,84,180,120,10,115,
+    134,217,247,17,179,170,243,70,11,180,195,17,78,135,78,63,16,229,232,118,71,129,102,168,
+    142,81,13,18,33,39,117,59,72,117,162,35,249,123,154,176,219,245,140,17,240,190,81,98,
+    211,97,156,244,26,46,234,227,76,235,234,220,111,91,177,5,49,184,104,66,253,17,155,6,
+    139,19,8,37,4,97,90,112,245,3,241,22,12,250,45,1,92,194,11,117,148,210,218,24,
+    2,161,59,58,119,32,8,116,18,69,158,146,16,10,98,248,185,75,15,160,208,71,132,132,
+    136,6,70,184,169,96,154,81,65,8,207,185,12,253,128,41,34,167,24,66,12,223,193,152,
+    1,30,38,148,76,194,238,47,40,64,247,37,20,76,98,118,253,208,105,64,239,61,17,50,
+    1,34,45,173,96,238,56,87,233,110,199,145,36,73,114,146,4,0,216,205,50,86,78,192,
+    218,49,54,28,97,185,142,47,34,134,10,183,130,197,133,30,226,226,66,160,40,171,99,131,
+    49,17,211,249,248,31,85,246,53,213,121,210,106,142,78,197,58,204,44,83,167,60,71,38,
+    166,190,85,181,150,139,239,75,132,87,179,24,17,21,194,99,56,230,20,198,224,144,43,227,
+    100,113,65,94,234,196,83,15,88,136,219,172,218,251,135,140,157,83,251,140,105,167,234,202,
+    220,82,150,164,83,158,220,122,237,221,117,225,169,76,167,84,179,212,14,68,244,12,214,162,
+    186,162,177,53,231,211,133,181,209,12,22,8,157,132,16,31,160,219,68,193,31,186,251,175,
+    46,72,198,104,241,26,101,152,33,2,153,71,114,16,11,38,7,15,22,161,154,16,233,182,
+    97,38,175,35,215,173,214,109,62,156,49,151,246,132,153,35,192,194,181,54,71,134,203,178,
+    6,115,40,104,183,67,11,133,125,62,212,48,13,70,37,49,40,48,161,197,216,249,25,183,
+    198,235,108,0,226,61,74,94,113,28,24,134,48,218,44,149,236,24,66,152,60,226,115,219,
+    70,15,152,30,206,16,2,186,211,165,158,98,147,99,236,199,233,75,147,131,54,70,179,126,
+    203,195,106,250,170,233,69,104,106,199,244,50,98,11,98,102,116,99,83,232,158,9,65,160,
+    211,204,132,193,100,84,172,33,196,192,1,147,0,116,244,134,144,25,146,47,3,216,36,196,
+    17,123,134,118,16,145,178,48,67,155,24,218,4,24,25,104,67,117,50,48,16,0,126,38,
+    236,70,166,195,0,240,206,130,205,232,44,37,48,34,36,223,62,9,93,206,237,92,197,170,
+    83,244,176,88,98,54,145,34,5,0,16,39,16,3,51,5,161,136,74,154,64,32,138,233,
+    192,9,59,195,9,199,39,125,217,169,189,35,123,17,52,12,63,219,196,222,73,31,117,107,
+    138,157,175,168,197,179,152,109,153,230,127,36,139,114,170,62,157,118,235,194,235,177,36,172,
+    163,140,94,132,235,113,37,215,161,93,249,33,106,28,86,103,95,74,69,197,95,142,227,82,
+    84,138,238,194,131,205,165,80,232,99,48,50,153,150,234,202,49,122,122,228,58,101,225,58,
+    46,69,197,111,230,224,178,19,180,71,7,177,168,145,74,178,91,187,157,4,157,94,74,175,
+    225,203,133,99,135,246,43,31,62,7,225,12,203,253,253,48,100,128,33,183,232,85,213,204,
+    113,5,235,52,110,108,57,172,193,234,69,0,114,61,94,135,210,239,245,151,74,153,48,161,
+    135,65,87,7,157,78,163,215,95,5,117,58,157,142,91,36,200,245,184,33,215,73,35,250,
+    189,108,194,132,213,85,245,22,24,114,213,139,162,20,221,154,76,5,144,244,87,161,146,222,
+    223,176,12,167,147,3,230,242,40,93,104,20,28,26,229,36,190,191,185,213,215,221,171,59,
+    195,121,214,162,149,167,250,169,27,113,201,36,30,213,153,114,79,163,223,102,206,38,149,107,
+    117,71,63,156,254,230,73,107,175,57,108,37,173,11,0,167,92,120,135,165,107,244,197,190,
+    233,247,134,70,114,216,181,203,12,13,16,216,245,163,127,247,158,254,51,122,62,123,43,77,
+    185,250,173,171,85,166,250,70,223,232,227,36,250,76,245,81,241,131,62,192,216,4,
+};
+
+// assets/sounds/sfx_point.ogg
+static const Uint8 AB_DATA_4[] = {
+    79,103,103,83,0,2,0,0,0,0,0,0,0,0,216,210,103,75,0,0,0,0,7,113,
+    105,48,1,30,1,118,111,114,98,105,115,0,0,0,0,2,68,172,0,0,0,0,0,0,
+    0,238,2,0,0,0,0,0,184,1,79,103,103,83,0,0,0,0,0,0,0,0,0,0,
+    216,210,103,75,1,0,0,0,52,118,99,49,16,61,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,113,3,118,111,114,98,105,115,45,0,0,0,88,105,112,104,46,79,114,103,
+    32,108,105,98,86,111,114,98,105,115,32,73,32,50,48,49,48,49,49,48,49,32,40,83,
+    99,104,97,117,102,101,110,117,103,103,101,116,41,0,0,0,0,1,5,118,111,114,98,105,
+    115,43,66,67,86,1,0,8,0,0,0,49,76,32,197,128,208,144,85,0,0,16,0,0,
+    96,36,41,14,147,102,73,41,165,148,161,40,121,152,148,72,73,41,165,148,197,48,137,152,
+    148,137,197,24,99,140,49,198,24,99,140,49,198,24,99,140,32,52,100,21,0,0,4,0,
+    128,40,9,142,163,230,73,106,206,57,103,24,39,142,114,160,57,105,78,56,167,32,7,138,
+    81,224,57,9,194,245,38,99,110,166,180,166,107,110,206,41,37,8,13,89,5,0,0,2,
+    0,64,72,33,133,20,82,72,33,133,20,98,136,33,134,24,98,136,33,135,28,114,200,33,
+    167,156,114,10,42,168,160,130,10,50,200,32,131,76,50,233,164,147,78,58,233,168,163,142,
+    58,234,40,180,208,66,11,45,180,210,74,76,49,213,86,99,174,189,6,93,124,115,206,57,
+    231,156,115,206,57,231,156,115,206,9,66,67,86,1,0,32,0,0,4,66,6,25,100,16,
+    66,8,33,133,20,82,136,41,166,152,114,10,50,200,128,208,144,85,0,0,32,0,128,0,
+    0,0,0,71,145,20,73,177,20,203,177,28,205,209,36,79,242,44,81,19,53,209,51,69,
+    83,84,77,85,85,85,85,117,93,87,118,101,215,118,117,215,118,125,89,152,133,91,184,125,
+    89,184,133,91,216,133,93,247,133,97,24,134,97,24,134,97,24,134,97,248,125,223,247,125,
+    223,247,125,32,52,100,21,0,32,1,0,160,35,57,150,227,41,162,34,26,162,226,57,162,
+    3,132,134,172,2,0,100,0,0,4,0,32,9,146,34,41,146,163,73,166,102,106,174,105,
+    155,182,104,171,182,109,203,178,44,203,178,12,132,134,172,2,0,0,1,0,4,0,0,0,
+    0,0,160,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,102,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,64,104,200,42,0,64,2,0,64,199,113,
+    28,199,113,36,69,82,36,199,114,44,7,8,13,89,5,0,200,0,0,8,0,64,82,44,
+    197,114,52,71,115,52,199,115,60,199,115,60,71,116,68,201,148,76,205,244,76,15,8,13,
+    89,5,0,0,2,0,8,0,0,0,0,0,64,49,28,197,113,28,201,209,36,79,82,45,
+    211,114,53,87,115,61,215,115,77,215,117,93,87,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,129,
+    208,144,85,0,0,4,0,0,33,157,102,150,106,128,8,51,144,97,32,52,100,21,0,128,
+    0,0,0,24,161,8,67,12,8,13,89,5,0,0,4,0,0,136,161,228,32,154,208,154,
+    243,205,57,14,154,229,160,169,20,155,211,193,137,84,155,39,185,169,152,155,115,206,57,231,
+    156,108,206,25,227,156,115,206,41,202,153,197,160,153,208,154,115,206,73,12,154,165,160,153,
+    208,154,115,206,121,18,155,7,173,169,210,154,115,206,25,231,156,14,198,25,97,156,115,206,
+    105,210,154,7,169,217,88,155,115,206,89,208,154,230,168,185,20,155,115,206,137,148,155,39,
+    181,185,84,155,115,206,57,231,156,115,206,57,231,156,115,206,169,94,156,206,193,57,225,156,
+    115,206,137,218,155,107,185,9,93,156,115,206,249,100,156,238,205,9,225,156,115,206,57,231,
+    156,115,206,57,231,156,115,206,9,66,67,86,1,0,64,0,0,4,97,216,24,198,157,130,
+    32,125,142,6,98,20,33,166,33,147,30,116,143,14,147,160,49,200,41,164,30,141,142,70,
+    74,169,131,80,82,25,39,165,116,130,208,144,85,0,0,32,0,0,132,16,82,72,33,133,
+    20,82,72,33,133,20,82,72,33,134,24,98,136,33,167,156,114,10,42,168,164,146,138,42,
+    202,40,179,204,50,203,44,179,204,50,203,172,195,206,58,235,176,195,16,67,12,49,180,210,
+    74,44,53,213,86,99,141,181,230,158,115,174,57,72,107,165,181,214,90,43,165,148,82,74,
+    41,165,32,52,100,21,0,0,2,0,64,32,100,144,65,6,25,133,20,82,72,33,134,152,
+    114,202,41,167,160,130,10,8,13,89,5,0,0,2,0,8,0,0,0,240,36,207,17,29,
+    209,17,29,209,17,29,209,17,29,209,17,29,207,241,28,81,18,37,81,18,37,209,50,45,
+    83,51,61,85,84,85,87,118,109,89,151,117,219,183,133,93,216,117,223,215,125,223,215,141,
+    95,23,134,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,9,66,67,86,1,
+    0,32,0,0,0,66,8,33,132,20,82,72,33,133,148,98,140,49,199,156,131,78,66,9,
+    129,208,144,85,0,0,32,0,128,0,0,0,0,71,113,20,199,145,28,201,145,36,75,178,
+    36,77,210,44,205,242,52,79,243,52,209,19,69,81,52,77,83,21,93,209,21,117,211,22,
+    101,83,54,93,211,53,101,211,85,101,213,118,101,217,182,101,91,183,125,89,182,125,223,247,
+    125,223,247,125,223,247,125,223,247,125,223,215,117,32,52,100,21,0,32,1,0,160,35,57,
+    146,34,41,146,34,57,142,227,72,146,4,132,134,172,2,0,100,0,0,4,0,160,40,142,
+    226,56,142,35,73,146,36,89,146,38,121,150,103,137,154,169,153,158,233,169,162,10,132,134,
+    172,2,0,0,1,0,4,0,0,0,0,0,160,104,138,167,152,138,167,136,138,231,136,142,
+    40,137,150,105,137,154,170,185,162,108,202,174,235,186,174,235,186,174,235,186,174,235,186,174,
+    235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,64,
+    104,200,42,0,64,2,0,64,71,114,36,71,114,36,69,82,36,69,114,36,7,8,13,89,
+    5,0,200,0,0,8,0,192,49,28,67,82,36,199,178,44,77,243,52,79,243,52,209,19,
+    61,209,51,61,85,116,69,23,8,13,89,5,0,0,2,0,8,0,0,0,0,0,192,144,
+    12,75,177,28,205,209,36,81,82,45,213,82,53,213,82,45,85,84,61,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,213,52,77,211,52,129,208,144,149,0,0,25,0,0,2,41,197,154,132,80,
+    146,65,78,74,236,69,105,198,32,7,173,6,229,41,132,24,147,216,139,233,152,66,200,81,
+    80,42,100,12,25,228,64,201,212,49,134,16,243,98,99,167,20,66,204,139,241,165,115,140,
+    65,47,198,184,82,66,40,193,8,66,67,86,4,0,81,0,0,6,73,34,73,36,73,242,
+    52,162,72,244,36,205,35,138,60,17,128,36,122,60,143,231,73,158,200,243,120,30,0,73,
+    20,121,30,207,147,68,145,231,241,60,1,0,0,1,14,0,0,1,22,66,161,33,43,2,
+    128,56,1,0,139,36,121,30,73,242,60,146,228,121,52,77,20,33,138,146,166,137,34,207,
+    51,77,158,102,138,76,83,85,161,170,146,166,137,34,207,51,77,154,39,154,76,83,85,161,
+    170,158,40,170,42,85,117,93,170,233,186,100,219,182,97,203,158,40,170,42,85,117,93,166,
+    234,186,108,217,182,33,219,0,0,0,36,79,83,77,154,102,154,52,205,52,137,162,106,66,
+    85,37,205,51,85,154,102,154,52,205,52,137,162,169,66,85,61,83,116,93,166,233,186,76,
+    211,117,185,174,44,67,150,61,209,116,93,166,169,186,76,211,117,185,174,44,67,150,1,0,
+    0,72,158,167,170,52,205,52,105,154,105,18,69,83,133,106,74,158,167,170,52,205,52,105,
+    154,105,18,69,85,133,169,122,166,233,186,76,211,117,153,166,235,114,101,89,134,45,123,166,
+    233,186,76,211,117,153,166,235,146,93,89,134,44,3,0,0,208,76,211,150,137,162,236,18,
+    69,215,101,154,174,11,215,213,76,83,182,137,162,43,19,69,215,101,154,174,11,215,21,85,
+    213,150,169,166,45,83,85,89,230,186,178,12,89,22,85,85,182,153,170,108,83,85,89,230,
+    186,178,12,89,6,0,0,0,0,0,0,0,0,128,168,170,182,77,85,101,153,106,202,50,
+    215,149,101,200,178,168,170,182,77,85,101,153,169,202,50,215,181,101,200,178,0,0,128,1,
+    7,0,128,0,19,202,64,161,33,43,1,128,40,0,0,135,226,88,150,166,137,34,199,177,
+    44,77,19,77,142,99,89,154,102,138,36,73,211,60,207,52,161,89,158,103,154,208,52,81,
+    84,85,104,154,40,170,42,0,0,2,0,0,10,28,0,0,2,108,208,148,88,28,160,208,
+    144,149,0,64,72,0,128,195,113,44,75,211,60,207,243,68,81,52,77,147,227,88,150,231,
+    137,162,40,154,166,105,170,42,199,177,44,207,19,69,81,52,77,211,84,85,150,165,105,158,
+    39,138,162,104,154,170,170,170,208,52,207,19,69,81,52,77,85,85,85,104,154,40,154,166,
+    105,170,170,170,186,46,52,77,20,77,211,52,85,85,85,93,23,154,230,121,162,104,154,170,
+    234,186,174,11,60,79,20,77,83,85,93,215,117,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,4,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,9,23,
+    30,128,66,67,86,4,0,81,0,0,128,49,136,49,197,152,81,10,66,41,37,52,74,65,
+    9,37,148,10,66,105,169,164,148,73,72,173,181,214,50,41,169,181,214,90,37,165,180,150,
+    90,203,160,164,214,90,107,153,132,214,90,107,173,0,0,176,3,7,0,176,3,11,161,208,
+    144,149,0,64,30,0,0,130,140,82,140,57,231,28,53,70,41,198,156,115,142,26,163,20,
+    99,206,57,71,149,82,202,57,231,32,164,148,42,197,156,115,14,82,74,25,115,206,57,231,
+    40,165,140,57,231,156,115,148,82,231,156,115,206,57,74,169,148,206,57,231,28,165,84,74,
+    231,156,115,142,82,42,37,99,206,57,39,0,0,168,192,1,0,32,192,70,145,205,9,70,
+    130,10,13,89,9,0,164,2,0,24,28,199,178,60,207,243,76,209,52,45,73,210,52,81,
+    20,69,211,84,85,75,146,52,77,20,77,81,53,85,149,101,105,154,40,154,166,170,186,46,
+    77,211,52,81,52,77,85,117,93,170,234,121,166,169,170,174,235,186,84,87,244,76,83,85,
+    93,87,150,1,0,0,0,0,0,0,0,0,0,1,0,224,9,14,0,64,5,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,3,0,0,49,6,33,100,12,66,200,24,132,20,66,
+    8,41,165,16,18,0,0,48,224,0,0,16,96,66,25,40,52,100,37,0,144,10,0,0,
+    24,163,148,115,206,73,73,165,66,136,49,231,32,148,210,82,133,16,99,206,65,40,165,165,
+    168,49,198,32,148,146,82,107,81,99,140,65,40,37,165,214,162,107,33,148,146,82,74,173,
+    69,215,66,40,37,165,214,90,139,82,170,84,74,106,173,197,24,165,84,169,148,214,90,139,
+    49,74,169,115,74,173,197,24,99,148,82,247,148,90,139,177,214,40,165,116,50,198,24,99,
+    173,205,57,231,100,140,49,198,90,11,0,64,104,112,0,0,59,176,97,117,132,147,162,177,
+    192,66,67,86,2,0,121,0,0,8,66,74,49,198,24,99,16,33,165,24,99,204,49,135,
+    144,82,140,49,198,24,84,138,49,198,28,99,14,66,200,24,99,140,49,7,33,100,140,49,
+    231,156,131,16,50,198,24,99,206,65,8,157,115,142,49,231,32,132,208,57,199,152,115,16,
+    66,231,156,99,204,57,8,161,115,140,49,230,156,0,0,160,2,7,0,128,0,27,69,54,
+    39,24,9,42,52,100,37,0,16,14,0,0,24,195,152,115,140,57,6,157,132,10,33,231,
+    32,116,14,66,42,169,84,8,57,7,161,115,16,74,73,169,120,14,58,41,33,148,82,74,
+    42,197,115,16,74,9,161,148,148,90,43,46,134,82,74,40,165,164,212,82,145,49,132,82,
+    74,41,37,165,214,138,49,166,132,144,82,74,169,181,86,140,49,161,132,84,82,74,41,182,
+    98,140,141,165,164,212,90,107,173,21,99,108,44,37,149,214,90,107,173,24,99,140,107,41,
+    181,22,99,172,197,24,99,92,75,169,165,24,107,44,198,24,227,123,106,45,198,88,99,49,
+    198,24,159,91,106,41,166,92,11,0,48,121,112,0,128,74,176,113,134,149,164,179,194,209,
+    224,66,67,86,2,0,185,1,0,8,66,74,49,198,152,99,206,57,231,156,115,206,73,165,
+    24,115,206,57,231,32,132,16,66,8,33,148,74,49,230,156,115,206,65,7,33,132,16,66,
+    40,25,115,206,57,7,33,132,16,66,8,33,132,80,82,234,152,115,14,66,8,33,132,16,
+    66,8,33,165,212,57,231,32,132,16,66,8,33,132,16,66,74,169,115,206,65,8,33,132,
+    16,66,8,33,132,148,82,8,33,132,16,66,8,33,132,16,66,8,41,165,148,66,8,33,
+    132,16,66,8,33,148,18,82,74,41,133,16,66,8,37,132,18,74,8,37,164,148,82,10,
+    33,132,16,66,41,165,132,82,66,73,41,165,20,66,8,165,148,80,74,41,161,148,144,82,
+    74,41,165,16,66,40,165,148,80,74,41,37,165,148,82,74,37,148,82,74,41,37,148,80,
+    74,74,41,165,148,74,40,161,148,80,74,41,165,148,148,82,74,41,149,82,74,41,37,148,
+    82,74,9,41,165,148,82,74,169,148,82,74,41,165,148,82,82,74,41,165,148,82,41,165,
+    148,82,74,41,165,164,148,82,74,41,165,82,74,41,165,148,18,74,73,41,165,148,82,74,
+    165,148,80,74,41,165,148,82,82,74,41,165,148,74,10,165,148,82,74,41,165,0,0,160,
+    3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,133,134,172,4,0,
+    82,1,0,0,66,40,165,148,82,74,41,53,140,81,74,41,165,148,82,138,28,164,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,149,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,1,192,221,23,14,128,62,19,54,172,142,
+    112,82,52,22,88,104,200,74,0,32,21,0,0,48,134,49,198,152,114,206,57,165,148,115,
+    206,57,6,157,148,72,41,231,32,116,78,74,41,61,132,16,66,8,157,132,148,122,7,33,
+    132,16,66,41,41,245,24,67,40,33,148,148,82,235,177,134,78,58,8,165,180,212,107,15,
+    33,132,148,90,106,169,247,30,50,168,40,165,146,82,239,61,181,80,82,106,41,198,222,123,
+    75,37,179,210,90,107,189,231,222,75,42,41,198,218,122,239,57,183,146,82,76,45,22,0,
+    96,18,225,0,128,184,96,195,234,8,39,69,99,129,133,134,172,2,0,98,0,0,8,67,
+    12,66,72,41,165,148,82,74,41,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,
+    198,24,99,140,49,1,0,128,9,14,0,0,1,86,176,43,179,180,106,163,184,169,147,188,
+    232,131,192,39,116,196,102,100,200,165,84,204,228,68,208,35,53,212,98,37,216,161,21,220,
+    224,5,96,161,33,43,1,0,50,0,0,196,81,172,53,198,94,43,98,24,132,146,106,44,
+    13,65,140,65,137,185,101,198,40,229,36,230,214,41,165,148,147,88,83,200,148,82,204,89,
+    138,37,116,76,41,70,41,166,18,66,198,148,164,24,99,140,41,116,210,90,206,61,183,84,
+    74,11,0,0,128,32,0,192,64,132,204,4,2,5,80,96,32,3,0,14,16,18,164,0,
+    128,194,2,67,199,112,17,16,144,75,200,40,48,40,28,19,206,73,167,13,0,64,16,34,
+    51,68,34,98,49,72,76,168,6,138,138,233,0,96,113,129,33,31,0,50,52,54,210,46,
+    46,160,203,0,23,116,113,215,129,16,130,16,132,32,22,7,80,64,2,14,78,184,225,137,
+    55,60,225,6,39,232,20,149,58,16,0,0,0,0,0,8,0,120,0,0,72,54,128,136,
+    104,102,230,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,4,0,0,0,0,0,
+    16,0,62,0,0,146,21,32,34,154,153,57,142,14,143,15,144,16,145,17,146,18,147,19,
+    148,20,149,0,0,64,0,1,0,0,0,0,16,64,0,2,2,2,0,0,0,0,0,1,
+    0,0,0,2,2,79,103,103,83,0,0,64,97,0,0,0,0,0,0,216,210,103,75,2,
+    0,0,0,175,162,216,42,34,1,1,1,1,1,1,1,1,119,114,124,119,255,70,174,173,
+    169,255,134,255,112,203,176,172,155,158,145,161,153,162,156,165,160,187,0,10,14,14,14,6,
+    0,0,212,29,203,86,102,23,143,226,112,55,137,208,210,149,217,226,81,44,187,91,69,13,
+    21,101,165,112,102,171,58,69,74,41,38,161,70,6,51,145,187,4,40,136,138,179,184,144,
+    22,161,132,98,162,148,189,99,58,157,204,104,58,114,28,199,236,45,126,139,31,211,206,206,
+    199,49,117,96,99,117,136,141,216,154,22,139,213,30,75,89,213,198,176,157,102,76,167,14,
+    213,129,197,222,222,226,64,29,170,3,167,246,14,13,127,57,190,149,190,10,215,21,3,37,
+    0,172,61,139,159,248,51,187,215,63,67,133,1,181,115,209,135,45,126,226,207,237,158,127,
+    7,147,199,220,170,177,179,226,72,21,41,69,89,179,36,109,81,67,101,101,138,20,69,173,
+    40,19,169,40,218,23,181,69,236,2,100,219,16,0,136,34,72,51,65,42,3,11,54,130,
+    76,34,136,38,132,178,203,69,165,144,82,132,93,8,25,209,229,246,182,22,191,45,134,96,
+    154,182,211,59,105,103,153,32,45,167,244,85,3,141,153,215,129,0,0,124,93,139,92,245,
+    127,17,231,252,59,1,43,62,171,86,74,3,92,92,184,48,86,191,158,107,252,74,176,225,
+    23,136,214,88,91,154,248,21,230,184,170,183,43,193,146,101,13,69,96,38,118,16,162,162,
+    34,64,235,129,247,3,3,34,171,75,168,156,34,40,184,156,146,233,94,43,87,173,227,143,
+    146,130,14,16,153,50,193,70,40,186,140,98,129,100,72,166,173,52,1,224,247,30,11,6,
+    64,38,70,1,6,32,116,32,75,58,6,233,227,151,95,190,76,128,16,28,6,12,0,148,
+    101,139,67,253,254,169,94,197,75,136,30,22,175,85,235,75,67,222,221,184,56,215,119,93,
+    126,154,73,176,199,93,252,214,88,95,26,237,207,40,138,146,182,249,133,122,192,166,172,172,
+    40,33,179,186,140,124,160,168,74,192,3,119,11,45,139,168,174,4,131,12,0,59,53,25,
+    206,82,89,207,11,56,148,75,193,164,43,45,224,112,77,32,0,76,52,170,179,130,1,4,
+    61,30,178,7,6,0,226,2,81,48,0,160,158,96,6,0,246,44,64,0,192,188,186,103,
+    181,62,186,222,206,191,42,87,238,158,7,122,219,8,221,255,129,198,111,240,49,235,237,58,
+    86,217,120,246,197,155,158,141,160,138,65,41,225,233,13,32,70,63,117,170,143,0,24,13,
+    118,16,33,94,32,35,107,168,174,142,140,4,1,229,38,11,19,9,0,8,41,202,31,15,
+    28,0,0,103,0,64,28,249,120,16,50,0,194,241,145,40,6,29,4,0,9,0,0,88,
+    141,101,12,226,188,229,192,246,179,93,214,167,242,238,247,203,229,149,202,42,169,139,162,41,
+    154,162,41,154,114,9,132,2,161,136,184,136,56,45,74,19,38,98,174,168,64,233,79,43,
+    91,74,132,65,32,48,243,162,26,15,51,198,31,185,60,67,58,218,140,134,80,66,189,156,
+    193,196,196,46,28,0,0,0,0,224,134,117,0,0,230,196,58,12,52,250,212,112,250,253,
+    190,120,134,39,32,166,141,189,157,95,126,251,219,113,127,59,114,204,129,173,209,106,88,237,
+    166,119,224,112,58,123,31,94,199,192,28,215,113,253,174,227,58,193,156,78,14,164,236,92,
+    6,224,230,116,58,195,23,190,240,117,187,221,110,6,61,251,253,128,155,211,233,116,58,157,
+    225,243,250,43,142,43,147,9,0,128,213,85,81,215,51,76,195,199,217,234,212,214,183,95,
+    126,3,68,138,138,138,231,154,198,206,174,28,112,176,92,134,181,250,108,22,0,0,8,83,
+    165,82,152,18,70,2,104,131,209,12,0,158,71,101,111,247,189,215,15,31,70,183,197,47,
+    4,35,201,149,88,236,210,119,250,126,231,195,167,221,15,241,139,96,36,57,34,208,43,1,
+    32,84,21,18,8,5,0,180,105,27,0,12,118,16,170,159,1,128,144,163,178,186,29,0,
+    32,4,229,143,54,37,0,192,74,0,64,117,128,144,1,32,170,1,80,14,8,0,0,0,
+    0,10,5,20,132,82,185,49,126,38,84,81,6,0,0,232,134,155,100,161,65,68,2,0,
+    0,52,50,238,44,228,147,2,0,0,211,202,202,51,179,6,0,0,160,255,113,0,0,136,
+    1,0,0,0,0,0,164,222,4,0,0,0,34,190,4,131,156,90,138,91,221,48,183,21,
+    211,92,8,0,0,0,208,221,5,0,0,120,100,0,32,34,0,126,7,133,239,244,189,215,
+    72,250,101,172,71,46,122,141,68,146,143,137,92,252,106,223,127,141,248,48,187,45,23,126,
+    70,2,73,16,20,161,28,0,0,132,2,0,84,95,0,24,236,192,132,250,0,16,10,32,
+    219,1,0,2,202,95,20,237,0,0,6,3,8,16,50,0,68,53,0,202,1,0,0,0,
+    0,0,40,3,0,0,2,217,6,221,181,163,2,0,160,178,164,211,145,239,79,161,0,0,
+    16,161,205,118,66,195,1,0,0,224,12,32,6,0,0,0,0,0,0,0,0,132,150,36,
+    0,0,0,32,138,23,49,240,197,175,13,76,0,184,14,21,17,107,221,56,68,106,8,96,
+    64,128,32,34,42,230,156,169,172,63,141,220,16,34,0,208,0,0,124,34,0,0,94,39,
+    165,175,244,189,215,71,249,101,244,95,57,254,141,164,71,112,78,228,178,119,253,126,125,196,
+    135,93,159,226,23,192,72,66,146,27,122,37,0,132,170,210,4,66,1,0,237,237,9,192,
+    96,7,89,184,70,2,32,228,168,136,74,0,64,72,40,191,246,149,0,0,131,1,156,32,
+    100,0,136,106,0,148,7,0,0,0,0,42,20,80,16,133,210,66,154,135,70,27,230,2,
+    0,160,232,112,234,224,242,8,0,0,64,94,244,242,53,71,110,65,0,0,0,90,154,205,
+    132,2,0,0,208,218,218,1,0,0,0,0,0,0,0,0,75,101,119,0,0,0,16,145,
+    32,6,85,157,157,110,250,172,148,229,20,0,0,0,0,128,31,0,192,206,71,1,0,254,
+    38,29,156,206,95,245,17,213,241,227,1,210,33,178,235,224,118,104,220,254,162,141,168,78,
+    120,123,0,117,224,228,62,208,182,109,219,182,109,219,6,166,149,3,192,241,26,152,40,3,
+    80,145,9,196,21,109,0,43,1,135,28,170,26,16,66,13,149,0,64,90,209,1,52,20,
+    10,96,146,152,46,1,0,0,0,0,136,44,240,112,115,57,38,1,85,185,149,91,149,0,
+    155,80,84,92,76,64,17,56,66,134,16,66,0,0,124,122,251,47,224,232,186,174,235,58,
+    37,244,37,18,97,21,32,234,136,203,180,168,208,1,33,132,16,66,0,128,218,220,31,146,
+    153,153,65,220,57,229,18,46,12,20,0,0,196,40,49,153,128,25,68,38,4,80,66,8,
+    33,132,16,37,126,197,54,10,216,218,219,59,156,209,49,199,28,115,204,161,195,233,109,109,
+    173,166,129,28,199,227,241,120,60,30,143,199,113,24,19,19,211,91,240,229,152,191,253,50,
+    17,0,64,68,133,227,56,142,223,239,247,120,252,126,199,113,194,162,35,240,46,87,207,193,
+    154,77,0,0,192,172,52,249,232,232,232,232,232,152,198,196,196,196,68,166,147,78,215,97,
+    29,214,97,214,232,116,58,0,168,145,187,220,232,58,232,144,74,83,180,51,49,49,49,49,
+    49,49,61,99,117,234,232,232,232,232,152,5,219,19,19,211,197,217,89,96,123,98,98,98,
+    34,131,78,29,29,29,29,2,0,0,170,147,53,53,78,154,152,142,70,96,194,66,160,211,
+    133,180,192,129,90,232,154,20,65,51,49,105,98,98,34,66,71,71,71,71,71,199,52,24,
+    19,61,184,0,0,0,32,8,215,35,5,0,219,19,19,211,129,78,211,166,77,155,5,236,
+    78,207,0,23,222,6,221,200,188,252,207,254,79,193,79,249,115,193,83,65,130,189,133,220,
+    13,231,93,226,57,63,68,63,237,235,130,161,44,57,244,151,233,186,174,235,186,110,239,58,
+    224,5,0,20,53,135,149,106,172,172,37,0,128,50,0,69,53,160,0,152,149,103,69,13,
+    149,0,176,18,136,131,135,100,0,252,50,35,39,108,47,50,0,34,160,252,40,242,1,173,
+    0,0,193,77,80,59,219,0,76,0,132,32,240,13,32,13,1,0,0,0,101,51,196,202,
+    188,66,129,144,50,194,18,48,53,74,40,21,23,23,17,82,12,66,11,68,69,60,88,134,
+    101,88,66,9,5,135,29,46,243,249,160,201,18,36,5,19,19,19,83,9,0,176,35,197,
+    142,209,16,8,5,0,0,32,76,209,132,136,131,49,13,196,69,9,159,199,130,80,66,9,
+    101,98,146,185,78,149,36,0,136,39,34,43,11,196,36,210,76,41,161,0,136,249,232,254,
+    61,128,216,0,80,8,129,120,8,26,65,51,96,174,222,245,184,20,166,0,0,0,132,134,
+    67,152,176,2,0,0,0,177,250,246,99,99,53,70,97,156,176,179,183,177,181,88,13,21,
+    16,21,211,0,0,0,48,153,167,223,239,247,233,118,195,26,214,176,134,53,172,97,181,86,
+    223,239,247,251,9,208,185,219,237,58,253,126,191,223,239,247,251,1,171,171,215,235,245,122,
+    68,10,7,48,156,176,155,0,200,72,81,233,206,1,206,214,86,2,160,15,91,9,0,176,
+    135,177,72,1,205,68,10,223,204,60,152,0,252,62,86,6,140,158,155,91,9,152,155,203,
+    128,0,241,252,248,24,0,108,246,59,0,62,23,205,125,85,191,120,255,161,246,175,72,134,
+    39,239,252,22,185,217,175,217,175,220,35,130,255,251,159,75,207,153,212,56,240,43,7,0,
+    213,210,96,207,234,11,0,32,100,0,212,44,18,24,236,25,147,23,1,128,242,8,94,25,
+    253,242,149,0,0,40,63,196,175,100,0,0,231,64,187,0,0,102,128,242,0,0,0,0,
+    0,42,20,80,232,232,131,219,218,236,161,64,196,40,205,1,0,0,0,0,0,0,144,20,
+    49,5,128,40,19,116,170,157,9,74,1,0,0,160,41,244,199,159,85,10,134,215,40,0,
+    0,0,0,22,205,0,0,0,0,0,129,198,16,0,0,128,169,22,87,236,203,194,170,199,
+    76,77,2,0,0,0,81,39,1,100,180,204,116,170,2,0,96,129,172,234,10,0,0,243,
+    120,12,0,0,0,128,20,135,2,0,128,250,49,26,0,0,0,128,244,157,0,0,62,7,
+    205,255,116,191,28,127,208,255,95,119,166,141,116,243,75,228,102,191,38,191,124,127,216,254,
+    238,255,114,141,76,106,89,232,5,0,162,114,34,97,176,23,39,69,2,0,33,133,193,238,
+    252,214,75,0,64,98,176,19,121,13,0,128,193,240,2,0,54,118,0,40,2,208,1,0,
+    0,0,40,72,40,16,24,168,249,230,203,225,158,161,34,216,40,0,0,0,0,132,156,40,
+    254,222,60,193,0,0,0,128,70,243,233,87,251,21,46,161,42,0,0,0,48,60,242,47,
+    209,1,0,0,0,0,92,5,87,2,0,0,80,248,24,172,227,44,0,0,0,40,125,3,
+    0,168,211,58,1,128,2,41,127,2,0,0,0,128,86,6,0,128,129,2,0,128,11,0,
+    104,175,0,128,27,1,30,7,205,124,117,191,172,31,114,255,127,187,98,149,171,190,196,173,
+    253,57,250,229,125,196,236,243,233,50,207,20,126,2,189,4,64,78,80,164,193,222,86,27,
+    0,64,8,188,58,0,0,48,216,137,150,171,1,0,80,126,168,29,9,0,56,3,242,200,
+    0,0,3,105,0,0,0,128,130,4,32,21,213,140,89,222,90,145,39,244,102,130,0,0,
+    0,0,224,10,0,208,132,222,251,245,49,195,20,3,0,0,0,64,44,124,0,0,0,0,
+    0,232,169,89,3,0,0,80,42,63,121,106,239,253,149,102,78,66,0,0,0,224,27,0,
+    184,102,1,54,35,104,191,227,106,209,89,68,0,0,0,0,32,49,1,0,0,128,48,2,
+    208,5,170,11,0,192,33,0,68,0,30,247,204,125,173,254,76,63,148,254,255,78,7,82,
+    249,234,62,220,230,190,14,191,114,30,158,253,249,41,109,59,19,120,9,244,2,128,140,137,
+    68,24,236,197,170,8,0,32,32,24,108,62,119,250,111,0,0,96,176,19,151,174,6,0,
+    64,249,161,93,17,0,128,33,192,8,32,0,0,0,0,0,0,128,40,163,250,8,117,82,
+    192,93,145,1,0,0,0,128,252,240,226,131,92,14,0,0,0,160,237,150,29,51,58,76,
+    49,5,0,0,0,96,18,75,18,0,0,0,160,224,170,168,0,0,0,0,184,62,64,1,
+    176,0,112,228,212,49,0,0,1,192,64,40,5,96,112,193,7,208,5,42,0,254,246,204,
+    126,237,126,153,135,217,127,207,233,50,184,242,39,185,22,106,195,207,197,15,207,31,158,253,
+    254,155,178,160,66,4,64,47,1,144,85,37,175,14,0,0,12,118,227,153,22,0,0,6,
+    187,240,145,203,0,0,6,195,1,128,21,72,0,129,68,10,0,0,0,0,0,0,80,16,
+    21,148,84,44,107,16,0,88,229,254,186,129,241,114,0,0,0,64,61,168,197,115,207,40,
+    111,169,0,0,0,0,132,185,140,25,0,0,0,0,88,164,12,12,0,0,184,197,45,248,
+    0,0,0,0,213,93,63,179,231,115,165,103,5,17,0,0,0,0,0,5,184,21,64,3,
+    240,8,248,240,81,126,1,64,1,31,0,62,231,204,254,92,252,11,15,239,254,127,79,87,
+    83,42,63,160,80,155,249,218,253,242,252,240,211,191,123,202,162,66,85,160,115,0,50,218,
+    223,62,6,123,123,73,17,0,0,131,221,120,210,2,0,192,96,71,123,2,0,160,252,144,
+    135,0,0,80,30,68,10,4,0,0,0,0,0,0,0,32,56,18,68,197,251,182,43,8,
+    0,0,0,0,99,235,220,233,214,138,0,0,0,0,40,76,119,58,7,26,2,0,0,128,
+    4,114,177,0,0,0,224,22,10,158,202,19,0,0,0,192,151,3,192,180,233,167,83,0,
+    224,87,212,10,184,208,46,62,0,10,16,0,62,231,204,254,186,139,160,232,195,255,254,123,
+    118,151,213,229,30,24,204,102,63,183,126,100,31,43,168,63,103,42,103,34,64,188,0,64,
+    237,246,135,193,222,166,126,1,0,128,96,176,107,57,239,124,0,0,6,59,218,1,0,160,
+    252,144,135,3,0,48,24,4,16,72,0,1,0,0,0,16,200,156,0,0,36,47,4,249,
+    206,239,142,162,160,22,0,0,0,242,14,114,141,38,90,249,4,0,0,0,16,41,34,95,
+    14,40,0,0,0,0,32,118,151,0,0,0,0,64,68,147,16,0,0,240,235,148,247,149,
+    123,134,134,174,93,110,13,194,198,9,0,0,0,124,249,6,44,160,224,150,234,243,84,160,
+    66,1,21,32,0,30,215,204,252,122,248,21,110,241,254,187,203,113,42,55,98,48,27,126,
+    221,252,114,191,165,247,231,238,202,110,1,129,46,0,160,214,52,216,99,114,9,0,192,96,
+    207,120,22,0,0,6,27,89,83,117,0,0,131,161,5,0,229,17,72,34,9,0,0,0,
+    0,118,16,0,0,12,121,11,29,126,34,63,20,0,0,0,0,246,95,61,255,2,19,1,
+    0,0,0,64,52,251,244,162,19,9,0,0,0,16,72,16,162,4,0,0,0,30,125,202,
+    7,140,71,243,163,2,0,0,160,178,107,0,156,29,248,18,0,0,247,82,64,249,255,170,
+    191,66,81,63,62,170,2,23,192,7,80,105,5,0,254,214,204,253,124,250,87,113,138,247,
+    223,78,103,187,178,153,64,108,246,235,229,151,231,41,217,247,78,167,218,25,2,222,128,53,
+    216,235,183,205,0,0,16,12,54,167,247,15,6,0,96,176,145,85,85,0,0,40,63,84,
+    10,0,0,229,17,72,34,9,0,0,0,0,200,12,0,80,6,17,135,128,111,240,97,98,
+    100,0,0,0,0,208,86,119,175,64,12,0,0,0,192,40,139,138,88,14,0,0,0,192,
+    76,189,51,0,0,0,128,194,70,14,53,244,190,242,237,102,38,114,170,158,1,0,0,128,
+    223,23,224,0,168,197,161,167,0,192,123,245,213,171,128,162,170,234,245,94,190,242,111,129,
+    234,13,112,1,31,240,161,1,254,198,204,252,250,242,47,102,22,239,191,35,167,187,114,103,
+    9,188,134,95,79,191,92,179,84,127,102,170,154,71,82,2,77,131,125,34,10,0,0,24,
+    236,92,49,0,0,24,108,100,76,12,0,128,242,195,129,50,1,128,28,146,68,130,0,0,
+    0,0,216,60,48,132,81,1,0,0,0,180,105,55,241,71,109,40,0,0,0,0,82,252,
+    240,128,229,0,0,0,0,12,222,163,96,0,0,0,240,121,228,82,185,37,203,211,238,158,
+    4,32,64,157,116,234,1,0,0,0,190,9,80,1,90,253,114,86,0,0,46,160,226,3,
+    254,125,130,55,238,173,215,125,162,190,95,191,252,114,139,66,129,119,136,0,222,198,204,253,
+    252,246,175,114,139,247,223,166,163,174,220,198,223,53,255,245,237,87,251,44,179,63,83,250,
+    24,159,148,32,243,96,47,212,50,1,0,4,131,45,107,191,120,58,0,0,131,141,204,251,
+    1,0,160,252,80,30,2,0,64,151,36,18,0,0,0,128,200,252,4,197,65,0,0,0,
+    128,173,77,99,56,175,3,0,0,0,160,163,234,185,80,24,0,0,0,72,73,127,32,1,
+    0,0,0,159,143,109,48,240,38,119,134,77,219,131,153,69,126,197,245,193,213,68,50,131,
+    155,8,0,0,0,192,176,7,44,0,42,30,1,0,40,124,224,195,87,111,125,42,126,253,
+    40,239,111,165,124,255,251,190,167,11,23,224,43,42,160,40,0,222,198,204,252,252,242,47,
+    182,139,252,59,255,29,165,220,177,248,207,154,249,250,242,203,222,165,247,111,83,109,208,201,
+    4,76,29,236,133,234,103,0,0,48,216,180,238,112,18,0,128,193,134,178,2,0,0,229,
+    135,56,12,0,52,36,73,36,1,0,0,0,208,113,46,45,3,0,0,0,0,144,103,182,
+    38,121,13,0,0,0,0,43,28,255,81,43,0,0,0,0,160,47,146,0,0,0,64,253,
+    197,251,251,125,47,85,157,126,74,120,10,83,135,71,153,9,0,0,0,136,56,249,129,10,
+    10,80,84,248,86,1,160,41,64,5,247,227,62,85,84,79,40,238,227,117,161,150,162,42,
+    174,11,160,226,163,128,10,124,0,222,182,12,127,126,139,32,167,46,242,247,254,167,85,202,
+    21,212,62,107,230,243,151,95,137,46,229,103,252,83,63,87,64,80,212,193,94,41,22,0,
+    0,8,6,187,241,36,0,0,24,108,56,42,0,0,80,126,136,138,4,32,153,36,137,0,
+    0,0,0,248,208,160,179,244,1,0,0,0,96,236,47,211,31,109,5,0,0,0,0,92,
+    246,194,151,50,0,0,0,0,0,110,66,0,0,0,192,47,21,48,98,96,104,242,118,198,
+    182,223,178,67,214,231,194,27,87,17,72,90,129,128,0,0,0,63,10,56,192,255,124,42,
+    202,45,254,117,255,45,239,133,61,174,116,97,99,187,255,241,254,250,198,231,226,63,61,62,
+    189,169,111,143,191,40,183,126,111,238,251,175,60,85,240,132,199,15,40,151,139,171,160,248,
+    62,31,248,0,79,103,103,83,0,0,64,165,0,0,0,0,0,0,216,210,103,75,3,0,
+    0,0,139,134,89,129,25,164,194,183,207,206,247,232,243,239,255,0,255,35,255,33,255,54,
+    255,31,255,50,255,55,255,57,190,166,204,254,252,245,47,178,139,251,119,255,185,72,41,83,
+    149,246,89,115,95,127,253,74,84,233,254,230,63,167,38,23,163,16,7,123,73,37,1,0,
+    48,216,212,227,116,0,0,6,27,142,79,1,0,172,224,4,4,162,75,18,0,0,0,0,
+    228,27,116,100,41,0,0,0,0,144,204,133,58,209,1,0,0,0,68,112,122,130,13,0,
+    0,0,0,160,4,2,6,0,0,0,124,192,133,28,106,3,108,32,112,158,118,14,108,119,
+    84,217,1,0,0,0,126,47,92,160,184,190,202,87,139,71,229,243,1,232,85,3,3,80,
+    222,46,10,42,190,82,189,223,170,80,42,245,189,192,251,231,87,245,177,240,239,127,114,113,
+    47,184,5,0,158,166,204,252,108,238,95,76,22,250,121,190,29,112,153,130,186,87,205,124,
+    253,246,203,94,165,252,237,63,245,179,10,8,226,189,58,0,0,48,216,57,31,0,0,131,
+    13,199,1,0,24,12,1,164,136,37,145,0,0,0,128,18,0,80,0,119,180,41,160,0,
+    0,0,0,136,88,53,27,0,0,0,0,64,120,102,40,1,0,0,0,238,47,239,234,228,
+    183,148,241,94,175,30,180,252,148,39,34,203,165,223,140,198,4,65,0,144,0,0,4,187,
+    9,44,78,185,156,4,12,0,0,0,0,192,47,254,173,158,248,133,251,169,248,197,47,239,
+    254,187,19,96,185,255,165,228,252,183,251,132,147,54,252,167,255,254,88,223,120,123,43,245,
+    150,235,253,123,175,254,88,10,182,132,196,127,188,74,125,172,62,229,243,85,133,71,149,2,
+    20,46,168,80,169,0,126,150,204,254,252,111,255,98,163,200,223,57,14,36,102,201,60,106,
+    238,243,175,31,246,42,211,191,251,71,253,172,18,2,238,193,94,90,41,0,0,128,242,59,
+    254,184,35,3,0,64,249,101,124,225,28,0,208,10,58,32,77,146,36,144,0,0,0,48,
+    233,165,134,87,0,0,0,0,208,99,35,16,0,0,0,128,150,114,19,0,0,0,0,164,
+    127,213,43,8,0,0,0,64,245,41,222,223,63,121,230,173,253,47,156,114,175,178,135,12,
+    72,0,2,0,0,128,138,235,22,0,126,85,1,160,122,132,175,240,1,31,126,41,16,156,
+    244,237,39,170,5,16,223,202,218,100,68,74,64,163,126,222,222,41,138,139,247,194,247,238,
+    189,250,170,239,79,206,182,240,228,122,242,43,30,93,80,65,1,69,5,10,0,62,134,204,
+    125,255,63,249,23,105,37,253,251,22,23,161,20,43,10,233,187,105,246,235,143,95,174,42,
+    229,231,249,163,234,81,76,80,110,176,183,23,139,0,0,24,108,162,93,11,0,0,202,207,
+    122,236,49,0,72,43,88,32,237,168,2,75,44,9,0,0,0,189,182,191,2,31,0,0,
+    0,0,44,251,206,7,5,10,0,0,0,160,235,46,90,1,0,0,0,136,220,127,108,64,
+    34,19,0,128,68,87,125,208,227,0,12,192,1,234,165,33,97,134,91,224,137,57,110,55,
+    75,220,127,109,69,98,202,137,84,153,4,18,0,0,0,95,190,169,0,184,128,55,168,106,
+    189,133,127,47,192,163,15,5,188,1,160,250,94,20,4,40,23,0,231,226,26,120,2,84,
+    224,227,162,240,239,59,16,69,5,202,255,85,253,149,11,12,72,252,142,255,127,121,171,255,
+    241,215,15,240,254,198,27,138,11,31,248,0,30,102,204,127,255,223,34,168,194,138,252,251,
+    41,46,81,92,35,184,46,154,251,218,220,159,244,44,211,207,243,235,108,142,2,130,16,30,
+    236,89,61,1,0,192,96,19,237,19,0,64,176,18,107,255,13,0,210,144,8,118,182,23,
+    144,36,147,0,0,0,80,204,205,112,68,0,0,0,0,200,175,240,134,26,0,0,0,0,
+    0,67,56,141,1,0,0,0,0,118,242,232,115,3,0,96,13,212,251,199,86,27,123,113,
+    230,223,111,139,71,22,188,218,200,48,201,246,2,0,0,0,120,190,1,5,84,248,160,250,
+    92,10,111,215,229,173,20,170,110,232,255,104,1,208,160,242,41,92,126,133,90,1,126,250,
+    55,23,5,2,52,0,250,169,248,229,87,126,187,112,225,3,87,121,204,95,243,222,168,229,
+    243,61,94,126,169,238,87,222,189,213,129,33,247,94,26,62,248,254,119,81,169,23,138,74,
+    133,2,222,85,204,125,255,63,71,34,168,66,240,223,207,151,3,201,138,34,57,14,154,255,
+    254,127,14,126,37,184,184,183,225,252,16,201,92,61,216,179,22,9,0,0,229,215,166,77,
+    173,0,64,106,37,34,30,3,0,51,93,90,179,21,144,88,18,73,0,0,0,16,121,136,
+    220,48,1,0,0,0,192,237,118,73,0,0,0,64,161,119,213,58,128,2,0,32,0,34,
+    241,90,162,6,18,64,175,10,144,2,71,156,119,53,94,51,109,183,109,98,216,178,29,241,
+    22,204,182,72,75,213,35,172,81,113,6,35,44,200,0,32,3,0,0,204,39,160,248,248,
+    124,158,62,234,231,157,71,202,231,87,5,108,53,142,191,23,222,127,190,246,80,167,127,67,
+    91,29,232,197,183,122,250,192,19,240,248,244,88,255,213,174,199,130,90,80,238,133,10,240,
+    102,239,141,27,126,4,17,64,67,129,82,129,39,229,214,119,79,202,83,121,228,216,120,179,
+    117,161,134,210,0,112,175,235,73,117,31,213,167,234,173,212,55,245,177,252,79,253,143,46,
+    163,126,80,46,197,197,247,125,40,158,53,204,126,253,223,126,69,29,255,189,127,162,131,156,
+    9,41,189,57,51,95,255,191,63,118,42,238,173,169,37,114,53,17,7,123,57,138,0,0,
+    24,108,180,3,0,4,90,97,18,168,77,90,51,21,172,36,73,18,0,0,192,80,35,190,
+    4,0,0,0,0,140,230,19,203,1,0,0,0,128,32,83,135,38,156,9,0,129,4,16,
+    100,237,122,141,0,10,96,181,66,113,189,121,47,229,241,31,170,186,247,189,236,217,247,111,
+    239,251,55,246,141,233,238,228,124,3,86,168,31,0,0,0,192,151,1,10,240,75,133,122,
+    75,185,188,185,126,81,170,207,165,84,0,102,128,239,51,240,210,125,23,223,152,153,105,96,
+    154,141,9,151,14,32,193,253,62,119,255,170,192,189,213,229,227,2,92,29,134,4,207,199,
+    241,47,202,130,162,212,224,63,225,215,84,148,139,242,179,198,43,212,127,255,231,171,240,75,
+    186,79,220,183,251,223,111,117,42,62,10,139,11,181,170,80,112,221,235,227,137,79,241,11,
+    84,158,53,204,125,253,63,243,171,161,133,126,238,236,64,92,13,24,215,204,253,252,63,39,
+    255,218,185,184,183,226,252,198,4,101,143,58,216,139,229,0,0,0,229,87,59,219,1,0,
+    129,198,16,77,218,153,126,64,32,147,68,64,2,0,0,20,104,172,45,13,21,0,0,0,
+    224,114,1,6,0,0,0,0,192,78,31,125,198,0,0,244,84,240,100,96,255,157,251,129,
+    153,251,63,134,103,120,158,103,246,247,163,199,143,137,220,23,57,20,50,238,143,46,9,226,
+    53,90,0,0,0,0,96,218,129,239,170,84,42,160,180,244,153,166,9,0,221,77,99,99,
+    75,224,175,26,18,248,55,180,47,61,180,45,70,5,222,74,249,245,148,135,121,254,125,7,
+    117,246,12,29,60,89,105,111,251,216,234,151,162,150,162,184,220,114,235,245,129,39,92,112,
+    29,223,35,128,210,120,0,160,42,111,42,110,41,201,146,182,235,170,10,222,96,144,106,199,
+    47,31,202,180,239,126,168,110,186,23,159,167,172,194,250,254,119,183,149,90,2,85,185,188,
+    113,93,10,0,126,53,204,125,253,191,253,72,25,254,249,249,201,46,161,100,66,74,111,204,
+    204,175,255,231,72,4,165,73,113,183,232,108,48,193,216,81,7,187,201,34,1,0,160,252,
+    60,112,1,0,4,162,115,153,116,1,217,46,0,36,147,68,2,0,0,32,226,118,162,71,
+    0,0,0,0,0,25,222,146,6,0,0,0,32,1,182,29,2,144,64,121,133,143,60,170,
+    45,38,6,94,119,76,254,231,57,237,193,171,188,229,219,247,166,51,184,63,147,133,5,54,
+    0,0,0,0,128,196,15,42,174,247,247,95,120,226,186,254,227,48,190,219,48,0,12,220,
+    199,171,252,138,167,234,191,25,123,177,229,210,255,90,138,102,134,102,154,231,123,207,32,158,
+    155,255,247,215,70,178,136,45,95,189,72,57,106,228,86,245,150,239,114,43,192,191,168,128,
+    236,86,8,58,0,175,0,48,5,222,223,188,93,62,170,255,136,245,254,63,64,165,218,156,
+    9,72,119,247,187,183,126,238,97,149,154,20,148,95,124,215,231,245,125,241,103,125,168,42,
+    149,139,11,190,53,204,126,255,63,249,151,102,248,243,247,23,93,134,118,54,192,218,50,247,
+    243,255,156,252,107,72,113,223,194,169,141,9,199,59,80,203,96,155,96,130,182,0,0,96,
+    48,219,2,4,76,143,43,17,28,108,11,1,144,36,73,2,0,0,192,158,14,19,170,131,
+    165,217,59,217,12,67,249,197,242,0,0,0,0,64,220,213,131,0,0,0,0,0,0,114,
+    229,211,83,5,0,64,126,4,138,80,0,157,33,3,168,0,140,211,81,5,53,127,46,249,
+    232,225,112,103,51,255,93,181,228,26,118,70,137,202,179,16,0,0,88,224,171,92,84,215,
+    223,144,234,47,22,138,158,170,128,134,230,62,220,61,85,169,236,161,180,31,255,255,28,106,
+    159,164,26,109,31,185,135,117,168,255,30,57,7,38,25,117,48,189,191,235,147,1,59,160,
+    236,188,207,102,38,53,77,53,48,80,175,242,232,2,112,5,191,170,204,243,101,200,138,119,
+    243,124,237,197,142,31,236,236,172,201,118,127,253,239,229,148,90,240,152,81,82,116,254,11,
+    71,193,250,169,82,97,82,205,168,62,40,240,169,192,167,0,112,1,190,53,204,126,255,63,
+    137,160,44,199,127,127,255,179,75,188,90,160,226,89,50,255,243,255,28,249,151,144,146,190,
+    45,59,106,76,100,60,187,193,118,135,118,117,0,0,172,112,0,92,241,138,46,93,64,180,
+    5,8,41,146,36,0,0,128,147,118,40,10,0,0,0,0,196,115,166,51,35,9,0,0,
+    0,0,0,29,21,52,0,0,170,226,43,142,43,227,60,242,248,159,241,146,94,237,15,253,
+    19,135,12,6,54,127,11,142,158,100,63,110,87,62,214,238,87,3,10,0,0,0,0,160,
+    226,135,122,223,106,121,175,229,189,252,127,28,106,41,39,117,222,102,190,53,12,195,125,232,
+    230,255,105,151,167,249,222,152,211,223,0,165,242,71,104,251,99,242,191,165,108,217,60,244,
+    12,223,250,91,222,71,53,13,52,251,90,0,248,237,251,204,253,121,56,123,32,127,249,47,
+    205,233,83,34,98,229,7,199,130,222,215,13,77,191,143,236,215,251,232,250,245,214,250,116,
+    241,238,141,15,149,226,170,117,230,4,20,72,15,40,220,250,81,150,207,5,255,189,130,98,
+    93,138,14,185,155,5,141,19,238,24,11,128,167,242,185,235,190,253,91,223,206,246,63,73,
+    242,152,75,194,250,21,29,188,192,197,47,112,21,21,255,173,20,46,224,2,158,53,12,62,
+    255,111,127,124,27,254,249,254,68,7,181,159,1,203,144,217,159,255,231,200,191,54,41,242,
+    76,157,67,193,68,75,156,169,131,61,174,150,0,0,172,36,30,3,0,73,213,196,166,53,
+    179,24,73,50,73,0,0,0,219,205,36,6,39,10,0,0,0,208,199,195,29,0,0,0,
+    0,0,224,42,85,39,64,2,138,181,10,28,198,38,27,26,206,153,249,105,246,237,218,100,
+    94,247,107,31,63,61,241,155,163,114,95,63,198,129,172,124,223,151,158,183,66,18,28,0,
+    0,0,0,217,133,75,173,143,127,255,24,230,39,57,142,63,135,132,28,192,6,254,216,95,
+    133,211,86,127,247,31,211,254,223,223,233,89,213,240,0,48,119,212,111,135,205,86,82,125,
+    127,186,123,186,27,209,253,128,52,10,182,124,222,210,147,20,1,132,38,63,44,75,72,156,
+    250,27,58,83,32,134,227,62,109,237,121,159,216,127,47,119,35,151,247,6,230,18,88,64,
+    59,0,191,162,0,138,229,234,97,112,164,216,248,224,95,223,250,148,202,157,173,158,236,112,
+    221,76,74,255,146,31,234,221,120,246,43,231,178,145,206,126,72,54,187,82,168,210,242,75,
+    40,233,122,247,186,164,86,31,189,61,114,113,128,250,168,128,235,126,10,0,158,53,12,190,
+    254,159,252,242,167,248,239,189,179,131,219,63,50,127,33,243,63,255,207,201,175,76,45,242,
+    188,171,75,208,131,233,34,62,128,26,64,13,246,150,246,4,0,192,182,3,88,77,29,186,
+    116,14,28,15,208,197,172,132,64,0,0,0,182,221,250,4,60,112,51,234,107,181,146,111,
+    55,242,194,127,89,26,199,116,26,107,242,213,2,231,20,5,0,0,0,0,76,242,97,50,
+    0,0,64,32,1,128,253,163,3,0,208,34,23,94,243,138,2,115,113,86,251,151,3,0,
+    0,0,0,128,14,160,1,96,102,152,239,51,230,243,211,214,174,240,239,147,170,162,57,191,
+    231,206,111,154,123,15,240,107,237,23,247,125,146,77,125,151,106,246,9,244,207,114,118,167,
+    238,243,11,235,73,232,156,198,114,58,159,95,26,150,168,159,239,187,237,44,163,242,183,247,
+    126,254,166,199,225,21,63,243,135,182,105,249,173,214,197,227,103,230,235,253,235,159,70,202,
+    139,52,145,79,157,159,148,226,156,123,27,158,212,239,163,212,11,62,151,151,91,41,1,128,
+    40,1,176,91,84,87,169,143,168,80,120,125,61,123,154,195,82,110,254,56,202,155,181,89,
+    112,7,176,147,156,125,226,13,217,155,183,167,116,129,249,29,234,3,176,120,124,218,68,163,
+    164,4,152,6,128,179,82,98,126,14,148,226,254,139,242,1,124,158,53,84,62,255,243,139,
+    191,225,159,231,29,29,212,62,229,173,99,246,251,255,247,47,211,241,207,247,94,20,26,153,
+    40,17,222,0,220,96,187,163,168,5,0,192,25,14,73,0,224,26,139,234,164,157,29,32,
+    144,73,38,18,0,0,32,124,86,98,121,148,249,58,184,38,100,122,158,217,33,1,0,0,
+    0,128,92,142,13,0,128,4,0,0,134,43,59,143,32,0,4,86,35,254,202,31,232,232,
+    8,224,147,46,61,245,68,175,85,230,235,154,58,110,121,253,199,229,20,0,0,0,0,0,
+    107,251,177,247,111,23,39,204,127,121,250,148,171,126,187,248,173,148,91,246,183,59,51,195,
+    51,67,15,38,111,27,75,145,199,159,147,217,199,77,91,208,66,31,134,166,1,76,111,206,
+    76,126,252,76,198,116,236,243,155,255,249,101,252,107,58,135,48,55,149,103,223,202,241,59,
+    193,99,237,63,155,92,240,100,30,121,95,100,45,74,66,179,245,109,114,52,224,71,7,204,
+    0,61,148,82,126,160,120,2,80,84,23,136,190,87,21,18,8,5,178,144,45,112,47,199,
+    245,144,171,87,149,134,84,66,171,96,240,244,203,139,90,41,150,228,77,41,84,21,75,229,
+    23,0,160,85,2,184,79,64,90,172,195,191,42,212,15,158,53,84,63,255,183,63,250,21,
+    255,189,79,117,80,123,35,233,214,48,255,253,127,251,215,99,197,189,223,157,3,141,129,242,
+    14,62,122,176,183,76,36,0,0,70,215,27,128,215,145,110,224,200,0,18,32,147,41,18,
+    0,0,64,108,92,205,124,177,89,71,157,111,11,195,255,77,247,232,208,81,1,0,0,0,
+    128,81,223,93,192,182,65,0,105,0,0,29,14,233,4,0,232,43,155,1,4,128,108,0,
+    2,17,8,60,191,252,248,128,146,86,159,31,62,30,69,14,79,142,204,186,63,88,250,188,
+    187,1,0,0,0,0,0,40,124,195,255,52,91,0,128,2,176,21,126,142,191,234,132,191,
+    39,28,199,156,158,134,123,243,112,31,190,53,108,230,223,22,205,64,15,205,208,127,130,171,
+    158,61,221,245,88,211,127,232,238,169,243,218,57,255,109,193,111,230,100,222,127,71,14,64,
+    230,178,46,193,146,20,101,252,32,187,97,211,189,89,34,104,59,51,255,97,15,187,57,111,
+    125,179,29,154,3,127,103,10,88,188,127,243,255,229,63,81,113,129,130,118,209,73,17,241,
+    73,111,181,20,160,238,128,18,3,15,129,85,119,248,59,179,239,62,146,43,177,248,59,182,
+    28,110,225,187,111,233,127,254,90,239,245,165,60,62,104,21,192,230,0,0,128,141,129,167,
+    159,45,72,248,168,192,34,1,126,53,228,63,254,243,131,191,227,207,243,68,7,217,207,0,
+    89,198,204,247,255,237,151,79,20,122,63,123,7,132,137,50,239,0,110,176,71,219,12,0,
+    0,193,88,222,212,109,70,112,240,56,32,1,18,221,20,9,0,0,160,209,170,161,169,231,
+    59,52,85,229,232,221,187,60,254,241,193,219,171,0,0,0,0,16,0,30,125,126,18,128,
+    2,112,174,86,131,25,0,25,0,128,8,197,179,149,99,246,223,90,222,187,125,206,253,209,
+    121,101,93,14,27,134,197,52,250,115,75,103,0,0,0,0,0,128,47,84,64,167,247,175,
+    0,84,211,48,63,202,159,227,136,191,208,63,152,6,238,221,61,24,234,231,16,234,62,19,
+    68,219,255,215,32,99,154,44,90,159,252,37,245,240,100,168,219,123,204,157,15,85,30,107,
+    233,32,60,115,143,168,207,223,2,113,250,242,63,205,161,41,230,127,200,123,207,115,184,163,
+    26,17,249,122,110,39,59,217,123,242,60,186,255,101,191,238,103,115,198,142,114,58,250,143,
+    158,233,246,23,109,138,43,178,28,255,125,103,92,249,47,185,161,0,124,197,7,198,213,138,
+    15,20,139,39,2,110,177,110,41,204,32,128,6,222,0,30,169,54,246,93,114,96,221,151,
+    162,167,163,102,174,185,191,236,46,159,0,118,220,168,0,214,25,60,1,18,229,188,100,255,
+    251,233,58,40,0,7,158,53,36,63,55,23,191,16,26,254,60,79,112,192,38,174,114,214,
+    48,252,250,223,254,229,54,252,243,126,47,150,140,164,137,170,219,1,106,176,221,161,173,22,
+    0,16,104,204,184,147,160,60,19,193,5,68,155,4,164,100,146,137,4,0,0,168,185,142,
+    109,177,1,234,166,170,121,205,234,170,213,144,7,0,0,0,0,132,47,191,33,17,117,189,
+    142,72,0,0,123,216,161,0,20,6,10,40,0,175,73,246,147,252,9,25,246,156,115,67,
+    241,138,245,119,189,127,50,196,61,207,135,140,96,0,0,0,0,0,115,81,170,199,234,253,
+    190,227,171,21,190,240,28,8,208,213,80,28,80,218,198,92,30,165,90,156,55,121,255,123,
+    168,197,239,2,92,182,57,243,157,220,199,210,217,111,225,208,75,82,138,101,171,109,163,205,
+    121,215,191,221,197,80,205,178,54,221,251,248,214,119,77,79,131,253,100,76,31,247,31,14,
+    254,80,19,122,152,104,232,250,27,25,181,244,250,132,215,59,55,137,102,22,52,182,234,142,
+    163,215,126,254,211,93,252,178,3,143,92,190,15,232,236,38,183,33,74,112,1,192,45,60,
+    253,226,95,23,165,186,75,245,254,189,237,252,82,101,17,27,74,43,50,249,233,150,50,10,
+    64,169,79,255,82,21,94,110,74,57,89,47,52,10,96,154,201,69,85,46,220,127,236,131,
+    122,147,92,247,201,0,79,103,103,83,0,4,68,172,0,0,0,0,0,0,216,210,103,75,
+    4,0,0,0,90,58,29,41,4,255,107,255,125,158,53,36,222,127,197,47,134,227,199,198,
+    81,116,100,13,51,223,255,79,126,249,51,60,189,159,213,209,26,207,192,196,3,192,13,184,
+    193,86,219,62,19,0,56,83,101,38,236,202,172,99,22,54,19,9,0,0,170,16,253,117,
+    217,225,155,77,253,251,66,221,9,155,204,159,51,88,35,220,232,119,86,110,150,154,34,54,
+    5,16,0,0,0,32,34,179,99,153,33,109,62,160,251,223,45,247,103,184,139,18,84,0,
+    0,0,112,42,168,0,64,158,148,90,122,174,237,239,222,216,123,255,183,21,22,63,255,150,
+    59,225,39,26,168,222,119,211,10,78,15,185,68,146,244,219,30,174,232,247,139,4,230,201,
+    201,249,47,202,105,48,247,254,183,242,127,203,205,166,173,15,129,21,188,233,197,173,21,111,
+    178,117,246,13,241,53,98,205,117,96,35,94,117,211,117,144,78,169,254,232,255,154,79,237,
+    244,158,165,42,64,42,223,251,222,202,136,85,249,21,204,37,46,76,226,151,211,241,215,185,
+    222,175,121,105,140,31,121,152,60,19,166,108,172,120,224,205,75,44,105,201,187,209,72,12,
+    237,191,62,94,79,245,237,231,121,243,189,23,199,83,190,193,143,118,100,129,235,187,79,191,
+    91,152,88,10,183,184,9,82,41,58,186,135,81,251,93,130,61,160,45,37,145,67,89,155,
+    212,28,49,176,121,170,119,78,125,201,121,148,78,41,251,146,91,54,8,247,55,224,134,148,
+    158,3,174,24,28,0,214,121,58,63,59,0,0,224,14,219,50,66,165,38,176,238,110,46,
+    10,120,132,131,226,85,134,138,167,123,75,130,3,18,0,94,53,180,222,255,183,248,166,39,
+    248,241,223,214,199,133,170,225,176,159,255,231,92,239,39,21,183,255,63,77,31,171,105,10,
+    13,193,218,39,55,38,87,175,232,58,128,51,102,236,29,32,73,25,199,36,0,0,0,0,
+    86,185,34,183,151,151,61,205,197,165,220,190,93,56,85,151,23,114,229,203,154,171,91,147,
+    232,109,47,220,75,18,144,116,185,152,166,152,9,43,97,130,224,200,102,190,120,58,222,54,
+    200,96,133,129,51,103,237,55,7,55,55,250,26,230,219,183,169,231,212,42,174,143,115,46,
+    158,85,23,94,103,74,191,139,227,117,40,29,67,38,76,32,195,71,55,246,67,55,246,67,
+    55,246,67,55,246,220,215,83,183,220,23,226,107,211,75,43,116,46,103,69,57,101,125,113,
+    216,250,123,139,23,83,166,218,219,120,75,53,50,14,74,181,252,240,174,130,243,171,183,197,
+    171,219,241,248,255,254,223,113,44,236,95,20,36,222,125,183,75,197,115,61,233,117,33,47,
+    159,231,196,247,231,95,104,253,174,173,251,103,119,70,238,36,35,35,137,140,3,16,103,255,
+    158,251,244,228,178,66,181,108,46,159,31,159,115,29,254,248,143,148,83,54,171,239,240,184,
+    107,153,163,114,236,64,241,205,2,0,192,239,207,60,35,223,188,91,250,134,127,44,5,214,
+    199,115,176,127,182,160,254,143,219,48,7,96,154,56,251,83,94,150,139,165,145,178,217,172,
+    149,158,226,85,186,103,191,117,171,206,221,186,101,233,185,213,98,207,252,63,185,136,237,250,
+    221,247,47,35,139,93,96,182,120,87,101,5,82,22,21,217,115,229,178,183,183,50,231,36,
+    168,115,115,220,39,220,167,167,10,192,7,
+};
+
+// assets/sounds/sfx_wing.ogg
+static const Uint8 AB_DATA_5[] = {
+    79,103,103,83,0,2,0,0,0,0,0,0,0,0,143,76,126,65,0,0,0,0,86,109,
+    130,48,1,30,1,118,111,114,98,105,115,0,0,0,0,1,68,172,0,0,0,0,0,0,
+    176,173,1,0,0,0,0,0,184,1,79,103,103,83,0,0,0,0,0,0,0,0,0,0,
+    143,76,126,65,1,0,0,0,77,3,202,211,16,61,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,229,3,118,111,114,98,105,115,45,0,0,0,88,105,112,104,46,79,114,103,
+    32,108,105,98,86,111,114,98,105,115,32,73,32,50,48,49,48,49,49,48,49,32,40,83,
+    99,104,97,117,102,101,110,117,103,103,101,116,41,0,0,0,0,1,5,118,111,114,98,105,
+    115,41,66,67,86,1,0,8,0,0,0,49,76,32,197,128,208,144,85,0,0,16,0,0,
+    96,36,41,14,147,102,73,41,165,148,161,40,121,152,148,72,73,41,165,148,197,48,137,152,
+    148,137,197,24,99,140,49,198,24,99,140,49,198,24,99,140,32,52,100,21,0,0,4,0,
+    128,40,9,142,163,230,73,106,206,57,103,24,39,142,114,160,57,105,78,56,167,32,7,138,
+    81,224,57,9,194,245,38,99,110,166,180,166,107,110,206,41,37,8,13,89,5,0,0,2,
+    0,64,72,33,133,20,82,72,33,133,20,98,136,33,134,24,98,136,33,135,28,114,200,33,
+    167,156,114,10,42,168,160,130,10,50,200,32,131,76,50,233,164,147,78,58,233,168,163,142,
+    58,234,40,180,208,66,11,45,180,210,74,76,49,213,86,99,174,189,6,93,124,115,206,57,
+    231,156,115,206,57,231,156,115,206,9,66,67,86,1,0,32,0,0,4,66,6,25,100,16,
+    66,8,33,133,20,82,136,41,166,152,114,10,50,200,128,208,144,85,0,0,32,0,128,0,
+    0,0,0,71,145,20,73,177,20,203,177,28,205,209,36,79,242,44,81,19,53,209,51,69,
+    83,84,77,85,85,85,85,117,93,87,118,101,215,118,117,215,118,125,89,152,133,91,184,125,
+    89,184,133,91,216,133,93,247,133,97,24,134,97,24,134,97,24,134,97,248,125,223,247,125,
+    223,247,125,32,52,100,21,0,32,1,0,160,35,57,150,227,41,162,34,26,162,226,57,162,
+    3,132,134,172,2,0,100,0,0,4,0,32,9,146,34,41,146,163,73,166,102,106,174,105,
+    155,182,104,171,182,109,203,178,44,203,178,12,132,134,172,2,0,0,1,0,4,0,0,0,
+    0,0,160,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,166,105,154,102,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,
+    89,150,101,89,150,101,89,150,101,89,150,101,89,64,104,200,42,0,64,2,0,64,199,113,
+    28,199,113,36,69,82,36,199,114,44,7,8,13,89,5,0,200,0,0,8,0,64,82,44,
+    197,114,52,71,115,52,199,115,60,199,115,60,71,116,68,201,148,76,205,244,76,15,8,13,
+    89,5,0,0,2,0,8,0,0,0,0,0,64,49,28,197,113,28,201,209,36,79,82,45,
+    211,114,53,87,115,61,215,115,77,215,117,93,87,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,129,
+    208,144,85,0,0,4,0,0,33,157,102,150,106,128,8,51,144,97,32,52,100,21,0,128,
+    0,0,0,24,161,8,67,12,8,13,89,5,0,0,4,0,0,136,161,228,32,154,208,154,
+    243,205,57,14,154,229,160,169,20,155,211,193,137,84,155,39,185,169,152,155,115,206,57,231,
+    156,108,206,25,227,156,115,206,41,202,153,197,160,153,208,154,115,206,73,12,154,165,160,153,
+    208,154,115,206,121,18,155,7,173,169,210,154,115,206,25,231,156,14,198,25,97,156,115,206,
+    105,210,154,7,169,217,88,155,115,206,89,208,154,230,168,185,20,155,115,206,137,148,155,39,
+    181,185,84,155,115,206,57,231,156,115,206,57,231,156,115,206,169,94,156,206,193,57,225,156,
+    115,206,137,218,155,107,185,9,93,156,115,206,249,100,156,238,205,9,225,156,115,206,57,231,
+    156,115,206,57,231,156,115,206,9,66,67,86,1,0,64,0,0,4,97,216,24,198,157,130,
+    32,125,142,6,98,20,33,166,33,147,30,116,143,14,147,160,49,200,41,164,30,141,142,70,
+    74,169,131,80,82,25,39,165,116,130,208,144,85,0,0,32,0,0,132,16,82,72,33,133,
+    20,82,72,33,133,20,82,72,33,134,24,98,136,33,167,156,114,10,42,168,164,146,138,42,
+    202,40,179,204,50,203,44,179,204,50,203,172,195,206,58,235,176,195,16,67,12,49,180,210,
+    74,44,53,213,86,99,141,181,230,158,115,174,57,72,107,165,181,214,90,43,165,148,82,74,
+    41,165,32,52,100,21,0,0,2,0,64,32,100,144,65,6,25,133,20,82,72,33,134,152,
+    114,202,41,167,160,130,10,8,13,89,5,0,0,2,0,8,0,0,0,240,36,207,17,29,
+    209,17,29,209,17,29,209,17,29,209,17,29,207,241,28,81,18,37,81,18,37,209,50,45,
+    83,51,61,85,84,85,87,118,109,89,151,117,219,183,133,93,216,117,223,215,125,223,215,141,
+    95,23,134,101,89,150,101,89,150,101,89,150,101,89,150,101,89,150,101,9,66,67,86,1,
+    0,32,0,0,0,66,8,33,132,20,82,72,33,133,148,98,140,49,199,156,131,78,66,9,
+    129,208,144,85,0,0,32,0,128,0,0,0,0,71,113,20,199,145,28,201,145,36,75,178,
+    36,77,210,44,205,242,52,79,243,52,209,19,69,81,52,77,83,21,93,209,21,117,211,22,
+    101,83,54,93,211,53,101,211,85,101,213,118,101,217,182,101,91,183,125,89,182,125,223,247,
+    125,223,247,125,223,247,125,223,247,125,223,215,117,32,52,100,21,0,32,1,0,160,35,57,
+    146,34,41,146,34,57,142,227,72,146,4,132,134,172,2,0,100,0,0,4,0,160,40,142,
+    226,56,142,35,73,146,36,89,146,38,121,150,103,137,154,169,153,158,233,169,162,10,132,134,
+    172,2,0,0,1,0,4,0,0,0,0,0,160,104,138,167,152,138,167,136,138,231,136,142,
+    40,137,150,105,137,154,170,185,162,108,202,174,235,186,174,235,186,174,235,186,174,235,186,174,
+    235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,174,235,186,64,
+    104,200,42,0,64,2,0,64,71,114,36,71,114,36,69,82,36,69,114,36,7,8,13,89,
+    5,0,200,0,0,8,0,192,49,28,67,82,36,199,178,44,77,243,52,79,243,52,209,19,
+    61,209,51,61,85,116,69,23,8,13,89,5,0,0,2,0,8,0,0,0,0,0,192,144,
+    12,75,177,28,205,209,36,81,82,45,213,82,53,213,82,45,85,84,61,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,213,52,77,211,52,129,208,144,149,0,0,25,0,0,67,61,6,25,124,16,
+    14,131,16,75,111,61,104,10,49,7,173,245,96,65,6,165,228,28,132,197,16,67,140,73,
+    15,26,116,208,73,74,57,104,140,57,228,28,228,224,49,8,153,99,130,113,141,49,71,210,
+    16,5,66,199,160,81,166,160,7,66,67,86,4,0,81,0,0,128,49,198,49,196,24,114,
+    206,73,201,160,68,206,49,9,157,148,200,57,39,165,147,210,73,41,45,150,24,51,41,37,
+    166,18,99,228,156,163,210,73,201,164,148,24,75,138,157,164,18,99,137,173,0,0,128,0,
+    7,0,128,0,11,161,208,144,21,1,64,20,0,0,98,12,82,10,41,133,148,82,206,41,
+    230,144,82,202,49,229,28,82,74,57,167,156,83,206,57,8,29,132,138,49,6,157,131,16,
+    41,165,28,83,206,41,231,28,132,204,65,229,156,131,208,65,40,0,0,32,192,1,0,32,
+    192,66,40,52,100,69,0,16,39,0,224,144,28,207,147,52,75,20,37,75,19,69,79,20,
+    101,215,19,77,87,150,52,205,20,53,81,84,85,205,19,85,213,84,85,219,22,77,85,182,
+    37,77,19,77,75,244,84,85,19,69,85,21,85,211,150,77,85,181,101,207,52,101,217,84,
+    85,93,23,85,213,182,101,219,22,126,87,182,125,223,51,77,217,22,85,213,214,77,213,181,
+    117,215,150,125,93,182,109,93,152,52,205,52,53,81,84,85,77,20,85,213,116,85,219,54,
+    85,213,182,53,81,116,85,81,85,101,89,84,85,89,86,101,217,214,85,87,214,125,75,20,
+    85,215,83,77,217,21,85,85,182,85,217,245,109,85,150,117,223,116,85,91,87,101,89,23,
+    86,89,22,126,93,247,133,223,214,125,163,168,170,182,110,186,174,175,171,178,236,251,178,110,
+    27,187,237,251,72,154,102,154,154,40,170,170,38,138,170,106,170,170,109,155,170,107,219,150,
+    40,170,170,168,170,178,236,153,170,43,171,178,236,235,170,43,219,190,38,138,170,43,170,170,
+    44,139,170,42,203,170,44,251,186,42,187,186,46,170,170,110,171,178,44,252,166,43,235,190,
+    237,251,140,219,214,117,225,84,93,93,87,101,217,247,85,89,246,125,219,247,149,225,214,117,
+    97,248,76,211,182,77,87,213,117,83,117,125,221,214,117,227,153,109,95,56,70,85,213,125,
+    85,150,133,97,149,101,225,215,125,31,221,247,17,85,85,215,77,217,21,118,85,150,133,95,
+    23,118,103,217,125,95,41,235,54,225,214,125,206,238,251,148,225,136,47,28,185,182,173,28,
+    179,110,19,110,221,87,150,223,248,41,203,51,60,61,211,148,109,83,85,117,221,116,93,221,
+    183,117,91,249,109,93,103,140,170,234,235,170,44,243,85,87,246,133,219,23,42,187,239,27,
+    69,85,213,125,85,150,125,95,181,101,99,216,125,223,120,118,97,201,181,109,97,184,125,29,
+    217,214,149,190,241,228,251,198,209,181,109,225,185,125,95,105,251,54,231,119,134,132,58,101,
+    0,0,192,128,3,0,64,128,9,101,160,208,144,21,1,64,156,0,0,131,144,115,138,41,
+    8,149,98,16,58,8,41,117,16,82,170,24,131,144,57,39,37,99,14,74,40,37,165,16,
+    74,106,21,99,16,50,199,36,100,206,73,9,37,180,20,74,105,169,131,144,82,40,165,181,
+    80,74,107,169,181,26,83,106,49,118,16,82,10,165,180,22,74,105,45,181,20,91,106,45,
+    198,136,49,8,153,99,82,50,230,164,132,82,90,10,165,164,150,57,39,165,115,144,82,7,
+    33,165,82,82,139,165,164,214,42,198,164,100,208,81,233,28,148,84,82,137,169,164,212,90,
+    40,165,181,82,82,140,37,165,22,91,107,177,182,22,107,13,165,180,22,74,137,173,164,20,
+    99,106,169,182,22,99,173,21,99,16,50,199,164,100,206,73,9,165,180,20,74,73,173,98,
+    76,74,7,29,149,204,65,73,37,165,214,74,73,41,102,206,73,233,32,164,212,65,71,169,
+    164,18,91,73,41,182,80,74,107,37,165,216,66,41,45,182,216,106,77,169,181,26,74,105,
+    173,164,20,99,73,37,182,214,90,173,45,182,26,59,8,41,133,82,90,11,165,180,150,90,
+    171,49,181,22,107,40,165,181,146,82,140,37,165,24,91,139,53,183,22,107,13,165,180,22,
+    82,137,173,148,212,98,139,173,198,214,98,205,169,181,26,83,107,181,182,24,107,141,177,214,
+    30,107,205,57,181,20,99,106,169,198,214,98,205,173,182,220,98,205,185,119,16,82,10,165,
+    180,22,74,105,45,181,86,99,106,45,198,80,74,107,37,149,216,66,73,45,182,216,106,109,
+    45,198,26,74,105,173,164,20,99,73,41,198,22,91,173,45,198,90,83,74,49,182,216,106,
+    77,169,197,90,107,237,185,181,218,114,106,45,214,22,99,205,169,181,90,99,173,189,199,26,
+    123,44,0,0,96,192,1,0,32,192,132,50,80,104,200,74,0,32,10,0,128,32,68,41,
+    231,164,52,8,57,230,28,165,4,33,230,156,163,84,57,6,161,132,150,42,230,32,132,146,
+    90,231,156,132,150,98,236,28,132,146,90,140,37,165,214,98,172,181,148,148,90,140,181,22,
+    0,0,80,224,0,0,16,96,131,166,196,226,0,133,134,172,4,0,162,0,0,16,99,16,
+    98,12,66,131,140,82,140,65,104,12,82,138,57,8,145,82,140,57,39,37,82,138,49,231,
+    164,100,142,57,39,33,165,140,57,231,160,148,20,66,40,37,165,150,66,8,165,164,148,90,
+    1,0,0,5,14,0,0,1,54,104,74,44,14,80,104,200,138,0,32,10,0,0,48,6,
+    49,134,24,67,208,49,41,157,148,200,65,38,37,147,208,56,7,41,117,148,50,74,165,196,
+    18,99,70,169,196,86,98,140,160,115,148,66,74,25,165,18,99,105,49,163,84,98,12,177,
+    20,0,0,118,224,0,0,118,96,33,20,26,178,18,0,200,3,0,64,140,81,138,49,231,
+    156,51,8,49,229,156,115,206,25,132,20,115,206,57,231,20,99,140,57,231,156,115,138,49,
+    198,156,115,206,57,230,156,115,206,65,8,33,115,206,57,231,32,132,208,57,231,28,132,16,
+    66,232,156,115,14,66,8,33,116,206,57,7,33,132,16,58,231,156,131,16,66,8,5,0,
+    0,21,56,0,0,4,216,40,178,57,193,72,80,161,33,43,1,128,60,0,0,192,24,165,
+    156,131,80,74,163,20,99,16,74,73,169,81,138,49,8,165,164,84,57,7,161,148,148,90,
+    171,156,131,80,74,74,173,117,16,74,73,169,181,24,59,8,165,164,212,90,140,165,148,148,
+    98,140,49,215,80,74,75,45,198,88,115,106,45,198,24,115,205,57,165,22,99,173,53,231,
+    92,0,0,238,130,3,0,216,129,141,34,155,19,140,4,21,26,178,18,0,200,3,0,64,
+    16,82,138,49,198,24,67,10,49,198,152,99,206,33,164,20,99,140,49,231,20,99,140,57,
+    230,156,115,74,49,198,152,115,206,57,198,152,115,206,57,231,28,99,140,57,231,156,115,142,
+    49,230,156,115,206,57,199,156,115,206,57,231,156,99,206,57,231,156,115,206,49,231,156,115,
+    206,57,231,4,0,0,21,56,0,0,4,216,40,178,57,193,72,80,161,33,43,1,128,112,
+    0,0,128,8,232,56,231,156,115,206,57,55,14,98,173,181,214,90,107,173,53,114,80,107,
+    173,181,214,90,107,173,169,214,90,107,173,181,214,90,107,77,181,214,90,107,173,181,214,90,
+    107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,
+    181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,0,
+    144,111,133,3,128,255,131,141,51,172,36,157,21,142,6,23,26,178,18,0,8,7,0,0,
+    140,97,204,65,231,160,131,14,66,195,148,115,16,66,8,33,132,16,26,166,32,148,18,66,
+    41,165,164,148,65,39,37,165,82,82,74,41,165,204,65,41,41,149,146,82,74,169,117,82,
+    82,106,45,165,214,90,139,173,147,146,82,75,41,165,214,90,139,29,132,84,82,106,173,181,
+    216,98,235,32,164,148,82,107,173,181,24,99,40,37,181,214,90,139,49,198,24,67,41,41,
+    181,214,90,140,49,214,88,74,105,169,181,24,99,140,49,198,82,82,74,173,197,24,99,140,
+    49,150,148,90,139,173,197,24,99,140,181,164,212,90,108,49,198,26,99,141,5,0,112,55,
+    56,0,64,36,216,56,195,74,210,89,225,104,112,161,33,43,1,128,144,0,0,4,33,198,
+    156,115,206,57,232,28,132,16,41,197,152,115,206,57,7,33,132,16,34,165,24,115,206,57,
+    231,32,132,16,66,198,152,115,206,65,8,33,132,16,66,200,24,115,206,57,8,33,132,16,
+    66,8,157,115,206,65,8,33,132,16,66,8,161,115,206,57,8,33,132,16,66,8,33,116,
+    206,65,8,33,132,16,66,8,33,132,206,57,8,33,132,16,66,8,33,132,208,65,8,33,
+    132,16,66,8,33,132,18,58,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+    33,132,80,74,8,33,132,16,66,8,33,132,16,66,40,33,132,16,66,8,33,132,18,66,
+    40,33,132,16,66,8,33,148,16,66,9,161,132,16,66,8,33,132,82,74,40,161,148,16,
+    66,8,33,132,80,74,40,37,132,82,0,0,192,129,3,0,64,128,17,116,146,81,101,17,
+    54,154,112,225,1,40,52,100,37,0,64,6,0,128,64,141,53,246,22,107,100,148,114,144,
+    74,203,37,66,74,57,41,177,151,74,41,229,32,180,26,51,165,140,82,140,106,201,24,83,
+    74,49,137,185,132,14,41,164,164,150,208,57,165,144,81,148,82,75,37,132,8,65,105,57,
+    198,24,59,198,0,0,0,16,4,0,24,136,144,153,64,160,0,10,12,100,0,192,1,66,
+    130,20,0,80,88,96,232,24,46,2,2,114,9,25,5,6,133,99,194,57,233,180,1,0,
+    8,66,100,134,72,68,44,6,137,9,213,64,81,49,29,0,44,46,48,228,3,64,134,198,
+    70,218,197,5,116,25,224,130,46,238,58,16,66,16,130,16,196,226,0,10,72,192,193,9,
+    55,60,241,134,39,220,224,4,157,162,82,7,1,0,0,0,0,128,0,0,15,0,0,201,
+    6,16,17,17,205,28,71,135,199,7,72,136,200,8,73,137,201,9,74,0,0,0,0,0,
+    0,1,192,7,0,64,146,2,68,68,68,51,199,209,225,241,1,18,34,50,66,82,98,114,
+    130,18,0,0,0,0,0,0,0,0,0,4,4,4,0,0,0,0,0,2,0,0,0,4,
+    4,79,103,103,83,0,4,10,55,0,0,0,0,0,0,143,76,126,65,2,0,0,0,20,
+    234,35,112,23,41,43,41,42,41,42,76,77,75,251,253,248,247,250,240,237,248,238,224,232,
+    236,227,108,124,229,180,8,92,106,214,24,182,35,95,0,139,135,199,186,120,159,155,20,69,
+    222,44,148,108,236,11,43,126,162,216,255,11,126,120,5,82,182,222,74,0,180,225,104,43,
+    16,220,8,32,50,62,179,1,115,60,117,79,95,132,148,141,146,238,236,91,127,185,56,128,
+    117,75,149,154,220,201,67,165,191,98,38,226,141,122,1,196,233,168,32,227,0,72,149,173,
+    82,17,192,132,209,200,180,63,110,43,104,70,99,25,182,181,90,100,16,190,123,214,160,238,
+    100,103,211,10,119,162,76,10,212,233,32,151,171,34,41,150,144,140,91,85,0,37,41,92,
+    30,165,185,40,23,105,134,156,124,4,153,57,250,139,97,195,246,180,215,27,50,113,67,194,
+    70,44,244,225,184,52,1,56,96,124,47,2,72,73,245,201,154,82,100,12,89,85,135,219,
+    186,166,21,254,222,196,2,47,223,163,142,160,188,128,168,241,166,50,0,172,225,16,68,222,
+    0,21,48,126,36,128,194,163,56,60,243,167,185,176,116,239,119,151,83,111,99,203,202,83,
+    61,233,25,87,47,194,103,197,186,175,199,4,1,12,250,154,51,9,73,151,20,25,254,255,
+    46,189,118,49,224,105,198,162,65,28,135,49,189,185,109,242,214,184,249,244,249,79,246,234,
+    204,241,202,178,225,141,179,240,171,237,93,153,236,10,177,63,62,44,253,108,45,214,173,219,
+    59,133,241,11,143,106,123,233,78,73,234,209,43,21,195,218,3,20,250,178,5,198,110,63,
+    97,248,151,51,77,230,190,143,193,13,230,103,57,61,47,188,55,49,168,124,240,209,83,253,
+    91,57,60,251,239,209,105,121,213,199,231,106,121,137,76,71,233,185,250,192,188,135,167,112,
+    234,205,231,88,93,214,255,62,178,143,84,118,125,238,244,77,62,33,52,119,1,3,44,6,
+    179,145,47,181,137,27,103,254,95,203,57,73,185,136,245,100,85,208,243,232,130,19,90,123,
+    125,166,183,99,255,103,172,112,53,54,218,31,74,30,171,222,125,127,173,253,243,50,125,213,
+    57,148,151,159,88,110,30,30,122,92,202,44,172,142,243,205,217,181,62,10,240,123,155,104,
+    1,250,183,36,108,15,77,254,32,97,149,118,28,0,128,44,208,123,47,154,27,33,149,34,
+    41,48,74,234,244,200,164,232,26,43,79,235,86,199,210,175,125,147,184,185,217,95,85,141,
+    25,163,215,183,156,220,180,124,179,39,7,82,183,157,87,252,161,180,31,232,41,135,245,251,
+    4,83,181,249,98,184,29,87,14,101,204,174,89,239,79,253,190,106,56,161,225,12,188,82,
+    146,102,42,190,156,97,167,134,166,221,89,192,214,127,128,143,221,211,118,159,134,208,52,2,
+    117,241,51,3,217,53,71,164,30,103,224,215,25,196,229,169,211,244,110,46,253,74,139,33,
+    48,134,107,38,54,77,187,251,202,121,2,195,79,189,9,127,95,131,205,163,247,122,53,187,
+    119,36,27,15,128,116,235,244,248,142,126,2,108,36,214,221,204,185,152,81,197,22,210,211,
+    156,114,35,186,158,44,177,159,253,152,2,52,237,83,248,173,90,255,65,93,195,121,189,107,
+    96,62,112,253,6,165,191,73,31,138,132,255,61,93,42,80,178,202,22,255,117,4,166,228,
+    156,81,62,165,139,67,252,217,183,157,178,0,126,89,37,135,42,246,200,155,73,65,34,122,
+    175,97,115,207,12,57,91,6,66,5,173,238,221,207,184,17,202,36,117,2,234,117,24,177,
+    198,19,147,222,247,222,199,244,229,174,113,124,186,202,24,173,15,255,122,228,83,199,161,212,
+    156,166,39,126,109,169,221,122,245,112,51,113,249,225,84,252,203,90,90,69,23,48,245,179,
+    26,71,123,166,177,83,233,234,172,191,56,27,97,207,91,44,230,216,59,92,76,11,163,75,
+    93,147,77,73,206,162,91,136,225,159,54,86,128,89,240,237,209,194,64,100,207,137,9,134,
+    32,77,87,106,35,127,158,115,187,111,56,251,57,249,81,142,234,13,232,10,251,74,128,75,
+    126,31,133,223,231,2,86,2,189,247,72,81,109,210,38,145,116,74,219,212,113,87,24,214,
+    239,162,172,175,166,208,222,72,238,221,212,41,137,173,182,83,25,229,195,171,226,202,167,93,
+    177,135,206,77,37,112,151,143,101,220,24,127,225,118,161,255,12,5,7,170,96,255,219,245,
+    187,36,32,26,69,125,197,113,244,16,86,58,38,193,111,202,126,154,9,134,133,240,183,236,
+    14,254,153,69,97,34,45,126,64,133,246,125,79,54,234,42,19,158,201,215,144,16,160,142,
+    222,202,200,61,87,9,74,2,45,14,51,136,77,158,59,54,136,73,110,56,149,27,163,239,
+    127,237,159,95,116,120,104,89,17,31,172,183,30,238,145,209,38,121,63,149,110,96,18,156,
+    249,43,118,68,136,98,233,157,161,193,106,135,175,114,15,29,11,211,21,27,39,16,240,57,
+    175,122,184,5,23,172,56,38,60,238,152,236,206,190,230,241,200,49,18,155,74,223,165,51,
+    136,157,33,120,234,234,124,205,205,250,76,113,241,21,73,245,187,125,221,163,167,218,164,25,
+    100,107,13,163,192,137,54,69,108,170,20,138,154,1,147,8,146,81,151,208,227,59,178,159,
+    234,38,122,208,15,74,50,41,82,194,115,147,89,212,149,178,214,122,190,109,213,203,119,229,
+    238,31,247,56,92,138,20,125,65,250,92,107,221,247,173,168,106,142,77,180,222,109,242,110,
+    176,47,82,135,86,152,213,96,71,56,236,67,137,228,107,108,191,127,96,133,50,29,148,199,
+    92,2,64,90,63,207,144,47,0,254,9,149,150,39,117,94,222,208,67,247,110,96,231,115,
+    209,109,150,131,176,146,238,39,45,137,208,148,39,77,9,28,133,89,123,149,17,127,46,123,
+    54,23,218,76,59,151,243,148,111,218,99,125,223,237,126,20,156,233,104,203,253,45,149,115,
+    36,30,76,173,41,108,117,172,233,189,201,137,177,246,15,13,82,50,25,100,190,111,46,223,
+    78,85,151,228,184,65,12,94,223,200,110,41,85,203,11,197,36,7,105,11,139,119,108,13,
+    146,96,47,51,55,216,188,96,229,168,146,200,239,91,92,12,16,157,153,148,103,140,117,224,
+    154,27,251,105,165,25,25,32,145,71,16,94,35,68,229,234,67,213,198,23,111,124,12,114,
+    23,178,54,144,59,168,69,92,26,36,136,119,56,38,18,67,250,91,84,8,182,125,162,248,
+    94,150,130,153,81,29,176,130,81,41,167,237,72,31,249,5,255,99,211,207,39,227,60,121,
+    145,13,17,46,1,180,241,14,209,120,219,23,140,118,74,20,84,72,172,191,225,18,234,185,
+    105,38,12,171,49,125,246,79,202,55,30,72,122,117,5,0,222,216,36,178,5,123,252,101,
+    83,44,70,244,222,20,182,46,242,57,162,17,5,232,205,9,208,123,132,233,138,164,41,129,
+    6,91,12,184,154,190,184,247,33,46,78,162,37,102,250,232,98,32,169,23,219,167,51,247,
+    181,200,38,154,55,138,222,212,104,81,58,216,231,206,55,99,243,226,186,142,193,171,156,141,
+    60,172,195,242,165,233,106,84,2,140,152,206,168,176,197,48,119,198,237,56,108,113,159,133,
+    58,92,230,42,121,245,185,147,120,113,168,114,26,167,211,172,197,235,208,253,241,216,195,180,
+    98,65,87,5,101,110,115,50,150,153,188,173,41,66,167,59,73,19,105,126,110,111,107,162,
+    232,17,23,144,93,76,103,94,59,229,217,195,66,246,141,164,166,41,151,176,77,134,65,10,
+    43,38,206,145,49,13,123,96,10,124,68,156,45,26,69,232,108,135,178,177,202,43,104,129,
+    105,49,173,9,152,80,181,220,151,86,79,100,47,231,4,100,50,4,47,146,20,197,92,151,
+    242,197,57,5,192,125,248,230,151,114,188,97,96,17,10,243,231,40,71,185,221,37,89,96,
+    15,0,62,9,21,106,77,115,99,66,15,111,28,0,128,136,134,214,6,128,30,161,89,158,
+    167,24,64,13,244,243,78,45,124,14,135,115,239,39,255,227,241,250,171,65,68,78,11,4,
+    55,251,86,222,117,35,179,9,97,177,51,213,14,24,85,154,232,253,214,210,219,149,99,179,
+    171,177,183,85,121,143,83,55,90,103,34,56,254,68,51,54,185,31,50,190,99,175,29,239,
+    177,208,96,10,145,94,127,249,52,190,237,188,29,211,213,24,108,225,30,155,130,251,195,73,
+    69,241,214,203,73,12,189,113,123,163,233,36,189,25,185,82,2,11,58,232,143,187,183,35,
+    124,176,24,116,147,33,255,161,93,111,119,193,162,98,117,16,96,68,176,144,244,169,33,88,
+    8,245,162,107,130,102,27,126,124,204,16,249,148,130,148,160,86,82,40,242,251,102,218,204,
+    160,72,204,58,124,50,25,66,86,194,155,41,137,34,86,42,39,206,137,59,58,103,98,147,
+    149,65,216,169,176,195,191,206,137,88,216,60,12,15,6,114,228,178,105,203,156,34,91,79,
+    11,0,222,168,20,86,109,166,16,14,195,98,226,189,41,112,196,198,17,209,8,30,189,245,
+    232,233,112,93,69,74,10,228,79,46,36,179,87,87,185,89,155,141,183,211,35,122,158,220,
+    150,66,234,54,211,50,189,248,50,236,116,10,149,142,168,212,45,138,16,160,214,142,89,137,
+    144,202,44,215,148,152,154,36,93,165,191,135,11,175,215,212,198,185,20,53,236,91,239,162,
+    72,175,104,161,140,181,55,104,224,218,72,30,138,36,151,81,75,30,195,7,69,150,67,209,
+    63,145,81,92,141,36,17,192,230,66,245,169,71,255,152,172,244,9,118,166,209,13,98,75,
+    105,224,197,49,246,67,104,5,139,140,101,24,44,104,171,157,193,81,214,165,30,139,226,252,
+    77,72,253,183,233,180,164,139,179,13,158,147,255,168,25,72,169,250,126,123,128,6,6,48,
+    189,110,55,129,180,80,186,80,197,53,198,179,218,181,128,197,73,27,91,83,183,133,12,88,
+    32,217,40,250,126,53,71,35,41,76,150,57,17,232,144,243,68,4,31,238,86,130,0,190,
+    88,100,92,205,9,164,209,48,241,191,9,102,4,115,220,148,40,118,160,247,30,165,27,154,
+    237,42,82,2,121,253,118,30,216,101,247,13,76,222,79,238,22,201,193,94,95,55,87,254,
+    243,52,43,159,37,183,39,173,180,94,58,187,149,162,242,43,64,10,211,83,24,8,141,67,
+    131,248,227,220,0,194,217,17,183,59,19,198,28,10,121,232,216,52,17,243,139,214,220,146,
+    92,139,45,74,38,255,217,49,195,132,75,38,63,1,238,57,121,178,248,38,215,183,117,87,
+    73,64,187,54,216,80,241,181,41,158,143,42,216,85,194,230,84,72,144,145,118,43,134,174,
+    22,198,104,167,117,215,84,224,23,248,240,64,11,217,79,10,57,216,29,124,198,237,68,110,
+    38,147,20,249,104,244,50,86,38,232,212,55,151,106,255,45,107,226,76,231,15,75,241,183,
+    62,128,165,165,191,249,165,155,59,1,112,238,94,175,155,56,231,121,95,80,215,236,166,67,
+    172,95,243,28,16,66,159,188,191,96,99,128,190,250,199,216,231,47,12,149,181,210,130,179,
+    114,183,222,11,88,176,0,126,120,44,182,75,73,102,147,49,198,55,14,0,80,244,9,179,
+    6,244,214,242,180,168,68,201,204,192,72,32,67,103,46,19,69,190,172,163,92,226,37,221,
+    115,208,97,237,204,122,245,167,183,141,120,221,247,117,11,101,1,123,14,178,68,21,163,86,
+    105,39,93,240,27,23,119,79,52,198,160,169,171,132,63,65,52,175,129,106,20,231,122,241,
+    108,154,194,196,22,153,90,155,233,22,203,68,80,252,61,227,218,111,162,153,201,58,97,216,
+    177,167,71,110,95,233,228,92,92,167,120,7,105,151,34,171,134,131,56,90,152,66,173,45,
+    43,78,9,233,206,28,65,36,134,60,19,252,169,215,153,188,212,253,26,137,67,35,66,108,
+    144,41,180,198,252,60,220,191,126,33,190,199,51,137,177,247,11,238,154,195,196,252,36,177,
+    77,21,173,59,178,178,28,44,250,41,144,16,107,223,104,50,40,67,172,155,35,90,231,191,
+    54,88,253,174,52,117,99,236,228,89,58,149,57,209,207,143,139,205,250,144,171,90,189,62,
+    171,23,27,16,0,158,119,100,118,107,58,204,13,224,141,3,0,4,25,232,145,36,190,231,
+    138,82,42,166,192,251,1,27,108,13,226,134,116,231,206,225,212,212,104,232,52,72,117,66,
+    195,74,144,60,245,150,87,43,170,180,47,243,94,35,118,57,52,59,6,75,125,159,149,249,
+    158,6,95,195,92,239,69,38,156,169,243,250,200,63,144,7,138,139,190,221,128,20,66,157,
+    185,188,72,112,90,20,140,248,103,196,89,218,197,108,149,21,224,203,193,68,54,151,204,232,
+    120,213,209,174,38,165,44,40,194,112,88,200,56,145,33,223,9,140,78,191,87,104,80,121,
+    125,50,104,87,11,219,48,242,58,196,133,84,183,15,133,8,239,43,24,239,22,48,107,152,
+    65,35,235,42,123,18,161,105,9,174,150,25,97,21,234,124,55,164,109,68,80,183,195,78,
+    66,204,162,122,107,178,125,64,182,113,130,248,250,125,249,66,139,177,199,141,173,0,69,220,
+    90,138,30,156,251,131,223,29,66,228,127,197,234,190,71,116,124,203,114,162,209,128,247,254,
+    149,224,134,163,55,208,129,150,180,36,114,205,53,89,100,6,18,235,161,96,114,123,221,224,
+    50,21,109,88,230,186,64,97,105,115,255,151,173,220,63,213,54,148,234,133,39,47,84,95,
+    239,15,242,35,105,33,158,173,84,127,71,177,235,113,229,145,153,190,209,124,255,249,195,235,
+    7,181,99,156,186,12,156,2,143,19,220,58,61,60,67,222,246,250,126,18,183,10,148,127,
+    179,66,69,199,173,244,67,11,60,116,76,47,106,26,189,203,154,154,97,190,37,181,103,248,
+    154,157,86,42,28,53,162,72,138,143,117,183,252,115,44,115,253,138,26,239,50,91,221,181,
+    145,114,59,98,88,113,23,159,101,230,48,86,178,74,166,251,162,93,78,64,195,183,252,43,
+    137,93,106,95,167,213,22,113,20,153,38,94,179,200,100,178,206,228,53,19,107,197,104,167,
+    73,102,147,204,133,111,206,8,21,52,255,59,32,155,177,107,82,145,215,102,46,98,74,1,
+    227,180,66,88,0,62,39,44,160,37,36,36,210,16,136,55,14,0,80,142,68,111,121,146,
+    132,210,148,98,131,2,55,0,23,50,46,193,237,69,217,15,207,81,204,206,109,11,61,11,
+    168,110,149,79,172,23,189,106,223,108,203,224,229,182,105,99,206,189,74,73,176,69,228,87,
+    157,222,25,206,206,57,6,99,177,162,60,214,69,110,108,184,7,177,211,166,145,7,185,28,
+    57,142,246,183,204,125,232,173,23,245,246,74,89,169,243,177,252,42,135,226,43,204,98,235,
+    26,78,155,18,144,52,89,43,248,103,108,18,123,120,231,57,7,93,159,165,249,190,196,175,
+    249,238,143,104,152,68,233,5,44,81,141,162,115,68,68,204,197,149,197,150,19,90,159,56,
+    30,79,58,43,58,42,156,80,103,36,199,140,145,114,184,93,64,199,96,123,192,209,251,143,
+    222,224,154,26,152,94,50,65,37,16,13,188,129,87,153,188,110,120,238,9,66,87,165,133,
+    21,106,90,251,57,86,90,170,215,215,158,242,233,148,250,18,92,239,86,230,139,150,182,221,
+    2,62,38,244,196,90,62,174,108,14,48,189,79,3,115,235,108,140,1,22,64,153,231,101,
+    136,14,73,40,50,5,150,215,255,164,214,30,164,42,253,218,196,235,51,249,62,40,107,59,
+    95,160,91,255,252,153,39,101,117,155,253,159,18,178,80,183,247,45,96,35,29,209,44,145,
+    192,65,21,27,227,29,177,22,196,6,207,129,67,86,167,119,171,11,214,252,254,186,168,98,
+    115,44,33,111,238,254,38,107,5,114,159,72,201,29,154,185,131,35,80,101,236,213,1,116,
+    254,26,163,5,71,147,73,117,82,150,123,122,242,68,219,27,229,98,218,31,171,69,158,171,
+    235,216,0,163,158,152,177,190,169,165,71,82,230,248,130,216,172,147,52,47,172,81,25,80,
+    246,39,183,168,223,13,166,216,107,129,250,23,210,223,111,28,51,31,158,123,82,100,12,55,
+    227,90,171,55,109,204,253,68,147,37,221,106,22,236,47,114,34,55,104,25,14,158,101,6,
+    123,25,55,221,24,223,183,116,63,148,65,2,126,53,252,111,175,119,80,192,6,206,158,177,
+    191,201,145,42,160,107,138,164,0,0,0,192,165,199,173,133,54,169,41,236,121,56,51,65,
+    243,205,245,190,237,169,147,194,88,61,251,54,136,137,195,26,121,130,147,252,208,225,199,20,
+    249,114,83,126,185,41,87,135,44,112,146,231,72,1,192,168,239,131,156,16,139,153,142,237,
+    101,125,78,35,35,3,16,185,73,90,30,146,28,172,253,111,146,22,0,161,121,216,236,0,
+};
+
+// assets/sprite_atlas.png
+static const Uint8 AB_DATA_6[] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,255,0,0,2,0,
+    8,6,0,0,0,140,221,101,239,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,
+    32,0,73,68,65,84,120,156,237,221,91,140,101,217,93,223,241,181,171,170,171,170,187,199,
+    246,204,116,207,197,51,99,27,203,66,36,6,108,163,8,48,34,76,72,30,140,35,89,121,
+    32,40,19,199,160,8,41,15,40,33,142,8,60,33,33,20,5,145,72,196,65,33,78,144,
+    18,69,150,2,198,34,114,120,136,144,50,182,132,184,72,192,24,28,20,219,220,28,100,97,
+    143,135,113,143,221,61,182,103,186,186,46,93,85,59,15,107,253,215,174,245,91,123,157,189,
+    79,213,62,85,187,123,125,63,15,156,62,183,181,47,115,204,174,223,186,252,119,243,247,126,
+    235,15,90,7,0,23,224,127,125,239,119,52,246,239,31,120,231,247,181,206,57,247,142,31,
+    59,118,206,57,247,224,235,174,250,199,215,62,144,60,190,238,1,255,250,107,30,184,226,156,
+    115,238,129,43,219,206,57,231,182,183,54,157,115,206,237,237,31,56,231,156,219,185,179,235,
+    156,115,238,149,157,61,255,248,234,109,231,156,115,95,123,197,63,126,245,149,157,228,249,215,
+    195,243,87,119,238,132,239,239,37,237,149,180,207,126,163,115,206,185,143,62,247,177,236,88,
+    238,23,31,125,238,99,205,245,199,159,90,201,49,221,188,241,66,60,111,108,99,245,219,176,
+    54,214,166,218,41,0,0,112,111,216,184,232,29,0,128,68,99,15,205,201,167,241,177,123,
+    127,113,240,177,119,155,182,77,94,104,91,249,68,155,182,159,109,239,12,126,244,195,111,117,
+    206,57,119,101,219,247,74,88,239,196,86,120,220,188,228,255,95,240,165,240,120,247,240,208,
+    57,231,220,254,93,255,120,16,122,29,182,54,253,231,247,195,115,235,141,184,179,103,143,251,
+    254,113,119,47,121,220,137,207,247,123,31,119,247,253,227,94,248,254,222,193,93,191,221,131,
+    176,253,95,127,115,118,76,95,249,210,23,151,56,3,101,143,188,254,13,206,185,46,193,158,
+    76,181,181,108,195,190,59,246,115,103,57,14,109,131,228,15,0,64,101,72,254,0,102,169,
+    203,245,146,193,219,113,217,220,122,14,90,253,152,118,33,200,83,233,40,56,147,135,31,244,
+    243,20,54,45,241,91,210,223,8,73,63,36,124,155,95,112,222,201,222,122,26,80,31,146,
+    63,0,0,149,33,249,3,152,151,44,122,167,25,188,105,210,231,229,132,46,239,104,226,215,
+    47,182,50,248,63,129,236,16,116,155,77,156,192,224,223,14,207,243,99,210,99,177,249,16,
+    77,255,167,154,116,130,131,245,126,52,133,115,138,250,144,252,1,0,168,12,201,31,192,204,
+    132,84,43,1,189,213,217,250,105,104,46,182,147,63,215,132,31,210,113,169,71,224,76,100,
+    39,179,157,149,94,14,237,125,40,204,79,104,219,254,157,212,230,237,152,154,86,247,99,194,
+    238,13,220,147,72,254,0,0,84,134,228,15,96,94,52,128,91,24,46,205,210,31,104,71,
+    199,185,117,156,188,27,63,159,158,213,24,104,74,99,254,93,49,130,66,11,182,207,210,110,
+    255,199,242,237,151,222,40,244,28,76,97,236,218,245,49,109,12,153,251,54,206,195,105,207,
+    55,201,31,0,128,202,144,252,1,204,138,166,100,29,251,215,217,254,69,50,55,32,235,74,
+    104,219,222,183,167,28,14,207,106,12,40,233,205,200,122,55,10,53,7,218,194,252,133,238,
+    16,155,222,215,187,192,63,239,49,255,243,72,219,115,79,244,67,172,202,223,105,107,252,147,
+    252,1,0,168,12,201,31,192,60,21,194,105,91,26,63,215,207,101,237,53,233,247,173,2,
+    96,250,118,214,97,112,22,67,99,245,221,130,131,82,55,69,255,94,52,186,66,33,146,213,
+    2,173,204,103,152,119,224,199,57,34,249,3,0,80,25,146,63,128,153,41,221,133,207,44,
+    94,224,223,101,230,182,247,251,113,92,125,116,165,192,211,211,98,133,58,7,160,205,238,83,
+    208,246,127,176,176,119,249,108,254,145,181,10,232,1,168,30,201,31,0,128,202,144,252,1,
+    204,76,58,78,157,5,245,166,48,5,94,62,175,237,104,37,191,70,134,199,245,249,20,61,
+    1,77,86,67,64,107,12,216,62,233,251,133,68,47,178,125,148,10,129,229,213,6,212,246,
+    159,131,139,92,113,64,242,7,0,160,50,36,127,0,179,210,198,212,218,191,134,189,203,198,
+    165,234,117,133,246,226,247,211,30,0,157,19,48,101,38,254,215,255,241,151,39,108,13,152,
+    14,201,31,0,128,202,144,252,1,204,82,35,83,228,227,58,252,216,33,80,24,208,46,77,
+    148,143,171,7,164,232,255,41,103,190,143,153,27,208,62,251,141,167,107,28,11,141,173,203,
+    63,69,27,247,122,37,192,18,146,63,0,0,149,33,249,3,152,169,254,250,244,249,189,238,
+    251,105,229,190,238,86,246,253,213,243,116,102,252,80,135,192,162,196,255,209,231,62,214,56,
+    231,220,15,188,243,251,90,231,156,107,222,253,23,3,173,205,139,245,88,216,113,44,99,78,
+    117,249,23,165,251,251,53,209,143,69,242,7,0,160,50,36,127,0,179,18,103,227,23,6,
+    213,227,50,255,129,91,213,199,175,183,86,195,95,106,249,235,118,87,120,199,187,183,191,245,
+    45,206,57,231,30,122,237,3,206,57,231,30,12,143,175,123,205,213,240,220,63,190,230,234,
+    21,231,156,115,87,175,108,59,231,156,219,222,218,116,206,57,183,183,127,224,156,115,110,231,
+    206,158,115,206,185,87,118,238,248,199,87,118,156,115,206,125,245,85,255,248,181,175,191,234,
+    31,195,243,175,135,199,87,111,223,73,190,111,237,97,181,230,60,175,128,228,15,0,64,101,
+    72,254,0,102,37,187,107,95,136,228,122,103,186,82,62,111,116,78,64,156,213,175,149,1,
+    251,219,237,42,1,78,167,91,185,144,182,218,140,238,100,72,123,45,92,118,40,118,140,82,
+    189,176,149,99,196,185,184,121,227,133,198,57,231,174,63,254,212,108,75,41,146,252,1,0,
+    168,12,201,31,192,188,72,28,110,101,44,190,52,214,159,145,30,132,46,225,167,115,0,178,
+    20,93,218,45,105,118,25,221,205,251,210,98,5,217,93,255,138,51,18,10,61,6,214,11,
+    162,237,202,94,151,90,197,106,89,15,64,201,69,246,12,144,252,1,0,168,12,201,31,192,
+    60,197,177,126,75,175,225,249,192,45,235,179,251,225,149,34,187,165,100,41,248,55,242,150,
+    1,75,209,93,208,158,128,174,216,224,226,254,133,236,93,233,57,200,58,24,228,155,83,196,
+    204,41,170,235,213,178,141,177,206,179,98,161,33,249,3,0,80,25,146,63,128,89,105,244,
+    95,133,225,239,226,108,255,244,99,217,28,1,171,35,96,41,187,201,186,10,198,238,233,120,
+    173,205,186,215,65,126,173,105,48,144,205,91,137,250,141,116,107,180,141,140,241,143,108,119,
+    140,243,152,193,126,191,108,227,60,247,229,180,109,144,252,1,0,168,12,201,31,192,44,53,
+    113,230,186,165,230,194,7,219,254,167,249,248,119,154,138,91,25,23,215,241,241,41,89,66,
+    183,100,94,186,61,65,59,176,237,216,91,97,159,111,229,220,104,55,71,171,103,227,236,134,
+    102,176,179,141,229,77,177,47,203,182,193,197,31,0,48,104,85,221,228,39,47,90,108,99,
+    252,54,206,138,139,63,128,89,105,99,226,183,148,43,235,242,245,54,125,34,123,89,43,5,
+    22,254,223,114,55,60,62,253,255,223,46,87,230,75,118,109,124,123,186,190,191,84,71,224,
+    76,213,9,112,63,227,226,15,0,24,109,170,155,208,216,210,52,75,201,39,83,45,219,24,
+    191,141,211,226,226,15,96,94,180,224,125,49,54,219,231,11,31,47,60,119,113,150,127,186,
+    108,96,133,55,245,203,247,166,80,212,127,160,36,65,79,165,62,73,248,177,150,127,179,104,
+    51,0,179,253,1,0,168,13,201,31,192,188,200,58,254,98,101,191,172,142,125,111,51,217,
+    205,253,226,44,127,105,176,88,9,112,10,165,170,129,178,10,160,72,166,59,196,158,0,57,
+    87,221,170,130,197,219,5,72,254,0,0,84,134,228,15,96,166,178,219,241,249,255,219,200,
+    106,128,172,130,95,250,152,173,157,31,168,225,191,138,49,255,108,93,127,28,155,79,31,7,
+    119,73,42,251,101,29,6,178,238,63,91,85,176,220,110,227,62,70,242,7,0,160,50,36,
+    127,0,179,162,195,213,93,138,77,211,113,252,92,33,206,182,146,170,179,150,37,142,119,203,
+    251,167,207,199,186,239,22,217,139,99,247,67,237,233,244,127,169,77,208,202,28,129,108,69,
+    3,170,199,197,31,0,48,153,251,229,118,188,182,141,169,214,234,95,212,54,74,184,248,3,
+    152,151,108,16,95,239,121,47,111,151,154,113,50,243,93,218,45,223,240,110,250,124,220,100,
+    243,14,250,183,49,122,203,217,73,72,163,126,35,61,10,250,49,128,139,63,0,96,50,99,
+    83,236,89,210,251,121,108,227,60,92,68,226,55,92,252,1,204,140,46,106,239,255,212,96,
+    74,206,166,188,107,179,82,88,191,73,159,174,116,106,188,212,228,31,26,235,207,22,40,20,
+    74,0,182,50,121,160,176,24,0,96,182,63,0,0,181,33,249,3,152,149,86,2,185,142,
+    213,235,45,234,139,105,182,109,78,126,44,239,1,176,247,91,233,97,88,124,211,192,83,178,
+    42,133,105,171,99,183,161,243,29,98,239,197,216,229,1,128,32,249,3,0,80,25,146,63,
+    128,121,146,202,126,186,118,61,166,225,108,96,59,121,232,30,109,109,189,181,23,155,47,204,
+    188,159,112,124,188,219,182,109,178,112,155,190,242,210,133,133,111,20,167,41,140,93,26,129,
+    234,112,241,7,0,84,103,238,43,1,86,141,139,63,128,89,233,238,174,151,206,96,31,125,
+    163,58,29,179,151,246,98,234,142,93,4,233,220,128,85,78,136,47,116,82,100,221,20,67,
+    251,208,37,253,52,243,183,90,57,176,244,69,84,143,49,127,0,64,53,110,222,120,161,185,
+    121,227,133,234,7,64,72,254,0,230,37,166,214,254,187,241,21,211,115,65,35,93,1,109,
+    97,46,65,250,234,180,154,194,58,124,163,199,80,152,134,144,127,65,106,251,55,210,75,18,
+    219,27,187,163,168,6,23,127,0,192,104,99,199,202,231,94,19,127,40,253,95,127,252,169,
+    149,15,146,80,219,31,0,130,60,137,203,236,252,54,77,242,67,61,1,173,76,219,143,235,
+    251,229,147,89,21,189,41,53,233,188,130,161,98,2,122,14,90,249,151,222,173,175,145,218,
+    254,122,20,231,81,180,16,247,22,46,254,0,128,209,46,178,30,253,156,246,97,10,212,246,
+    7,0,35,195,226,173,164,221,174,7,160,77,159,247,55,211,45,161,79,39,247,199,153,241,
+    113,123,171,156,238,31,183,93,40,75,56,122,222,65,97,52,63,155,83,176,248,78,136,0,
+    179,253,1,0,168,12,201,31,192,76,105,108,13,105,182,177,196,159,166,219,244,83,39,123,
+    14,10,3,232,165,132,191,130,152,28,123,47,90,237,102,72,55,217,22,118,42,219,37,153,
+    229,175,237,117,85,13,229,249,216,29,198,125,143,228,15,0,64,101,72,254,0,230,41,206,
+    144,183,217,254,50,107,63,251,71,144,85,183,11,61,5,113,70,188,110,198,198,203,251,155,
+    155,70,186,98,161,84,121,175,41,78,255,151,167,86,201,175,84,204,63,219,128,174,54,64,
+    237,72,254,0,0,84,134,228,15,96,86,238,203,218,254,113,159,210,173,196,249,10,165,192,
+    110,159,206,122,55,210,239,107,47,71,220,94,124,186,120,101,4,234,195,197,31,0,48,218,
+    121,220,13,111,78,119,220,59,203,190,204,233,56,20,23,127,0,243,114,31,214,246,215,198,
+    27,217,118,43,61,0,122,80,217,234,126,221,103,93,223,47,159,39,241,67,49,230,15,0,
+    24,116,30,119,195,155,211,29,247,206,178,47,115,58,142,18,146,63,128,89,185,31,107,251,
+    199,177,121,173,74,168,9,191,88,132,127,241,117,68,171,21,150,14,98,214,87,35,156,43,
+    46,254,0,128,209,206,35,209,206,41,53,159,101,95,230,116,28,138,139,63,128,121,185,31,
+    107,251,203,221,247,154,129,218,254,57,93,232,31,30,134,198,248,23,223,60,112,41,171,186,
+    197,237,89,46,144,127,255,157,239,90,106,159,254,231,115,31,95,217,197,120,78,251,50,6,
+    99,254,0,0,84,134,228,15,96,166,238,159,218,254,217,182,44,177,75,50,31,234,197,208,
+    154,253,113,222,66,172,133,144,214,68,136,223,151,94,143,179,152,234,54,180,182,12,206,122,
+    20,198,244,0,104,186,254,200,135,222,213,251,185,247,254,240,199,253,251,191,243,235,233,235,
+    79,191,167,117,110,154,212,61,167,125,57,13,146,63,0,0,149,33,249,3,152,37,77,169,
+    54,246,175,195,229,229,164,46,61,7,113,220,189,255,245,172,221,9,117,235,249,23,175,48,
+    208,245,251,70,123,51,154,210,23,139,53,255,229,243,247,24,75,217,154,174,143,63,255,145,
+    228,249,251,254,213,53,231,92,158,178,141,189,126,150,212,61,167,125,57,11,146,63,0,0,
+    149,33,249,3,152,23,169,130,167,169,215,233,120,119,65,12,197,113,192,59,60,232,34,251,
+    254,142,128,149,174,137,111,165,54,127,211,189,113,114,151,202,223,47,60,150,186,47,74,61,
+    10,115,167,41,91,211,117,201,231,110,126,218,57,231,220,91,174,191,45,121,253,189,79,191,
+    199,57,183,92,234,46,205,226,183,177,252,15,255,244,173,115,219,151,41,145,252,1,0,168,
+    12,201,31,192,44,117,113,75,7,255,199,101,115,173,159,159,55,215,95,212,95,58,10,166,
+    37,17,60,171,237,47,189,29,241,115,133,102,26,45,78,160,237,223,227,99,252,150,170,199,
+    38,254,85,236,67,105,204,222,88,130,31,234,1,152,27,146,63,0,0,149,33,249,3,152,
+    151,44,122,75,109,126,89,216,95,14,183,165,42,122,90,42,80,182,187,130,17,215,110,222,
+    129,85,43,44,236,67,220,23,249,126,225,253,88,253,176,116,202,154,222,167,43,101,235,247,
+    167,168,7,96,51,230,75,52,109,219,243,247,125,255,79,58,231,156,251,153,95,251,89,231,
+    92,55,222,62,148,226,79,227,196,152,125,178,15,23,177,47,203,32,249,3,0,80,25,146,
+    63,128,153,73,171,223,197,25,237,58,91,127,176,110,125,105,176,63,155,98,31,254,239,64,
+    26,63,3,173,50,24,103,251,219,158,21,231,37,148,218,75,255,161,43,27,74,43,23,206,
+    99,10,192,89,18,255,216,113,118,83,26,111,215,212,61,118,187,189,51,237,63,247,11,254,
+    241,45,239,239,255,178,189,95,48,233,190,76,136,228,15,0,64,101,72,254,0,230,37,187,
+    123,95,120,185,52,75,127,160,157,70,26,106,178,89,254,253,51,236,167,212,72,196,215,36,
+    158,213,30,16,165,89,251,221,41,105,210,246,178,214,238,177,133,254,103,76,219,54,87,224,
+    87,221,199,151,218,236,51,39,82,183,37,239,247,254,176,11,181,6,250,191,51,180,222,127,
+    138,125,89,234,139,35,145,252,1,0,168,12,201,31,192,172,104,221,122,29,251,215,217,254,
+    69,58,197,61,27,40,111,123,223,94,69,53,188,110,76,94,54,146,150,228,47,223,104,48,
+    59,7,246,15,107,119,241,242,0,189,167,192,92,105,218,118,3,105,249,3,239,126,209,57,
+    231,220,141,79,248,231,63,254,236,19,206,185,46,101,63,227,250,239,180,55,180,253,197,251,
+    180,120,31,204,42,246,101,74,36,127,0,0,42,67,242,7,48,79,133,220,211,230,3,218,
+    253,159,203,218,107,210,239,187,116,156,60,75,215,163,118,114,164,194,186,251,174,196,95,186,
+    79,37,178,64,161,167,50,96,90,50,112,217,105,18,115,97,169,215,102,190,91,186,30,98,
+    159,123,230,89,159,178,199,142,179,47,147,202,231,180,47,103,65,242,7,0,160,50,36,127,
+    0,51,83,186,11,159,89,188,192,191,11,217,109,239,247,187,241,242,177,149,2,207,78,19,
+    123,35,213,4,179,98,131,133,118,180,211,35,246,86,132,99,105,227,169,73,123,53,206,101,
+    129,255,10,116,227,222,233,157,245,134,210,183,166,238,241,219,185,55,246,101,10,36,127,0,
+    0,42,67,242,7,48,51,233,90,248,44,168,103,133,236,251,190,157,183,163,149,252,154,52,
+    124,103,207,39,13,203,89,194,207,110,231,231,95,29,200,124,217,24,126,220,103,59,86,237,
+    1,24,215,238,50,172,118,255,144,41,106,251,155,60,13,191,107,212,127,158,85,164,232,57,
+    237,203,89,144,252,1,0,168,12,201,31,192,172,180,50,142,93,186,51,93,91,202,230,242,
+    178,78,168,111,164,7,64,231,4,172,100,120,60,219,70,161,182,255,200,141,199,49,253,120,
+    108,54,191,65,23,248,47,185,159,35,76,153,232,79,107,78,41,122,78,251,178,12,46,254,
+    0,128,123,146,45,5,28,235,94,189,80,175,2,23,127,0,179,212,85,250,147,187,252,201,
+    56,119,254,69,121,46,83,228,99,58,214,65,254,101,247,79,154,31,243,225,70,63,93,152,
+    237,63,180,75,177,215,35,174,30,232,222,73,159,47,177,143,168,10,23,127,0,192,61,65,
+    147,254,71,62,212,191,124,206,110,182,163,183,6,126,239,211,239,57,151,219,229,222,11,184,
+    248,3,152,169,116,202,122,86,4,111,228,61,239,165,140,254,137,123,3,164,13,232,112,249,
+    112,250,30,175,149,157,105,228,46,124,131,87,34,93,224,32,237,181,121,177,255,229,218,71,
+    117,184,248,3,0,102,205,18,191,38,253,227,207,127,36,121,110,183,207,213,196,111,236,117,
+    122,0,184,248,3,152,25,93,171,158,13,147,23,43,255,165,175,199,175,183,150,178,23,167,
+    237,38,235,90,88,129,194,216,188,237,115,156,189,95,152,4,144,215,62,176,85,3,82,203,
+    95,187,49,236,243,213,94,234,160,184,248,3,0,102,73,19,191,38,253,146,207,221,252,180,
+    115,206,185,183,92,127,91,242,250,123,159,126,143,115,142,30,0,231,184,248,3,152,153,236,
+    174,125,77,255,29,234,74,255,223,90,135,191,187,89,253,253,3,231,249,157,239,210,241,242,
+    41,116,53,248,157,252,35,125,63,206,222,47,30,156,236,155,46,235,143,53,254,251,203,21,
+    78,113,76,99,43,252,97,222,184,248,3,0,102,197,18,255,135,127,250,150,115,110,124,226,
+    199,120,92,252,1,204,139,196,94,189,103,125,105,172,63,35,61,8,93,194,79,231,0,140,
+    77,197,103,171,249,47,131,251,35,75,20,228,205,244,119,123,100,181,15,164,172,97,105,254,
+    196,50,110,222,120,161,113,206,185,235,143,63,69,217,128,251,0,23,127,0,192,125,193,122,
+    10,222,247,253,63,233,156,115,238,103,126,237,103,157,115,221,216,127,105,21,64,141,184,248,
+    3,152,167,56,214,111,73,61,60,47,84,197,51,217,68,249,82,234,109,229,14,120,58,215,
+    96,160,221,165,100,53,247,211,109,103,187,86,106,70,43,248,73,187,229,5,11,211,205,103,
+    179,30,0,220,219,184,248,3,0,102,201,214,237,151,88,210,47,189,110,61,0,67,108,142,
+    65,77,179,254,185,248,3,152,149,70,255,85,168,213,95,156,16,159,126,44,155,35,208,173,
+    137,15,213,246,150,45,172,127,10,217,29,9,227,161,53,233,235,246,185,66,244,239,122,65,
+    178,111,164,79,179,85,3,12,211,35,197,197,31,0,48,11,89,37,191,183,188,191,255,131,
+    159,251,5,231,92,87,195,95,123,0,172,199,224,87,221,199,151,218,254,51,21,245,0,112,
+    241,7,48,75,86,189,46,27,231,86,133,59,216,117,181,252,237,245,180,194,159,142,183,119,
+    205,172,242,255,239,235,32,127,56,70,187,115,161,86,55,148,125,235,142,173,255,238,128,197,
+    93,39,248,67,112,241,7,0,204,75,41,241,7,150,248,63,240,238,23,157,115,206,221,248,
+    132,127,253,199,159,125,194,57,215,37,254,103,92,255,93,255,74,106,72,252,134,139,63,128,
+    89,105,99,226,183,52,44,227,220,122,155,62,145,189,172,149,2,139,227,233,113,7,150,218,
+    223,81,36,240,199,99,42,212,32,24,61,159,65,86,42,52,210,96,171,221,32,64,192,197,
+    31,0,48,111,50,198,111,137,95,217,235,207,60,235,19,255,216,49,255,101,123,8,238,7,
+    92,252,1,204,139,22,182,215,155,216,15,204,206,31,94,51,111,179,252,37,37,23,218,155,
+    68,190,228,32,253,71,97,69,67,105,151,242,93,180,185,2,233,193,48,217,31,37,92,252,
+    1,0,179,96,99,238,118,183,189,211,210,30,128,177,219,173,9,23,127,0,243,146,221,144,
+    174,80,217,47,206,13,88,216,76,118,115,191,56,203,95,83,242,4,245,239,75,154,56,150,
+    47,43,24,180,230,255,216,234,130,82,48,64,87,7,100,223,43,222,38,16,181,226,226,15,
+    0,152,149,225,36,254,174,81,127,162,213,152,232,199,226,226,15,96,166,178,169,240,254,255,
+    198,123,218,247,87,232,211,37,239,109,105,82,64,233,242,177,194,203,69,27,123,0,22,39,
+    118,221,135,82,213,194,174,90,97,120,46,167,172,107,134,65,127,164,184,248,3,0,238,41,
+    36,250,179,227,226,15,96,86,74,117,238,91,151,142,241,107,157,124,149,141,171,107,203,18,
+    143,187,9,249,211,95,87,90,253,87,97,197,194,232,249,11,89,103,70,122,231,195,236,156,
+    16,252,33,214,46,122,7,0,0,192,249,34,249,3,152,151,108,16,63,29,219,31,94,243,
+    110,175,203,184,186,180,91,94,3,191,194,152,220,166,9,189,88,233,79,100,65,190,84,185,
+    79,206,85,155,15,254,247,182,75,199,64,125,72,254,0,0,84,134,228,15,96,102,164,134,
+    255,216,181,239,89,51,253,227,235,93,179,109,250,57,169,147,63,233,208,191,84,248,107,164,
+    219,97,244,50,124,157,167,32,237,55,50,159,97,168,89,18,127,189,72,254,0,0,84,134,
+    228,15,96,86,90,9,228,58,86,175,227,221,197,155,240,181,114,135,60,237,1,176,247,91,
+    137,209,35,83,243,50,26,29,123,143,99,255,233,190,21,15,69,107,19,116,101,10,211,118,
+    93,127,187,177,70,194,50,59,141,251,26,201,31,0,128,202,144,252,1,204,147,166,89,153,
+    10,16,135,234,11,107,218,243,176,108,169,88,210,177,174,46,176,207,79,56,32,158,85,35,
+    212,117,250,114,108,74,167,63,88,149,67,173,240,151,221,209,144,219,250,161,128,228,15,0,
+    64,101,72,254,0,102,165,187,187,94,168,86,215,46,78,183,121,3,201,195,137,47,134,118,
+    116,0,93,230,6,172,54,35,167,221,18,89,48,31,216,184,28,202,137,90,255,253,123,175,
+    157,26,67,199,198,186,255,122,144,252,1,0,168,12,201,31,192,188,196,84,219,127,55,190,
+    101,203,214,55,210,21,208,22,230,18,164,175,174,134,86,27,140,43,27,180,246,64,246,69,
+    121,46,171,7,26,45,233,119,202,232,78,226,175,7,201,31,0,128,202,144,252,1,204,74,
+    158,196,117,237,122,154,228,135,122,2,90,173,174,23,199,248,165,126,64,225,251,83,136,43,
+    19,36,153,103,119,48,28,42,194,175,237,197,239,167,199,164,171,6,88,223,15,69,242,7,
+    0,160,50,36,127,0,243,146,165,218,52,205,106,61,251,98,85,60,151,182,147,13,139,75,
+    131,141,198,240,73,165,251,170,133,250,242,74,125,125,223,206,219,113,146,248,117,200,191,80,
+    188,16,32,249,3,0,80,27,146,63,128,153,210,233,253,33,229,218,76,121,173,154,231,210,
+    143,235,120,184,54,91,76,248,43,137,199,50,79,33,219,198,226,226,254,217,216,190,30,82,
+    214,149,144,126,15,80,36,127,0,0,42,67,242,7,48,43,217,12,248,24,138,211,241,110,
+    29,46,87,113,174,64,254,141,244,105,118,119,192,21,230,229,82,178,215,238,138,130,188,195,
+    64,103,247,75,53,196,194,170,2,128,228,15,0,64,101,72,254,0,230,37,27,196,79,199,
+    246,53,253,150,194,114,172,15,160,211,253,245,123,89,28,158,62,31,183,133,94,134,46,161,
+    143,236,109,200,11,3,164,255,136,119,46,212,246,151,216,89,84,129,228,15,0,64,101,72,
+    254,0,102,70,166,196,143,44,119,159,55,211,63,131,62,171,163,47,93,10,77,150,170,39,
+    208,191,112,225,68,34,31,25,205,165,86,65,188,63,129,126,127,160,6,2,64,242,7,0,
+    160,50,36,127,0,179,210,74,32,215,177,250,86,146,121,113,60,59,214,240,183,231,233,219,
+    177,198,127,161,12,222,180,115,254,229,46,126,182,41,93,247,191,120,185,127,207,59,122,50,
+    92,242,188,201,186,28,0,143,228,15,0,64,101,72,254,0,230,73,199,181,37,37,199,161,
+    250,194,109,253,242,58,250,54,62,46,119,9,212,213,5,246,249,41,7,204,27,237,78,72,
+    119,90,103,251,151,131,122,161,90,97,41,225,15,204,155,64,189,72,254,0,0,84,134,228,
+    15,96,86,186,241,111,27,39,151,170,117,131,13,36,15,217,98,247,166,149,62,1,153,27,
+    176,202,144,220,5,243,108,2,194,168,173,199,170,133,165,161,255,108,214,127,104,126,37,243,
+    24,112,47,35,249,3,0,80,25,146,63,128,121,137,99,246,253,227,219,133,33,254,162,70,
+    186,2,178,53,242,141,126,126,5,10,247,39,208,192,158,29,179,232,238,103,80,186,75,160,
+    28,171,235,127,4,72,254,0,0,84,134,228,15,96,86,218,210,236,251,66,154,45,102,229,
+    88,7,160,48,14,46,207,11,79,39,34,243,11,226,60,131,240,216,44,158,119,208,61,215,
+    85,2,246,126,250,125,173,35,0,40,146,63,0,0,149,33,249,3,152,23,157,8,239,154,
+    194,99,239,199,243,137,239,186,214,189,52,94,190,202,148,156,77,95,104,11,143,253,187,82,
+    90,185,144,61,111,211,167,12,242,163,132,228,15,0,64,101,72,254,0,102,38,45,225,103,
+    115,0,98,58,110,71,166,100,137,189,93,224,239,159,113,191,202,123,222,55,186,164,32,190,
+    110,251,148,62,22,119,37,174,219,239,95,162,32,165,253,245,109,32,34,249,3,0,80,25,
+    146,63,128,121,137,9,189,127,6,187,147,4,95,210,221,20,176,48,30,46,55,1,200,102,
+    202,47,179,207,67,74,251,92,40,189,63,180,237,86,247,93,142,73,23,76,48,244,15,69,
+    242,7,0,160,50,36,127,0,179,84,90,219,222,149,228,27,170,134,215,95,193,175,116,103,
+    189,174,46,128,110,255,236,98,111,131,173,231,143,119,24,236,221,147,158,6,100,159,164,189,
+    86,151,44,52,233,188,6,198,252,161,72,254,0,0,84,134,228,15,96,94,178,232,173,179,
+    246,211,231,229,132,222,63,190,94,28,104,215,181,243,171,80,24,155,143,135,44,189,15,145,
+    220,149,47,62,198,59,30,166,119,62,204,187,59,194,231,233,2,64,64,242,7,0,160,50,
+    36,127,0,51,99,227,226,254,153,174,195,111,101,32,187,28,102,75,131,253,253,197,253,219,
+    82,143,192,4,226,177,116,183,229,235,125,191,91,199,95,106,40,29,203,207,167,67,164,181,
+    17,244,144,153,245,15,67,242,7,0,160,50,36,127,0,243,162,1,60,75,195,35,7,174,
+    211,137,239,177,161,38,155,229,159,214,19,88,13,233,182,40,108,108,120,214,127,127,119,71,
+    215,172,116,49,200,92,2,162,63,12,201,31,0,128,202,144,252,1,204,74,76,234,146,248,
+    187,165,237,35,227,171,46,114,207,42,251,181,189,111,175,100,70,188,206,190,183,251,19,148,
+    22,30,148,154,209,10,126,210,110,105,46,0,43,253,161,72,254,0,0,84,134,228,15,96,
+    158,10,97,117,236,189,234,179,183,173,26,158,196,99,77,252,171,168,138,151,117,66,20,238,
+    95,208,221,143,160,191,157,88,181,48,255,70,250,52,155,39,193,96,63,82,36,127,0,0,
+    42,67,242,7,48,51,165,187,240,153,197,11,252,187,44,220,246,126,191,43,131,63,182,82,
+    224,148,250,151,50,180,173,245,0,164,115,1,210,79,229,199,166,205,22,187,43,8,254,16,
+    36,127,0,0,42,67,242,7,48,51,233,56,120,22,212,155,180,103,160,255,219,121,59,90,
+    201,79,139,224,21,138,226,77,35,155,79,144,206,63,232,74,24,44,174,57,160,251,22,231,
+    14,88,59,210,160,86,67,4,12,201,31,0,128,202,144,252,1,204,74,92,251,46,81,60,
+    95,182,95,200,230,242,178,174,165,111,164,7,64,231,4,172,98,120,92,103,239,199,245,250,
+    250,129,66,167,70,118,151,2,41,70,16,107,250,203,39,135,166,2,160,94,36,127,0,0,
+    42,67,242,7,48,75,90,197,174,145,113,236,172,70,127,252,162,60,151,169,242,109,54,80,
+    126,202,253,147,230,199,124,184,52,75,127,40,233,171,86,186,8,178,251,23,156,67,111,6,
+    238,109,36,127,0,0,42,67,242,7,48,83,233,122,254,172,110,253,64,60,214,202,125,241,
+    107,77,255,20,120,93,91,63,156,190,199,107,101,103,108,204,126,244,100,124,157,11,32,237,
+    181,141,156,148,56,7,96,100,251,168,14,201,31,0,128,202,144,252,1,204,74,86,229,78,
+    135,201,139,149,255,210,215,227,215,219,180,30,126,41,13,55,89,215,194,10,20,198,230,109,
+    159,91,153,215,208,237,92,186,103,93,109,2,91,53,32,171,7,180,27,195,62,79,23,0,
+    2,146,63,0,0,149,33,249,3,152,149,236,174,125,141,174,137,119,233,115,161,195,223,39,
+    202,223,165,237,102,107,237,211,215,167,156,33,31,87,42,232,109,253,228,253,252,110,124,218,
+    144,236,155,222,3,192,222,47,148,43,100,214,63,12,201,31,0,128,202,144,252,1,204,139,
+    86,175,147,152,91,26,235,207,232,189,237,165,253,86,150,17,12,53,123,182,154,255,50,184,
+    63,178,68,65,222,76,127,183,71,86,251,64,202,26,150,230,79,160,94,36,127,0,0,42,
+    67,242,7,48,79,113,172,223,146,122,120,94,168,138,103,178,137,242,165,212,219,166,171,10,
+    154,182,240,185,197,47,143,163,179,239,101,219,217,174,149,154,209,10,126,210,110,121,193,2,
+    211,252,145,34,249,3,0,80,25,146,63,128,89,105,244,95,133,90,253,163,239,121,159,149,
+    211,79,123,20,180,14,254,42,66,114,118,71,194,120,104,77,250,186,125,174,16,253,187,94,
+    144,236,27,233,211,108,213,0,131,253,72,145,252,1,0,168,12,201,31,192,44,89,245,186,
+    108,156,91,21,238,96,215,213,242,183,215,211,10,127,58,222,222,53,179,202,241,113,29,228,
+    15,199,104,119,46,212,234,134,178,111,221,177,245,223,29,176,184,235,4,127,8,146,63,0,
+    0,149,33,249,3,152,149,54,38,126,75,195,50,206,173,183,233,19,217,203,90,41,176,56,
+    158,30,119,96,169,253,29,69,2,127,60,166,66,13,130,209,243,25,100,165,66,35,13,182,
+    218,13,2,4,36,127,0,0,42,67,242,7,48,47,90,216,94,111,98,63,48,59,127,120,
+    205,188,205,242,151,148,92,104,111,18,249,146,131,244,31,133,21,13,165,93,202,119,209,230,
+    10,164,7,195,100,127,148,144,252,1,0,168,12,201,31,192,188,100,55,164,43,84,246,139,
+    115,3,22,54,147,221,220,47,206,242,215,148,188,194,250,247,77,28,203,151,21,12,90,243,
+    127,108,117,65,41,24,160,171,3,178,239,21,111,19,136,90,145,252,1,0,168,12,201,31,
+    192,76,101,83,225,253,255,141,247,180,239,175,208,167,75,222,219,210,164,128,82,194,95,97,
+    72,110,99,15,192,226,196,174,251,80,170,90,216,85,43,12,207,229,148,117,205,48,232,143,
+    20,201,31,0,128,202,144,252,1,204,74,169,206,125,235,210,49,126,173,147,175,178,113,117,
+    109,89,226,113,55,33,127,250,232,223,234,191,10,43,22,70,207,95,200,58,51,210,59,31,
+    102,231,132,224,15,65,242,7,0,160,50,36,127,0,243,146,13,226,167,99,251,195,107,222,
+    237,117,25,87,151,118,203,107,224,87,24,147,219,52,161,23,43,253,137,44,200,151,42,247,
+    201,185,106,243,193,255,222,118,233,24,168,15,201,31,0,128,202,144,252,1,204,140,212,240,
+    31,187,246,61,107,166,127,124,189,107,182,77,63,39,117,242,39,29,250,151,10,127,141,116,
+    59,140,94,134,175,243,20,164,253,70,230,51,12,53,75,226,175,23,201,31,0,128,202,144,
+    252,1,204,74,43,129,92,199,234,117,188,187,120,19,190,86,238,144,167,61,0,246,126,43,
+    49,122,100,106,94,70,163,99,239,113,236,63,221,183,226,161,104,109,130,174,76,97,218,174,
+    235,111,55,214,72,88,102,167,113,95,35,249,3,0,80,25,146,63,128,121,210,52,43,83,
+    1,226,80,125,97,77,123,30,150,45,21,75,58,214,213,5,246,249,9,7,196,179,106,132,
+    186,78,95,142,77,233,244,7,171,114,168,21,254,178,59,26,114,91,63,20,144,252,1,0,
+    168,12,201,31,192,172,116,119,215,11,213,234,218,197,233,54,111,32,121,56,241,197,208,142,
+    14,160,203,220,128,213,102,228,180,91,34,11,230,3,27,151,67,57,81,235,191,127,239,181,
+    83,99,232,216,88,247,95,15,146,63,0,0,149,33,249,3,152,151,152,106,251,239,198,183,
+    108,217,250,70,186,2,218,194,92,130,244,213,213,208,106,131,113,101,131,214,30,200,190,40,
+    207,101,245,64,163,37,253,78,25,221,73,252,245,32,249,3,0,80,25,146,63,128,121,201,
+    146,120,58,59,191,88,215,190,32,214,209,143,61,7,97,140,63,187,135,192,146,251,185,132,
+    184,109,73,230,217,29,12,135,138,240,107,123,241,251,54,111,161,191,98,32,235,251,161,72,
+    254,0,0,84,134,228,15,96,94,178,177,253,254,5,253,67,235,240,179,42,119,50,174,174,
+    107,239,179,158,133,73,181,39,254,111,94,168,47,175,212,215,247,237,188,29,39,137,95,135,
+    252,11,197,11,1,146,63,0,0,181,33,249,3,152,21,41,71,31,43,243,149,102,251,151,
+    210,108,86,78,95,198,221,187,196,159,214,17,88,77,60,78,147,125,94,201,111,113,113,255,
+    108,108,95,23,66,100,93,9,233,247,0,69,242,7,0,160,50,36,127,0,243,34,83,224,
+    187,68,94,42,139,215,79,123,16,26,249,94,43,115,9,242,59,225,173,64,41,217,107,55,
+    69,65,222,97,160,179,251,165,26,98,97,85,1,64,242,7,0,160,50,36,127,0,179,162,
+    19,224,181,144,189,166,89,149,165,221,172,148,127,127,229,192,184,253,210,173,245,206,160,149,
+    100,159,239,227,200,109,230,133,1,210,127,72,47,70,118,14,128,128,228,15,0,64,101,72,
+    254,0,102,165,75,234,233,154,246,24,158,7,166,229,151,130,123,55,166,159,142,139,231,195,
+    237,43,136,201,217,252,133,100,87,198,111,83,74,248,199,251,19,232,247,229,220,1,138,228,
+    15,0,64,101,72,254,0,102,165,145,188,218,200,56,118,54,126,61,16,111,179,97,113,251,
+    154,182,43,143,211,142,252,203,93,252,108,27,186,18,97,241,114,255,158,119,178,242,133,201,
+    243,38,235,114,0,60,146,63,0,0,149,33,249,3,152,149,86,226,112,59,52,189,127,241,
+    228,253,19,137,63,180,167,101,244,11,117,5,38,29,47,111,74,27,13,219,26,93,153,175,
+    116,176,165,242,135,218,35,0,120,36,127,0,0,42,67,242,7,48,79,50,184,31,11,252,
+    101,149,250,82,26,126,99,153,128,86,199,199,117,110,193,105,119,116,188,226,138,130,70,103,
+    28,244,139,247,33,40,206,123,208,89,255,161,249,197,55,13,68,133,72,254,0,0,84,134,
+    228,15,96,214,226,108,255,108,66,187,205,104,31,248,126,225,177,20,245,87,82,13,79,238,
+    32,152,229,252,248,254,226,163,209,149,10,249,125,11,210,215,75,43,25,0,146,63,0,0,
+    149,33,249,3,152,149,110,108,191,127,6,252,80,189,250,44,237,150,190,216,22,198,207,117,
+    131,19,210,109,217,10,132,172,19,162,24,209,251,35,125,171,221,34,217,252,8,32,69,242,
+    7,0,160,50,36,127,0,243,82,152,174,47,55,247,27,92,246,31,31,117,60,61,86,246,
+    75,43,252,197,239,55,233,247,166,165,19,23,236,216,210,138,124,122,147,191,188,250,96,214,
+    133,144,62,42,6,251,33,72,254,0,0,84,134,228,15,96,94,100,93,126,171,3,215,131,
+    41,182,233,125,218,20,238,116,39,101,3,86,19,146,37,240,199,106,131,217,221,254,22,175,
+    96,208,234,131,173,244,82,52,210,160,150,54,0,12,201,31,0,128,202,144,252,1,204,74,
+    76,179,154,130,181,3,160,88,132,127,113,118,215,116,92,74,197,83,246,0,232,252,129,88,
+    169,79,63,80,232,125,200,75,246,203,189,1,26,235,213,88,188,66,2,48,36,127,0,0,
+    42,67,242,7,48,79,82,21,47,171,237,95,24,207,112,99,40,237,0,0,31,28,73,68,
+    65,84,206,202,222,107,234,110,210,1,241,161,148,61,137,88,120,175,127,150,254,178,251,208,
+    74,23,65,215,179,208,95,187,128,201,254,80,36,127,0,0,42,67,242,7,48,47,146,248,
+    45,7,235,24,127,113,70,124,97,225,126,156,75,208,189,145,110,47,62,29,119,207,128,101,
+    116,179,238,173,162,95,90,99,96,112,91,58,23,64,218,235,86,68,164,211,255,153,236,143,
+    18,146,63,0,0,149,33,249,3,152,153,116,38,124,150,90,99,66,47,140,100,235,50,255,
+    98,13,255,82,23,66,255,92,128,73,196,121,6,118,140,50,107,63,251,71,80,232,181,104,
+    180,236,97,220,76,122,207,0,198,252,161,72,254,0,0,84,134,228,15,96,86,98,245,59,
+    153,149,111,180,74,158,202,82,110,236,66,232,111,79,239,1,176,218,181,241,212,246,199,60,
+    144,252,1,0,168,12,201,31,192,188,72,45,254,236,166,244,163,215,176,103,43,254,147,246,
+    26,93,239,191,202,241,113,106,251,99,102,72,254,0,0,84,134,228,15,96,94,178,202,123,
+    139,111,183,167,179,248,117,70,124,43,3,230,109,156,33,223,31,139,139,183,12,56,3,106,
+    251,99,110,72,254,0,0,84,134,228,15,96,86,218,108,76,62,125,95,83,172,206,140,207,
+    104,252,149,170,120,133,153,1,211,162,182,63,102,134,228,15,0,64,101,72,254,0,102,169,
+    152,134,181,140,253,64,59,221,24,126,58,154,31,43,255,149,218,153,112,160,156,218,254,152,
+    27,146,63,0,0,149,33,249,3,152,149,152,200,195,243,86,163,185,150,187,83,197,1,110,
+    105,119,232,123,171,24,40,47,140,205,199,5,8,253,69,8,179,94,142,174,42,161,29,147,
+    172,30,40,76,132,208,146,9,168,23,201,31,0,128,202,144,252,1,204,140,173,207,239,175,
+    233,63,68,43,245,197,162,119,67,61,6,43,20,23,46,116,221,25,189,239,75,17,194,158,
+    134,164,6,130,22,63,180,247,245,70,5,139,75,37,160,66,36,127,0,0,42,67,242,7,
+    48,111,114,207,250,161,0,159,85,181,203,203,227,133,135,180,139,32,27,102,159,116,124,92,
+    6,247,11,109,15,207,250,239,95,154,208,53,43,93,12,50,151,128,232,15,67,242,7,0,
+    160,50,36,127,0,179,210,106,60,45,68,240,209,193,60,155,197,159,166,240,24,166,11,105,
+    122,18,58,251,126,224,78,130,229,133,12,82,193,79,218,45,205,5,96,165,63,20,201,31,
+    0,128,202,144,252,1,204,138,141,91,119,107,214,165,18,159,206,230,31,106,79,235,4,72,
+    196,215,181,246,110,241,176,252,169,104,165,189,110,232,62,61,214,248,185,210,29,12,109,37,
+    68,254,141,244,105,182,106,128,193,126,164,72,254,0,0,84,134,228,15,96,86,178,68,223,
+    164,105,183,213,158,129,194,247,99,24,182,241,245,194,116,254,108,2,125,97,28,126,26,218,
+    184,237,155,29,83,58,23,32,253,212,201,156,95,184,213,225,224,73,1,60,146,63,0,0,
+    149,33,249,3,152,151,210,26,120,27,251,31,154,134,175,75,234,75,115,5,98,123,139,183,
+    59,9,217,118,28,187,215,249,5,205,226,94,141,236,246,6,233,77,252,186,115,163,247,8,
+    96,178,63,4,201,31,0,128,202,144,252,1,204,84,233,22,119,225,229,244,83,221,183,10,
+    55,1,116,46,29,87,239,230,18,20,230,4,76,73,27,215,9,6,122,16,165,143,23,158,
+    199,185,3,210,189,193,100,127,148,144,252,1,0,168,12,201,31,192,172,20,67,177,222,25,
+    111,108,123,113,14,128,222,28,32,237,1,104,138,125,9,103,215,200,54,98,165,62,157,160,
+    80,72,232,217,203,82,48,160,116,78,116,197,4,96,72,254,0,0,84,134,228,15,96,86,
+    90,153,213,95,170,228,151,173,117,215,118,92,250,253,70,214,245,103,105,184,201,103,9,76,
+    173,141,61,0,139,19,187,118,62,100,179,252,227,152,126,155,188,223,200,88,127,215,12,131,
+    254,72,145,252,1,0,168,12,201,31,192,172,116,9,189,127,208,191,171,123,191,120,28,187,
+    145,73,3,173,44,122,143,117,3,156,189,63,174,221,211,104,245,95,121,55,70,239,203,250,
+    253,82,167,69,87,253,176,191,66,32,193,31,138,228,15,0,64,101,72,254,0,102,37,75,
+    185,50,208,221,198,148,188,120,118,126,246,110,97,253,127,86,101,79,198,209,39,213,166,9,
+    189,88,233,79,100,65,126,160,200,65,92,225,48,80,243,127,245,179,28,48,87,36,127,0,
+    0,42,67,242,7,48,43,154,244,99,154,149,228,222,20,115,107,26,115,99,74,214,245,254,
+    89,29,125,153,3,176,244,158,47,32,21,254,186,49,251,86,158,15,144,36,223,221,28,80,
+    234,6,20,10,7,102,187,53,114,179,184,255,144,252,1,0,168,12,201,31,192,172,148,214,
+    225,143,175,189,47,99,246,217,162,129,244,158,1,113,14,65,172,245,63,189,70,199,222,91,
+    217,214,226,2,127,89,239,197,137,157,78,219,117,253,237,118,247,53,0,60,146,63,0,0,
+    149,33,249,3,152,149,79,253,233,231,46,122,23,38,103,235,240,155,194,44,253,24,224,75,
+    179,242,101,140,191,105,210,49,254,210,60,133,86,230,22,0,134,228,15,0,64,101,72,254,
+    0,46,212,15,188,243,251,146,88,218,62,251,141,23,181,43,103,98,199,241,209,231,62,182,
+    96,104,61,29,220,207,130,249,64,64,215,106,132,221,194,136,254,236,223,72,123,67,249,159,
+    117,255,245,32,249,3,0,80,25,146,63,128,89,104,222,253,23,23,189,11,103,50,166,199,
+    162,91,201,16,86,26,164,37,7,78,84,45,212,47,202,115,89,61,208,104,73,191,83,70,
+    119,18,127,61,72,254,0,0,84,134,228,15,96,22,126,234,159,255,160,115,206,185,173,205,
+    75,206,57,231,54,195,227,165,141,117,231,156,115,119,15,15,157,115,206,237,31,248,199,131,
+    131,187,206,57,231,118,247,246,195,227,129,115,206,185,59,225,249,157,221,189,228,113,39,62,
+    247,239,239,220,241,207,119,247,211,239,237,135,118,246,14,252,227,193,93,191,157,187,119,143,
+    78,125,108,22,204,27,73,230,58,198,222,12,21,225,215,246,226,247,109,29,127,127,197,64,
+    214,247,67,145,252,1,0,168,12,201,31,192,44,88,205,253,110,220,89,167,170,247,215,226,
+    239,185,231,93,111,251,89,250,149,197,243,58,51,126,193,55,79,33,61,54,45,212,151,87,
+    234,235,251,118,222,142,147,196,175,67,254,250,156,30,0,24,146,63,0,0,149,33,249,163,
+    74,221,29,226,210,59,198,149,66,100,183,174,58,157,165,141,233,100,119,237,107,245,125,205,
+    205,77,255,7,11,249,182,45,253,199,61,151,91,223,165,7,151,87,242,91,92,220,63,27,
+    219,215,10,129,89,87,66,250,61,64,145,252,1,0,168,12,201,31,85,176,164,180,102,247,
+    112,95,243,143,91,225,207,223,205,240,254,186,124,207,230,119,31,132,100,181,127,28,238,154,
+    118,236,95,56,110,233,9,152,74,86,151,190,244,188,105,228,149,197,117,233,116,38,124,71,
+    7,196,101,60,125,21,255,77,75,201,190,212,243,164,159,203,218,211,217,253,82,235,191,176,
+    170,0,32,249,3,0,80,153,209,201,159,49,82,140,49,151,223,73,41,233,63,16,162,253,
+    213,117,255,252,71,223,122,197,57,231,220,122,248,51,120,93,6,83,143,194,14,29,29,251,
+    231,31,252,211,59,206,57,231,118,66,151,192,237,35,122,2,166,82,158,109,31,72,36,111,
+    53,162,23,38,204,55,218,67,160,67,253,177,58,94,250,186,166,233,179,104,229,127,7,89,
+    34,111,7,34,191,41,117,122,200,100,130,172,79,132,223,35,4,201,31,0,128,202,20,147,
+    63,99,164,24,99,170,223,201,129,253,78,194,15,227,56,36,237,101,123,4,108,63,214,194,
+    126,92,9,191,240,215,132,164,255,254,111,246,73,255,82,120,255,210,154,125,47,60,74,110,
+    60,182,199,176,253,31,255,214,171,206,57,231,238,134,23,126,225,79,124,79,192,171,225,128,
+    238,28,54,97,255,211,223,59,134,181,150,90,75,189,69,186,38,62,147,166,222,216,110,255,
+    199,242,237,23,171,235,77,48,103,62,235,109,8,47,47,59,193,64,74,248,119,199,172,53,
+    17,180,30,0,144,34,249,3,0,80,153,152,252,25,35,157,198,92,198,188,87,101,85,191,
+    147,255,28,126,39,123,225,249,157,240,56,182,231,200,246,103,61,108,255,161,240,203,254,177,
+    111,241,73,125,43,188,190,25,247,71,142,163,48,94,108,105,208,182,183,17,198,135,55,195,
+    113,91,79,192,222,145,127,253,3,159,217,113,206,57,247,245,195,116,191,117,127,239,247,223,
+    201,233,200,90,247,82,100,215,65,249,236,243,233,23,155,66,114,207,231,254,91,149,60,221,
+    143,41,78,118,250,223,77,15,65,23,48,148,183,88,234,215,144,115,161,43,28,88,240,15,
+    65,242,7,0,160,50,27,140,145,158,205,189,50,55,226,180,73,83,147,197,202,126,39,111,
+    243,191,147,195,240,194,221,161,158,163,54,141,72,182,95,215,54,252,227,191,252,86,191,63,
+    219,235,186,63,139,147,190,202,19,90,56,15,97,187,235,33,37,90,207,134,253,222,255,109,
+    232,1,216,145,30,128,230,62,253,157,140,237,145,208,246,147,247,244,31,217,54,101,86,190,
+    173,113,47,183,148,124,79,199,197,227,167,98,93,253,112,204,133,113,245,51,201,126,112,105,
+    155,58,219,191,188,69,61,54,249,71,54,79,66,123,4,0,143,228,15,0,64,101,54,46,
+    135,164,100,9,238,95,124,139,79,76,171,30,35,221,15,99,164,63,255,199,62,33,125,53,
+    36,36,139,58,115,237,1,184,87,230,70,76,213,35,113,24,146,102,248,153,172,236,119,98,
+    135,117,28,218,57,26,232,57,218,59,74,247,247,170,236,215,229,184,95,203,37,253,33,165,
+    158,128,205,112,4,71,113,206,65,186,165,253,240,223,243,242,125,250,59,41,245,72,196,64,
+    42,61,140,27,61,177,227,229,175,221,118,206,57,119,101,123,211,57,231,220,246,150,127,220,
+    10,143,155,151,124,119,211,213,43,219,254,249,166,127,190,105,159,223,62,112,206,57,247,250,
+    205,135,253,62,237,251,231,123,225,241,206,158,61,238,251,199,221,189,228,113,39,62,223,239,
+    125,220,221,247,143,123,225,251,123,7,119,253,57,56,56,244,143,249,33,101,186,255,186,58,
+    9,164,56,209,33,97,189,23,89,77,132,210,170,129,120,254,117,251,168,29,201,31,0,128,
+    202,108,60,22,254,180,255,145,48,102,187,157,141,217,174,102,140,116,35,188,254,19,33,217,
+    253,251,207,248,68,115,203,26,154,89,15,192,220,231,70,172,170,71,226,191,252,153,223,15,
+    251,212,170,126,39,38,206,218,31,232,57,58,12,251,249,161,176,127,255,228,173,87,195,231,
+    92,242,249,85,39,30,107,215,246,123,43,236,248,251,67,15,196,47,254,177,223,191,163,240,
+    123,249,145,183,222,159,191,19,237,145,216,177,30,137,240,121,235,8,121,48,180,255,207,194,
+    239,232,127,156,104,243,131,239,251,83,55,47,214,223,113,69,30,79,65,231,70,164,47,159,
+    120,127,241,47,213,222,109,229,135,221,253,231,73,95,215,237,204,227,255,155,98,14,72,254,
+    0,0,84,166,249,252,222,159,183,206,117,127,225,111,44,153,224,150,165,75,103,15,66,66,
+    217,61,244,143,255,46,204,146,126,217,15,167,185,163,80,234,237,162,58,0,86,183,126,60,
+    60,134,127,88,66,59,138,231,197,63,230,115,35,252,235,71,71,233,9,153,174,71,194,18,
+    163,75,30,237,83,231,245,59,49,165,243,116,44,175,219,241,172,159,211,126,41,221,207,67,
+    73,198,246,254,122,147,62,222,47,191,19,91,157,97,61,18,31,12,61,18,54,55,192,230,
+    14,252,211,176,157,173,208,240,155,183,255,26,195,208,192,5,32,249,3,0,80,153,230,75,
+    119,63,155,68,131,243,74,76,154,104,44,185,236,132,30,128,127,99,235,164,239,90,130,234,
+    143,254,171,90,151,172,137,127,234,245,227,170,148,240,44,81,89,5,185,159,15,137,234,149,
+    187,233,142,79,55,11,63,221,143,146,139,154,61,156,77,114,150,217,204,230,162,226,228,170,
+    207,223,92,127,39,218,35,113,40,61,71,214,238,134,204,33,120,226,210,55,145,252,129,11,
+    64,242,7,0,160,50,205,75,135,159,29,200,40,171,101,27,183,100,191,27,6,9,173,70,
+    250,75,97,33,241,113,24,60,181,207,159,125,93,114,216,190,204,138,142,179,183,215,124,131,
+    15,95,242,207,109,85,130,213,69,88,245,108,242,210,220,8,75,118,191,24,146,157,153,106,
+    22,62,238,45,115,249,157,232,126,100,203,206,165,93,219,206,227,27,36,127,224,34,144,252,
+    1,0,168,204,133,39,127,211,205,26,78,199,254,127,238,211,225,46,105,71,233,231,175,78,
+    182,46,57,108,79,218,127,109,104,255,39,66,205,121,219,142,141,145,94,212,220,8,157,69,
+    110,206,123,22,62,230,229,94,253,157,60,70,242,7,46,4,201,31,0,128,202,108,92,244,
+    14,24,75,32,54,43,216,18,246,195,151,252,227,101,25,196,255,209,137,43,234,125,80,198,
+    70,47,135,246,46,203,172,254,243,78,74,90,184,107,35,252,99,67,39,53,216,199,72,252,
+    85,226,119,2,96,25,36,127,0,0,42,51,155,49,127,211,85,150,75,215,47,31,203,172,
+    225,13,233,41,152,106,93,114,188,63,124,104,64,103,67,175,17,149,128,201,48,230,15,92,
+    12,146,63,0,0,149,153,205,152,191,105,100,204,126,211,198,44,7,214,11,15,197,135,236,
+    243,114,183,193,120,34,6,182,3,0,192,189,142,228,15,0,64,101,230,151,252,237,81,147,
+    246,200,228,221,85,22,75,239,155,93,106,168,213,87,99,207,192,82,155,157,173,51,159,15,
+    123,126,159,156,15,195,121,73,113,62,128,186,144,252,1,0,168,204,236,146,255,105,117,179,
+    249,219,244,49,188,174,247,127,87,122,87,192,245,238,141,147,15,247,12,206,71,63,206,75,
+    138,243,1,212,137,228,15,0,64,101,238,159,228,47,247,15,255,236,87,191,230,156,115,238,
+    208,238,222,23,62,119,99,231,193,222,239,219,250,125,171,27,240,244,83,254,31,150,100,238,
+    181,217,254,156,143,126,156,151,20,231,3,168,19,201,31,0,128,202,156,123,242,111,75,131,
+    135,5,205,64,116,208,49,75,187,155,153,37,151,71,183,214,194,251,254,249,139,59,254,31,
+    223,246,240,171,73,3,77,136,48,159,126,249,181,201,231,87,61,104,201,249,232,199,121,73,
+    113,62,0,76,137,228,15,0,64,101,54,172,182,253,202,214,235,182,246,208,38,207,15,246,
+    246,195,243,116,118,113,219,173,244,119,206,57,183,121,121,51,121,174,179,136,109,172,210,142,
+    227,119,94,104,194,115,63,70,249,252,109,31,101,186,191,114,142,195,247,253,227,139,251,71,
+    206,57,231,158,216,222,8,237,165,53,255,155,54,61,3,103,62,47,156,143,126,156,151,20,
+    231,3,192,10,145,252,1,0,168,204,134,221,207,222,254,34,183,187,215,157,117,189,174,142,
+    81,30,236,22,18,75,120,126,28,182,112,44,223,91,179,133,198,77,154,128,108,143,186,118,
+    92,242,253,119,60,244,74,120,223,63,95,179,239,199,245,200,254,249,83,151,215,194,246,211,
+    230,45,193,196,55,214,236,123,201,230,71,159,23,206,71,63,206,75,138,243,1,224,60,144,
+    252,1,0,168,204,198,111,124,209,255,195,254,10,176,245,186,127,235,169,244,185,222,199,190,
+    56,134,39,147,146,179,228,34,9,229,88,146,199,115,47,111,75,51,105,242,176,207,199,13,
+    135,231,223,253,100,186,249,38,36,150,27,123,135,206,185,46,169,188,24,158,63,121,217,143,
+    85,190,120,199,71,148,71,183,124,131,135,161,129,223,124,193,63,90,242,185,20,14,120,233,
+    243,194,249,72,118,79,15,195,84,127,94,42,59,31,172,255,7,46,22,201,31,0,128,202,
+    108,92,219,254,170,115,206,185,39,183,253,168,220,103,190,230,215,235,30,133,49,187,99,73,
+    46,54,39,96,173,77,95,239,2,133,127,163,148,92,226,144,160,37,23,151,38,7,123,124,
+    187,173,39,118,233,156,4,27,74,124,113,207,255,235,198,157,135,78,110,38,90,147,253,46,
+    38,80,121,193,146,212,35,87,124,165,179,167,194,108,230,63,254,218,107,156,115,195,231,101,
+    93,19,86,229,231,131,223,137,110,167,238,223,73,43,237,2,184,24,36,127,0,0,42,179,
+    113,99,199,39,253,151,238,248,63,197,55,194,88,221,239,252,85,250,193,117,75,114,33,81,
+    124,79,24,195,139,127,192,203,88,226,96,114,9,143,54,59,56,206,58,142,159,11,99,143,
+    251,126,172,241,137,208,51,161,223,63,118,214,126,58,139,217,188,126,59,253,251,230,245,151,
+    215,122,223,183,100,98,45,188,180,243,58,231,156,115,95,217,9,231,101,109,220,121,121,218,
+    198,54,195,251,93,176,171,243,124,240,59,241,248,157,248,79,105,15,16,128,139,65,242,7,
+    0,160,50,27,79,62,144,142,249,235,216,100,247,135,189,127,110,53,188,247,239,28,56,231,
+    156,59,90,115,201,247,46,109,91,101,177,148,38,143,223,15,179,147,143,36,185,88,130,248,
+    212,87,31,72,158,191,116,199,63,59,148,65,195,161,146,231,95,10,99,156,79,134,228,242,
+    165,93,255,252,9,123,30,222,127,116,115,253,100,179,238,137,43,254,188,188,225,178,157,151,
+    54,60,46,62,47,123,187,254,188,108,132,207,109,93,190,212,187,95,181,156,15,126,39,182,
+    123,252,78,78,34,249,3,23,139,228,15,0,64,101,54,214,155,80,195,123,205,255,29,96,
+    127,13,52,86,225,203,165,9,38,86,244,178,10,99,54,155,123,228,6,245,254,225,111,127,
+    248,149,100,123,113,150,114,147,126,222,222,253,226,238,81,120,238,63,112,99,231,225,208,94,
+    155,124,94,71,49,215,10,143,42,30,119,99,251,33,207,199,158,151,108,20,181,95,53,231,
+    131,223,73,242,88,235,239,36,126,158,232,15,92,40,146,63,0,0,149,217,88,139,9,37,
+    172,255,13,99,121,79,133,74,94,150,24,94,111,115,2,36,105,44,59,122,215,125,219,255,
+    235,69,169,36,246,210,222,93,191,61,171,36,22,246,231,49,187,191,120,248,190,38,169,189,
+    59,251,225,249,86,178,189,39,100,214,242,19,161,93,125,223,198,80,187,158,15,111,61,171,
+    120,54,116,94,150,115,255,159,15,126,39,206,241,59,177,243,241,165,221,195,100,63,1,92,
+    12,146,63,0,0,149,217,40,229,144,99,125,33,155,93,124,54,54,230,183,166,99,131,217,
+    58,96,219,226,122,242,122,252,171,37,236,215,95,238,239,250,167,173,159,69,110,99,163,235,
+    103,28,91,212,227,93,213,121,225,124,244,227,188,164,238,245,243,113,186,126,15,0,83,35,
+    249,3,0,80,153,108,224,45,171,236,101,207,75,127,178,159,110,72,183,107,127,203,106,156,
+    249,134,98,37,177,208,238,99,91,126,253,243,31,189,236,107,132,199,245,202,113,187,97,61,
+    115,168,44,182,38,179,157,95,220,247,153,227,13,118,119,178,48,230,248,132,140,141,62,26,
+    247,163,176,159,203,158,151,83,186,111,207,7,191,147,73,221,171,231,227,113,198,250,129,89,
+    32,249,3,0,80,153,236,207,112,171,220,165,149,188,94,63,240,23,190,205,66,238,30,198,
+    69,157,47,237,251,217,208,79,73,37,177,199,67,98,176,247,205,223,176,187,150,53,233,246,
+    94,8,251,249,229,221,7,123,183,163,179,156,151,29,147,29,125,94,52,225,214,126,62,178,
+    102,249,157,156,108,167,182,223,201,13,233,65,0,112,49,72,254,0,0,84,102,163,149,121,
+    192,173,254,13,95,250,203,222,94,111,236,198,229,254,133,59,119,118,146,143,53,177,194,89,
+    19,95,113,238,68,69,177,214,37,175,159,252,230,137,102,227,247,109,118,243,139,97,93,179,
+    37,157,99,231,147,206,209,177,79,22,71,173,127,30,215,57,135,118,94,191,157,38,142,199,
+    236,251,97,67,86,241,236,48,124,191,123,253,56,180,99,55,38,79,103,83,119,44,89,249,
+    253,61,216,221,115,139,88,210,179,253,181,199,67,217,110,183,125,23,142,55,8,231,227,75,
+    123,190,86,252,227,91,118,62,210,253,181,237,44,127,183,182,51,58,227,239,100,201,205,196,
+    239,13,253,78,142,237,119,226,236,119,98,223,15,73,189,120,94,230,254,59,113,233,163,108,
+    239,188,127,39,214,222,113,220,111,255,5,59,111,0,46,6,201,31,0,128,202,108,28,183,
+    33,1,132,4,242,216,182,159,37,108,9,243,177,80,153,44,214,10,151,196,19,255,244,111,
+    210,191,236,205,122,99,179,144,195,125,197,157,37,14,223,206,163,91,27,97,251,254,249,227,
+    97,251,150,92,30,15,239,191,120,71,146,143,59,12,251,225,63,119,183,245,207,247,91,159,
+    244,14,194,243,23,238,248,253,121,83,184,107,218,141,125,255,5,187,91,217,11,119,142,194,
+    126,248,227,223,63,62,8,237,248,202,103,123,97,191,175,109,250,247,15,67,98,180,89,206,
+    199,49,114,234,88,109,255,216,173,157,191,163,99,75,64,254,241,32,156,182,107,155,71,201,
+    254,95,11,251,117,247,216,246,211,239,247,23,111,91,15,199,221,112,252,7,225,113,45,60,
+    134,118,194,241,28,133,246,108,108,248,141,86,113,109,207,127,174,116,183,182,146,210,172,246,
+    227,248,59,145,132,183,228,239,164,117,107,201,231,74,179,219,99,143,78,120,255,197,29,75,
+    192,139,127,39,123,246,59,57,246,143,127,117,224,63,240,166,43,254,119,242,146,141,213,111,
+    251,215,173,82,223,163,155,107,225,123,115,253,157,216,118,253,243,47,222,182,243,112,62,191,
+    19,235,57,180,158,144,71,54,219,208,190,223,254,67,225,249,222,209,221,222,227,6,112,62,
+    72,254,0,0,84,102,227,197,59,15,57,231,156,123,98,219,207,6,254,244,203,254,126,224,
+    239,184,230,159,255,209,45,191,78,248,109,15,249,187,136,237,31,167,201,233,56,60,254,210,
+    11,191,233,156,235,146,149,185,212,248,228,240,67,79,253,109,123,197,183,115,228,31,63,121,
+    235,170,115,206,185,111,191,126,59,108,239,129,176,61,191,253,63,184,233,159,91,130,179,237,
+    62,180,233,159,127,232,11,191,235,219,11,201,200,70,18,63,115,219,111,247,155,31,120,151,
+    115,206,185,71,183,125,37,179,231,119,252,172,230,235,155,254,120,62,127,219,183,255,218,205,
+    151,157,115,206,125,234,182,63,142,163,144,172,45,215,108,133,100,250,190,55,125,183,115,206,
+    185,151,246,124,178,122,195,182,221,95,61,108,63,36,182,110,18,183,141,169,166,99,179,251,
+    225,60,29,132,68,255,169,87,253,118,63,249,170,127,61,222,247,62,252,125,246,15,223,232,
+    183,251,87,123,97,204,188,245,131,212,59,199,126,172,248,127,223,248,221,112,252,33,121,57,
+    251,190,63,15,239,184,246,93,126,187,33,145,221,13,31,136,247,133,143,251,111,223,183,36,
+    223,38,199,97,127,47,118,179,184,253,171,47,238,218,186,111,75,198,103,251,157,52,225,119,
+    114,247,216,191,254,124,24,171,126,83,184,79,252,75,123,150,196,253,254,61,31,146,249,254,
+    145,255,239,177,31,18,110,233,119,98,121,251,79,110,251,253,253,59,143,125,103,248,190,37,
+    85,123,244,219,179,30,161,189,208,67,246,233,240,59,185,59,179,223,201,63,8,191,147,63,
+    186,245,96,104,199,247,76,76,245,59,105,109,142,67,155,126,255,48,236,95,252,255,15,199,
+    246,187,241,175,255,202,243,126,187,119,157,221,93,112,170,73,37,0,78,131,228,15,0,64,
+    101,154,255,244,231,159,105,157,115,238,59,174,251,164,253,153,175,250,164,255,109,15,127,221,
+    57,231,220,31,134,36,254,45,15,125,205,57,231,220,239,223,242,81,239,179,183,159,117,206,
+    57,119,215,249,68,116,249,122,24,155,116,105,162,219,8,137,98,247,166,255,59,99,45,212,
+    16,255,166,7,254,174,115,206,185,75,33,51,189,243,186,159,253,253,127,67,69,178,183,135,
+    237,255,94,72,254,54,118,252,231,97,187,199,141,79,52,219,215,109,76,51,77,34,235,161,
+    221,131,91,126,187,219,141,79,146,239,123,227,119,37,251,247,225,47,252,190,115,206,185,189,
+    48,38,186,121,205,146,97,58,27,121,35,252,157,100,237,93,114,254,56,126,232,141,127,211,
+    57,231,220,167,95,246,247,71,127,250,90,154,200,26,103,61,18,190,61,27,187,255,208,243,
+    191,229,156,115,238,142,243,199,177,113,45,253,156,147,68,183,115,211,74,176,165,119,83,179,
+    4,117,229,122,72,90,77,154,168,214,194,121,184,123,203,127,127,43,252,247,248,199,111,250,
+    30,191,221,198,191,191,222,164,99,211,54,70,254,127,66,207,207,147,15,248,255,30,54,119,
+    226,203,97,29,249,147,33,137,127,225,142,63,127,143,132,89,243,191,119,211,247,232,252,217,
+    41,127,39,235,225,252,254,245,7,222,237,156,115,238,141,87,125,79,205,155,227,220,141,195,
+    176,61,255,249,191,220,245,219,127,254,246,107,253,118,95,245,219,61,106,252,235,165,223,137,
+    253,119,221,15,231,231,74,233,119,242,124,248,157,132,36,126,233,90,72,232,51,249,157,216,
+    239,125,231,166,127,222,30,219,220,9,151,236,231,3,103,252,157,108,52,233,28,161,187,161,
+    167,226,185,208,131,247,200,21,191,3,191,245,229,79,132,253,244,251,189,25,207,87,56,255,
+    97,191,255,219,55,252,220,25,239,34,0,224,52,72,254,0,0,84,166,249,192,159,125,178,
+    117,206,185,239,12,201,223,198,46,109,157,180,205,6,254,165,47,252,158,115,206,185,157,144,
+    224,182,175,133,36,213,164,143,58,150,215,132,191,47,214,67,18,177,217,220,187,95,241,143,
+    155,33,25,253,240,55,124,103,248,130,255,252,71,66,210,218,9,99,136,119,67,82,60,14,
+    143,150,116,109,46,128,46,11,95,11,237,172,183,182,157,144,160,111,165,179,171,47,63,220,
+    36,251,127,32,137,212,214,41,55,33,233,88,18,95,15,99,210,123,55,125,251,219,141,143,
+    188,223,252,26,63,199,224,187,31,246,137,231,195,95,252,237,164,93,91,141,96,99,163,91,
+    215,93,186,93,57,142,120,119,181,214,254,78,11,199,241,21,219,79,127,190,183,175,175,165,
+    223,183,187,191,133,195,181,100,109,231,227,208,18,94,216,239,127,20,146,238,39,95,246,201,
+    249,255,221,254,141,112,252,190,253,239,125,236,219,157,115,93,242,222,144,191,27,237,119,242,
+    223,195,216,238,157,54,237,73,25,253,59,9,251,183,22,30,247,66,79,192,229,144,200,127,
+    232,77,223,21,206,130,255,254,135,159,255,68,216,94,58,54,126,24,127,39,190,253,210,239,
+    100,61,38,103,127,126,54,195,255,2,118,111,166,191,147,173,107,97,22,191,75,219,239,238,
+    86,55,179,223,73,107,61,1,54,171,254,148,191,147,155,246,59,241,199,241,131,225,252,127,
+    49,212,254,255,237,47,255,161,115,206,185,221,227,116,245,193,97,232,73,235,254,119,106,171,
+    61,194,238,133,243,245,43,111,254,15,36,127,224,2,144,252,1,0,168,76,243,190,63,252,
+    169,214,57,231,182,195,223,223,27,113,118,185,79,122,191,28,18,184,141,53,238,134,191,232,
+    109,204,48,86,110,27,170,73,126,156,86,236,59,248,74,216,129,144,180,54,195,152,162,45,
+    247,190,122,45,172,67,142,73,203,214,135,251,247,247,110,30,132,6,252,11,219,215,125,98,
+    105,52,209,132,127,196,120,113,156,222,253,236,118,104,103,235,186,245,121,28,135,118,214,194,
+    118,14,251,15,47,36,172,171,215,125,146,219,8,179,213,247,111,185,240,60,28,199,117,75,
+    140,182,222,220,142,199,111,167,75,102,110,225,113,116,219,13,123,41,21,18,247,195,126,110,
+    63,210,95,51,189,141,159,243,219,93,139,201,116,35,236,239,122,178,189,171,215,54,66,243,
+    254,139,187,161,199,100,219,198,126,195,247,159,121,163,239,177,249,229,208,51,180,17,198,118,
+    247,195,239,228,104,217,223,137,220,125,110,189,245,251,97,115,67,246,95,110,195,254,123,151,
+    195,249,61,176,186,2,241,119,226,159,199,255,126,252,78,252,118,199,254,78,190,226,183,223,
+    88,79,76,216,111,251,223,169,43,252,239,244,72,206,255,238,173,254,253,54,36,127,224,98,
+    144,252,1,0,168,204,198,230,245,180,166,184,85,86,251,175,207,219,122,108,255,23,252,229,
+    54,29,27,63,241,133,197,207,227,203,221,188,99,255,220,30,125,18,217,184,238,199,254,109,
+    246,243,222,90,186,30,219,42,2,90,76,184,252,104,90,121,112,239,86,58,86,191,29,146,
+    235,241,90,186,67,173,174,51,142,165,11,195,186,234,91,233,253,203,182,44,169,200,221,215,
+    92,76,100,187,225,121,72,120,143,92,74,182,183,19,131,172,37,96,153,115,16,18,88,233,
+    56,46,135,227,136,127,166,201,24,173,174,150,110,165,114,158,37,125,179,21,198,124,99,96,
+    12,255,61,215,229,63,220,94,147,142,45,111,92,183,119,108,85,64,248,157,124,97,53,191,
+    19,123,123,55,156,95,75,216,87,175,251,243,107,191,147,221,208,163,96,29,6,252,78,92,
+    178,31,75,255,78,194,231,183,174,217,42,136,244,30,8,107,225,127,167,205,192,255,78,7,
+    247,123,160,3,8,192,106,145,252,1,0,168,204,198,193,154,31,147,147,192,224,54,174,133,
+    231,50,230,105,182,194,95,244,246,249,161,191,232,99,146,8,9,99,235,145,244,239,142,56,
+    27,60,188,188,214,164,99,176,235,118,55,192,248,141,176,110,56,124,96,59,142,81,135,253,
+    177,177,205,235,253,99,155,49,233,52,242,220,246,87,246,79,143,171,59,142,244,60,28,175,
+    133,132,100,31,92,242,56,46,203,113,236,134,243,106,199,215,52,78,190,95,56,46,97,137,
+    63,238,89,140,254,97,54,118,211,191,223,230,40,62,30,39,111,175,252,119,98,61,21,33,
+    249,119,171,6,194,209,240,59,113,206,77,240,59,177,196,127,189,255,252,219,142,29,91,143,
+    206,41,255,119,122,217,206,51,201,31,184,80,36,127,0,0,42,179,177,158,6,188,110,236,
+    46,12,22,218,208,224,150,36,163,125,91,103,30,254,124,176,196,81,18,103,67,11,75,116,
+    46,125,40,222,205,61,190,30,18,135,125,222,198,72,109,108,49,222,46,93,199,104,45,1,
+    202,108,231,86,254,177,127,43,93,71,191,165,199,23,103,137,187,116,255,37,9,149,20,143,
+    35,156,119,157,28,223,202,227,254,203,233,249,212,100,105,218,194,241,148,146,174,38,208,124,
+    135,147,221,58,183,223,137,238,7,191,147,169,127,39,225,248,165,167,195,30,39,251,223,169,
+    237,40,115,252,129,11,69,242,7,0,160,50,139,99,152,235,25,171,13,182,53,65,12,252,
+    25,161,73,115,79,18,211,101,153,45,109,9,107,116,64,176,132,82,24,115,141,251,91,88,
+    23,173,219,201,102,41,203,58,238,152,8,151,76,114,37,246,61,107,199,146,157,157,183,189,
+    175,164,179,239,7,215,121,203,203,131,179,197,227,127,31,171,253,190,220,241,240,59,9,251,
+    123,207,254,78,194,61,48,100,14,195,212,231,191,235,1,0,112,145,72,254,0,0,84,102,
+    48,249,239,133,49,67,253,139,63,27,203,44,36,154,24,176,66,66,177,191,248,117,214,175,
+    37,12,75,42,167,253,171,196,198,96,117,172,86,134,44,135,247,215,165,251,27,147,85,104,
+    191,145,227,159,106,8,51,38,187,240,120,44,47,232,108,238,181,248,223,99,228,241,20,102,
+    93,159,245,252,243,59,113,201,126,221,179,191,147,21,159,127,107,119,112,110,7,128,149,34,
+    249,3,0,80,153,98,242,183,191,10,116,12,118,40,17,169,210,172,223,108,253,245,25,147,
+    92,220,223,71,86,179,191,54,75,220,198,120,75,235,225,39,19,183,159,110,215,196,90,244,
+    3,155,95,245,249,231,119,194,239,100,25,165,223,11,128,243,69,242,7,0,160,50,217,159,
+    223,150,0,218,44,1,164,239,159,86,57,97,156,110,59,43,223,223,56,102,219,223,210,170,
+    150,43,175,234,184,166,58,255,252,78,228,251,252,78,70,181,23,247,147,10,127,192,133,34,
+    249,3,0,80,153,226,192,219,170,146,202,170,182,179,234,253,61,175,243,113,222,219,157,44,
+    161,175,24,191,147,139,221,238,228,231,255,162,78,20,0,231,28,201,31,0,128,234,112,241,
+    7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,
+    0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,
+    160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,
+    50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,
+    92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,
+    252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,
+    1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,
+    0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,
+    168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,
+    12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,
+    23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,
+    127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,
+    0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,
+    0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,
+    42,195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,
+    195,197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,
+    197,31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,
+    31,0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,
+    0,128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,
+    128,202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,
+    202,112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,
+    112,241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,
+    241,7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,
+    7,0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,
+    0,160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,
+    160,50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,
+    50,92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,
+    92,252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,112,241,7,0,160,50,92,
+    252,1,0,168,12,23,127,0,0,42,195,197,31,0,128,202,252,127,75,27,101,36,191,92,
+    238,175,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+// assets/start_screen.png
+static const Uint8 AB_DATA_7[] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,2,128,0,0,1,224,
+    8,3,0,0,0,2,15,44,214,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,
+    0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,3,0,80,76,84,69,1,1,
+    1,2,2,2,3,3,3,4,4,4,5,5,5,6,6,6,7,7,7,8,8,8,9,9,
+    9,10,10,10,11,11,11,12,12,12,13,13,13,14,14,14,15,15,15,16,16,16,17,17,
+    17,18,18,18,19,19,19,20,20,20,21,21,21,22,22,22,23,23,23,24,24,24,25,25,
+    25,26,26,26,27,27,27,28,28,28,29,29,29,30,30,30,31,31,31,32,32,32,33,33,
+    33,34,34,34,35,35,35,36,36,36,37,37,37,38,38,38,39,39,39,40,40,40,41,41,
+    41,42,42,42,43,43,43,45,45,45,46,46,46,47,47,47,48,48,48,49,49,49,50,50,
+    50,51,51,51,52,52,52,53,53,53,54,54,54,55,55,55,56,56,56,57,57,57,58,58,
+    58,59,59,59,60,60,60,61,61,61,62,62,62,63,63,63,64,64,64,65,65,65,66,66,
+    66,67,67,67,68,68,68,69,69,69,70,70,70,73,73,73,74,74,74,75,75,75,76,76,
+    76,78,78,78,79,79,79,82,82,82,83,83,83,84,84,84,85,85,85,86,86,86,87,87,
+    87,88,88,88,89,89,89,90,90,90,91,91,91,92,92,92,93,93,93,94,94,94,95,95,
+    95,96,96,96,97,97,97,98,98,98,99,99,99,100,100,100,101,101,101,102,102,102,103,103,
+    103,104,104,104,105,105,105,106,106,106,107,107,107,108,108,108,109,109,109,110,110,110,111,111,
+    111,112,112,112,113,113,113,114,114,114,115,115,115,116,116,116,117,117,117,118,118,118,119,119,
+    119,120,120,120,121,121,121,122,122,122,123,123,123,124,124,124,125,125,125,126,126,126,127,127,
+    127,128,128,128,129,129,129,130,130,130,133,133,133,134,134,134,136,136,136,137,137,137,138,138,
+    138,139,139,139,140,140,140,141,141,141,142,142,142,143,143,143,144,144,144,145,145,145,146,146,
+    146,147,147,147,148,148,148,149,149,149,150,150,150,151,151,151,152,152,152,153,153,153,154,154,
+    154,155,155,155,156,156,156,157,157,157,158,158,158,159,159,159,160,160,160,161,161,161,162,162,
+    162,163,163,163,164,164,164,165,165,165,166,166,166,167,167,167,168,168,168,169,169,169,170,170,
+    170,171,171,171,172,172,172,173,173,173,174,174,174,175,175,175,178,178,178,179,179,179,182,182,
+    182,183,183,183,185,185,185,186,186,186,188,188,188,190,190,190,191,191,191,192,192,192,193,193,
+    193,194,194,194,195,195,195,196,196,196,197,197,197,198,198,198,199,199,199,200,200,200,201,201,
+    201,203,203,203,204,204,204,205,205,205,206,206,206,207,207,207,208,208,208,209,209,209,210,210,
+    210,214,214,214,215,215,215,216,216,216,217,217,217,218,218,218,219,219,219,220,220,220,222,222,
+    222,223,223,223,224,224,224,225,225,225,226,226,226,227,227,227,229,229,229,231,231,231,233,233,
+    233,236,236,236,237,237,237,238,238,238,239,239,239,240,240,240,241,241,241,242,242,242,243,243,
+    243,244,244,244,245,245,245,247,247,247,248,248,248,249,249,249,251,251,251,252,252,252,253,253,
+    253,254,254,254,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,141,
+    80,0,0,0,0,9,112,72,89,115,0,0,14,195,0,0,14,195,1,199,111,168,100,0,
+    0,0,24,116,69,88,116,83,111,102,116,119,97,114,101,0,112,97,105,110,116,46,110,101,
+    116,32,52,46,48,46,53,101,133,50,101,0,0,43,224,73,68,65,84,120,94,237,157,251,
+    99,27,215,149,152,99,57,137,227,196,15,145,0,136,199,0,224,27,36,213,196,113,28,173,
+    236,218,235,88,114,154,108,183,145,56,3,144,18,101,199,73,245,38,101,91,38,101,203,73,
+    155,118,179,77,188,226,155,196,27,20,9,190,149,221,109,147,118,219,77,108,217,173,69,41,
+    221,109,119,195,1,212,110,42,217,193,196,187,190,32,254,146,206,0,67,138,4,102,128,153,
+    193,189,184,0,121,190,95,124,41,219,36,53,248,230,62,207,61,231,51,25,0,160,8,8,
+    8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,
+    64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,
+    85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,
+    1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,
+    4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,
+    16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,
+    128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,
+    170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,
+    2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,
+    8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,
+    32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,
+    0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,
+    84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,
+    5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,
+    16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,
+    64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,
+    1,170,128,128,0,85,64,64,128,42,32,32,64,149,90,23,80,88,22,228,22,80,147,212,
+    184,128,233,41,199,53,185,9,212,36,53,46,224,29,214,18,146,155,64,77,82,227,2,174,
+    118,177,9,185,9,212,36,120,5,76,243,75,81,153,216,2,143,228,63,37,72,204,61,145,
+    150,155,64,77,130,85,64,97,154,107,113,108,210,204,141,197,150,8,175,16,132,126,38,38,
+    55,129,218,4,167,128,194,171,182,38,118,36,146,99,132,109,119,57,28,3,63,75,146,236,
+    161,22,25,102,81,110,2,181,9,78,1,231,173,214,139,235,155,227,46,90,95,138,246,59,
+    152,78,239,112,52,73,108,44,142,49,253,41,185,9,212,38,56,5,140,90,207,239,212,33,
+    181,56,198,218,76,54,110,114,149,140,131,233,113,55,140,192,53,14,86,1,237,81,185,181,
+    69,122,61,114,149,237,106,236,100,253,36,102,131,9,174,99,69,110,2,53,10,97,1,69,
+    80,114,101,130,179,155,207,70,230,177,59,24,119,113,188,220,4,106,20,242,2,138,160,245,
+    11,22,145,179,152,21,68,195,246,145,10,108,245,0,36,169,136,128,226,108,112,46,116,214,
+    98,198,172,32,223,221,20,151,155,64,173,82,33,1,69,82,115,146,130,3,24,183,167,151,
+    218,88,24,129,107,157,202,9,152,85,208,236,236,89,195,101,32,26,101,198,96,4,174,117,
+    42,41,160,168,224,20,251,85,239,232,2,158,113,56,193,53,207,203,77,160,102,169,172,128,
+    25,180,118,162,213,225,120,29,139,129,75,237,220,186,220,4,106,150,10,11,40,46,136,23,
+    46,216,108,56,12,220,8,184,96,4,174,125,42,45,160,72,234,117,44,6,126,252,86,219,
+    130,220,4,106,23,10,2,98,50,240,131,23,14,191,43,55,129,218,133,134,128,120,12,140,
+    218,135,62,150,155,64,237,66,69,64,44,6,134,45,254,13,185,9,212,46,116,4,148,12,
+    116,4,203,90,66,160,97,75,88,110,2,53,12,37,1,51,169,55,218,186,203,186,205,145,
+    96,157,112,31,110,23,64,75,192,12,207,58,167,202,9,150,94,233,32,30,9,35,92,199,
+    176,91,4,20,135,154,128,104,130,225,146,114,219,0,27,65,215,56,233,93,192,72,67,68,
+    110,1,196,160,38,96,134,231,58,87,229,166,1,238,93,38,126,14,39,124,115,223,247,229,
+    38,64,12,122,2,162,113,231,69,227,67,220,141,23,143,188,47,55,73,17,127,228,1,16,
+    144,56,244,4,204,44,57,157,75,114,83,63,139,237,67,119,229,38,41,194,143,60,60,41,
+    55,1,98,80,20,48,53,224,24,48,220,5,206,184,3,164,119,1,195,143,62,6,115,64,
+    226,80,20,176,156,46,80,24,112,206,200,77,82,160,97,16,176,2,208,20,48,101,220,162,
+    178,134,111,109,36,185,253,32,32,121,104,10,152,153,113,25,21,112,198,57,64,250,70,250,
+    106,231,65,19,8,72,156,242,5,20,102,103,229,153,156,126,1,157,70,39,129,198,213,213,
+    204,140,187,23,246,1,201,83,190,128,203,142,250,217,92,75,183,128,198,7,210,10,8,24,
+    115,125,23,4,36,79,249,2,166,78,213,5,115,45,221,2,26,158,4,166,39,221,196,15,
+    130,65,192,138,128,97,14,24,172,55,42,160,225,142,44,193,117,93,151,155,196,0,1,43,
+    66,109,10,24,105,40,231,28,89,19,233,113,247,43,32,32,121,106,83,192,160,105,152,76,
+    36,66,58,57,39,175,174,147,92,215,89,16,144,60,24,4,12,212,93,205,197,85,85,78,
+    192,105,83,64,110,97,230,78,175,123,115,69,101,229,126,2,2,146,7,131,128,33,11,123,
+    39,219,168,152,128,194,101,43,33,53,182,146,158,167,175,154,134,131,32,32,121,48,8,152,
+    96,187,114,113,85,21,19,240,221,63,124,142,208,133,184,173,164,231,73,214,22,193,31,15,
+    152,78,134,131,161,80,104,115,227,20,192,34,96,122,210,61,46,125,106,104,164,82,2,206,
+    55,253,128,204,57,200,86,202,85,20,233,100,121,220,2,10,75,147,172,165,174,190,190,110,
+    115,227,20,192,34,160,20,29,47,141,91,60,235,158,203,253,129,102,12,10,24,179,7,201,
+    132,194,108,165,92,229,185,142,80,26,171,128,233,228,202,0,227,236,98,175,6,2,167,160,
+    186,211,125,112,8,200,115,46,41,79,223,178,71,119,174,22,131,2,234,31,235,53,178,149,
+    114,117,190,89,252,187,224,20,80,240,115,29,78,166,127,245,142,56,86,164,150,33,179,250,
+    22,56,4,20,199,94,105,87,36,230,214,157,171,197,152,128,104,148,148,128,17,91,46,229,
+    170,112,94,202,189,138,79,64,180,254,170,213,201,141,45,130,120,5,224,16,48,19,111,234,
+    22,59,142,152,75,119,202,122,99,2,242,92,35,153,204,168,104,216,158,83,110,193,110,159,
+    199,120,41,73,240,179,238,109,21,44,128,109,96,17,144,103,219,150,42,40,160,129,177,94,
+    27,155,57,127,211,35,118,169,224,4,46,1,133,215,29,45,236,52,244,126,138,96,17,16,
+    141,50,254,141,138,9,184,17,212,63,214,107,99,51,231,47,207,182,74,5,152,34,214,16,
+    142,181,142,32,229,33,169,68,225,188,154,4,139,128,153,185,198,193,123,21,19,240,163,55,
+    219,9,213,231,138,50,163,89,79,22,154,89,169,139,189,230,188,130,97,195,46,235,31,116,
+    127,106,224,17,240,253,35,71,110,84,76,192,247,95,56,242,158,220,196,203,198,52,147,27,
+    115,163,246,172,136,191,124,230,153,95,102,191,46,3,196,151,231,159,48,159,43,62,26,223,
+    173,93,40,30,1,239,74,157,146,126,1,13,133,245,109,68,157,132,242,178,221,27,108,204,
+    110,100,110,238,168,11,87,92,101,239,24,39,122,27,237,134,253,67,137,133,243,86,171,93,
+    162,145,11,237,206,227,19,60,2,166,131,141,19,72,191,128,134,194,250,82,87,220,81,50,
+    219,208,55,142,228,46,187,111,238,168,111,4,202,62,114,22,46,181,30,245,27,245,79,92,
+    60,183,216,108,231,165,218,163,195,108,155,139,244,45,44,58,224,17,48,179,210,201,38,244,
+    11,104,40,172,239,189,127,254,108,217,3,163,50,139,237,111,74,151,221,211,145,14,121,149,
+    29,110,40,51,3,28,10,57,153,128,209,177,83,120,205,214,204,142,204,103,245,69,252,69,
+    226,247,80,233,128,73,192,4,231,152,209,45,96,122,184,254,170,254,79,39,102,127,139,204,
+    148,126,35,208,24,144,206,180,147,220,129,72,238,215,42,87,64,97,234,59,158,65,131,191,
+    44,226,95,181,90,95,91,255,84,254,210,224,142,85,245,131,73,64,52,98,9,235,22,48,
+    201,218,244,159,104,108,248,45,132,98,1,239,14,101,87,215,233,49,75,246,104,91,164,76,
+    1,133,126,179,237,184,193,28,114,233,219,125,46,219,171,219,228,5,1,139,19,110,8,234,
+    22,112,181,211,64,138,191,223,13,25,176,86,19,31,28,121,241,134,248,143,36,103,30,201,
+    133,100,149,41,32,154,54,153,206,25,60,254,64,183,124,127,224,219,177,119,13,2,22,231,
+    26,115,101,90,175,128,49,151,28,124,167,135,247,14,63,79,40,45,214,124,115,54,223,209,
+    106,215,102,7,40,10,88,70,26,106,33,252,157,252,2,222,218,73,250,24,223,206,154,102,
+    32,96,113,126,245,204,51,111,233,20,16,141,27,121,166,75,109,111,127,36,55,49,19,149,
+    142,115,164,152,138,173,215,34,234,24,52,188,225,131,66,141,29,189,6,199,223,140,48,228,
+    57,182,182,243,229,4,1,139,35,188,237,236,211,41,32,207,121,12,236,44,196,92,132,98,
+    1,69,1,165,177,29,141,201,49,169,34,55,190,113,68,26,148,141,128,214,186,59,222,76,
+    24,92,0,139,139,103,87,40,239,255,5,1,139,179,17,113,30,116,232,19,48,222,104,36,
+    166,32,230,212,57,208,107,5,141,58,37,1,19,92,231,114,238,15,50,153,143,222,50,122,
+    232,135,214,124,205,61,70,147,176,163,155,221,158,161,252,193,27,4,44,1,207,217,76,186,
+    212,64,35,185,3,47,125,108,4,72,9,152,232,246,136,230,161,41,167,119,107,224,220,8,
+    234,157,214,202,160,155,125,95,243,221,52,216,255,101,18,190,182,194,193,27,4,44,1,26,
+    175,175,215,245,105,37,216,86,3,181,222,238,13,182,16,170,146,62,151,141,134,78,116,55,
+    78,223,23,39,154,237,20,245,179,222,243,196,73,195,117,145,81,168,189,251,195,130,255,25,
+    4,44,197,140,78,1,23,91,178,33,39,250,216,248,175,223,36,20,137,144,9,91,165,176,
+    238,229,246,237,191,149,49,1,211,137,126,151,130,66,90,225,189,173,10,53,124,64,192,82,
+    92,171,175,211,117,114,42,135,156,232,227,222,191,121,226,135,132,114,67,135,173,225,236,8,
+    191,253,183,138,57,141,68,30,38,123,29,214,109,221,168,94,22,91,21,230,198,105,67,91,
+    6,53,0,62,1,175,219,31,126,71,110,106,65,56,111,100,67,249,253,195,47,254,21,153,
+    69,112,122,88,18,240,222,96,211,246,155,125,75,237,91,123,130,218,65,209,174,163,101,196,
+    63,11,253,14,133,55,51,185,121,249,122,183,129,79,192,228,193,125,175,200,77,45,44,216,
+    108,6,10,125,204,186,135,238,201,77,204,36,57,230,154,56,194,239,172,254,176,206,54,235,
+    159,167,222,63,75,54,196,130,195,161,176,244,142,52,24,120,21,106,1,124,2,34,223,190,
+    151,229,166,6,208,168,205,192,49,193,70,192,65,42,57,126,246,92,240,238,15,191,186,99,
+    132,71,35,14,221,221,116,122,212,194,150,147,186,43,234,80,122,48,129,250,97,253,167,70,
+    181,0,62,1,51,47,237,243,105,127,70,9,67,55,219,82,111,19,171,143,116,205,61,142,
+    50,239,31,249,230,95,237,248,59,68,245,11,152,100,27,12,76,110,183,144,183,35,243,9,
+    154,228,20,100,187,13,140,2,126,111,223,65,205,111,190,48,216,102,100,23,250,198,115,207,
+    255,74,110,226,70,90,101,162,233,166,188,17,94,191,128,226,12,176,172,193,146,103,61,185,
+    228,12,59,16,78,131,128,37,249,233,195,54,205,243,228,69,167,211,72,160,102,168,225,77,
+    82,129,233,146,128,235,172,231,218,206,17,94,191,128,60,215,17,41,103,176,156,115,42,133,
+    8,205,213,155,118,105,58,15,140,2,70,246,107,222,8,20,6,236,253,6,214,137,255,244,
+    239,73,197,2,74,119,61,175,101,226,141,185,107,153,247,209,45,32,154,118,27,136,49,219,
+    70,168,65,33,247,166,112,186,254,180,241,117,117,85,131,81,192,152,230,157,232,116,200,201,
+    24,57,100,253,219,158,175,252,92,110,226,230,222,155,158,197,244,72,118,47,122,59,250,4,
+    252,228,221,79,120,182,197,95,198,12,80,18,48,36,183,182,177,123,59,64,204,2,106,44,
+    225,155,100,59,12,69,170,255,226,107,189,255,91,110,226,230,253,195,71,110,36,57,103,254,
+    45,56,93,2,162,235,47,252,231,165,150,252,78,84,39,138,2,6,119,109,7,136,85,64,
+    147,77,227,232,19,105,144,243,144,234,100,214,253,227,79,228,38,110,102,27,135,238,173,22,
+    22,97,143,234,217,246,73,176,255,236,122,204,62,182,117,141,195,16,74,2,166,175,238,214,
+    37,8,94,1,237,7,181,109,173,136,51,26,67,155,90,104,212,142,37,87,134,18,97,199,
+    244,167,147,238,137,252,30,60,222,124,229,119,114,179,20,66,252,12,195,254,207,11,229,94,
+    24,80,18,240,14,91,238,245,188,234,5,167,128,174,94,57,185,84,113,210,147,6,83,132,
+    242,172,155,80,36,76,102,195,239,136,36,185,3,5,171,248,119,191,241,156,182,11,0,66,
+    252,156,197,108,153,138,27,58,223,217,142,130,128,40,122,192,187,59,143,65,68,176,10,248,
+    93,135,150,23,245,14,103,57,99,104,70,67,44,43,86,110,135,91,233,150,178,48,100,86,
+    152,146,21,34,92,20,245,59,19,255,200,208,249,206,14,20,4,76,112,93,209,178,22,54,
+    213,76,229,5,20,6,115,25,125,245,19,115,17,202,138,37,174,65,254,240,27,239,6,235,
+    21,54,64,166,235,181,108,252,8,23,205,230,51,241,148,193,243,157,29,20,10,136,38,157,
+    101,46,108,170,153,138,11,168,116,223,65,27,27,129,251,183,53,112,19,182,12,125,60,172,
+    52,211,223,170,194,83,4,148,184,96,54,103,203,199,46,123,238,135,83,27,164,80,192,4,
+    235,158,218,181,29,96,197,5,20,166,143,182,27,76,22,112,143,88,90,54,233,172,127,58,
+    201,54,40,172,31,2,117,165,214,75,233,100,148,179,231,252,195,209,71,23,8,136,194,237,
+    196,102,30,85,64,133,5,68,126,171,195,224,101,197,141,95,29,38,21,12,157,201,248,77,
+    254,249,3,74,123,67,97,139,55,87,133,71,5,196,79,112,7,186,54,243,159,98,184,49,
+    85,32,32,207,181,26,78,47,83,3,84,86,64,180,198,185,6,12,38,11,72,253,176,237,
+    109,50,105,217,178,103,124,99,67,109,65,133,190,174,68,2,47,33,228,181,219,184,232,230,
+    253,75,2,2,10,151,140,92,93,168,29,176,10,248,138,163,120,38,1,33,232,125,162,199,
+    232,211,252,213,179,207,254,23,82,187,128,127,235,251,202,104,46,49,71,62,233,73,183,122,
+    40,60,74,92,114,122,184,209,251,215,127,9,8,184,192,24,207,175,85,11,96,21,240,84,
+    115,209,196,85,194,37,71,203,113,195,151,21,163,182,43,198,230,142,26,248,197,147,189,127,
+    210,118,89,241,178,137,122,198,27,148,8,114,173,204,224,246,219,231,248,5,68,99,140,145,
+    176,141,218,1,167,128,206,238,231,228,109,219,223,255,197,239,179,255,220,14,74,12,217,202,
+    72,214,189,225,55,147,138,132,201,100,102,93,151,143,117,197,21,251,215,88,174,14,89,62,
+    194,124,100,132,109,107,102,3,59,236,192,46,32,90,59,214,177,117,79,126,87,130,81,192,
+    69,167,227,95,89,114,147,192,229,214,254,185,188,192,61,97,154,109,103,202,72,150,252,187,
+    65,82,21,50,69,162,182,239,90,85,54,39,87,10,83,120,33,62,30,145,82,231,54,117,
+    251,243,230,179,184,5,76,223,62,222,228,219,189,123,128,18,24,5,76,245,51,39,229,173,
+    180,120,131,201,124,46,28,222,146,80,136,135,207,153,153,188,238,66,31,239,29,254,198,7,
+    114,19,63,17,219,75,106,199,211,60,231,218,81,1,47,125,103,117,220,235,178,89,173,231,
+    34,241,223,228,119,231,184,5,76,156,120,186,215,240,156,165,54,192,40,160,180,12,54,229,
+    158,94,106,238,172,217,108,49,75,18,102,57,103,22,185,80,86,162,247,197,86,82,89,177,
+    68,34,182,62,233,213,17,102,67,5,4,188,143,189,36,55,179,140,120,187,220,30,118,56,
+    18,87,122,153,48,11,40,156,179,249,110,237,110,255,8,9,40,41,24,12,74,18,230,48,
+    155,207,4,55,107,225,27,132,92,86,44,145,136,245,91,210,228,97,153,169,47,228,139,159,
+    249,162,220,202,82,103,97,39,87,212,94,37,188,2,10,253,38,211,46,62,3,201,65,74,
+    64,9,73,66,153,50,237,147,86,131,229,127,182,170,160,225,250,142,231,111,136,191,240,181,
+    64,33,125,143,177,211,114,83,194,31,42,146,116,13,171,128,146,127,187,123,5,44,65,82,
+    64,156,240,92,43,185,50,5,137,239,60,230,248,183,106,155,220,243,77,218,67,1,176,8,
+    40,39,110,223,27,254,97,22,240,229,122,191,220,198,205,82,11,193,3,209,21,119,195,179,
+    127,173,54,192,255,166,91,170,196,168,13,12,2,206,48,217,107,237,136,63,191,39,252,195,
+    221,3,90,46,19,122,102,49,185,140,27,17,98,38,203,160,106,202,35,52,146,205,156,170,
+    9,12,2,174,115,29,171,226,15,189,117,220,102,222,11,254,97,22,240,7,207,191,64,38,
+    94,128,232,20,48,19,173,55,249,213,99,94,34,114,5,57,13,96,16,48,155,34,24,173,
+    245,125,221,59,185,23,252,195,44,224,212,219,70,146,78,106,128,103,165,244,165,132,216,240,
+    23,189,80,26,177,159,215,122,27,126,198,72,222,255,60,98,238,177,223,76,179,95,238,51,
+    156,224,178,182,192,43,96,52,160,125,184,210,69,220,37,213,100,39,196,189,179,143,48,69,
+    114,58,204,219,29,90,223,170,213,78,3,181,199,118,146,246,59,159,252,99,119,83,143,241,
+    4,151,181,5,94,1,199,35,186,83,89,104,35,98,29,33,247,129,188,223,249,249,23,139,
+    120,147,186,224,208,58,6,39,56,91,121,105,36,133,217,145,63,126,116,159,149,157,46,56,
+    100,217,173,224,20,112,181,139,125,135,152,128,228,14,130,51,179,245,15,255,184,216,231,173,
+    125,18,104,172,250,221,22,194,236,233,186,253,150,39,190,116,114,207,232,135,87,192,4,103,
+    121,165,22,5,140,60,254,104,209,139,31,58,86,33,81,171,241,49,56,171,95,221,169,208,
+    59,90,239,247,239,10,112,10,40,190,255,47,43,165,151,45,159,13,63,73,1,67,143,62,
+    90,116,255,92,135,128,9,239,1,163,55,40,133,11,146,126,215,82,226,130,171,179,156,12,
+    171,53,6,78,1,51,193,250,239,55,19,201,36,251,241,101,134,224,46,204,79,30,218,95,
+    244,187,71,25,205,19,80,20,237,52,250,0,150,29,89,253,196,239,17,234,240,230,213,233,
+    210,73,58,25,159,175,149,250,234,152,5,252,49,167,253,216,64,7,55,14,191,64,168,66,
+    161,200,39,189,159,61,88,116,204,139,235,120,171,120,150,49,152,199,42,117,45,171,159,8,
+    127,252,203,229,5,1,254,246,135,86,59,177,11,132,152,193,42,96,160,254,207,70,93,36,
+    38,129,139,237,111,17,202,77,46,242,119,135,62,119,174,104,15,183,174,227,173,66,163,214,
+    178,163,118,208,205,110,3,185,209,183,129,198,247,151,155,33,164,98,96,21,48,100,225,222,
+    33,33,224,70,192,77,48,22,235,231,142,135,127,44,55,149,65,83,237,59,98,82,139,50,
+    235,186,162,111,244,75,255,195,71,249,227,45,26,177,149,55,149,142,218,46,212,202,49,10,
+    86,1,19,92,199,183,73,236,68,223,27,108,37,248,66,255,233,67,166,18,223,253,111,94,
+    253,27,185,85,154,191,126,230,153,119,229,166,54,18,63,250,89,65,164,237,156,219,88,254,
+    186,77,244,103,22,166,6,86,1,211,33,87,125,93,169,187,233,6,184,113,228,69,98,87,
+    210,165,228,234,79,149,152,113,125,154,212,158,243,79,184,226,152,212,211,123,9,67,29,87,
+    254,65,110,111,177,238,237,136,150,179,12,217,171,2,102,82,131,13,95,252,169,220,198,200,
+    130,202,149,73,44,252,254,143,246,249,48,238,122,108,68,29,94,29,91,129,233,136,203,89,
+    152,42,7,69,14,116,223,54,110,32,26,221,171,2,102,248,131,251,190,137,125,3,96,35,
+    232,38,85,158,70,228,189,206,207,189,45,55,177,192,115,93,218,123,175,244,218,177,142,130,
+    210,192,34,9,206,214,243,107,163,175,69,250,86,79,19,169,68,138,216,193,44,32,122,105,
+    223,163,218,39,236,26,249,136,96,86,34,41,1,248,163,83,114,19,11,40,218,213,125,75,
+    171,129,73,175,195,167,212,95,138,14,29,234,51,120,31,14,221,242,29,236,171,153,179,20,
+    204,2,102,102,247,63,212,135,187,11,124,255,5,195,149,243,53,240,211,135,45,120,183,46,
+    147,62,183,87,99,44,149,48,228,57,166,172,89,250,118,95,135,193,205,192,164,143,241,213,
+    78,44,23,110,1,19,135,246,61,134,57,36,112,35,234,28,34,149,149,72,228,244,190,131,
+    120,131,253,209,154,239,169,19,154,220,65,65,198,169,148,17,73,2,125,216,221,122,169,200,
+    253,39,85,196,85,77,119,121,7,41,21,5,183,128,232,79,191,240,24,230,9,112,234,45,
+    119,148,220,20,112,163,111,95,15,230,238,2,221,244,53,207,106,249,141,121,174,237,13,213,
+    28,232,40,224,104,58,97,224,86,240,146,211,21,174,153,254,15,191,128,210,201,254,89,188,
+    99,240,187,207,60,251,75,185,73,128,123,223,218,247,125,185,137,13,228,111,121,91,67,114,
+    125,20,104,42,118,211,42,229,247,126,189,87,247,118,160,48,192,228,146,101,214,8,248,5,
+    124,236,81,43,222,49,56,102,47,154,115,171,76,222,109,255,220,21,185,137,143,247,94,120,
+    246,23,165,71,65,158,109,81,168,205,127,31,180,230,117,20,20,142,40,129,148,1,153,220,
+    253,85,2,224,23,208,252,130,21,239,24,28,34,152,22,43,147,153,120,228,81,252,87,73,
+    83,151,173,222,95,151,50,80,184,212,204,254,70,110,43,131,198,108,223,137,37,245,204,231,
+    208,26,231,49,152,1,153,18,248,5,180,188,84,110,173,150,60,66,218,42,37,24,228,252,
+    103,191,94,220,2,67,252,189,134,93,148,121,155,173,84,89,57,254,248,129,46,93,43,218,
+    132,183,85,255,168,77,149,234,23,112,195,79,82,192,141,151,246,157,208,57,202,105,33,125,
+    187,175,179,196,46,138,112,222,90,50,98,0,37,162,108,147,14,3,81,184,163,187,198,178,
+    105,17,16,208,135,87,192,223,13,97,238,81,119,112,247,143,30,60,43,55,177,130,110,178,
+    45,151,138,45,198,144,223,170,37,100,10,125,232,123,234,164,86,167,196,73,99,91,173,229,
+    243,197,46,96,212,126,208,130,85,152,247,14,63,79,46,24,53,243,65,215,67,63,144,155,
+    120,65,126,135,189,216,8,155,224,220,23,181,76,214,208,205,147,79,176,83,9,45,19,65,
+    244,161,247,201,19,181,150,208,28,187,128,60,107,223,143,85,192,165,54,130,137,1,51,113,
+    243,99,19,114,19,51,169,215,27,143,70,84,119,146,133,193,54,141,201,110,208,77,95,163,
+    179,175,244,225,158,84,175,164,69,235,17,76,245,128,93,64,52,86,143,119,39,154,104,98,
+    192,204,59,15,219,87,228,38,110,214,123,61,93,94,149,157,228,116,200,229,212,58,88,162,
+    245,41,239,33,223,84,137,205,213,244,154,239,64,87,13,94,103,199,46,96,38,138,87,192,
+    141,0,201,172,48,153,151,31,56,88,110,46,3,53,16,31,234,118,247,222,86,82,34,189,
+    246,29,61,187,37,232,214,9,115,221,153,98,251,49,40,17,57,230,60,182,85,175,164,134,
+    168,122,1,239,13,182,144,12,45,122,233,1,156,193,128,121,160,155,189,79,31,87,24,20,
+    209,175,123,236,62,61,187,37,40,113,102,191,217,59,185,172,44,88,58,177,60,202,117,116,
+    214,80,4,194,54,170,94,192,27,47,146,12,133,65,190,7,94,146,155,36,64,107,199,155,
+    187,131,249,131,39,90,59,113,168,71,115,196,86,142,212,36,215,229,238,240,142,70,21,24,
+    229,90,29,205,92,68,211,66,165,234,32,34,32,206,195,224,197,118,130,209,208,25,254,169,
+    125,167,229,38,17,196,21,68,187,115,32,182,176,253,129,160,155,61,237,250,163,12,80,98,
+    117,140,115,219,21,105,102,71,231,13,22,64,163,14,126,1,99,38,172,135,193,49,146,209,
+    208,153,185,186,207,23,191,17,87,46,136,127,131,17,25,184,175,160,84,175,204,107,104,177,
+    128,214,231,34,138,196,107,213,62,17,252,2,174,120,218,204,248,198,96,52,81,164,86,91,
+    249,4,191,244,240,180,220,36,69,106,33,114,129,113,48,3,49,153,126,166,229,248,94,201,
+    189,166,1,252,2,38,216,199,49,78,2,19,92,87,145,212,125,101,243,147,135,30,33,121,
+    208,44,147,90,184,192,48,78,25,134,185,84,86,193,148,93,6,126,1,209,240,163,24,5,
+    140,52,100,115,118,147,226,204,131,95,175,200,217,189,216,13,110,177,80,83,209,42,164,193,
+    47,96,38,244,72,241,100,83,186,8,154,134,73,118,23,223,125,160,23,122,35,170,16,16,
+    112,102,255,23,126,132,235,83,77,15,215,23,77,221,87,38,200,247,192,203,114,19,160,3,
+    1,1,249,167,63,251,12,174,91,129,73,14,115,116,235,78,18,79,225,143,199,7,116,65,
+    64,64,244,163,135,27,112,165,180,191,94,88,44,21,39,51,117,143,140,201,77,128,14,4,
+    4,204,68,30,127,28,87,62,211,152,107,146,228,254,254,15,31,242,252,74,110,2,116,32,
+    33,224,82,195,23,48,37,136,65,227,46,146,187,128,153,211,159,253,54,185,188,131,128,22,
+    72,8,184,126,240,65,76,231,91,60,71,176,62,141,200,43,15,158,36,120,204,2,104,128,
+    132,128,232,228,103,79,201,205,50,137,55,18,157,2,166,79,60,248,138,220,4,40,65,66,
+    64,61,105,229,139,19,177,19,172,79,35,46,130,191,78,230,66,8,160,29,34,2,166,254,
+    28,211,102,127,196,78,176,58,131,184,8,126,252,225,119,228,38,64,9,34,2,226,66,56,
+    111,35,42,96,240,145,253,68,191,63,80,154,170,22,112,193,70,54,217,123,240,75,197,170,
+    100,2,149,160,170,5,140,216,206,227,61,184,23,86,118,132,202,254,228,243,196,110,36,1,
+    26,169,110,1,113,79,1,231,156,59,210,183,126,247,129,131,181,149,199,98,23,178,167,4,
+    20,78,213,239,136,211,121,233,51,28,196,194,80,166,154,5,196,190,6,153,173,171,223,81,
+    71,235,123,251,190,39,183,0,90,84,179,128,216,215,32,161,186,51,59,230,148,65,51,201,
+    88,47,64,11,213,44,32,246,53,72,104,231,8,156,73,173,66,112,50,109,170,90,64,194,
+    83,64,160,10,216,75,2,230,79,1,129,42,96,15,9,40,156,202,155,2,2,85,192,222,
+    17,80,184,0,29,96,21,82,197,2,162,17,156,37,247,68,255,234,106,166,136,238,30,162,
+    138,5,228,217,22,124,37,226,192,191,42,165,138,5,92,106,97,177,229,155,77,79,213,237,
+    7,255,170,145,42,22,48,226,40,175,110,253,125,80,34,122,204,124,22,252,171,70,170,90,
+    64,60,107,16,196,251,189,157,7,106,172,124,198,158,161,154,5,180,159,154,199,144,104,16,
+    173,245,52,185,185,112,13,102,175,221,19,84,177,128,113,135,213,254,90,185,6,166,19,81,
+    239,151,187,167,106,56,129,222,46,167,138,5,76,205,159,179,90,47,68,227,101,36,51,19,
+    226,35,108,151,231,248,135,159,202,95,3,85,71,21,11,40,42,248,170,205,230,104,226,198,
+    102,174,223,209,159,31,1,37,98,225,51,102,147,205,27,130,238,175,138,169,106,1,197,78,
+    48,60,194,122,92,238,78,110,88,95,9,2,148,92,157,228,108,102,147,233,76,140,175,201,
+    220,221,123,134,234,22,80,4,173,47,199,198,89,107,189,149,157,152,153,153,89,77,106,208,
+    16,37,230,70,184,206,198,46,110,56,52,11,123,47,85,78,213,11,40,145,230,163,127,198,
+    118,185,93,82,87,56,34,37,25,141,171,119,135,136,95,26,99,93,13,14,118,124,69,139,
+    172,0,101,106,66,64,17,113,76,157,137,70,71,89,166,193,106,181,218,26,217,113,57,229,
+    119,1,99,92,155,211,195,93,157,129,137,95,109,80,43,2,230,64,252,181,176,200,112,183,
+    199,41,21,63,80,164,149,27,91,134,44,224,53,67,109,9,40,131,248,229,104,54,223,183,
+    18,11,208,247,213,18,53,41,32,176,123,0,1,1,170,128,128,0,85,64,64,128,42,32,
+    32,64,21,16,80,11,194,50,134,184,48,64,9,16,80,11,179,204,172,220,2,48,67,72,
+    192,93,214,101,4,137,22,12,219,211,16,18,48,63,11,75,141,3,2,18,131,144,128,175,
+    60,176,155,234,31,164,175,214,5,228,38,128,25,16,80,3,119,88,11,100,53,34,4,33,
+    1,199,31,25,151,91,187,129,213,46,22,238,212,17,130,144,128,187,107,210,20,115,79,208,
+    8,171,22,102,103,119,255,238,15,8,168,129,152,139,70,53,7,225,66,157,131,104,165,188,
+    170,0,4,212,0,29,1,103,235,246,99,206,16,91,141,128,128,26,160,34,96,250,234,254,
+    83,123,224,70,11,8,88,154,244,184,155,130,128,123,100,233,13,2,150,38,193,117,84,190,
+    160,146,48,212,177,39,150,222,32,96,105,226,46,162,85,139,21,17,46,57,156,225,189,112,
+    163,25,4,44,77,196,70,180,106,177,34,139,140,227,210,158,184,211,12,2,150,38,66,182,
+    104,172,34,49,166,127,111,220,169,7,1,75,67,65,64,58,235,30,26,128,128,165,161,32,
+    32,149,117,15,21,8,9,24,168,187,186,123,102,208,20,4,164,177,238,161,3,33,1,67,
+    22,246,142,220,172,121,208,48,230,138,77,165,17,127,100,229,215,61,116,32,36,96,130,237,
+    90,149,155,53,15,223,221,20,151,155,149,130,194,143,164,5,33,1,211,19,187,103,18,189,
+    212,198,86,122,56,164,240,35,105,65,72,64,74,231,247,68,136,50,184,202,69,104,134,194,
+    143,164,5,8,88,146,8,83,241,53,8,133,31,73,11,16,176,36,213,43,32,74,70,67,
+    247,153,169,201,164,116,196,4,116,143,239,150,125,152,234,20,80,88,154,153,145,210,96,223,
+    199,238,13,213,96,0,53,41,1,87,58,184,221,18,203,81,133,2,162,228,234,0,195,184,
+    220,93,236,213,224,38,87,57,143,43,88,123,125,32,41,1,121,206,181,91,54,18,42,47,
+    160,112,190,104,149,50,33,62,194,117,186,156,253,209,216,202,182,92,217,40,49,212,90,131,
+    107,103,82,2,162,17,10,39,248,100,168,188,128,11,118,199,188,220,44,4,37,250,45,102,
+    7,59,182,88,16,172,176,206,53,47,200,205,218,129,148,128,248,206,175,132,249,104,22,28,
+    117,227,12,81,121,1,35,118,245,80,24,33,200,50,230,179,49,165,5,7,26,197,86,95,
+    180,114,84,185,128,104,125,225,188,213,106,19,177,90,7,40,173,242,40,8,168,254,19,133,
+    215,157,237,236,148,138,158,139,109,221,53,55,6,19,19,48,106,15,110,200,77,163,32,126,
+    113,140,109,178,90,207,73,185,199,207,53,48,116,42,174,162,17,38,42,55,43,133,186,128,
+    194,235,14,199,27,170,47,226,122,119,147,250,208,93,12,97,78,42,62,48,71,99,140,33,
+    38,224,156,251,237,242,34,42,81,34,202,53,51,109,236,72,60,251,125,82,211,71,59,99,
+    52,118,118,18,92,179,177,79,213,56,170,2,162,32,227,120,93,253,177,26,10,155,72,39,
+    98,161,179,245,245,38,83,125,125,63,5,3,137,9,248,238,115,207,190,43,55,13,32,190,
+    146,195,92,167,135,27,89,218,122,221,81,184,139,163,17,97,179,212,206,173,203,205,74,161,
+    38,32,186,233,109,41,26,168,175,127,222,35,44,78,112,214,250,250,250,211,193,224,233,186,
+    186,233,202,191,225,196,4,20,222,178,234,127,27,101,80,242,188,180,177,202,133,118,12,54,
+    119,56,211,48,133,46,48,234,26,171,240,220,83,109,208,79,223,244,62,113,162,232,36,79,
+    175,128,40,241,134,211,217,201,93,13,74,53,245,82,103,27,188,183,43,62,205,38,38,96,
+    38,96,54,118,173,53,91,232,210,106,58,19,138,229,85,156,65,195,102,26,65,134,81,87,
+    165,167,128,42,131,62,186,125,162,205,251,97,81,67,116,10,40,4,216,54,103,255,74,66,
+    126,173,249,19,135,78,84,124,154,77,78,192,144,33,1,81,98,138,235,114,119,114,147,10,
+    35,13,157,32,195,202,11,168,50,232,39,69,63,110,22,239,161,244,9,40,188,102,117,113,
+    129,251,15,26,221,242,49,19,149,238,2,171,74,192,244,221,247,253,44,99,227,198,151,21,
+    171,97,166,39,105,28,48,87,94,64,229,65,63,61,106,41,57,66,234,18,80,120,173,161,
+    225,213,29,163,12,154,118,87,252,50,60,73,1,135,245,189,77,40,57,127,249,72,107,7,
+    59,166,186,205,64,229,128,153,134,128,74,63,49,201,54,148,220,102,214,35,96,214,191,188,
+    113,102,157,109,187,84,225,149,48,57,1,163,54,54,41,55,53,145,94,243,117,121,94,188,
+    28,47,178,221,76,229,128,185,90,4,92,237,42,253,246,233,16,16,249,109,214,124,255,50,
+    40,224,176,7,244,117,27,229,66,78,192,4,167,103,198,134,18,145,99,142,99,161,27,119,
+    139,141,177,104,196,174,179,87,197,64,149,8,40,12,184,74,103,201,84,19,176,176,104,1,
+    186,217,221,244,90,225,60,59,117,169,169,194,1,13,228,4,68,19,238,25,185,89,26,180,
+    214,219,209,229,45,49,197,206,100,226,77,152,207,154,164,168,58,153,69,149,177,167,74,4,
+    92,100,156,139,114,83,29,53,1,11,235,156,240,199,15,244,40,173,116,214,185,150,202,14,
+    194,228,4,212,17,20,141,248,73,246,128,55,188,185,29,160,14,207,182,45,201,77,13,164,
+    147,225,96,168,72,150,91,148,92,237,103,24,87,14,134,81,121,240,21,23,16,41,102,69,
+    208,148,171,67,77,192,130,60,1,194,27,109,202,175,59,242,59,152,138,70,21,86,131,128,
+    233,91,125,77,45,61,197,119,184,114,160,49,29,183,117,132,8,107,169,171,103,84,179,220,
+    10,126,111,167,147,233,207,197,218,68,251,237,118,101,3,43,46,96,130,237,84,200,138,160,
+    233,105,106,21,80,184,228,96,252,202,15,50,245,70,91,69,87,194,36,5,116,251,53,133,
+    35,160,91,190,131,190,64,145,181,199,54,230,155,181,174,131,211,201,65,87,7,123,53,112,
+    77,173,223,16,94,109,96,184,209,173,168,186,212,37,59,163,216,187,86,92,192,25,187,87,
+    97,158,129,83,192,116,216,105,87,61,82,230,57,71,37,207,132,9,10,184,216,62,116,87,
+    110,170,131,146,43,147,199,152,158,53,141,253,218,58,215,174,113,12,78,244,122,156,131,119,
+    212,7,117,209,191,134,129,237,187,96,169,1,187,226,131,175,184,128,33,243,213,194,167,129,
+    198,93,26,102,212,26,5,76,178,158,33,213,241,28,77,154,205,23,43,103,32,65,1,111,
+    188,120,228,3,185,169,138,184,248,232,108,20,87,31,90,247,151,209,152,123,92,147,171,194,
+    69,231,209,109,155,252,133,172,54,229,239,66,44,50,138,93,32,5,1,21,118,240,121,206,
+    163,33,99,190,54,1,209,168,181,216,56,146,26,48,155,251,21,79,2,72,64,80,192,187,
+    67,37,227,152,208,77,111,27,59,182,154,212,254,183,93,233,212,54,67,153,183,90,167,139,
+    126,215,255,243,39,161,60,63,83,3,140,82,39,83,29,2,198,27,181,100,43,210,38,96,
+    146,179,140,22,123,227,83,3,22,219,113,93,123,184,101,64,80,192,13,127,137,72,206,141,
+    212,127,60,241,213,210,123,47,59,224,189,118,45,155,59,104,216,122,174,88,255,39,206,131,
+    62,46,248,12,102,148,70,185,141,64,85,8,24,209,148,173,72,85,192,186,83,247,7,85,
+    97,168,163,132,204,169,169,163,158,183,146,90,71,165,242,32,40,96,38,90,92,64,244,119,
+    87,142,124,249,164,150,197,239,54,208,85,77,71,204,134,178,251,40,10,248,241,91,109,21,
+    190,233,163,34,160,178,90,59,81,19,240,90,93,221,214,70,32,10,58,157,225,18,15,29,
+    133,220,30,110,186,34,19,65,106,2,162,68,152,115,61,255,163,255,165,207,63,149,143,167,
+    0,67,217,125,20,5,252,224,133,195,101,4,214,170,35,44,198,20,153,89,254,15,248,5,
+    76,157,170,219,26,131,19,156,103,176,248,224,32,146,10,177,86,211,217,74,196,232,19,21,
+    208,169,190,105,135,214,142,123,58,189,255,233,35,221,247,70,66,102,13,99,17,26,101,12,
+    68,145,42,10,24,181,15,125,44,55,203,7,37,86,100,207,98,253,14,135,83,9,87,251,
+    147,143,188,28,141,222,143,4,207,81,158,128,219,38,129,104,130,209,50,155,68,252,121,83,
+    189,233,236,236,221,114,47,246,148,130,164,128,203,158,110,181,5,3,186,217,243,101,111,216,
+    200,82,75,83,140,131,177,123,28,138,2,134,45,218,118,51,75,35,204,133,71,184,78,217,
+    51,39,179,181,5,190,147,209,127,249,197,125,251,29,142,182,151,118,254,45,163,101,205,1,
+    183,9,152,96,93,83,154,30,123,106,238,140,201,228,14,255,147,252,37,41,72,10,200,115,
+    174,57,185,153,71,250,118,95,167,79,231,236,79,134,231,186,174,203,77,117,140,221,227,80,
+    17,48,44,183,202,66,180,239,172,201,100,182,179,99,178,104,209,5,229,113,16,77,49,7,
+    127,18,25,233,125,238,231,242,31,228,88,104,209,50,167,40,45,32,10,105,127,52,169,185,
+    208,236,255,171,229,30,80,92,138,42,127,120,233,95,251,14,245,253,15,67,254,137,67,72,
+    99,233,168,93,99,247,56,200,9,40,204,137,246,153,164,107,6,165,15,124,102,164,157,78,
+    148,248,197,239,229,175,115,240,108,243,235,37,103,100,234,233,40,182,4,228,217,214,234,74,
+    32,67,82,192,76,88,89,192,244,175,189,54,227,215,95,86,52,84,143,54,180,119,39,244,
+    43,237,3,98,16,80,210,175,94,180,111,174,228,220,95,66,249,204,237,83,191,205,86,114,
+    53,46,14,175,42,67,206,150,128,75,173,21,191,227,87,28,10,2,162,155,125,135,188,183,
+    12,191,134,9,206,161,224,201,78,12,9,184,196,48,10,1,79,229,11,40,244,75,250,105,
+    179,79,68,229,208,55,117,222,86,50,14,99,197,227,85,177,107,83,64,52,86,241,59,126,
+    37,32,44,160,194,61,74,244,97,79,71,223,109,227,187,156,104,196,82,114,65,104,72,192,
+    25,102,64,65,146,178,5,68,83,166,122,237,250,169,71,29,196,27,125,165,158,90,118,244,
+    86,100,83,192,4,219,81,101,53,176,137,10,120,141,225,10,86,172,104,237,228,87,122,244,
+    157,126,228,17,105,32,36,160,210,20,176,124,1,147,156,85,87,221,105,53,1,249,190,63,
+    240,142,22,223,55,80,254,27,72,108,30,133,204,58,171,173,254,8,81,1,121,174,179,32,
+    42,63,209,251,84,159,177,245,239,38,17,75,201,29,137,106,18,80,203,93,142,237,168,9,
+    136,214,142,91,27,122,139,109,65,165,39,85,99,208,229,163,16,52,108,169,252,157,134,226,
+    16,21,16,141,187,175,201,205,77,208,164,221,167,53,246,74,133,89,87,201,79,212,136,128,
+    42,31,95,217,2,206,184,117,221,181,221,240,171,21,184,72,243,99,71,15,68,139,124,175,
+    59,234,183,112,228,163,144,164,134,249,115,133,33,42,96,97,167,130,110,251,108,229,206,130,
+    121,206,83,170,142,154,17,1,147,202,215,222,203,22,48,166,175,98,202,221,161,118,213,187,
+    31,40,218,201,21,153,189,132,45,234,201,115,114,147,192,213,206,170,171,0,70,86,192,107,
+    238,201,29,243,102,113,24,57,84,60,187,137,6,208,184,171,84,76,160,17,1,35,22,175,
+    210,248,86,105,1,223,63,252,226,13,185,89,8,223,219,214,29,84,221,14,12,212,41,68,
+    178,202,228,4,84,95,165,80,131,172,128,215,119,206,127,208,154,175,249,120,153,3,176,72,
+    233,72,131,152,129,7,29,172,83,156,30,85,90,192,249,166,34,113,228,232,67,95,155,227,
+    146,202,102,182,112,250,126,196,65,1,57,1,213,230,151,20,33,43,96,146,219,177,98,229,
+    251,190,230,43,107,1,156,99,157,107,41,113,67,81,107,216,234,54,210,195,202,31,95,165,
+    5,140,49,197,18,123,34,254,13,71,179,74,134,152,217,186,186,252,25,247,125,246,168,128,
+    104,216,180,237,83,69,193,150,242,54,96,100,208,88,145,48,155,44,26,195,86,183,115,135,
+    83,222,94,172,188,128,197,255,243,148,223,247,164,242,91,28,172,59,165,190,221,147,21,112,
+    35,160,227,170,118,133,32,43,96,38,176,45,165,95,250,195,238,118,60,231,144,203,158,18,
+    99,48,186,170,37,104,107,7,215,187,188,138,157,102,181,9,152,65,55,125,45,108,84,225,
+    186,85,174,147,219,206,198,39,91,157,105,246,95,222,187,236,41,125,185,189,194,16,22,112,
+    91,240,20,186,125,162,221,135,103,13,198,119,151,202,17,163,55,49,141,250,109,167,170,19,
+    80,52,176,183,243,128,111,45,223,64,133,41,224,111,253,191,149,91,57,1,63,56,252,226,
+    123,242,215,85,3,97,1,239,111,69,167,111,247,28,234,195,49,0,139,160,145,82,217,87,
+    53,5,109,109,135,247,170,220,58,171,62,1,51,40,17,61,230,60,22,202,59,21,41,156,
+    2,162,41,247,86,108,66,86,192,185,198,193,123,242,215,85,3,97,1,211,19,155,211,222,
+    36,231,232,193,150,0,86,53,238,109,19,52,238,28,208,21,79,30,119,171,236,144,85,161,
+    128,82,39,200,117,118,176,33,126,123,47,88,56,5,220,190,237,156,21,48,202,224,10,174,
+    197,7,97,1,55,215,93,40,241,102,199,209,242,55,96,54,201,10,248,143,255,253,31,229,
+    47,21,88,116,186,66,58,126,28,26,85,139,53,169,176,128,66,191,67,203,127,142,248,8,
+    215,220,214,61,186,176,245,150,41,140,192,219,183,157,101,1,13,156,80,18,134,184,128,78,
+    41,221,0,90,59,222,238,14,22,206,155,141,18,177,158,19,210,127,249,237,255,38,127,169,
+    64,106,208,163,103,39,134,103,155,84,166,231,229,11,152,125,2,90,89,116,56,180,93,194,
+    67,188,191,187,201,106,61,159,203,167,40,204,158,222,159,63,2,11,23,183,109,216,239,89,
+    1,23,156,82,186,1,190,231,128,183,104,158,2,157,196,173,13,241,91,221,95,249,115,249,
+    75,37,18,94,187,142,51,88,245,26,67,101,11,184,232,116,234,200,232,21,115,104,14,157,
+    65,188,84,69,202,237,149,86,196,203,76,93,93,222,255,152,14,59,183,37,116,219,179,2,
+    166,250,153,24,226,95,107,238,198,180,254,200,145,58,219,240,239,122,28,202,251,38,50,104,
+    210,201,106,30,243,209,152,99,244,83,185,157,71,217,2,166,46,58,117,156,126,107,154,2,
+    110,145,90,24,97,59,14,120,71,147,31,95,203,207,194,132,214,216,142,109,9,96,164,120,
+    44,52,186,7,5,148,38,129,137,94,183,221,175,242,249,26,36,98,121,230,80,79,241,140,
+    50,124,207,147,154,143,157,19,172,234,45,186,178,5,212,117,44,131,198,156,122,4,148,186,
+    193,8,103,54,115,177,188,236,38,40,17,62,214,232,219,246,99,165,120,44,190,187,173,234,
+    182,1,43,33,96,96,176,237,168,31,227,248,43,17,121,188,206,87,34,170,95,58,120,46,
+    125,143,39,75,58,236,81,189,41,81,190,128,9,206,161,126,68,150,7,207,106,201,65,180,
+    131,116,98,148,61,208,233,29,157,223,118,68,44,248,185,246,142,29,73,79,164,120,172,249,
+    166,238,234,186,15,34,65,94,64,231,183,28,12,246,196,215,113,171,165,120,238,33,17,228,
+    119,56,180,253,224,4,219,169,154,172,162,124,1,209,136,229,156,214,101,72,220,101,32,7,
+    113,250,78,132,115,217,154,186,71,229,11,159,209,232,5,123,35,151,119,235,90,156,4,70,
+    40,100,216,46,9,113,1,23,92,14,103,145,250,122,6,73,197,115,37,12,139,146,186,212,
+    122,76,75,226,55,52,110,83,15,147,43,95,192,204,156,197,162,53,81,77,196,170,247,8,
+    49,11,90,159,189,218,221,230,216,194,110,127,45,175,204,84,86,192,82,187,167,52,32,46,
+    96,106,81,237,10,54,121,120,111,219,9,13,155,223,73,174,97,76,213,83,12,2,166,206,
+    154,181,118,129,17,195,5,246,208,250,98,84,42,107,155,99,190,224,145,239,89,1,105,130,
+    110,158,56,212,83,242,2,158,112,185,88,253,27,12,2,106,239,2,211,37,207,24,13,3,
+    2,210,0,221,238,113,28,11,21,239,125,80,200,229,42,146,174,12,135,128,154,187,192,36,
+    199,104,94,175,232,4,4,164,2,90,227,60,174,55,138,93,102,68,107,197,18,38,75,2,
+    98,152,185,207,89,180,165,93,38,120,103,3,4,164,67,58,49,200,180,23,185,6,128,214,
+    124,45,189,197,182,233,174,57,117,7,87,23,34,165,93,46,185,106,23,153,113,107,175,66,
+    161,19,16,144,22,169,0,119,128,157,86,185,71,129,214,78,126,173,120,154,46,158,235,40,
+    117,7,79,3,169,126,230,168,250,109,162,77,116,21,151,210,9,8,72,13,116,179,167,165,
+    209,59,126,189,48,233,113,154,159,96,159,60,89,252,144,80,91,125,132,146,240,189,109,206,
+    146,155,146,36,11,34,131,128,244,248,116,61,224,245,184,59,185,145,29,101,187,210,119,174,
+    79,112,140,187,183,212,33,117,76,207,81,174,42,40,49,216,82,242,70,126,180,161,48,149,
+    9,46,2,117,87,195,32,32,45,208,250,242,56,103,171,55,157,9,223,103,132,235,106,236,
+    224,166,242,55,108,11,88,106,197,179,48,88,63,254,4,91,60,239,119,250,106,189,250,197,
+    222,114,9,89,216,159,130,128,20,73,243,209,127,109,50,153,239,99,178,114,147,202,149,217,
+    119,178,206,181,232,8,167,82,71,156,9,184,26,94,45,102,96,146,179,146,139,86,17,135,
+    247,115,32,32,93,82,179,193,237,68,52,216,39,130,70,117,69,72,169,131,214,7,44,150,
+    115,179,170,53,65,81,180,139,216,38,140,248,2,78,184,95,1,1,107,146,24,182,226,125,
+    169,139,13,22,167,234,225,32,239,237,136,106,56,185,54,74,204,5,2,214,38,11,14,7,
+    174,48,186,84,124,216,251,180,111,68,185,254,134,182,106,92,134,137,185,123,65,192,154,36,
+    117,30,99,24,19,186,117,162,161,174,254,188,194,56,44,156,55,22,9,163,149,21,79,155,
+    25,4,172,73,22,218,46,253,95,185,89,62,136,143,156,174,107,224,38,22,243,122,65,225,
+    53,171,149,104,77,48,254,233,125,143,235,47,95,70,28,16,176,52,169,213,191,199,218,53,
+    165,38,165,122,53,3,177,237,107,112,201,191,215,136,134,173,161,190,7,255,5,173,184,184,
+    34,128,128,20,72,39,86,250,25,198,229,225,2,178,130,130,116,191,141,172,127,153,210,183,
+    249,169,0,2,210,33,181,16,29,227,154,154,217,92,24,189,168,159,141,180,127,153,212,207,
+    170,176,3,4,1,233,129,214,167,216,22,123,22,155,237,188,134,43,6,187,18,16,144,34,
+    136,95,148,67,232,247,170,126,32,32,64,25,16,16,160,10,8,8,80,5,4,4,168,2,
+    2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,
+    8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,
+    64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,
+    85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,
+    1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,
+    4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,
+    16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,
+    128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,
+    170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,
+    2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,
+    8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,
+    32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,
+    0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,5,4,4,168,2,2,2,
+    84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,16,16,160,10,8,8,80,
+    5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,64,128,42,32,32,64,21,
+    16,16,160,10,8,8,80,5,4,4,168,2,2,2,84,1,1,1,170,128,128,0,85,64,
+    64,128,42,32,32,64,21,16,16,160,72,38,243,255,1,150,76,161,185,168,94,10,254,0,
+    0,0,0,73,69,78,68,174,66,96,130,
+};
+
+const BundledAsset AB_ASSETS[] = {
+    { "assets/dead.png", AB_DATA_0, 8145 },
+    { "assets/pause_screen.png", AB_DATA_1, 14760 },
+    { "assets/sounds/sfx_die.ogg", AB_DATA_2, 18942 },
+    { "assets/sounds/sfx_hit.ogg", AB_DATA_3, 15670 },
+    { "assets/sounds/sfx_point.ogg", AB_DATA_4, 13235 },
+    { "assets/sounds/sfx_wing.ogg", AB_DATA_5, 7728 },
+    { "assets/sprite_atlas.png", AB_DATA_6, 16238 },
+    { "assets/start_screen.png", AB_DATA_7, 12155 },
+};
+
+const int AB_NUM_ASSETS = 8;
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Bytes written per line of the generated arrays
+const int BYTES_PER_LINE = 24;
+
+bool readFile( const std::string& path, std::vector<unsigned char>& data );
+
+// Generates a source file holding the given asset files as byte arrays plus the sorted AB_ASSETS table
+int main( int argc, char** argv )
+{
+    if( argc < 3 || argv[ 1 ][ 0 ] == '-' )
+    {
+        printf( "Usage: AssetBundler <output.cpp> <asset> [asset...]\n" );
+        return 1;
+    }
+
+    // Assets are looked up by path with a binary search, so the table is sorted
+    std::vector<std::string> paths( argv + 2, argv + argc );
+    for( std::string& path : paths )
+    {
+        std::replace( path.begin(), path.end(), '\\', '/' );
+    }
+    std::sort( paths.begin(), paths.end() );
+    paths.erase( std::unique( paths.begin(), paths.end() ), paths.end() );
+
+    FILE* output = fopen( argv[ 1 ], "w" );
+    if( output == nullptr )
+    {
+        printf( "Could not open %s!\n", argv[ 1 ] );
+        return 1;
+    }
+
+    fprintf( output, "// Generated by AssetBundler, do not edit\n\n" );
+    fprintf( output, "#include <SDL.h>\n\n" );
+    fprintf( output, "#include \"AssetBundle.hpp\"\n\n" );
+
+    bool success = true;
+    long totalSize = 0;
+    std::vector<size_t> sizes;
+    for( int i = 0; i < int( paths.size() ) && success; ++i )
+    {
+        std::vector<unsigned char> data;
+        if( !readFile( paths[ i ], data ) )
+        {
+            success = false;
+            break;
+        }
+        sizes.push_back( data.size() );
+        totalSize += data.size();
+
+        fprintf( output, "// %s\n", paths[ i ].c_str() );
+        fprintf( output, "static const Uint8 AB_DATA_%d[] = {", i );
+        for( size_t byte = 0; byte < data.size(); ++byte )
+        {
+            fprintf( output, byte % BYTES_PER_LINE == 0 ? "\n    %u," : "%u,", data[ byte ] );
+        }
+        // Empty files still need one element
+        fprintf( output, data.empty() ? "\n    0\n};\n\n" : "\n};\n\n" );
+    }
+
+    if( success )
+    {
+        fprintf( output, "const BundledAsset AB_ASSETS[] = {\n" );
+        for( int i = 0; i < int( paths.size() ); ++i )
+        {
+            fprintf( output, "    { \"%s\", AB_DATA_%d, %d },\n", paths[ i ].c_str(), i, int( sizes[ i ] ) );
+        }
+        fprintf( output, "};\n\n" );
+        fprintf( output, "const int AB_NUM_ASSETS = %d;\n", int( paths.size() ) );
+
+        success = ferror( output ) == 0;
+    }
+
+    fclose( output );
+
+    if( !success )
+    {
+        printf( "Could not generate %s!\n", argv[ 1 ] );
+        remove( argv[ 1 ] );
+        return 1;
+    }
+
+    printf( "Bundled %d assets ( %ld bytes ) into %s\n", int( paths.size() ), totalSize, argv[ 1 ] );
+
+    return 0;
+}
+
+// Reads whole file into data. Returns whether file could be read
+bool readFile( const std::string& path, std::vector<unsigned char>& data )
+{
+    FILE* file = fopen( path.c_str(), "rb" );
+    if( file == nullptr )
+    {
+        printf( "Could not open asset %s!\n", path.c_str() );
+        return false;
+    }
+
+    unsigned char buffer[ 4096 ];
+    size_t read = 0;
+    while( ( read = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+    {
+        data.insert( data.end(), buffer, buffer + read );
+    }
+
+    bool success = ferror( file ) == 0;
+    fclose( file );
+    if( !success )
+    {
+        printf( "Could not read asset %s!\n", path.c_str() );
+    }
+
+    return success;
+}
@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "AtlasPacker.hpp"
+
+// Part of the skyline: the atlas is filled up to height y between x and x + w
+struct AP_SkylineSegment{
+    int x, y, w;
+};
+
+// Gets height at which a w wide sprite rests on the skyline starting at segment index, or -1 if it does not fit
+static int AP_fitSkyline( const std::vector<AP_SkylineSegment>& skyline, const int index, const int w, const int width )
+{
+    if( skyline[ index ].x + w > width )
+    {
+        return -1;
+    }
+
+    int y = 0;
+    int widthLeft = w;
+    for( int i = index; widthLeft > 0; ++i )
+    {
+        if( i == int( skyline.size() ) )
+        {
+            return -1;
+        }
+        y = std::max( y, skyline[ i ].y );
+        widthLeft -= skyline[ i ].w;
+    }
+
+    return y;
+}
+
+AtlasPacker::AtlasPacker()
+{
+    mSheet = nullptr;
+
+    mWidth = 0; mHeight = 0;
+}
+
+AtlasPacker::~AtlasPacker()
+{
+    SDL_FreeSurface( mSheet );
+}
+
+bool AtlasPacker::loadSheet( const std::string& path )
+{
+    SDL_Surface* loadedSurface = IMG_Load( path.c_str() );
+    if( loadedSurface == nullptr )
+    {
+        printf( "Could not load sprite sheet %s! IMG_Error: %s\n", path.c_str(), IMG_GetError() );
+        return false;
+    }
+
+    SDL_FreeSurface( mSheet );
+    mSheet = SDL_ConvertSurfaceFormat( loadedSurface, SDL_PIXELFORMAT_RGBA32, 0 );
+    SDL_FreeSurface( loadedSurface );
+    if( mSheet == nullptr )
+    {
+        printf( "Could not convert sprite sheet %s! SDL_Error: %s\n", path.c_str(), SDL_GetError() );
+        return false;
+    }
+
+    mSheetPath = path;
+    mSprites.clear();
+
+    return true;
+}
+
+bool AtlasPacker::addSprite( const std::string& name, const SDL_Rect& source, const bool trim )
+{
+    if( mSheet == nullptr || source.x < 0 || source.y < 0 || source.w <= 0 || source.h <= 0 ||
+        source.x + source.w > mSheet->w || source.y + source.h > mSheet->h )
+    {
+        printf( "Sprite %s is outside of the sprite sheet!\n", name.c_str() );
+        return false;
+    }
+
+    AtlasSprite sprite;
+    sprite.name = name;
+    sprite.source = trim ? trimRect( source ) : source;
+    sprite.trim = trim;
+    sprite.clip = { 0, 0, sprite.source.w, sprite.source.h };
+    mSprites.push_back( sprite );
+
+    return true;
+}
+
+SDL_Rect AtlasPacker::trimRect( const SDL_Rect& source ) const
+{
+    int minX = source.x + source.w, minY = source.y + source.h;
+    int maxX = source.x - 1, maxY = source.y - 1;
+
+    SDL_LockSurface( mSheet );
+    const Uint8* pixels = static_cast<const Uint8*>( mSheet->pixels );
+    for( int y = source.y; y < source.y + source.h; ++y )
+    {
+        for( int x = source.x; x < source.x + source.w; ++x )
+        {
+            if( pixels[ y * mSheet->pitch + x * 4 + 3 ] != 0 )
+            {
+                minX = std::min( minX, x ); maxX = std::max( maxX, x );
+                minY = std::min( minY, y ); maxY = std::max( maxY, y );
+            }
+        }
+    }
+    SDL_UnlockSurface( mSheet );
+
+    // Fully transparent sprites keep a single pixel so they still get a clip
+    if( maxX < minX )
+    {
+        return { source.x, source.y, 1, 1 };
+    }
+
+    return { minX, minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+int AtlasPacker::packSkyline( const int width, const std::vector<int>& order, std::vector<SDL_Point>& positions ) const
+{
+    std::vector<AP_SkylineSegment> skyline( 1, AP_SkylineSegment{ 0, 0, width } );
+    positions.assign( mSprites.size(), SDL_Point{ 0, 0 } );
+
+    int height = 0;
+    for( int sprite : order )
+    {
+        const int w = mSprites[ sprite ].clip.w + PADDING;
+        const int h = mSprites[ sprite ].clip.h + PADDING;
+
+        // Find the lowest resting place, leftmost among equal ones
+        int bestIndex = -1, bestY = 0;
+        for( int i = 0; i < int( skyline.size() ); ++i )
+        {
+            int y = AP_fitSkyline( skyline, i, w, width );
+            if( y >= 0 && ( bestIndex < 0 || y < bestY ) )
+            {
+                bestIndex = i;
+                bestY = y;
+            }
+        }
+        if( bestIndex < 0 )
+        {
+            return -1;
+        }
+
+        const int x = skyline[ bestIndex ].x;
+        positions[ sprite ] = { x, bestY };
+        height = std::max( height, bestY + h );
+
+        // Raise the skyline under the sprite and cut the segments it covers
+        skyline.insert( skyline.begin() + bestIndex, AP_SkylineSegment{ x, bestY + h, w } );
+        for( int i = bestIndex + 1; i < int( skyline.size() ); )
+        {
+            int overlap = x + w - skyline[ i ].x;
+            if( overlap <= 0 )
+            {
+                break;
+            }
+
+            skyline[ i ].x += overlap;
+            skyline[ i ].w -= overlap;
+            if( skyline[ i ].w > 0 )
+            {
+                break;
+            }
+            skyline.erase( skyline.begin() + i );
+        }
+
+        // Merge neighbours of equal height
+        for( int i = 0; i + 1 < int( skyline.size() ); )
+        {
+            if( skyline[ i ].y == skyline[ i + 1 ].y )
+            {
+                skyline[ i ].w += skyline[ i + 1 ].w;
+                skyline.erase( skyline.begin() + i + 1 );
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    return height;
+}
+
+bool AtlasPacker::pack()
+{
+    if( mSprites.empty() )
+    {
+        printf( "No sprites to pack!\n" );
+        return false;
+    }
+
+    // Tall sprites first so short ones fill the gaps beside them
+    std::vector<int> order( mSprites.size() );
+    for( int i = 0; i < int( order.size() ); ++i )
+    {
+        order[ i ] = i;
+    }
+    std::stable_sort( order.begin(), order.end(), [ this ]( const int a, const int b )
+    {
+        const SDL_Rect& clipA = mSprites[ a ].clip;
+        const SDL_Rect& clipB = mSprites[ b ].clip;
+        return clipA.h != clipB.h ? clipA.h > clipB.h : clipA.w > clipB.w;
+    } );
+
+    // Try every power of two width and keep the smallest atlas
+    std::vector<SDL_Point> positions, bestPositions;
+    long bestArea = -1;
+    for( int width = MIN_ATLAS_WIDTH; width <= MAX_ATLAS_WIDTH; width *= 2 )
+    {
+        if( packSkyline( width, order, positions ) < 0 )
+        {
+            continue;
+        }
+
+        // Atlas ends at the rightmost and lowest sprite ( padding is only needed between sprites )
+        int usedWidth = 0, usedHeight = 0;
+        for( int i = 0; i < int( mSprites.size() ); ++i )
+        {
+            usedWidth = std::max( usedWidth, positions[ i ].x + mSprites[ i ].clip.w );
+            usedHeight = std::max( usedHeight, positions[ i ].y + mSprites[ i ].clip.h );
+        }
+
+        long area = long( usedWidth ) * usedHeight;
+        if( bestArea < 0 || area < bestArea )
+        {
+            bestArea = area;
+            bestPositions = positions;
+            mWidth = usedWidth;
+            mHeight = usedHeight;
+        }
+    }
+
+    if( bestArea < 0 )
+    {
+        printf( "Sprites do not fit into a %d pixel wide atlas!\n", MAX_ATLAS_WIDTH );
+        return false;
+    }
+
+    for( int i = 0; i < int( mSprites.size() ); ++i )
+    {
+        mSprites[ i ].clip.x = bestPositions[ i ].x;
+        mSprites[ i ].clip.y = bestPositions[ i ].y;
+    }
+
+    return true;
+}
+
+bool AtlasPacker::saveAtlas( const std::string& path ) const
+{
+    // New surfaces are cleared to transparent black
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat( 0, mWidth, mHeight, 32, SDL_PIXELFORMAT_RGBA32 );
+    if( atlas == nullptr )
+    {
+        printf( "Could not create atlas surface! SDL_Error: %s\n", SDL_GetError() );
+        return false;
+    }
+
+    SDL_LockSurface( mSheet );
+    SDL_LockSurface( atlas );
+    const Uint8* sheetPixels = static_cast<const Uint8*>( mSheet->pixels );
+    Uint8* atlasPixels = static_cast<Uint8*>( atlas->pixels );
+    for( const AtlasSprite& sprite : mSprites )
+    {
+        for( int row = 0; row < sprite.clip.h; ++row )
+        {
+            memcpy( atlasPixels + ( sprite.clip.y + row ) * atlas->pitch + sprite.clip.x * 4,
+                    sheetPixels + ( sprite.source.y + row ) * mSheet->pitch + sprite.source.x * 4, sprite.clip.w * 4 );
+        }
+    }
+    SDL_UnlockSurface( atlas );
+    SDL_UnlockSurface( mSheet );
+
+    bool success = IMG_SavePNG( atlas, path.c_str() ) == 0;
+    if( !success )
+    {
+        printf( "Could not save atlas %s! IMG_Error: %s\n", path.c_str(), IMG_GetError() );
+    }
+
+    SDL_FreeSurface( atlas );
+
+    return success;
+}
+
+bool AtlasPacker::writeClipTable( const std::string& path, const std::string& atlasPath ) const
+{
+    FILE* tableFile = fopen( path.c_str(), "w" );
+    if( tableFile == nullptr )
+    {
+        printf( "Could not open clip table %s!\n", path.c_str() );
+        return false;
+    }
+
+    // Include guard from the file name, e.g. SpriteAtlas.hpp gives _SPRITEATLAS_HPP_INCLUDED
+    std::string guard = path.substr( path.find_last_of( "/\\" ) + 1 );
+    for( char& c : guard )
+    {
+        c = isalnum( c ) ? toupper( c ) : '_';
+    }
+    guard = "_" + guard + "_INCLUDED";
+
+    fprintf( tableFile, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str() );
+    fprintf( tableFile, "// Generated by AtlasPacker from %s, do not edit\n\n", mSheetPath.c_str() );
+    fprintf( tableFile, "#include <SDL.h>\n\n" );
+
+    fprintf( tableFile, "// Texture holding every sprite of the game\n" );
+    fprintf( tableFile, "const char* const SPRITE_ATLAS_PATH = \"%s\";\n", atlasPath.c_str() );
+    fprintf( tableFile, "const int SPRITE_ATLAS_WIDTH = %d;\n", mWidth );
+    fprintf( tableFile, "const int SPRITE_ATLAS_HEIGHT = %d;\n\n", mHeight );
+
+    fprintf( tableFile, "// Sprites of the atlas\n" );
+    fprintf( tableFile, "enum SpriteId{\n" );
+    for( const AtlasSprite& sprite : mSprites )
+    {
+        fprintf( tableFile, "    SPRITE_%s,\n", sprite.name.c_str() );
+    }
+    fprintf( tableFile, "    SPRITE_TOTAL\n};\n\n" );
+
+    fprintf( tableFile, "// Clip rectangles of the sprites in the atlas ( indexed by SpriteId )\n" );
+    fprintf( tableFile, "constexpr SDL_Rect SPRITE_CLIPS[ SPRITE_TOTAL ] = {\n" );
+    for( const AtlasSprite& sprite : mSprites )
+    {
+        fprintf( tableFile, "    { %d, %d, %d, %d }, // SPRITE_%s\n", sprite.clip.x, sprite.clip.y, sprite.clip.w, sprite.clip.h,
+                 sprite.name.c_str() );
+    }
+    fprintf( tableFile, "};\n\n" );
+
+    fprintf( tableFile, "#endif // %s\n", guard.c_str() );
+
+    bool success = ferror( tableFile ) == 0;
+    fclose( tableFile );
+    if( !success )
+    {
+        printf( "Could not write clip table %s!\n", path.c_str() );
+    }
+
+    return success;
+}
+
+int AtlasPacker::getWidth() const
+{
+    return mWidth;
+}
+
+int AtlasPacker::getHeight() const
+{
+    return mHeight;
+}
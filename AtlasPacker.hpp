@@ -0,0 +1,79 @@
+#ifndef _ATLASPACKER_HPP_INCLUDED
+#define _ATLASPACKER_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+// Sprite cut from the source sheet
+struct AtlasSprite{
+    // Name used for the generated SPRITE_ constant
+    std::string name;
+    // Rectangle of the sprite in the source sheet
+    SDL_Rect source;
+    // Whether fully transparent border rows and columns are cut off ( frames of one animation must keep their size )
+    bool trim;
+    // Rectangle of the sprite in the packed atlas
+    SDL_Rect clip;
+};
+
+// Build tool that copies only the used sprites of a sprite sheet into a tight atlas and generates a header with a
+// constexpr table of their clip rectangles, so the game loads a small texture and has one source of truth for clips
+class AtlasPacker{
+
+public:
+
+    // Transparent pixels between packed sprites so filtering never samples a neighbour
+    static const int PADDING = 1;
+
+    // Atlas widths tried while packing
+    static const int MIN_ATLAS_WIDTH = 64;
+    static const int MAX_ATLAS_WIDTH = 4096;
+
+    // Initializes internal variables
+    AtlasPacker();
+
+    // Frees source sheet
+    ~AtlasPacker();
+
+    // Loads source sprite sheet. Returns whether it was loaded
+    bool loadSheet( const std::string& path );
+
+    // Adds sprite at source rectangle of the sheet. Returns false if it is outside of the sheet
+    bool addSprite( const std::string& name, const SDL_Rect& source, const bool trim = true );
+
+    // Places sprites in the atlas width that gives the smallest area. Returns whether all sprites fit
+    bool pack();
+
+    // Saves packed atlas as PNG. Returns whether it was saved
+    bool saveAtlas( const std::string& path ) const;
+
+    // Writes header declaring the atlas path and clip rectangles. Returns whether it was written
+    bool writeClipTable( const std::string& path, const std::string& atlasPath ) const;
+
+    // Packed atlas dimensions
+    int getWidth() const;
+    int getHeight() const;
+
+private:
+
+    // Gets smallest rectangle within source that holds every non transparent pixel of it
+    SDL_Rect trimRect( const SDL_Rect& source ) const;
+
+    // Places sprites ( in order ) with a bottom-left skyline into an atlas of given width. Returns used height or -1 if a
+    // sprite is wider than the atlas
+    int packSkyline( const int width, const std::vector<int>& order, std::vector<SDL_Point>& positions ) const;
+
+    // Source sheet in RGBA32 format
+    SDL_Surface* mSheet;
+    std::string mSheetPath;
+
+    // Sprites in the order they were added
+    std::vector<AtlasSprite> mSprites;
+
+    // Atlas dimensions
+    int mWidth, mHeight;
+};
+
+#endif // _ATLASPACKER_HPP_INCLUDED
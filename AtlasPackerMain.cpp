@@ -0,0 +1,76 @@
+#include <cstdio>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "AtlasPacker.hpp"
+
+// Default input and outputs, relative to the project directory
+const std::string DEFAULT_SHEET_PATH = "assets/sprite_sheet.png";
+const std::string DEFAULT_ATLAS_PATH = "assets/sprite_atlas.png";
+const std::string DEFAULT_TABLE_PATH = "SpriteAtlas.hpp";
+
+// Sprites used by the game and where they are in the sprite sheet. Bird frames are not trimmed so the animation and the
+// collision masks built from it keep one size
+struct SheetSprite{
+    const char* name;
+    SDL_Rect source;
+    bool trim;
+};
+
+const SheetSprite SHEET_SPRITES[] = {
+    { "BACKGROUND", { 0, 0, 288, 512 }, true },
+    { "PIPE_TOP", { 112, 645, 52, 321 }, true },
+    { "PIPE_BOTTOM", { 168, 646, 52, 320 }, true },
+    { "BIRD_NEUTRAL", { 62, 982, 34, 24 }, false },
+    { "BIRD_UP", { 6, 982, 34, 24 }, false },
+    { "BIRD_DOWN", { 118, 982, 34, 24 }, false },
+    { "DIGIT_0", { 992, 120, 25, 36 }, true },
+    { "DIGIT_1", { 272, 910, 16, 36 }, true },
+    { "DIGIT_2", { 584, 320, 24, 36 }, true },
+    { "DIGIT_3", { 612, 320, 24, 36 }, true },
+    { "DIGIT_4", { 640, 320, 24, 36 }, true },
+    { "DIGIT_5", { 668, 320, 24, 36 }, true },
+    { "DIGIT_6", { 584, 368, 24, 36 }, true },
+    { "DIGIT_7", { 612, 368, 24, 36 }, true },
+    { "DIGIT_8", { 640, 368, 24, 36 }, true },
+    { "DIGIT_9", { 668, 368, 24, 36 }, true }
+};
+
+int main( int argc, char** argv )
+{
+    if( argc > 1 && argv[ 1 ][ 0 ] == '-' )
+    {
+        printf( "Usage: AtlasPacker [spriteSheet] [atlas] [clipTable]\n" );
+        return 1;
+    }
+
+    std::string sheetPath = argc >= 2 ? argv[ 1 ] : DEFAULT_SHEET_PATH;
+    std::string atlasPath = argc >= 3 ? argv[ 2 ] : DEFAULT_ATLAS_PATH;
+    std::string tablePath = argc >= 4 ? argv[ 3 ] : DEFAULT_TABLE_PATH;
+
+    if( ( IMG_Init( IMG_INIT_PNG ) & IMG_INIT_PNG ) != IMG_INIT_PNG )
+    {
+        printf( "Could not initialize PNG loading! IMG_Error: %s\n", IMG_GetError() );
+        return 1;
+    }
+
+    AtlasPacker packer;
+    bool success = packer.loadSheet( sheetPath );
+    for( const SheetSprite& sprite : SHEET_SPRITES )
+    {
+        success = success && packer.addSprite( sprite.name, sprite.source, sprite.trim );
+    }
+    success = success && packer.pack() && packer.saveAtlas( atlasPath ) && packer.writeClipTable( tablePath, atlasPath );
+
+    if( success )
+    {
+        printf( "Packed %d sprites into %dx%d atlas %s\n", int( sizeof( SHEET_SPRITES ) / sizeof( SHEET_SPRITES[ 0 ] ) ),
+                packer.getWidth(), packer.getHeight(), atlasPath.c_str() );
+    }
+
+    IMG_Quit();
+
+    return success ? 0 : 1;
+}
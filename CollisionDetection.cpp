@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>
+
 #include <SDL.h>
 
 #include "CollisionDetection.hpp"
@@ -31,3 +34,126 @@ bool CD_checkCollision( const SDL_Rect& a, const SDL_Rect& b )
     // If there is collision
     return true;
 }
+
+// Appends roots of ( a / 2 ) * t^2 + b * t + c = 0 that lie strictly inside ( tMin, tMax ) to roots
+static void CD_addRoots( double a, double b, double c, double tMin, double tMax, double* roots, int& numRoots )
+{
+    double found[ 2 ];
+    int numFound = 0;
+
+    // Equation is linear
+    if( std::fabs( a ) < 1e-9 )
+    {
+        if( std::fabs( b ) > 1e-9 )
+        {
+            found[ numFound++ ] = -c / b;
+        }
+    }
+    else
+    {
+        double discriminant = b * b - 2 * a * c;
+        if( discriminant >= 0 )
+        {
+            double sqrtDiscriminant = std::sqrt( discriminant );
+            found[ numFound++ ] = ( -b - sqrtDiscriminant ) / a;
+            found[ numFound++ ] = ( -b + sqrtDiscriminant ) / a;
+        }
+    }
+
+    for( int i = 0; i < numFound; ++i )
+    {
+        if( found[ i ] > tMin && found[ i ] < tMax )
+        {
+            roots[ numRoots++ ] = found[ i ];
+        }
+    }
+}
+
+bool CD_checkSweptCollision( double posX, double posY, int w, int h, double velX, double velY, double accelY, double duration, const SDL_Rect& b, double* timeOfImpact )
+{
+    // Time interval in which the rectangles overlap on the X axis ( movement along X is linear )
+    double enterX = 0.0, exitX = duration;
+    if( std::fabs( velX ) < 1e-9 )
+    {
+        // If rectangles never overlap on the X axis
+        if( posX + w <= b.x || b.x + b.w <= posX )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        double tEnter = ( b.x - w - posX ) / velX;
+        double tExit = ( b.x + b.w - posX ) / velX;
+        if( tEnter > tExit )
+        {
+            std::swap( tEnter, tExit );
+        }
+        enterX = std::max( enterX, tEnter );
+        exitX = std::min( exitX, tExit );
+    }
+
+    if( enterX >= exitX )
+    {
+        return false;
+    }
+
+    // Quick reject: vertical span of the path while the rectangles overlap on the X axis ( ends and top of the parabola )
+    double enterY = posY + velY * enterX + ( accelY * enterX * enterX ) / 2;
+    double exitY = posY + velY * exitX + ( accelY * exitX * exitX ) / 2;
+    double minY = std::min( enterY, exitY ), maxY = std::max( enterY, exitY );
+    if( std::fabs( accelY ) > 1e-9 )
+    {
+        double tTurn = -velY / accelY;
+        if( tTurn > enterX && tTurn < exitX )
+        {
+            double turnY = posY + velY * tTurn + ( accelY * tTurn * tTurn ) / 2;
+            minY = std::min( minY, turnY );
+            maxY = std::max( maxY, turnY );
+        }
+    }
+    if( maxY + h <= b.y || minY >= b.y + b.h )
+    {
+        return false;
+    }
+
+    // Y overlap can only start or stop where the top of a crosses the bottom of b or the bottom of a crosses the top of b
+    double candidates[ 6 ];
+    int numCandidates = 0;
+    candidates[ numCandidates++ ] = enterX;
+    CD_addRoots( accelY, velY, posY + h - b.y, enterX, exitX, candidates, numCandidates );
+    CD_addRoots( accelY, velY, posY - ( b.y + b.h ), enterX, exitX, candidates, numCandidates );
+    candidates[ numCandidates++ ] = exitX;
+
+    // Sort candidates ( there are at most six of them )
+    for( int i = 1; i < numCandidates; ++i )
+    {
+        for( int j = i; j > 0 && candidates[ j ] < candidates[ j - 1 ]; --j )
+        {
+            std::swap( candidates[ j ], candidates[ j - 1 ] );
+        }
+    }
+
+    // Y overlap is constant between consecutive candidates so sampling the middle of each span is enough
+    for( int i = 0; i + 1 < numCandidates; ++i )
+    {
+        if( candidates[ i + 1 ] <= candidates[ i ] )
+        {
+            continue;
+        }
+
+        double t = ( candidates[ i ] + candidates[ i + 1 ] ) / 2;
+        double y = posY + velY * t + ( accelY * t * t ) / 2;
+        if( y + h > b.y && y < b.y + b.h )
+        {
+            if( timeOfImpact != nullptr )
+            {
+                *timeOfImpact = candidates[ i ];
+            }
+            return true;
+        }
+    }
+
+    // If there is no collision
+    return false;
+}
@@ -5,5 +5,10 @@
 
 bool CD_checkCollision( const SDL_Rect& a, const SDL_Rect& b );
 
+// Checks collision of a w x h rectangle starting at ( posX, posY ) and moving along a parabolic path ( velocities in px/s, vertical
+// acceleration in px/s^2 ) for given duration ( in seconds ) with static rectangle b. If there is collision and timeOfImpact is
+// provided it is set to the earliest moment of contact ( in seconds from the start of the movement )
+bool CD_checkSweptCollision( double posX, double posY, int w, int h, double velX, double velY, double accelY, double duration, const SDL_Rect& b, double* timeOfImpact = nullptr );
+
 
 #endif // _COLLISIONDETECTION_HPP_INCLUDED
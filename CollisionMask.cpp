@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <SDL.h>
+
+#include "CollisionMask.hpp"
+
+// Alpha value from which a pixel is considered opaque
+static const Uint8 CM_ALPHA_THRESHOLD = 128;
+
+CollisionMask::CollisionMask()
+{
+    mBounds = { 0, 0, 0, 0 };
+}
+
+bool CollisionMask::build( SDL_Surface* surface, const SDL_Rect& clip, const int stretchW, const int stretchH, const double angle )
+{
+    mBounds = { 0, 0, 0, 0 };
+    mRows.clear();
+
+    double radians = angle * M_PI / 180.0;
+    double cosAngle = std::cos( radians );
+    double sinAngle = std::sin( radians );
+
+    // Center of rotation and the box containing the rotated stretch rect
+    double centerX = stretchW / 2.0;
+    double centerY = stretchH / 2.0;
+    double extentX = ( std::fabs( cosAngle ) * stretchW + std::fabs( sinAngle ) * stretchH ) / 2.0;
+    double extentY = ( std::fabs( sinAngle ) * stretchW + std::fabs( cosAngle ) * stretchH ) / 2.0;
+    int boxX = std::floor( centerX - extentX );
+    int boxY = std::floor( centerY - extentY );
+    int boxW = std::ceil( centerX + extentX ) - boxX;
+    int boxH = std::ceil( centerY + extentY ) - boxY;
+
+    // Sample the clip for every pixel of the rotated box
+    std::vector<bool> opaque( boxW * boxH, false );
+    int minX = boxW, minY = boxH, maxX = -1, maxY = -1;
+
+    SDL_LockSurface( surface );
+    const Uint8* pixels = static_cast<const Uint8*>( surface->pixels );
+    for( int y = 0; y < boxH; ++y )
+    {
+        for( int x = 0; x < boxW; ++x )
+        {
+            // Rotate the pixel center back into the stretch rect
+            double dx = boxX + x + 0.5 - centerX;
+            double dy = boxY + y + 0.5 - centerY;
+            double srcX = cosAngle * dx + sinAngle * dy + centerX;
+            double srcY = -sinAngle * dx + cosAngle * dy + centerY;
+            if( srcX < 0 || srcY < 0 || srcX >= stretchW || srcY >= stretchH )
+            {
+                continue;
+            }
+
+            int texelX = clip.x + int( srcX * clip.w / stretchW );
+            int texelY = clip.y + int( srcY * clip.h / stretchH );
+            // RGBA32 stores alpha in the fourth byte of each pixel
+            if( pixels[ texelY * surface->pitch + texelX * 4 + 3 ] >= CM_ALPHA_THRESHOLD )
+            {
+                opaque[ y * boxW + x ] = true;
+                minX = std::min( minX, x ); maxX = std::max( maxX, x );
+                minY = std::min( minY, y ); maxY = std::max( maxY, y );
+            }
+        }
+    }
+    SDL_UnlockSurface( surface );
+
+    // If the clip has no opaque pixels
+    if( maxX < 0 )
+    {
+        return false;
+    }
+
+    mBounds.x = boxX + minX;
+    mBounds.y = boxY + minY;
+    mBounds.w = std::min( maxX - minX + 1, int( MAX_WIDTH ) );
+    mBounds.h = maxY - minY + 1;
+
+    mRows.assign( mBounds.h * WORDS_PER_ROW, 0 );
+    for( int y = 0; y < mBounds.h; ++y )
+    {
+        for( int x = 0; x < mBounds.w; ++x )
+        {
+            if( opaque[ ( minY + y ) * boxW + minX + x ] )
+            {
+                mRows[ y * WORDS_PER_ROW + x / 64 ] |= Uint64( 1 ) << ( x % 64 );
+            }
+        }
+    }
+
+    return true;
+}
+
+bool CollisionMask::checkCollision( const int x, const int y, const SDL_Rect& rect ) const
+{
+    // Intersection of the mask bounding box and rect ( relative to the bounding box )
+    int left = std::max( rect.x - ( x + mBounds.x ), 0 );
+    int right = std::min( rect.x + rect.w - ( x + mBounds.x ), mBounds.w );
+    int top = std::max( rect.y - ( y + mBounds.y ), 0 );
+    int bottom = std::min( rect.y + rect.h - ( y + mBounds.y ), mBounds.h );
+
+    // If bounding boxes do not overlap
+    if( left >= right || top >= bottom )
+    {
+        return false;
+    }
+
+    // Bits of each word that lie in columns [ left, right )
+    Uint64 columnMasks[ WORDS_PER_ROW ];
+    for( int i = 0; i < WORDS_PER_ROW; ++i )
+    {
+        int wordLeft = std::max( left - i * 64, 0 );
+        int wordRight = std::min( right - i * 64, 64 );
+        if( wordLeft >= wordRight )
+        {
+            columnMasks[ i ] = 0;
+        }
+        else
+        {
+            Uint64 upToRight = wordRight == 64 ? ~Uint64( 0 ) : ( Uint64( 1 ) << wordRight ) - 1;
+            columnMasks[ i ] = upToRight & ~( ( Uint64( 1 ) << wordLeft ) - 1 );
+        }
+    }
+
+    for( int row = top; row < bottom; ++row )
+    {
+        const Uint64* words = &mRows[ row * WORDS_PER_ROW ];
+        for( int i = 0; i < WORDS_PER_ROW; ++i )
+        {
+            if( words[ i ] & columnMasks[ i ] )
+            {
+                return true;
+            }
+        }
+    }
+
+    // If no opaque pixel is inside rect
+    return false;
+}
+
+SDL_Rect CollisionMask::getBounds() const
+{
+    return mBounds;
+}
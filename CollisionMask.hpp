@@ -0,0 +1,41 @@
+#ifndef _COLLISIONMASK_HPP_INCLUDED
+#define _COLLISIONMASK_HPP_INCLUDED
+
+#include <vector>
+
+#include <SDL.h>
+
+class CollisionMask{
+
+public:
+
+    // Maximum width ( in pixels ) of a mask, each row is stored in WORDS_PER_ROW 64 bit words
+    static const int WORDS_PER_ROW = 2;
+    static const int MAX_WIDTH = WORDS_PER_ROW * 64;
+
+    // Initializes internal variables
+    CollisionMask();
+
+    // Deallocates memory
+    ~CollisionMask() = default;
+
+    // Builds mask from the alpha channel of clip in given RGBA32 surface, stretched to stretchW x stretchH and rotated clockwise
+    // by angle ( in degrees ) around its center ( the same way SDL_RenderCopyEx does it ). Returns whether the mask is not empty
+    bool build( SDL_Surface* surface, const SDL_Rect& clip, const int stretchW, const int stretchH, const double angle );
+
+    // Checks whether any opaque pixel of the mask overlaps rect when the stretch rect is placed at ( x, y )
+    bool checkCollision( const int x, const int y, const SDL_Rect& rect ) const;
+
+    // Gets the tight bounding box of the opaque pixels relative to the top left corner of the stretch rect
+    SDL_Rect getBounds() const;
+
+private:
+
+    // Bounding box of the opaque pixels relative to the top left corner of the stretch rect
+    SDL_Rect mBounds;
+
+    // Bit rows of the mask ( bit i of word j is column j * 64 + i of the bounding box )
+    std::vector<Uint64> mRows;
+};
+
+#endif // _COLLISIONMASK_HPP_INCLUDED
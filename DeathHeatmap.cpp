@@ -0,0 +1,357 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "DeathHeatmap.hpp"
+#include "HeadlessGame.hpp"
+#include "ReferenceBot.hpp"
+
+// Distance ( in pixels ) within which the bird counts as touching the side of a pipe or the ground
+static const double DH_SIDE_TOLERANCE = 0.5;
+
+// Opacity of the pipes drawn over the heatmap
+static const int DH_PIPE_ALPHA = 96;
+
+// Longest flap free fall simulated after the last flap of a replay ( in seconds ), enough to hit the ground from the top
+static const double DH_FINAL_FALL_TIME = 10.0;
+
+// Longest single headless step ( in seconds ), short enough that the generated level always reaches past the player
+static const double DH_MAX_STEP = 0.25;
+
+// Draws flap margin of a bot episode from its index
+static int DH_flapMargin( const int episode )
+{
+    Uint32 hash = Uint32( episode ) * 2654435761u;
+    hash ^= hash >> 16;
+    return int( hash % ( DeathHeatmap::MAX_FLAP_MARGIN + 1 ) );
+}
+
+// Moves game for duration ( in seconds ) in steps of at most DH_MAX_STEP, flapping at the start if requested
+static void DH_move( HeadlessGame& game, const LevelGenerator& generator, bool flap, double duration )
+{
+    do
+    {
+        const double step = std::min( duration, DH_MAX_STEP );
+        game.step( generator, flap, step );
+        flap = false;
+        duration -= step;
+    } while( duration > 0.0 && game.isAlive() );
+}
+
+// Maps value from 0 to 1 to a black, red, yellow and white ramp
+static void DH_heatColor( const double value, Uint8& r, Uint8& g, Uint8& b )
+{
+    r = Uint8( std::min( std::max( value * 3.0, 0.0 ), 1.0 ) * 255 );
+    g = Uint8( std::min( std::max( value * 3.0 - 1.0, 0.0 ), 1.0 ) * 255 );
+    b = Uint8( std::min( std::max( value * 3.0 - 2.0, 0.0 ), 1.0 ) * 255 );
+}
+
+DeathHeatmap::DeathHeatmap()
+{
+    clearHistogram( mHistogram );
+
+    mNextEpisode = 0;
+}
+
+void DeathHeatmap::addBotEpisodes( const LevelGenerator& generator, const int firstSeed, const int numEpisodes, unsigned numThreads )
+{
+    if( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    mNextEpisode = 0;
+
+    std::vector<std::thread> threads;
+    for( unsigned i = 1; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( &DeathHeatmap::playBotEpisodes, this, generator, firstSeed, numEpisodes ) );
+    }
+    playBotEpisodes( generator, firstSeed, numEpisodes );
+
+    for( std::thread& thread : threads )
+    {
+        thread.join();
+    }
+}
+
+void DeathHeatmap::addReplays( const LevelGenerator& generator, const std::vector<ReplayRun>& runs, unsigned numThreads )
+{
+    if( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    mNextEpisode = 0;
+
+    std::vector<std::thread> threads;
+    for( unsigned i = 1; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( &DeathHeatmap::playReplays, this, generator, std::cref( runs ) ) );
+    }
+    playReplays( generator, runs );
+
+    for( std::thread& thread : threads )
+    {
+        thread.join();
+    }
+}
+
+void DeathHeatmap::playBotEpisodes( LevelGenerator generator, const int firstSeed, const int numEpisodes )
+{
+    DeathHistogram histogram;
+    clearHistogram( histogram );
+
+    std::vector<Pipe> level;
+    level.reserve( NUM_OBSTACLES );
+
+    int chunkStart;
+    while( ( chunkStart = mNextEpisode.fetch_add( CHUNK_SIZE ) ) < numEpisodes )
+    {
+        int chunkEnd = std::min( chunkStart + CHUNK_SIZE, numEpisodes );
+        for( int episode = chunkStart; episode < chunkEnd; ++episode )
+        {
+            ReferenceBot bot( DH_flapMargin( episode ) );
+
+            // Play the start of the level and only generate more if the bot got to its last pipe, where it decides
+            // without seeing the following one
+            int numPipes = std::min( int( EPISODE_PIPES ), NUM_OBSTACLES );
+            int deathPipe;
+            while( true )
+            {
+                generator.generate( firstSeed + episode, level, numPipes );
+                deathPipe = bot.play( level );
+                if( deathPipe < numPipes - 1 || numPipes == NUM_OBSTACLES )
+                {
+                    break;
+                }
+                numPipes = std::min( numPipes * 2, NUM_OBSTACLES );
+            }
+
+            ++histogram.numEpisodes;
+            if( deathPipe == NUM_OBSTACLES )
+            {
+                ++histogram.numSurvived;
+            }
+            else
+            {
+                addDeath( histogram, level[ deathPipe ], bot.getDeathX(), bot.getDeathY() );
+            }
+        }
+    }
+
+    merge( histogram );
+}
+
+void DeathHeatmap::playReplays( LevelGenerator generator, const std::vector<ReplayRun>& runs )
+{
+    DeathHistogram histogram;
+    clearHistogram( histogram );
+
+    HeadlessGame game;
+
+    int index;
+    while( ( index = mNextEpisode.fetch_add( 1 ) ) < int( runs.size() ) )
+    {
+        const ReplayRun& run = runs[ index ];
+        game.reset( generator, run.seed );
+
+        // Move from flap to flap, then fall until the bird dies
+        Uint32 time = 0;
+        for( size_t i = 0; i < run.flapTimes.size() && game.isAlive(); ++i )
+        {
+            DH_move( game, generator, i > 0, ( run.flapTimes[ i ] - std::min( time, run.flapTimes[ i ] ) ) / 1000.0 );
+            time = run.flapTimes[ i ];
+        }
+        if( game.isAlive() )
+        {
+            DH_move( game, generator, !run.flapTimes.empty(), DH_FINAL_FALL_TIME );
+        }
+
+        ++histogram.numEpisodes;
+        if( game.isAlive() || game.isFinished() )
+        {
+            ++histogram.numSurvived;
+        }
+        else
+        {
+            const std::vector<Pipe>& level = game.getLevel();
+            addDeath( histogram, level[ std::min( game.getNextPipe(), int( level.size() ) - 1 ) ], game.getPosX(), game.getPosY() );
+        }
+    }
+
+    merge( histogram );
+}
+
+void DeathHeatmap::clearHistogram( DeathHistogram& histogram )
+{
+    histogram.bins.assign( NUM_BINS_X * NUM_BINS_Y, 0 );
+    std::fill( histogram.causes, histogram.causes + DEATH_TOTAL, 0 );
+    histogram.numEpisodes = 0;
+    histogram.numSurvived = 0;
+}
+
+void DeathHeatmap::addDeath( DeathHistogram& histogram, const Pipe& pipe, const double deathX, const double deathY )
+{
+    const SDL_Rect topRect = pipe.getTopRect();
+    const SDL_Rect botRect = pipe.getBotRect();
+
+    // Center of the bird relative to the left side of the pipe and the center of its gap
+    const double gapCenterY = ( topRect.y + topRect.h + botRect.y ) / 2.0;
+    const double relX = deathX + PLAYER_WIDTH / 2.0 - topRect.x;
+    const double relY = deathY + PLAYER_HEIGHT / 2.0 - gapCenterY;
+
+    DeathCause cause;
+    const bool side = deathX + PLAYER_WIDTH <= topRect.x + DH_SIDE_TOLERANCE;
+    if( deathY + PLAYER_HEIGHT >= SCREEN_HEIGHT - DH_SIDE_TOLERANCE )
+    {
+        cause = DEATH_GROUND;
+    }
+    else if( relY < 0 )
+    {
+        cause = side ? DEATH_TOP_PIPE_SIDE : DEATH_TOP_PIPE_BOTTOM;
+    }
+    else
+    {
+        cause = side ? DEATH_BOTTOM_PIPE_SIDE : DEATH_BOTTOM_PIPE_TOP;
+    }
+    ++histogram.causes[ cause ];
+
+    int binX = std::min( std::max( int( std::floor( ( relX - MIN_X ) / BIN_SIZE ) ), 0 ), NUM_BINS_X - 1 );
+    int binY = std::min( std::max( int( std::floor( ( relY - MIN_Y ) / BIN_SIZE ) ), 0 ), NUM_BINS_Y - 1 );
+    ++histogram.bins[ binY * NUM_BINS_X + binX ];
+}
+
+void DeathHeatmap::merge( const DeathHistogram& histogram )
+{
+    std::lock_guard<std::mutex> lock( mMergeMutex );
+
+    for( size_t i = 0; i < mHistogram.bins.size(); ++i )
+    {
+        mHistogram.bins[ i ] += histogram.bins[ i ];
+    }
+    for( int i = 0; i < DEATH_TOTAL; ++i )
+    {
+        mHistogram.causes[ i ] += histogram.causes[ i ];
+    }
+    mHistogram.numEpisodes += histogram.numEpisodes;
+    mHistogram.numSurvived += histogram.numSurvived;
+}
+
+bool DeathHeatmap::writeImage( const std::string& path ) const
+{
+    const int width = NUM_BINS_X * PIXELS_PER_BIN;
+    const int height = NUM_BINS_Y * PIXELS_PER_BIN;
+    SDL_Surface* image = SDL_CreateRGBSurfaceWithFormat( 0, width, height, 32, SDL_PIXELFORMAT_RGBA32 );
+    if( image == nullptr )
+    {
+        printf( "Could not create heatmap surface! SDL_Error: %s\n", SDL_GetError() );
+        return false;
+    }
+
+    const Uint64 maxCount = *std::max_element( mHistogram.bins.begin(), mHistogram.bins.end() );
+    const double logMax = std::log( 1.0 + maxCount );
+
+    SDL_LockSurface( image );
+    Uint8* pixels = static_cast<Uint8*>( image->pixels );
+    for( int y = 0; y < height; ++y )
+    {
+        for( int x = 0; x < width; ++x )
+        {
+            const int binX = x / PIXELS_PER_BIN, binY = y / PIXELS_PER_BIN;
+            const Uint64 count = mHistogram.bins[ binY * NUM_BINS_X + binX ];
+
+            Uint8 r, g, b;
+            DH_heatColor( logMax > 0 ? std::log( 1.0 + count ) / logMax : 0.0, r, g, b );
+
+            // Blend the pipes ( of the gap size every level uses ) over the deaths
+            const int relX = MIN_X + binX * BIN_SIZE;
+            const int relY = MIN_Y + binY * BIN_SIZE;
+            if( relX >= 0 && relX < BLOCK_WIDTH && ( relY < -PIPE_GAP / 2.0 || relY >= PIPE_GAP / 2.0 ) )
+            {
+                const SDL_Color pipeColor = Pipe::PIPE_COLOR;
+                r = Uint8( ( r * ( 255 - DH_PIPE_ALPHA ) + pipeColor.r * DH_PIPE_ALPHA ) / 255 );
+                g = Uint8( ( g * ( 255 - DH_PIPE_ALPHA ) + pipeColor.g * DH_PIPE_ALPHA ) / 255 );
+                b = Uint8( ( b * ( 255 - DH_PIPE_ALPHA ) + pipeColor.b * DH_PIPE_ALPHA ) / 255 );
+            }
+
+            Uint8* pixel = pixels + y * image->pitch + x * 4;
+            pixel[ 0 ] = r; pixel[ 1 ] = g; pixel[ 2 ] = b; pixel[ 3 ] = 0xff;
+        }
+    }
+    SDL_UnlockSurface( image );
+
+    bool success = IMG_SavePNG( image, path.c_str() ) == 0;
+    if( !success )
+    {
+        printf( "Could not save heatmap %s! IMG_Error: %s\n", path.c_str(), IMG_GetError() );
+    }
+
+    SDL_FreeSurface( image );
+
+    return success;
+}
+
+bool DeathHeatmap::writeCsv( const std::string& path ) const
+{
+    FILE* csvFile = fopen( path.c_str(), "w" );
+    if( csvFile == nullptr )
+    {
+        printf( "Could not open %s!\n", path.c_str() );
+        return false;
+    }
+
+    fprintf( csvFile, "relX,relY,count\n" );
+    for( int binY = 0; binY < NUM_BINS_Y; ++binY )
+    {
+        for( int binX = 0; binX < NUM_BINS_X; ++binX )
+        {
+            const Uint64 count = mHistogram.bins[ binY * NUM_BINS_X + binX ];
+            if( count > 0 )
+            {
+                fprintf( csvFile, "%d,%d,%llu\n", MIN_X + binX * BIN_SIZE + BIN_SIZE / 2, MIN_Y + binY * BIN_SIZE + BIN_SIZE / 2,
+                         static_cast<unsigned long long>( count ) );
+            }
+        }
+    }
+
+    bool success = ferror( csvFile ) == 0;
+    fclose( csvFile );
+    if( !success )
+    {
+        printf( "Could not write %s!\n", path.c_str() );
+    }
+
+    return success;
+}
+
+const DeathHistogram& DeathHeatmap::getHistogram() const
+{
+    return mHistogram;
+}
+
+const char* DeathHeatmap::getCauseName( const DeathCause cause )
+{
+    switch( cause )
+    {
+        case DEATH_TOP_PIPE_SIDE:
+            return "top pipe side";
+        case DEATH_TOP_PIPE_BOTTOM:
+            return "top pipe bottom";
+        case DEATH_BOTTOM_PIPE_SIDE:
+            return "bottom pipe side";
+        case DEATH_BOTTOM_PIPE_TOP:
+            return "bottom pipe top";
+        case DEATH_GROUND:
+            return "ground";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,117 @@
+#ifndef _DEATHHEATMAP_HPP_INCLUDED
+#define _DEATHHEATMAP_HPP_INCLUDED
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "ReplayLog.hpp"
+#include "constants.hpp"
+
+// Where a bird died relative to the pipe it hit
+enum DeathCause{
+    DEATH_TOP_PIPE_SIDE,
+    DEATH_TOP_PIPE_BOTTOM,
+    DEATH_BOTTOM_PIPE_SIDE,
+    DEATH_BOTTOM_PIPE_TOP,
+    DEATH_GROUND,
+    DEATH_TOTAL
+};
+
+// Deaths binned by the center of the bird relative to the pipe it died at: X from the left side of the pipe, Y from the
+// center of the gap
+struct DeathHistogram{
+    std::vector<Uint64> bins;
+    Uint64 causes[ DEATH_TOTAL ];
+    // Episodes played and episodes in which the bird passed the whole level
+    Uint64 numEpisodes;
+    Uint64 numSurvived;
+};
+
+// Analytics tool for tuning PIPE_GAP, GRAVITY and FLAP_HEIGHT. It plays bot episodes ( or replays logged runs ) in bulk
+// on all cores and bins every death into a pipe-relative 2D histogram. Every thread fills its own histogram, so the hot
+// loop never shares memory, and the histograms are merged once at the end
+class DeathHeatmap{
+
+public:
+
+    // Size of a histogram bin ( in pixels )
+    static const int BIN_SIZE = 4;
+
+    // Range covered by the histogram, from a pipe spacing before the pipe to a pipe spacing after its left side and a
+    // screen height above and below the gap center. Deaths outside are put into the border bins
+    static const int MIN_X = -PIPE_SPACING;
+    static const int MAX_X = PIPE_SPACING;
+    static const int MIN_Y = -SCREEN_HEIGHT;
+    static const int MAX_Y = SCREEN_HEIGHT;
+    static const int NUM_BINS_X = ( MAX_X - MIN_X ) / BIN_SIZE;
+    static const int NUM_BINS_Y = ( MAX_Y - MIN_Y ) / BIN_SIZE;
+
+    // Pixels per bin in the heatmap image
+    static const int PIXELS_PER_BIN = 2;
+
+    // Number of bot episodes a thread claims at once
+    static const int CHUNK_SIZE = 1024;
+
+    // Pipes generated for a bot episode at first. Levels are only generated further for the rare bot that gets past them
+    static const int EPISODE_PIPES = 32;
+
+    // Largest flap margin of the bots ( in pixels ). Each episode draws its own, which spreads where they die
+    static const int MAX_FLAP_MARGIN = BIRD_LENGTH / 2;
+
+    // Initializes internal variables
+    DeathHeatmap();
+
+    // Deallocates memory
+    ~DeathHeatmap() = default;
+
+    // Adds numEpisodes reference bot episodes: episode i plays the level of seed firstSeed + i. Uses one thread per core
+    // if numThreads is 0
+    void addBotEpisodes( const LevelGenerator& generator, const int firstSeed, const int numEpisodes, unsigned numThreads = 0 );
+
+    // Adds runs replayed headless at their recorded flap times
+    void addReplays( const LevelGenerator& generator, const std::vector<ReplayRun>& runs, unsigned numThreads = 0 );
+
+    // Saves histogram as PNG, log scaled from black through red and yellow to white, with the pipes drawn over it. Returns whether it was saved
+    bool writeImage( const std::string& path ) const;
+
+    // Writes every non empty bin as relX,relY,count ( bin centers in pixels ). Returns whether file was written
+    bool writeCsv( const std::string& path ) const;
+
+    // Gets merged histogram
+    const DeathHistogram& getHistogram() const;
+
+    // Gets name of a death cause
+    static const char* getCauseName( const DeathCause cause );
+
+private:
+
+    // Clears histogram
+    static void clearHistogram( DeathHistogram& histogram );
+
+    // Adds death of a bird at ( deathX, deathY ) at pipe to histogram
+    static void addDeath( DeathHistogram& histogram, const Pipe& pipe, const double deathX, const double deathY );
+
+    // Adds histogram to the merged one
+    void merge( const DeathHistogram& histogram );
+
+    // Claims and plays chunks of bot episodes until there are none left
+    void playBotEpisodes( LevelGenerator generator, const int firstSeed, const int numEpisodes );
+
+    // Claims and replays runs until there are none left
+    void playReplays( LevelGenerator generator, const std::vector<ReplayRun>& runs );
+
+    // Histogram of all finished episodes
+    DeathHistogram mHistogram;
+    std::mutex mMergeMutex;
+
+    // Index of the next episode to be claimed
+    std::atomic<int> mNextEpisode;
+};
+
+#endif // _DEATHHEATMAP_HPP_INCLUDED
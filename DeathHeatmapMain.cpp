@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "DeathHeatmap.hpp"
+#include "LevelGenerator.hpp"
+#include "ReplayLog.hpp"
+
+void printSummary( const DeathHeatmap& heatmap, const Uint32 time );
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    DeathHeatmap heatmap;
+    LevelGenerator generator;
+    std::string imagePath, csvPath;
+    Uint32 startTicks = SDL_GetTicks();
+
+    if( argc >= 5 && strcmp( argv[ 1 ], "--replays" ) == 0 )
+    {
+        ReplayLog replayLog;
+        if( !replayLog.load( argv[ 2 ] ) )
+        {
+            return 1;
+        }
+
+        imagePath = argv[ 3 ];
+        csvPath = argv[ 4 ];
+        unsigned numThreads = argc >= 6 ? atoi( argv[ 5 ] ) : 0;
+
+        heatmap.addReplays( generator, replayLog.getRuns(), numThreads );
+    }
+    else if( argc >= 5 && argv[ 1 ][ 0 ] != '-' )
+    {
+        int firstSeed = atoi( argv[ 1 ] );
+        int numEpisodes = atoi( argv[ 2 ] );
+        imagePath = argv[ 3 ];
+        csvPath = argv[ 4 ];
+        unsigned numThreads = argc >= 6 ? atoi( argv[ 5 ] ) : 0;
+
+        heatmap.addBotEpisodes( generator, firstSeed, numEpisodes, numThreads );
+    }
+    else
+    {
+        printUsage();
+        return 1;
+    }
+
+    printSummary( heatmap, SDL_GetTicks() - startTicks );
+
+    if( ( IMG_Init( IMG_INIT_PNG ) & IMG_INIT_PNG ) != IMG_INIT_PNG )
+    {
+        printf( "Could not initialize PNG saving! IMG_Error: %s\n", IMG_GetError() );
+        return 1;
+    }
+
+    bool success = heatmap.writeImage( imagePath ) && heatmap.writeCsv( csvPath );
+
+    IMG_Quit();
+
+    return success ? 0 : 1;
+}
+
+void printSummary( const DeathHeatmap& heatmap, const Uint32 time )
+{
+    const DeathHistogram& histogram = heatmap.getHistogram();
+    Uint64 numDeaths = histogram.numEpisodes - histogram.numSurvived;
+
+    printf( "Played %llu episodes in %u ms ( %llu survived the level )\n", static_cast<unsigned long long>( histogram.numEpisodes ),
+            time, static_cast<unsigned long long>( histogram.numSurvived ) );
+    for( int cause = 0; cause < DEATH_TOTAL; ++cause )
+    {
+        printf( "%-18s %12llu %6.2f%%\n", DeathHeatmap::getCauseName( DeathCause( cause ) ),
+                static_cast<unsigned long long>( histogram.causes[ cause ] ),
+                numDeaths > 0 ? 100.0 * histogram.causes[ cause ] / numDeaths : 0.0 );
+    }
+}
+
+void printUsage()
+{
+    printf( "Usage:\n" );
+    printf( "  DeathHeatmap <firstSeed> <numEpisodes> <image.png> <deaths.csv> [numThreads]\n" );
+    printf( "      plays reference bot episodes on consecutive seeds\n" );
+    printf( "  DeathHeatmap --replays <replayLog> <image.png> <deaths.csv> [numThreads]\n" );
+    printf( "      replays every run of the log\n" );
+}
@@ -0,0 +1,187 @@
+#ifndef _FIXEDPHYSICS_HPP_INCLUDED
+#define _FIXEDPHYSICS_HPP_INCLUDED
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL.h>
+
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Fixed-point physics. Builds defining FIXED_POINT_PHYSICS move the simulated player with integers only, so the same
+// inputs give the same bits on every compiler, optimization level and FPU. Every operation below rounds in one specified
+// way: products are shifted back with round half up, divisions truncate toward zero
+
+// Positions ( in pixels ), velocities ( in px/s ) and accelerations ( in px/s^2 ) with 12 fractional bits. Levels are
+// longer than 32768 pixels, so 16 fractional bits would leave too few integer bits for the X position
+typedef Sint32 Fixed;
+const int FIXED_FRACTION_BITS = 12;
+const Fixed FIXED_ONE = 1 << FIXED_FRACTION_BITS;
+
+// Durations ( in seconds ) with 20 fractional bits, fine enough for the step lengths in use to be off by under a microsecond
+typedef Sint32 FixedTime;
+const int FIXED_TIME_BITS = 20;
+
+// Rounding below relies on right shifts of negative numbers being arithmetic, as on every supported compiler
+static_assert( ( Sint64( -3 ) >> 1 ) == -2, "Fixed-point physics needs arithmetic right shifts" );
+
+// Divides value by 2^bits, rounding half up
+inline Sint64 FX_shiftRound( const Sint64 value, const int bits )
+{
+    return ( value + ( Sint64( 1 ) << ( bits - 1 ) ) ) >> bits;
+}
+
+// Converts value with given number of fractional bits, rounding half away from zero. Exact for constants and for values
+// that came from FX_toDouble
+constexpr Sint64 FX_fromDouble( const double value, const int bits = FIXED_FRACTION_BITS )
+{
+    return Sint64( value * double( Sint64( 1 ) << bits ) + ( value < 0.0 ? -0.5 : 0.5 ) );
+}
+
+inline FixedTime FX_toTime( const double seconds )
+{
+    return FixedTime( FX_fromDouble( seconds, FIXED_TIME_BITS ) );
+}
+
+// Converts value with given number of fractional bits to a double ( always exact )
+inline double FX_toDouble( const Sint64 value, const int bits = FIXED_FRACTION_BITS )
+{
+    return std::ldexp( double( value ), -bits );
+}
+
+// Constants of a physics profile in fixed point
+template<class Profile>
+struct FixedProfile{
+    static constexpr Fixed GRAVITY = Fixed( FX_fromDouble( Profile::GRAVITY ) );
+    static constexpr Fixed FLAP_HEIGHT = Profile::FLAP_HEIGHT * FIXED_ONE;
+    static constexpr Fixed CAMERA_VELOCITY = Profile::CAMERA_VELOCITY * FIXED_ONE;
+};
+
+template<class Profile> constexpr Fixed FixedProfile<Profile>::GRAVITY;
+template<class Profile> constexpr Fixed FixedProfile<Profile>::FLAP_HEIGHT;
+template<class Profile> constexpr Fixed FixedProfile<Profile>::CAMERA_VELOCITY;
+
+// Position and velocity of a falling player. Plain integers without branches in the step, so arrays of bodies stepped in a
+// loop map onto integer SIMD lanes
+struct FixedBody{
+    Fixed posX, posY;
+    Fixed velY;
+};
+
+// Vertical position after falling for time ( the same rounding as FX_move )
+template<class Profile>
+inline Fixed FX_moveY( const FixedBody& body, const FixedTime time )
+{
+    const Sint64 halfTimeSquared = FX_shiftRound( Sint64( time ) * time, FIXED_TIME_BITS + 1 );
+    return body.posY + Fixed( FX_shiftRound( Sint64( body.velY ) * time + Sint64( FixedProfile<Profile>::GRAVITY ) * halfTimeSquared,
+                                             FIXED_TIME_BITS ) );
+}
+
+// Moves body for time with the constants of a physics profile
+template<class Profile>
+inline void FX_move( FixedBody& body, const FixedTime time )
+{
+    body.posX += Fixed( FX_shiftRound( Sint64( FixedProfile<Profile>::CAMERA_VELOCITY ) * time, FIXED_TIME_BITS ) );
+    body.posY = FX_moveY<Profile>( body, time );
+    body.velY += Fixed( FX_shiftRound( Sint64( FixedProfile<Profile>::GRAVITY ) * time, FIXED_TIME_BITS ) );
+}
+
+// Finds the first time in [start, end] at which test holds, given it holds at end and switches at most once. Bisects over
+// the integer times instead of solving for the root, so no square root is needed
+template<class Test>
+inline FixedTime FX_findFirst( FixedTime start, FixedTime end, const Test& test )
+{
+    while( start < end )
+    {
+        FixedTime middle = start + ( end - start ) / 2;
+        if( test( middle ) )
+        {
+            end = middle;
+        }
+        else
+        {
+            start = middle + 1;
+        }
+    }
+
+    return end;
+}
+
+// Checks collision of the player collider moving with body for duration against the pipe with given top and bottom rects,
+// like CD_checkSweptCollision against both rects. Sets timeOfImpact to the moment of the first overlap
+template<class Profile>
+inline bool FX_checkPipeCollision( const FixedBody& body, const FixedTime duration, const SDL_Rect& topRect,
+                                   const SDL_Rect& botRect, FixedTime* timeOfImpact )
+{
+    // Time interval in which the collider overlaps the pipe on the X axis
+    const Sint64 velX = FixedProfile<Profile>::CAMERA_VELOCITY;
+    const Sint64 enterDistance = Sint64( topRect.x - PLAYER_WIDTH ) * FIXED_ONE - body.posX;
+    const Sint64 exitDistance = Sint64( topRect.x + topRect.w ) * FIXED_ONE - body.posX;
+    if( exitDistance <= 0 )
+    {
+        return false;
+    }
+    const FixedTime enter = enterDistance > 0 ? FixedTime( ( enterDistance << FIXED_TIME_BITS ) / velX ) : 0;
+    const FixedTime exit = FixedTime( std::min( ( exitDistance << FIXED_TIME_BITS ) / velX, Sint64( duration ) ) );
+    if( enter >= exit )
+    {
+        return false;
+    }
+
+    // Highest and lowest position of the collider that fit the gap
+    const Fixed gapTop = ( topRect.y + topRect.h ) * FIXED_ONE;
+    const Fixed gapBot = ( botRect.y - PLAYER_HEIGHT ) * FIXED_ONE;
+    auto aboveGap = [ & ]( const FixedTime time ){ return FX_moveY<Profile>( body, time ) < gapTop; };
+    auto belowGap = [ & ]( const FixedTime time ){ return FX_moveY<Profile>( body, time ) > gapBot; };
+
+    if( aboveGap( enter ) || belowGap( enter ) )
+    {
+        *timeOfImpact = enter;
+        return true;
+    }
+
+    // The path only rises until it turns, so it can leave through the top of the gap before the turn and through the bottom
+    // after it
+    const Sint64 turn = body.velY < 0 ? ( Sint64( -body.velY ) << FIXED_TIME_BITS ) / FixedProfile<Profile>::GRAVITY : 0;
+    const FixedTime rising = FixedTime( std::min( std::max( turn, Sint64( enter ) ), Sint64( exit ) ) );
+    if( aboveGap( rising ) )
+    {
+        *timeOfImpact = FX_findFirst( enter, rising, aboveGap );
+        return true;
+    }
+    if( belowGap( exit ) )
+    {
+        *timeOfImpact = FX_findFirst( rising, exit, belowGap );
+        return true;
+    }
+
+    return false;
+}
+
+// Numbers the simulated player state is kept in, selected at build time
+#ifdef FIXED_POINT_PHYSICS
+typedef Fixed PhysicsScalar;
+#else
+typedef double PhysicsScalar;
+#endif
+
+inline double PHYS_toDouble( const PhysicsScalar value )
+{
+#ifdef FIXED_POINT_PHYSICS
+    return FX_toDouble( value );
+#else
+    return value;
+#endif
+}
+
+inline PhysicsScalar PHYS_fromDouble( const double value )
+{
+#ifdef FIXED_POINT_PHYSICS
+    return Fixed( FX_fromDouble( value ) );
+#else
+    return value;
+#endif
+}
+
+#endif // _FIXEDPHYSICS_HPP_INCLUDED
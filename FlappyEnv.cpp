@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstdio>
+#include <new>
+#include <vector>
+
+#include <SDL.h>
+
+#include "FlappyEnv.h"
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+#include "ObservationRenderer.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Rewards for staying alive for one step, passing a pipe and dying
+static const float ENV_REWARD_ALIVE = 0.1f;
+static const float ENV_REWARD_PIPE = 1.0f;
+static const float ENV_REWARD_DEATH = -1.0f;
+
+// State of one game of the batch
+struct EnvGame{
+    HeadlessGame game;
+    // Number of finished games, selects the seed of the level
+    int episode;
+};
+
+struct FlappyEnv{
+    // Shared by all games since building its tables is slow
+    LevelGenerator generator;
+    std::vector<EnvGame> games;
+    int seed;
+    ObservationRenderer renderer = ObservationRenderer( FLAPPYENV_FRAME_WIDTH, FLAPPYENV_FRAME_HEIGHT );
+};
+
+// Starts a new game on the level of its current episode
+static void ENV_resetGame( FlappyEnv* env, const int index )
+{
+    EnvGame& envGame = env->games[ index ];
+    envGame.game.reset( env->generator, env->seed + index + envGame.episode * int( env->games.size() ) );
+}
+
+// Writes observation of a game into its row of the observation buffer
+static void ENV_observe( const HeadlessGame& game, float* observation )
+{
+    observation[ 0 ] = float( game.getPosY() / SCREEN_HEIGHT );
+    observation[ 1 ] = float( game.getVelY() / FLAP_HEIGHT );
+
+    // Describe the next two pipes, repeating the last one at the end of the level
+    const std::vector<Pipe>& level = game.getLevel();
+    for( int i = 0; i < 2; ++i )
+    {
+        int pipe = std::min( game.getNextPipe() + i, int( level.size() ) - 1 );
+        SDL_Rect topRect = level[ pipe ].getTopRect();
+        SDL_Rect botRect = level[ pipe ].getBotRect();
+
+        observation[ 2 + 3 * i ] = float( ( topRect.x - game.getPosX() - PLAYER_WIDTH ) / SCREEN_WIDTH );
+        observation[ 3 + 3 * i ] = float( topRect.y + topRect.h ) / SCREEN_HEIGHT;
+        observation[ 4 + 3 * i ] = float( botRect.y ) / SCREEN_HEIGHT;
+    }
+}
+
+FlappyEnv* env_create( int n, int seed )
+{
+    if( n <= 0 )
+    {
+        printf( "Could not create environment with %d games!\n", n );
+        return nullptr;
+    }
+
+    FlappyEnv* env = new( std::nothrow ) FlappyEnv();
+    if( env == nullptr )
+    {
+        printf( "Could not allocate environment!\n" );
+        return nullptr;
+    }
+
+    env->seed = seed;
+    env->games.resize( n );
+    for( int i = 0; i < n; ++i )
+    {
+        env->games[ i ].episode = 0;
+        ENV_resetGame( env, i );
+    }
+
+    return env;
+}
+
+void env_destroy( FlappyEnv* env )
+{
+    delete env;
+}
+
+int env_num_envs( const FlappyEnv* env )
+{
+    return env->games.size();
+}
+
+void env_reset( FlappyEnv* env, float* observations )
+{
+    for( size_t i = 0; i < env->games.size(); ++i )
+    {
+        env->games[ i ].episode = 0;
+        ENV_resetGame( env, i );
+        ENV_observe( env->games[ i ].game, observations + i * FLAPPYENV_OBS_SIZE );
+    }
+}
+
+void env_step( FlappyEnv* env, const uint8_t* actions, float* observations, float* rewards, uint8_t* dones )
+{
+    for( size_t i = 0; i < env->games.size(); ++i )
+    {
+        HeadlessGame& game = env->games[ i ].game;
+
+        int lastScore = game.getScore();
+        bool alive = game.step( env->generator, actions[ i ] != 0, FLAPPYENV_STEP_DURATION );
+
+        rewards[ i ] = alive ? ENV_REWARD_ALIVE + ENV_REWARD_PIPE * ( game.getScore() - lastScore ) : ENV_REWARD_DEATH;
+        dones[ i ] = !alive || game.isFinished();
+
+        // Continue on the next level right away so the batch never waits for single games
+        if( dones[ i ] )
+        {
+            ++env->games[ i ].episode;
+            ENV_resetGame( env, i );
+        }
+
+        ENV_observe( game, observations + i * FLAPPYENV_OBS_SIZE );
+    }
+}
+
+void env_render( const FlappyEnv* env, uint8_t* frames )
+{
+    const int frameSize = FLAPPYENV_FRAME_WIDTH * FLAPPYENV_FRAME_HEIGHT;
+    for( size_t i = 0; i < env->games.size(); ++i )
+    {
+        const HeadlessGame& game = env->games[ i ].game;
+        env->renderer.render( game.getLevel(), game.getNextPipe(), game.getPosX(), game.getPosY(), frames + i * frameSize );
+    }
+}
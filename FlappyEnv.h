@@ -0,0 +1,70 @@
+#ifndef _FLAPPYENV_H_INCLUDED
+#define _FLAPPYENV_H_INCLUDED
+
+/*
+ * C interface of the headless training environment ( FlappyEnv shared library ).
+ *
+ * One FlappyEnv holds a batch of independent games that are stepped together with the game physics and collision, without
+ * SDL video or audio. All data is passed through caller-owned contiguous buffers:
+ *   observations  n * FLAPPYENV_OBS_SIZE floats, row per game
+ *   actions       n bytes, non-zero means flap
+ *   rewards       n floats
+ *   dones         n bytes, set when the game ended during the step
+ *   frames        n * FLAPPYENV_FRAME_WIDTH * FLAPPYENV_FRAME_HEIGHT bytes, grayscale frame per game
+ * A game that ends is reset to a new level right away and its row of observations describes the new game.
+ * Nothing is allocated after env_create.
+ */
+
+#include <stdint.h>
+
+#if defined( _WIN32 ) && defined( FLAPPYENV_BUILD )
+    #define FLAPPYENV_API __declspec( dllexport )
+#elif defined( _WIN32 )
+    #define FLAPPYENV_API __declspec( dllimport )
+#else
+    #define FLAPPYENV_API __attribute__( ( visibility( "default" ) ) )
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of floats in the observation of one game:
+ * player Y, player Y velocity,
+ * distance to the next pipe, top and bottom of its gap,
+ * distance to the pipe after it, top and bottom of its gap
+ * ( positions relative to the screen size, velocity relative to the flap velocity ) */
+#define FLAPPYENV_OBS_SIZE 8
+
+/* Size of the grayscale frames drawn by env_render */
+#define FLAPPYENV_FRAME_WIDTH 84
+#define FLAPPYENV_FRAME_HEIGHT 84
+
+/* Duration of one step in seconds */
+#define FLAPPYENV_STEP_DURATION ( 1.0 / 30.0 )
+
+typedef struct FlappyEnv FlappyEnv;
+
+/* Creates batch of n games. Game i plays the levels generated from seeds seed + i, seed + i + n, ... Returns NULL on failure */
+FLAPPYENV_API FlappyEnv* env_create( int n, int seed );
+
+/* Destroys batch */
+FLAPPYENV_API void env_destroy( FlappyEnv* env );
+
+/* Gets number of games in batch */
+FLAPPYENV_API int env_num_envs( const FlappyEnv* env );
+
+/* Restarts every game on its first level and writes the initial observations */
+FLAPPYENV_API void env_reset( FlappyEnv* env, float* observations );
+
+/* Advances every game by one step. Rewards are +1 for each passed pipe, -1 for dying and a small bonus for staying alive */
+FLAPPYENV_API void env_step( FlappyEnv* env, const uint8_t* actions, float* observations, float* rewards, uint8_t* dones );
+
+/* Draws the current screen of every game at low resolution on the CPU */
+FLAPPYENV_API void env_render( const FlappyEnv* env, uint8_t* frames );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FLAPPYENV_H_INCLUDED */
@@ -0,0 +1,82 @@
+#include <cstdio>
+
+#include <SDL.h>
+
+#include "FrameCache.hpp"
+
+FrameCache::FrameCache()
+{
+    mRenderer = nullptr;
+    mTarget = nullptr;
+
+    mValid = false;
+}
+
+FrameCache::~FrameCache()
+{
+    free();
+}
+
+bool FrameCache::init( SDL_Renderer* renderer, const int width, const int height )
+{
+    free();
+
+    mRenderer = renderer;
+
+    mTarget = SDL_CreateTexture( renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height );
+    if( mTarget == nullptr )
+    {
+        printf( "Could not create frame cache target! SDL_Error: %s\n", SDL_GetError() );
+        return false;
+    }
+
+    return true;
+}
+
+void FrameCache::free()
+{
+    if( mTarget != nullptr )
+    {
+        SDL_DestroyTexture( mTarget );
+        mTarget = nullptr;
+    }
+
+    mValid = false;
+}
+
+bool FrameCache::beginCapture()
+{
+    if( mTarget == nullptr || SDL_SetRenderTarget( mRenderer, mTarget ) != 0 )
+    {
+        return false;
+    }
+
+    // Always capture at full resolution, whatever scale the last frame was rendered at
+    SDL_RenderSetScale( mRenderer, 1.f, 1.f );
+
+    return true;
+}
+
+void FrameCache::endCapture()
+{
+    SDL_SetRenderTarget( mRenderer, nullptr );
+    mValid = true;
+}
+
+void FrameCache::invalidate()
+{
+    mValid = false;
+}
+
+bool FrameCache::isValid() const
+{
+    return mValid;
+}
+
+void FrameCache::render()
+{
+    if( mValid )
+    {
+        SDL_RenderCopy( mRenderer, mTarget, nullptr, nullptr );
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef _FRAMECACHE_HPP_INCLUDED
+#define _FRAMECACHE_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Keeps one rendered frame in an offscreen target at full resolution, so screens that do not change ( paused, dead ) are
+// drawn once and afterwards only copied to the window with their overlay
+class FrameCache{
+
+public:
+
+    // Initializes internal variables
+    FrameCache();
+
+    // Deallocates memory
+    ~FrameCache();
+
+    // Creates offscreen target of given size for renderer. Returns whether it succeeded, if not nothing is cached
+    bool init( SDL_Renderer* renderer, const int width, const int height );
+
+    // Frees offscreen target
+    void free();
+
+    // Redirects rendering into the cache ( in window coordinates ). Returns false if there is no target to render into
+    bool beginCapture();
+
+    // Restores rendering to the window and marks the cached frame as valid
+    void endCapture();
+
+    // Marks the cached frame as outdated
+    void invalidate();
+
+    // Gets whether the cache holds a frame that can be shown
+    bool isValid() const;
+
+    // Copies cached frame over the whole current render target
+    void render();
+
+private:
+
+    // Renderer and its offscreen target
+    SDL_Renderer* mRenderer;
+    SDL_Texture* mTarget;
+
+    // Whether the target holds the frame that should be shown
+    bool mValid;
+};
+
+#endif // _FRAMECACHE_HPP_INCLUDED
@@ -1,13 +1,22 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <ctime>
 #include <string>
 #include <vector>
 
+#include <SDL_image.h>
 #include <SDL_mixer.h>
 
+#include "AllocationProfiler.hpp"
+#include "AssetBundle.hpp"
 #include "constants.hpp"
 #include "Engine.hpp"
 #include "Game.hpp"
 #include "LevelGenerator.hpp"
+#include "LevelSolver.hpp"
+#include "SpriteAtlas.hpp"
+#include "Startup.hpp"
 
 Game::Game()
 {
@@ -15,6 +24,7 @@ Game::Game()
     mGameRenderer = nullptr;
     mGameMusic = nullptr;
     mPlayer = nullptr;
+    mSpriteSheetSurface = nullptr;
 
     mCamera = { 0, 0, 0, 0 };
 
@@ -22,8 +32,24 @@ Game::Game()
     mPaused = false;
 
     mBackgroundClipRect = { 0, 0, 0, 0 };
-    mTopPipeClipRect = { 0, 0, 0, 0 };
-    mBotPipeClipRect = { 0, 0, 0, 0 };
+    mGhostClipRect = { 0, 0, 0, 0 };
+
+    mLevelSeed = 0;
+    mPhysicsMode = PHYSICS_NORMAL;
+    mMovingObstacles = false;
+    mFirstPipeEntity = 0;
+    mNumPipes = 0;
+    mNextFirstPipeEntity = 0;
+    mNextNumPipes = 0;
+    mNextLevelSeed = 0;
+    mLevelThread = nullptr;
+    mFirstNearEntity = mLastNearEntity = 0;
+    mRunStartTime = 0;
+    mRewound = false;
+    mShowTrajectory = false;
+
+    // Flaps are stored during play, so the list should not have to grow then
+    mRunFlaps.reserve( RUN_FLAPS_RESERVE );
 }
 
 Game::~Game()
@@ -33,9 +59,18 @@ Game::~Game()
 
 void Game::quit()
 {
+    // A level still being built uses the level generator and solver
+    if( mLevelThread != nullptr )
+    {
+        SDL_WaitThread( mLevelThread, nullptr );
+        mLevelThread = nullptr;
+    }
+
     // If game is not initialized
     if( !mInitialized )
     {
+        SDL_FreeSurface( mSpriteSheetSurface );
+        mSpriteSheetSurface = nullptr;
         mSpriteSheetTexture.free();
         mStartScreenTexture.free();
         mPauseTexture.free();
@@ -43,6 +78,9 @@ void Game::quit()
 
         Mix_FreeMusic( mGameMusic );
 
+        mResolutionScaler.free();
+        mFrameCache.free();
+
         SDL_DestroyRenderer( mGameRenderer );
         SDL_DestroyWindow( mGameWindow );
         mGameRenderer = nullptr;
@@ -66,8 +104,10 @@ bool Game::init()
     }
     else
     {
+        STARTUP_trace( "window created" );
+
         // Attempt to create renderer for game window
-        mGameRenderer = SDL_CreateRenderer( mGameWindow, -1, SDL_RENDERER_ACCELERATED  );
+        mGameRenderer = SDL_CreateRenderer( mGameWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE );
         if( mGameRenderer == nullptr )
         {
             printf( "Could not create renderer for game window! SDL_Error: %s\n", SDL_GetError() );
@@ -75,8 +115,22 @@ bool Game::init()
         }
         else
         {
+            STARTUP_trace( "renderer created" );
+
             SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
 
+            // Without an offscreen target the game still runs, only at fixed full resolution
+            if( !mResolutionScaler.init( mGameRenderer, SCREEN_WIDTH, SCREEN_HEIGHT ) )
+            {
+                printf( "Could not enable dynamic resolution!\n" );
+            }
+
+            // Without a cache the scene is rendered again whenever a static screen has to be shown
+            if( !mFrameCache.init( mGameRenderer, SCREEN_WIDTH, SCREEN_HEIGHT ) )
+            {
+                printf( "Could not enable frame cache!\n" );
+            }
+
             // Initialize camera
             mCamera.x = 0;
             mCamera.y = 0;
@@ -89,13 +143,14 @@ bool Game::init()
                 printf( "Could not create level!\n " );
                 success = false;
             }
+            STARTUP_trace( "level created" );
 
             // Start timer and pause it until game starts
             mGameTimer.start();
             mGameTimer.pause();
             mStarted = false;
             mPaused = false;
-            //mPlayer = new Player( this, mGameTimer.getTicks() );
+            //mPlayer = new Player( this, mGameTimer.getTicks(), mPhysicsMode );
             //mLastCamMove = mGameTimer.getTicks();
 
             // Attempt to load media
@@ -104,6 +159,13 @@ bool Game::init()
                 printf( "Could not load media!\n " );
                 success = false;
             }
+            STARTUP_trace( "media loaded" );
+
+            // Runs of previous games are only needed for ghosts, so a broken log is not fatal
+            if( !mReplayLog.load( "replays.rpl" ) )
+            {
+                printf( "Could not load all stored runs!\n" );
+            }
         }
     }
 
@@ -117,13 +179,24 @@ bool Game::loadMedia()
     // Success flag
     bool success = true;
 
-    if( !mSpriteSheetTexture.loadFromFile( mGameRenderer, "assets/sprite_sheet.png" ) )
+    // Player and score tracker draw from this texture too, and the player masks come from the surface
+    SDL_Surface* loadedSurface = IMG_Load_RW( AB_openAsset( SPRITE_ATLAS_PATH ), 1 );
+    if( loadedSurface == nullptr )
+    {
+        printf( "Could not load sprite sheet! IMG_Error: %s\n", IMG_GetError() );
+    }
+    else
+    {
+        mSpriteSheetSurface = SDL_ConvertSurfaceFormat( loadedSurface, SDL_PIXELFORMAT_RGBA32, 0 );
+        SDL_FreeSurface( loadedSurface );
+    }
+    if( mSpriteSheetSurface == nullptr || !mSpriteSheetTexture.loadFromSurface( mGameRenderer, mSpriteSheetSurface, SPRITE_ATLAS_PATH ) )
     {
         printf( "Could not load sprite sheet texture!\n" );
         success = false;
     }
 
-    if( !mPauseTexture.loadFromFile( mGameRenderer, "assets/pause_screen.png" ) )
+    if( !mPauseTexture.loadFromRW( mGameRenderer, AB_openAsset( "assets/pause_screen.png" ), "assets/pause_screen.png" ) )
     {
         printf( "Could not load pause screen texture!\n" );
         success = false;
@@ -134,13 +207,13 @@ bool Game::loadMedia()
         mPauseTexture.setAlpha( 126 );
     }
 
-    if( !mStartScreenTexture.loadFromFile( mGameRenderer, "assets/start_screen.png" ) )
+    if( !mStartScreenTexture.loadFromRW( mGameRenderer, AB_openAsset( "assets/start_screen.png" ), "assets/start_screen.png" ) )
     {
         printf( "Could not load start screen texture!\n" );
         success = false;
     }
 
-    if( !mDeadTexture.loadFromFile( mGameRenderer, "assets/dead.png" ) )
+    if( !mDeadTexture.loadFromRW( mGameRenderer, AB_openAsset( "assets/dead.png" ), "assets/dead.png" ) )
     {
         printf( "Could not load dead texture!\n" );
         success = false;
@@ -151,37 +224,170 @@ bool Game::loadMedia()
         mDeadTexture.setAlpha( 126 );
     }
 
-    mGameMusic = Mix_LoadMUS( "assets/rollin.mp3" );
+    // Set clip rectangles
+    mBackgroundClipRect = SPRITE_CLIPS[ SPRITE_BACKGROUND ];
+    mGhostClipRect = SPRITE_CLIPS[ SPRITE_BIRD_NEUTRAL ];
+
+    return success;
+}
+
+bool Game::loadAudio()
+{
+    // Audio device is opened in the background during startup, sounds can only be decoded once it is open
+    if( !STARTUP_waitForAudio() )
+    {
+        printf( "Could not open audio device!\n" );
+        return false;
+    }
+
     if( mGameMusic == nullptr )
     {
-        printf( "Could not load game music! Mix_Error: %s\n", Mix_GetError() );
-        success = false;
+        mGameMusic = Mix_LoadMUS_RW( AB_openAsset( "assets/rollin.mp3" ), 1 );
+        if( mGameMusic == nullptr )
+        {
+            printf( "Could not load game music! Mix_Error: %s\n", Mix_GetError() );
+            return false;
+        }
     }
-    // Set clip rectangles
-    mBackgroundClipRect.x = 0;
-    mBackgroundClipRect.y = 0;
-    mBackgroundClipRect.w = 288;
-    mBackgroundClipRect.h = 512;
 
-    mTopPipeClipRect.x = 112;
-    mTopPipeClipRect.y = 645;
-    mTopPipeClipRect.w = 52;
-    mTopPipeClipRect.h = 321;
+    return true;
+}
 
-    mBotPipeClipRect.x = 168;
-    mBotPipeClipRect.y = 646;
-    mBotPipeClipRect.w = 52;
-    mBotPipeClipRect.h = 320;
+bool Game::createLevel()
+{
+    bool success = buildLevel( mWorld, mFirstPipeEntity, mNumPipes, mLevelSeed );
+    mFirstNearEntity = mLastNearEntity = 0;
 
+    // Returns whether level was created
     return success;
 }
 
-bool Game::createLevel()
+bool Game::buildLevel( World& world, Entity& firstPipeEntity, int& numPipes, int& seed )
 {
-    mPipes = mLevelGen.generate();
+    // Pipes are only generated and solved here, from then on the level lives in world
+    std::vector<Pipe> pipes;
 
-    // Returns whether level was created
-    return !mPipes.empty();
+    // Regenerate level ( with a different seed ) until the solver finds it passable
+    bool passable = false;
+    for( int attempt = 0; attempt < MAX_LEVEL_ATTEMPTS; ++attempt )
+    {
+        seed = time( nullptr ) + attempt;
+        mLevelGen.generate( seed, pipes );
+
+        passable = mLevelSolver.solve( pipes );
+
+        // Stop the last moving gap before the pipe that can not be passed until the level is passable
+        while( !passable )
+        {
+            int pipe = mLevelSolver.getFirstImpassablePipe();
+            while( pipe >= 0 && !pipes[ pipe ].isMoving() )
+            {
+                --pipe;
+            }
+            if( pipe < 0 )
+            {
+                break;
+            }
+
+            pipes[ pipe ].setMotion( PIPE_STATIC, 0, 1, 0 );
+            passable = mLevelSolver.solve( pipes );
+        }
+
+        if( passable )
+        {
+            break;
+        }
+
+        printf( "Generated level can not be passed at pipe %d!\n", mLevelSolver.getFirstImpassablePipe() );
+    }
+
+    // Fall back to static gaps all centered at the height the player starts at
+    if( !passable )
+    {
+        printf( "Using a level of centered gaps instead!\n" );
+        for( std::vector<Pipe>::iterator iter = pipes.begin(); iter != pipes.end(); ++iter )
+        {
+            SDL_Rect topRect = iter->getTopRect();
+            *iter = Pipe( topRect.x, 0, topRect.w, ( SCREEN_HEIGHT - PIPE_GAP ) / 2 );
+        }
+        passable = !pipes.empty() && mLevelSolver.solve( pipes );
+    }
+
+    world.clear();
+    firstPipeEntity = world.addPipes( pipes, SPRITE_CLIPS[ SPRITE_PIPE_TOP ], SPRITE_CLIPS[ SPRITE_PIPE_BOTTOM ] );
+    numPipes = pipes.size();
+
+    return passable;
+}
+
+void Game::prepareNextLevel()
+{
+    if( mLevelThread != nullptr )
+    {
+        return;
+    }
+
+    // The level is built right at restart instead if no thread could be started
+    mLevelThread = SDL_CreateThread( buildNextLevel, "NextLevel", this );
+    if( mLevelThread == nullptr )
+    {
+        printf( "Could not start building next level! SDL_Error: %s\n", SDL_GetError() );
+    }
+}
+
+int Game::buildNextLevel( void* data )
+{
+    Game* game = static_cast<Game*>( data );
+    return game->buildLevel( game->mNextWorld, game->mNextFirstPipeEntity, game->mNextNumPipes, game->mNextLevelSeed ) ? 1 : 0;
+}
+
+bool Game::swapInNextLevel()
+{
+    if( mLevelThread == nullptr )
+    {
+        return false;
+    }
+
+    int built = 0;
+    SDL_WaitThread( mLevelThread, &built );
+    mLevelThread = nullptr;
+    if( built == 0 )
+    {
+        return false;
+    }
+
+    // Only the buffers are exchanged, so this does not depend on the size of the level
+    mWorld.swap( mNextWorld );
+    std::swap( mFirstPipeEntity, mNextFirstPipeEntity );
+    std::swap( mNumPipes, mNextNumPipes );
+    std::swap( mLevelSeed, mNextLevelSeed );
+    mFirstNearEntity = mLastNearEntity = 0;
+
+    return true;
+}
+
+void Game::setPhysicsMode( const PhysicsMode mode )
+{
+    // Reachable heights and passability depend on the physics
+    mPhysicsMode = mode;
+    mLevelGen = LevelGenerator( mode );
+    mLevelSolver = LevelSolver( LevelSolver::DEFAULT_TICK_DURATION, mode );
+
+    if( mMovingObstacles )
+    {
+        mLevelGen.setMovingFraction( MOVING_OBSTACLE_FRACTION );
+    }
+}
+
+void Game::enableMovingObstacles()
+{
+    mMovingObstacles = true;
+    mLevelGen.setMovingFraction( MOVING_OBSTACLE_FRACTION );
+}
+
+void Game::enableTrajectoryPreview()
+{
+    mShowTrajectory = true;
 }
 
 void Game::pause()
@@ -204,14 +410,32 @@ void Game::run()
     // Event handler
     SDL_Event e;
 
-    // Wait for player to start game
+    // Wait for player to start game, showing the start screen before the first event arrives
+    bool firstFrame = true;
+    bool redraw = true;
     while( !mStarted )
     {
-        SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
-        SDL_RenderClear( mGameRenderer );
+        if( redraw )
+        {
+            SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
+            SDL_RenderClear( mGameRenderer );
+
+            mStartScreenTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
+
+            SDL_RenderPresent( mGameRenderer );
+        }
+
+        if( firstFrame )
+        {
+            STARTUP_trace( "first frame presented" );
+            firstFrame = false;
+        }
 
         SDL_WaitEvent( &e );
 
+        // The start screen never changes, it is only lost when the window is exposed or resized
+        redraw = e.type == SDL_WINDOWEVENT || e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET;
+
         if( e.type == SDL_QUIT )
         {
             quit = true;
@@ -223,20 +447,30 @@ void Game::run()
             mStarted = true;
             unpause();
         }
+    }
 
-        mStartScreenTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
-
-        SDL_RenderPresent( mGameRenderer );
+    // The player loads its sound effects, so audio has to be ready first
+    if( !loadAudio() )
+    {
+        printf( "Could not load audio!\n" );
     }
 
-    mPlayer = new Player( this, mGameTimer.getTicks() );
+    mPlayer = new Player( this, mGameTimer.getTicks(), mSpriteSheetSurface, mPhysicsMode );
+    SDL_FreeSurface( mSpriteSheetSurface );
+    mSpriteSheetSurface = nullptr;
+    startRun();
 
     //Mix_PlayMusic( mGameMusic, -1 );
 
+    // A frame spans the move of the player and the events and rendering after it, so waiting on the death screen is left out
+    ALLOC_beginFrame();
+
     while( !quit )
     {
         while( SDL_PollEvent( &e ) != 0 )
         {
+            AllocationTag tag( "events" );
+
             if( e.type == SDL_QUIT )
             {
                 quit = true;
@@ -255,10 +489,54 @@ void Game::run()
             }
 
             if( !mPaused && mPlayer->isAlive() )
+            {
+                if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_SPACE )
+                {
+                    mRunFlaps.push_back( mGameTimer.getTicks() - mRunStartTime );
+                }
+
                 mPlayer->handleEvent( e );
+            }
+
+            if( !mPaused && e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_BACKSPACE )
+            {
+                rewind();
+            }
+
+            if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_t )
+            {
+                mShowTrajectory = !mShowTrajectory;
+            }
+
+            // Textures that are render targets lose their content when the renderer resets
+            if( e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET )
+            {
+                mFrameCache.invalidate();
+            }
         }
 
-        render();
+        if( !mPlayer->isAlive() )
+        {
+            renderStaticFrame( mDeadTexture );
+        }
+        else if( mPaused )
+        {
+            renderStaticFrame( mPauseTexture );
+        }
+        else
+        {
+            mFrameCache.invalidate();
+            render();
+        }
+
+        // Frames in which a run ends store the run, they are not steady play
+        ALLOC_endFrame( mPlayer->isAlive() );
+
+        // Nothing moves while paused, so sleep until the next event instead of spinning
+        if( mPaused && mPlayer->isAlive() )
+        {
+            SDL_WaitEvent( nullptr );
+        }
 
         while( !mPlayer->isAlive() && !quit )
         {
@@ -269,30 +547,195 @@ void Game::run()
                 quit = true;
             }
 
+            // Show the death screen again if the window lost it
+            if( e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET )
+            {
+                mFrameCache.invalidate();
+            }
+            if( e.type == SDL_WINDOWEVENT || e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET )
+            {
+                renderStaticFrame( mDeadTexture );
+            }
+
             if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_SPACE )
             {
                 restart();
             }
 
+            // Retry the same level to race the ghosts of its best runs
+            if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_r )
+            {
+                restart( true );
+            }
+
+            // Practice from shortly before the death
+            if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_BACKSPACE )
+            {
+                rewind();
+            }
+
             if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE )
             {
                 quit = true;
             }
         }
 
+        ALLOC_beginFrame();
+
         int currentTime = mGameTimer.getTicks();
 
         if( !mPaused && mPlayer->isAlive() )
         {
-            mPlayer->move( mPipes, currentTime );
+            AllocationTag tag( "update" );
+
+            updateObstacles( currentTime - mRunStartTime );
+            mPlayer->move( mWorld, mFirstNearEntity, mLastNearEntity, currentTime );
+            mPlayer->addPoints( mWorld.updateScores( mPlayer->getPosX(), mFirstNearEntity, mLastNearEntity ) );
             moveCamera();
+
+            mGhosts.update( currentTime - mRunStartTime );
+
+            if( Uint32( currentTime ) - mRewindBuffer.getLatestTime() >= Uint32( RewindBuffer::SNAPSHOT_INTERVAL ) )
+            {
+                takeSnapshot( currentTime );
+            }
+
+            // The replay log and the tools reading it assume normal physics and static pipes
+            if( !mPlayer->isAlive() && !mRewound && mPhysicsMode == PHYSICS_NORMAL && !mMovingObstacles )
+            {
+                recordRun( currentTime );
+            }
+
+            // Build the next level while the player looks at the death screen
+            if( !mPlayer->isAlive() )
+            {
+                prepareNextLevel();
+            }
         }
     }
 
     this->quit();
 }
 
+bool Game::runVersus( RollbackSession& session )
+{
+    const double tickTime = RollbackSession::TICK_DURATION * 1000.0;
+
+    // Pipes of the longest level either bird has generated, built again whenever it grows
+    World world;
+    size_t numPipes = 0;
+
+    // Game time of the last flap of each bird, found from the velocity jumping up ( in milliseconds )
+    double lastVelY[ VERSUS_PLAYERS ];
+    Uint32 lastFlaps[ VERSUS_PLAYERS ];
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        lastVelY[ i ] = session.getGame( i ).getVelY();
+        lastFlaps[ i ] = 0;
+    }
+
+    Uint32 startTime = SDL_GetTicks();
+    int confirmedTick = -1;
+    Uint32 progressTime = startTime;
+    bool flap = false;
+    bool quit = false;
+    bool timedOut = false;
+
+    while( !quit )
+    {
+        const Uint32 frameStart = SDL_GetTicks();
+
+        SDL_Event e;
+        while( SDL_PollEvent( &e ) != 0 )
+        {
+            if( e.type == SDL_QUIT || ( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE ) )
+            {
+                quit = true;
+            }
+            else if( e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_SPACE && e.key.repeat == 0 )
+            {
+                flap = true;
+            }
+        }
+
+        session.poll();
+
+        // The clock only starts once the other peer is there, afterwards ticks missed while waiting for it are caught up
+        if( session.getConfirmedTick() < 0 )
+        {
+            startTime = frameStart - Uint32( session.getTick() * tickTime );
+        }
+        const int targetTick = int( ( frameStart - startTime ) / tickTime ) + 1;
+        for( int step = 0; step < RollbackSession::MAX_CATCH_UP_TICKS && session.getTick() < targetTick && !session.isOver();
+             ++step )
+        {
+            if( !session.advance( flap ) )
+            {
+                break;
+            }
+            flap = false;
+        }
+
+        for( int i = 0; i < VERSUS_PLAYERS; ++i )
+        {
+            const double velY = session.getGame( i ).getVelY();
+            if( velY < lastVelY[ i ] )
+            {
+                lastFlaps[ i ] = Uint32( session.getTick() * tickTime );
+            }
+            lastVelY[ i ] = velY;
+        }
+
+        if( session.getConfirmedTick() > confirmedTick )
+        {
+            confirmedTick = session.getConfirmedTick();
+            progressTime = frameStart;
+        }
+        else if( confirmedTick >= 0 && !session.isOver() && frameStart - progressTime >= RollbackSession::PEER_TIMEOUT )
+        {
+            printf( "No inputs from the other peer for %u ms, giving up!\n", RollbackSession::PEER_TIMEOUT );
+            timedOut = true;
+            break;
+        }
+
+        const std::vector<Pipe>& level0 = session.getGame( 0 ).getLevel();
+        const std::vector<Pipe>& level1 = session.getGame( 1 ).getLevel();
+        const std::vector<Pipe>& level = level0.size() >= level1.size() ? level0 : level1;
+        if( level.size() != numPipes )
+        {
+            world.clear();
+            world.addPipes( level, SPRITE_CLIPS[ SPRITE_PIPE_TOP ], SPRITE_CLIPS[ SPRITE_PIPE_BOTTOM ] );
+            numPipes = level.size();
+        }
+
+        renderVersus( session, world, lastFlaps );
+
+        const Uint32 frameTime = SDL_GetTicks() - frameStart;
+        if( frameTime < Uint32( tickTime ) )
+        {
+            SDL_Delay( Uint32( tickTime ) - frameTime );
+        }
+    }
+
+    printf( "Versus over after %d ticks, scores %d:%d, %d rollbacks, %d stalls, %d/%d checksums differed\n",
+            session.getTick(), session.getGame( 0 ).getScore(), session.getGame( 1 ).getScore(), session.getNumRollbacks(),
+            session.getNumStalls(), session.getNumDesyncs(), session.getNumChecksums() );
+
+    return session.getNumDesyncs() == 0 && !timedOut;
+}
+
 void Game::render()
+{
+    AllocationTag tag( "render" );
+
+    mResolutionScaler.beginFrame();
+
+    renderScene();
+
+    mResolutionScaler.presentFrame();
+}
+
+void Game::renderScene()
 {
     // Clear the screen
     SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
@@ -300,56 +743,249 @@ void Game::render()
 
     mSpriteSheetTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT, &mBackgroundClipRect );
 
-    // Set color for pipe rendering
-    SDL_Color pipeColor = Pipe::PIPE_COLOR;
-    SDL_SetRenderDrawColor( mGameRenderer, pipeColor.r, pipeColor.g, pipeColor.b, pipeColor.a );
+    mWorld.render( mGameRenderer, mSpriteSheetTexture.getTexture(), mCamera, mFirstNearEntity, mLastNearEntity );
+
+    mGhosts.render( mGameRenderer, mSpriteSheetTexture.getTexture(), mGhostClipRect, mCamera.x, mCamera.y );
 
-    for( std::vector<Pipe>::iterator iter = mPipes.begin(); iter != mPipes.end(); ++iter )
+    mPlayer->renderScore();
+
+    if( mPlayer->isAlive() )
     {
-        SDL_Rect topRect = iter->getTopRect();
-        if( topRect.x >= mCamera.x - topRect.w && topRect.x <= mCamera.x + mCamera.w )
+        if( mShowTrajectory )
         {
-            iter->render( mGameRenderer, mCamera, mSpriteSheetTexture, mTopPipeClipRect, mBotPipeClipRect );
+            renderTrajectory();
         }
+
+        mPlayer->render( mCamera.x, mCamera.y );
     }
+}
 
-    mPlayer->renderScore();
+void Game::renderStaticFrame( LTexture& overlay )
+{
+    if( !mFrameCache.isValid() && mFrameCache.beginCapture() )
+    {
+        renderScene();
+        mFrameCache.endCapture();
+    }
 
-    if( mPlayer->isAlive() )
+    if( mFrameCache.isValid() )
     {
-        mPlayer->render( mCamera.x, mCamera.y );
+        mFrameCache.render();
+    }
+    else
+    {
+        renderScene();
+    }
+
+    overlay.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
+
+    SDL_RenderPresent( mGameRenderer );
+}
 
-        if( mPaused )
+void Game::renderTrajectory()
+{
+    bool impact = false;
+    int numPoints = mPlayer->predictTrajectory( mWorld, mFirstNearEntity, mLastNearEntity, TRAJECTORY_PREVIEW_TIME, mCamera.x,
+                                                mCamera.y, mTrajectoryPoints, TRAJECTORY_ARC_POINTS, &impact );
+    if( numPoints == 0 )
+    {
+        return;
+    }
+
+    // Mark the impact with a diamond around the end of the arc, continuing the strip from its center
+    if( impact )
+    {
+        const SDL_Point end = mTrajectoryPoints[ numPoints - 1 ];
+        const int size = TRAJECTORY_MARKER_SIZE;
+        mTrajectoryPoints[ numPoints++ ] = { end.x, end.y - size };
+        mTrajectoryPoints[ numPoints++ ] = { end.x + size, end.y };
+        mTrajectoryPoints[ numPoints++ ] = { end.x, end.y + size };
+        mTrajectoryPoints[ numPoints++ ] = { end.x - size, end.y };
+        mTrajectoryPoints[ numPoints++ ] = { end.x, end.y - size };
+    }
+
+    if( impact )
+    {
+        SDL_SetRenderDrawColor( mGameRenderer, 0xe0, 0x30, 0x30, 0xff );
+    }
+    else
+    {
+        SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
+    }
+    if( SDL_RenderDrawLines( mGameRenderer, mTrajectoryPoints, numPoints ) != 0 )
+    {
+        printf( "Could not render trajectory! SDL_Error: %s\n", SDL_GetError() );
+    }
+}
+
+void Game::renderVersus( const RollbackSession& session, World& world, const Uint32* lastFlaps )
+{
+    const int localPlayer = session.getLocalPlayer();
+    const Uint32 time = Uint32( session.getTick() * RollbackSession::TICK_DURATION * 1000.0 );
+
+    mCamera.x = int( session.getGame( localPlayer ).getPosX() ) - Player::PLAYER_CAMERA_OFFSET;
+    mCamera.y = 0;
+
+    mResolutionScaler.beginFrame();
+
+    SDL_SetRenderDrawColor( mGameRenderer, 0xff, 0xff, 0xff, 0xff );
+    SDL_RenderClear( mGameRenderer );
+
+    mSpriteSheetTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT, &mBackgroundClipRect );
+
+    world.render( mGameRenderer, mSpriteSheetTexture.getTexture(), mCamera );
+
+    // The other bird first, so the own one is always on top. Birds tilt along their path like ghosts do
+    const SDL_Rect birdStretchRect = { 0, 0, PLAYER_WIDTH, PLAYER_HEIGHT };
+    for( int i = 1; i <= VERSUS_PLAYERS; ++i )
+    {
+        const int player = ( localPlayer + i ) % VERSUS_PLAYERS;
+        const HeadlessGame& game = session.getGame( player );
+        if( !game.isAlive() )
         {
-            mPauseTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
+            continue;
         }
+
+        const double velX = PHYS_getValues( game.getPhysicsMode() ).cameraVelocity;
+        double angle = std::atan2( game.getVelY(), velX ) * 180.0 / M_PI;
+        angle = std::min( std::max( angle, BIRD_ROTATION_AFTER_FLAP ), BIRD_ROTATION_MAX );
+
+        // Bird sprites are stored in the atlas in the order of the animation frames
+        const SDL_Rect& clip = SPRITE_CLIPS[ SPRITE_BIRD_NEUTRAL + PHYS_getBirdFrame( time - lastFlaps[ player ] ) ];
+
+        mSpriteSheetTexture.setAlpha( player == localPlayer ? 0xff : VERSUS_RIVAL_ALPHA );
+        mSpriteSheetTexture.renderStretched( mGameRenderer, int( game.getPosX() ) - mCamera.x,
+                                             int( game.getPosY() ) - mCamera.y, &birdStretchRect, &clip, angle );
     }
-    else
+    mSpriteSheetTexture.setAlpha( 0xff );
+
+    // Own score on the left, the other one on the right
+    renderNumber( session.getGame( localPlayer ).getScore(), SCREEN_WIDTH / 4, SCREEN_HEIGHT / 8 );
+    renderNumber( session.getGame( 1 - localPlayer ).getScore(), SCREEN_WIDTH * 3 / 4, SCREEN_HEIGHT / 8 );
+
+    if( session.isOver() )
     {
         mDeadTexture.renderStretched( mGameRenderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
     }
 
-    /* TRAJECTORY DRAWING
-    drawPoints( mGameRenderer, mPlayer->gPoints, mCamera );
-    */
-    SDL_RenderPresent( mGameRenderer );
+    mResolutionScaler.presentFrame();
 }
 
-void Game::restart()
+void Game::renderNumber( const int number, const int x, const int y )
 {
-    mPipes.clear();
-    if( !createLevel() )
+    // Digits in reverse order
+    int digits[ MAX_NUMBER_DIGITS ];
+    int numDigits = 0;
+    int rest = std::max( number, 0 );
+    do
     {
-        printf( "Failed to create new level!\n" );
+        digits[ numDigits++ ] = rest % 10;
+        rest /= 10;
+    }
+    while( rest > 0 && numDigits < MAX_NUMBER_DIGITS );
+
+    int totalWidth = 0;
+    for( int i = 0; i < numDigits; ++i )
+    {
+        totalWidth += SPRITE_CLIPS[ SPRITE_DIGIT_0 + digits[ i ] ].w;
     }
 
-    delete mPlayer;
+    int renderX = x - totalWidth / 2;
+    for( int i = numDigits - 1; i >= 0; --i )
+    {
+        const SDL_Rect& clip = SPRITE_CLIPS[ SPRITE_DIGIT_0 + digits[ i ] ];
+        mSpriteSheetTexture.render( mGameRenderer, renderX, y, &clip );
+        renderX += clip.w;
+    }
+}
+
+void Game::restart( const bool sameLevel )
+{
+    // The next level is normally ready since the player died, it is only built here if that failed
+    if( !sameLevel && !swapInNextLevel() && !createLevel() )
+    {
+        printf( "Failed to create new level!\n" );
+    }
 
     mGameTimer.reset();
 
-    mPlayer = new Player( this, mGameTimer.getTicks() );
+    // Keeps the loaded sprites, collision masks and sounds of the player
+    mPlayer->reset( mGameTimer.getTicks() );
 
     mCamera.x = 0; mCamera.y = 0;
+    startRun();
+}
+
+void Game::startRun()
+{
+    mRunStartTime = mGameTimer.getTicks();
+
+    mRewindBuffer.clear();
+    mRewound = false;
+    takeSnapshot( mRunStartTime );
+
+    mRunFlaps.clear();
+    if( mPhysicsMode == PHYSICS_NORMAL && !mMovingObstacles )
+    {
+        mGhosts.setRuns( mReplayLog.getBestRuns( mLevelSeed, GhostSystem::MAX_GHOSTS ) );
+    }
+    else
+    {
+        mGhosts.clear();
+    }
+
+    mWorld.resetScores( mPlayer->getPosX() );
+    updateObstacles( 0 );
+}
+
+void Game::recordRun( const int deathTime )
+{
+    ReplayRun run;
+    run.seed = mLevelSeed;
+    run.score = mPlayer->getScore();
+    run.duration = deathTime - mRunStartTime;
+    run.flapTimes = mRunFlaps;
+
+    if( !mReplayLog.addRun( run ) )
+    {
+        printf( "Could not store run!\n" );
+    }
+}
+
+void Game::takeSnapshot( const Uint32 time )
+{
+    WorldSnapshot snapshot;
+    snapshot.time = time;
+    mPlayer->saveState( snapshot.player );
+    snapshot.numFlaps = mRunFlaps.size();
+
+    mRewindBuffer.push( snapshot );
+}
+
+void Game::rewind()
+{
+    Uint32 latestTime = mRewindBuffer.getLatestTime();
+    WorldSnapshot snapshot;
+    if( !mRewindBuffer.rewindTo( latestTime > Uint32( REWIND_STEP ) ? latestTime - REWIND_STEP : 0, snapshot ) )
+    {
+        return;
+    }
+
+    mPlayer->restoreState( snapshot.player );
+    mWorld.resetScores( mPlayer->getPosX() );
+    mGameTimer.setTicks( snapshot.time );
+
+    // Flaps after the snapshot did not happen ( shrinking keeps the capacity, so nothing is allocated )
+    mRunFlaps.resize( snapshot.numFlaps );
+
+    // Ghosts only move forward, so they are replayed from the start up to the snapshot
+    mGhosts.restart();
+    mGhosts.update( snapshot.time - mRunStartTime );
+
+    moveCamera();
+    updateObstacles( snapshot.time - mRunStartTime );
+
+    mRewound = true;
 }
 
 void Game::moveCamera()
@@ -357,6 +993,39 @@ void Game::moveCamera()
     mCamera.x = mPlayer->getCollider().x - Player::PLAYER_CAMERA_OFFSET;
 }
 
+void Game::updateObstacles( const Uint32 time )
+{
+    // Pipes are sorted by X and their X never changes, so the window is found by binary search over the top rects
+    int windowBegin = mCamera.x - OBSTACLE_WINDOW_MARGIN;
+    int windowEnd = mCamera.x + mCamera.w + OBSTACLE_WINDOW_MARGIN;
+
+    // Gets the first pipe from begin on whose top rect is not before the window edge
+    auto findPipe = [this]( int begin, auto isBefore )
+    {
+        for( int count = mNumPipes - begin; count > 0; )
+        {
+            int step = count / 2;
+            if( isBefore( mWorld.getTransform( mFirstPipeEntity + 2 * ( begin + step ) ) ) )
+            {
+                begin += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        return begin;
+    };
+    int firstPipe = findPipe( 0, [windowBegin]( const TransformComponent& t ){ return t.x + t.w <= windowBegin; } );
+    int lastPipe = findPipe( firstPipe, [windowEnd]( const TransformComponent& t ){ return t.x < windowEnd; } );
+
+    mFirstNearEntity = mFirstPipeEntity + 2 * firstPipe;
+    mLastNearEntity = mFirstPipeEntity + 2 * lastPipe;
+
+    mWorld.updateMotion( time, mFirstNearEntity, mLastNearEntity );
+}
+
 Uint32 Game::getTicks() const
 {
     return mGameTimer.getTicks();
@@ -367,22 +1036,7 @@ SDL_Renderer* Game::getRenderer() const
     return mGameRenderer;
 }
 
-LTexture Game::getSpriteSheet() const
+const LTexture& Game::getSpriteSheet() const
 {
     return mSpriteSheetTexture;
 }
-
-const std::vector<Pipe> Game::getPipes()
-{
-    return mPipes;
-}
-
-
-/*
-void drawPoints( SDL_Renderer* r, std::vector<SDL_Point>& gPoints, SDL_Rect camera )
-{
-    for( auto i : gPoints )
-    {
-        SDL_RenderDrawPoint( r, i.x - camera.x, i.y + BIRD_LENGTH / 2 - camera.y );
-    }
-}*/
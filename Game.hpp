@@ -7,10 +7,18 @@
 
 #include <SDL_mixer.h>
 
+#include "FrameCache.hpp"
+#include "GhostSystem.hpp"
 #include "LTexture.hpp"
 #include "LTimer.hpp"
 #include "LevelGenerator.hpp"
+#include "LevelSolver.hpp"
 #include "Player.hpp"
+#include "ReplayLog.hpp"
+#include "ResolutionScaler.hpp"
+#include "RewindBuffer.hpp"
+#include "RollbackSession.hpp"
+#include "World.hpp"
 
 class Player;
 
@@ -30,6 +38,10 @@ public:
     // Starts game simulation
     void run();
 
+    // Plays the local bird of a rollback versus game in the window until it is closed: space flaps, the bird of the other
+    // peer flies see-through on the same level. Returns false if the peers desynced or the other one stopped answering
+    bool runVersus( RollbackSession& session );
+
     void pause();
     void unpause();
 
@@ -45,9 +57,17 @@ public:
     // Creates level using level generator. Returns path to level file
     bool createLevel();
 
-    LTexture getSpriteSheet() const;
+    // Sets physics of the game mode. Has to be called before init
+    void setPhysicsMode( const PhysicsMode mode );
+
+    // Makes levels created from now on have moving gaps
+    void enableMovingObstacles();
+
+    // Shows the predicted path of the player until the next collision ( toggled with T while playing )
+    void enableTrajectoryPreview();
 
-    const std::vector<Pipe> getPipes();
+    // Gets the sprite atlas texture shared by everything drawn in the game
+    const LTexture& getSpriteSheet() const;
 
 private:
     // The position of the game camera
@@ -56,6 +76,9 @@ private:
     // Loads required media for game
     bool loadMedia();
 
+    // Waits for the audio device and loads music. Returns whether audio is ready
+    bool loadAudio();
+
     // Game state flag
     bool mStarted;
     bool mPaused;
@@ -63,11 +86,58 @@ private:
     // Renders game objects
     void render();
 
+    // Renders background, level, ghosts, score and the player ( if alive ) into the current render target
+    void renderScene();
+
+    // Shows the scene as it was when the game stopped with overlay on top. The scene is captured into mFrameCache the first
+    // time, later calls only copy it
+    void renderStaticFrame( LTexture& overlay );
+
+    // Renders predicted path of the player, ending in a marker where it hits something
+    void renderTrajectory();
+
+    // Renders the versus level from world, both birds of session ( animated from the game time of their last flaps ) and
+    // both scores, with the death screen on top once the game is over
+    void renderVersus( const RollbackSession& session, World& world, const Uint32* lastFlaps );
+
+    // Renders number with the digit sprites, centered on x
+    void renderNumber( const int number, const int x, const int y );
+
     // Moves camera position based on player position
     void moveCamera();
 
-    // Reinitializes game variables and restarts game
-    void restart();
+    // Finds the pipe entities near the camera and runs the motion system on them for given time since the start of the run
+    // ( in milliseconds ). Only these entities are moved, collided with, scored and rendered
+    void updateObstacles( const Uint32 time );
+
+    // Reinitializes game variables and restarts game on a new level, or on the same level if sameLevel is set
+    void restart( const bool sameLevel = false );
+
+    // Generates a passable level and builds its pipes into world as numPipes pairs of entities from firstPipeEntity on. If no
+    // generated level is passable, a level of centered static gaps is used instead. Returns whether the level is passable
+    bool buildLevel( World& world, Entity& firstPipeEntity, int& numPipes, int& seed );
+
+    // Starts building the next level on a worker thread unless it is already being built or waiting
+    void prepareNextLevel();
+
+    // Waits for the worker ( it is usually done by then ) and swaps the next level in. Returns false if there is no
+    // prepared level
+    bool swapInNextLevel();
+
+    // Worker thread function building the next level of the game passed as data
+    static int buildNextLevel( void* data );
+
+    // Starts recording a run from now, empties the rewind buffer and replaces ghosts with the best stored runs of the level
+    void startRun();
+
+    // Stores the run that just ended at given time in the replay log
+    void recordRun( const int deathTime );
+
+    // Adds snapshot of the run at given game time to the rewind buffer
+    void takeSnapshot( const Uint32 time );
+
+    // Puts the run back REWIND_STEP milliseconds before the latest snapshot
+    void rewind();
 
     // Timer used in game simulation calculations
     LTimer mGameTimer;
@@ -76,15 +146,97 @@ private:
     SDL_Window* mGameWindow;
     SDL_Renderer* mGameRenderer;
 
+    // Adapts rendering resolution to frame time
+    ResolutionScaler mResolutionScaler;
+
+    // Last scene while the game is paused or the player is dead
+    FrameCache mFrameCache;
+
     // The player entity
     Player* mPlayer;
 
-    // Objects go here
-    std::vector<Pipe> mPipes;
+    // Objects of the level. Its systems move, collide, score and render them
+    World mWorld;
+
+    // Next level, built on mLevelThread while the player is dead. Only touched by the worker until it is joined
+    World mNextWorld;
+    Entity mNextFirstPipeEntity;
+    int mNextNumPipes;
+    int mNextLevelSeed;
+    SDL_Thread* mLevelThread;
+
+    // Entity of the first pipe, number of pipes and range of entities near the camera ( from first up to, not including,
+    // last )
+    Entity mFirstPipeEntity;
+    int mNumPipes;
+    Entity mFirstNearEntity, mLastNearEntity;
+
+    // How far beyond the camera on either side pipes are updated and rendered ( in pixels )
+    static const int OBSTACLE_WINDOW_MARGIN = PIPE_SPACING;
+
+    // Whether levels get moving gaps and the fraction of pipes that get one
+    bool mMovingObstacles;
+    static constexpr double MOVING_OBSTACLE_FRACTION = 0.5;
 
     // The level generator for the game
     LevelGenerator mLevelGen;
 
+    // Number of levels generated before giving up on finding a passable one
+    static const int MAX_LEVEL_ATTEMPTS = 8;
+
+    // Checks that generated levels can be passed
+    LevelSolver mLevelSolver;
+
+    // Seed of the current level
+    int mLevelSeed;
+
+    // Physics of the game mode. Runs are only stored and shown as ghosts with normal physics
+    PhysicsMode mPhysicsMode;
+
+    // Stored runs of previous games
+    ReplayLog mReplayLog;
+
+    // Ghosts of the best stored runs of the current level
+    GhostSystem mGhosts;
+
+    // Start time of the current run and times of its flaps since the start ( in milliseconds )
+    int mRunStartTime;
+    std::vector<Uint32> mRunFlaps;
+
+    // Flaps stored before the flap list of a run has to grow ( minutes of play, the list keeps its memory between runs )
+    static const int RUN_FLAPS_RESERVE = 1024;
+
+    // How far back one rewind goes ( in milliseconds )
+    static const int REWIND_STEP = 1000;
+
+    // Latest snapshots of the current run for practice rewinds
+    RewindBuffer mRewindBuffer;
+
+    // Whether the current run was rewound ( such runs are not stored in the replay log )
+    bool mRewound;
+
+    // Whether the trajectory preview is shown, how far ahead it looks ( in milliseconds ) and the points of its arc
+    bool mShowTrajectory;
+    static const int TRAJECTORY_PREVIEW_TIME = 1000;
+    static const int TRAJECTORY_ARC_POINTS = 32;
+
+    // Size of the impact marker ( in pixels ) and points of the marker, drawn as part of the same line strip as the arc
+    static const int TRAJECTORY_MARKER_SIZE = BIRD_LENGTH / 6;
+    static const int TRAJECTORY_MARKER_POINTS = 5;
+
+    // Line strip of the trajectory preview, filled again every frame
+    SDL_Point mTrajectoryPoints[ TRAJECTORY_ARC_POINTS + TRAJECTORY_MARKER_POINTS ];
+
+    // Opacity of the bird of the other peer in versus
+    static const Uint8 VERSUS_RIVAL_ALPHA = 0x80;
+
+    // Most digits renderNumber draws
+    static const int MAX_NUMBER_DIGITS = 10;
+
+    // Decoded sprite atlas in RGBA32. Kept from loading media until the player has built its collision masks from it, so the
+    // atlas is only decoded once
+    SDL_Surface* mSpriteSheetSurface;
+
     // Textures needed for game
     LTexture mSpriteSheetTexture;
     LTexture mStartScreenTexture;
@@ -93,8 +245,7 @@ private:
 
     // Clip rectangles for texture clipping
     SDL_Rect mBackgroundClipRect;
-    SDL_Rect mTopPipeClipRect;
-    SDL_Rect mBotPipeClipRect;
+    SDL_Rect mGhostClipRect;
 
     // Is game initialized flag
     bool mInitialized;
@@ -103,6 +254,4 @@ private:
     Mix_Music* mGameMusic;
 };
 
-void drawPoints( SDL_Renderer* r, std::vector<SDL_Point>& gPoints, SDL_Rect camera );
-
 #endif // _GAME_HPP_INCLUDED
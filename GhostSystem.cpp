@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <SDL.h>
+
+#include "constants.hpp"
+#include "GhostSystem.hpp"
+#include "Physics.hpp"
+#include "ReplayLog.hpp"
+
+// Rotation limits of ghost birds ( in degrees ), the ones of the player in single precision
+static const float GS_ROTATION_MIN = float( BIRD_ROTATION_AFTER_FLAP );
+static const float GS_ROTATION_MAX = float( BIRD_ROTATION_MAX );
+
+static const float GS_DEGREES_TO_RADIANS = float( M_PI / 180.0 );
+
+// Gravity in single precision so the position loop stays in floats
+static const float GS_GRAVITY = float( GRAVITY );
+
+GhostSystem::GhostSystem()
+{
+    mNumGhosts = 0;
+    mTime = 0;
+
+    mVertices.resize( MAX_GHOSTS * 4 );
+
+    // Quads never change their corners, so the indices are built once
+    mIndices.resize( MAX_GHOSTS * 6 );
+    for( int i = 0; i < MAX_GHOSTS; ++i )
+    {
+        mIndices[ i * 6 + 0 ] = i * 4 + 0;
+        mIndices[ i * 6 + 1 ] = i * 4 + 1;
+        mIndices[ i * 6 + 2 ] = i * 4 + 2;
+        mIndices[ i * 6 + 3 ] = i * 4 + 0;
+        mIndices[ i * 6 + 4 ] = i * 4 + 2;
+        mIndices[ i * 6 + 5 ] = i * 4 + 3;
+    }
+}
+
+void GhostSystem::setRuns( const std::vector<ReplayRun>& runs )
+{
+    clear();
+
+    mNumGhosts = std::min( int( runs.size() ), int( MAX_GHOSTS ) );
+    mNextFlap.resize( mNumGhosts );
+    mFlapEnd.resize( mNumGhosts );
+    mSegmentTime.assign( mNumGhosts, 0 );
+    mSegmentY.assign( mNumGhosts, float( PLAYER_START_Y ) );
+    mSegmentVelY.assign( mNumGhosts, 0.f );
+    mDeathTime.resize( mNumGhosts );
+    mPosY.assign( mNumGhosts, float( PLAYER_START_Y ) );
+    mVelY.assign( mNumGhosts, 0.f );
+
+    for( int i = 0; i < mNumGhosts; ++i )
+    {
+        mNextFlap[ i ] = mFlapTimes.size();
+        mFlapTimes.insert( mFlapTimes.end(), runs[ i ].flapTimes.begin(), runs[ i ].flapTimes.end() );
+        mFlapEnd[ i ] = mFlapTimes.size();
+        mDeathTime[ i ] = runs[ i ].duration;
+    }
+}
+
+void GhostSystem::clear()
+{
+    mNumGhosts = 0;
+    mTime = 0;
+    mFlapTimes.clear();
+}
+
+void GhostSystem::restart()
+{
+    for( int i = 0; i < mNumGhosts; ++i )
+    {
+        mNextFlap[ i ] = i == 0 ? 0 : mFlapEnd[ i - 1 ];
+        mSegmentTime[ i ] = 0;
+        mSegmentY[ i ] = PLAYER_START_Y;
+        mSegmentVelY[ i ] = 0.f;
+    }
+    mTime = 0;
+}
+
+void GhostSystem::update( const Uint32 time )
+{
+    mTime = time;
+
+    // Start a new free fall for every flap passed since the last update. Flaps are rare, so this loop is mostly skipped
+    for( int i = 0; i < mNumGhosts; ++i )
+    {
+        while( mNextFlap[ i ] < mFlapEnd[ i ] && mFlapTimes[ mNextFlap[ i ] ] <= std::min( time, mDeathTime[ i ] ) )
+        {
+            Uint32 flapTime = mFlapTimes[ mNextFlap[ i ] ];
+            float t = ( flapTime - mSegmentTime[ i ] ) / 1000.f;
+            mSegmentY[ i ] = std::max( float( PHYS_moveY( mSegmentY[ i ], mSegmentVelY[ i ], t ) ), 0.f );
+            mSegmentVelY[ i ] = -FLAP_HEIGHT;
+            mSegmentTime[ i ] = flapTime;
+            ++mNextFlap[ i ];
+        }
+    }
+
+    // Position every ghost along its current free fall ( ghosts stop where they died )
+    const Uint32* segmentTime = mSegmentTime.data();
+    const Uint32* deathTime = mDeathTime.data();
+    const float* segmentY = mSegmentY.data();
+    const float* segmentVelY = mSegmentVelY.data();
+    float* posY = mPosY.data();
+    float* velY = mVelY.data();
+    for( int i = 0; i < mNumGhosts; ++i )
+    {
+        float t = ( std::min( time, deathTime[ i ] ) - segmentTime[ i ] ) / 1000.f;
+        posY[ i ] = std::max( segmentY[ i ] + segmentVelY[ i ] * t + GS_GRAVITY * t * t / 2, 0.f );
+        velY[ i ] = segmentVelY[ i ] + GS_GRAVITY * t;
+    }
+}
+
+void GhostSystem::render( SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& clip, const int camPosX, const int camPosY )
+{
+    if( mNumGhosts == 0 || texture == nullptr )
+    {
+        return;
+    }
+
+    int textureWidth = 0, textureHeight = 0;
+    SDL_QueryTexture( texture, nullptr, nullptr, &textureWidth, &textureHeight );
+
+    const float u0 = float( clip.x ) / textureWidth, u1 = float( clip.x + clip.w ) / textureWidth;
+    const float v0 = float( clip.y ) / textureHeight, v1 = float( clip.y + clip.h ) / textureHeight;
+    const SDL_Color color = { 0xff, 0xff, 0xff, GHOST_ALPHA };
+
+    const float halfWidth = PLAYER_WIDTH / 2.f, halfHeight = PLAYER_HEIGHT / 2.f;
+
+    // All ghosts move with the camera velocity, so they share their X position at a given time
+    const float centerX = PLAYER_START_X + CAMERA_VELOCITY * ( mTime / 1000.f ) - camPosX + halfWidth;
+
+    int numQuads = 0;
+    for( int i = 0; i < mNumGhosts; ++i )
+    {
+        // Dead ghosts are not shown
+        if( mTime >= mDeathTime[ i ] )
+        {
+            continue;
+        }
+
+        // Tilt bird along its path ( the player eases into the same range with its rotation speed )
+        float angle = std::atan2( mVelY[ i ], float( CAMERA_VELOCITY ) ) / GS_DEGREES_TO_RADIANS;
+        angle = std::min( std::max( angle, GS_ROTATION_MIN ), GS_ROTATION_MAX ) * GS_DEGREES_TO_RADIANS;
+        const float cosAngle = std::cos( angle ), sinAngle = std::sin( angle );
+
+        const float centerY = mPosY[ i ] - camPosY + halfHeight;
+
+        // Corners of the rotated quad, clockwise from top left
+        const float cornerX[ 4 ] = { -halfWidth, halfWidth, halfWidth, -halfWidth };
+        const float cornerY[ 4 ] = { -halfHeight, -halfHeight, halfHeight, halfHeight };
+        const float cornerU[ 4 ] = { u0, u1, u1, u0 };
+        const float cornerV[ 4 ] = { v0, v0, v1, v1 };
+
+        SDL_Vertex* quad = &mVertices[ numQuads * 4 ];
+        for( int corner = 0; corner < 4; ++corner )
+        {
+            quad[ corner ].position.x = centerX + cornerX[ corner ] * cosAngle - cornerY[ corner ] * sinAngle;
+            quad[ corner ].position.y = centerY + cornerX[ corner ] * sinAngle + cornerY[ corner ] * cosAngle;
+            quad[ corner ].color = color;
+            quad[ corner ].tex_coord.x = cornerU[ corner ];
+            quad[ corner ].tex_coord.y = cornerV[ corner ];
+        }
+        ++numQuads;
+    }
+
+    if( numQuads > 0 && SDL_RenderGeometry( renderer, texture, mVertices.data(), numQuads * 4, mIndices.data(), numQuads * 6 ) != 0 )
+    {
+        printf( "Could not render ghosts! SDL_Error: %s\n", SDL_GetError() );
+    }
+}
+
+int GhostSystem::getNumGhosts() const
+{
+    return mNumGhosts;
+}
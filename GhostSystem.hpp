@@ -0,0 +1,78 @@
+#ifndef _GHOSTSYSTEM_HPP_INCLUDED
+#define _GHOSTSYSTEM_HPP_INCLUDED
+
+#include <vector>
+
+#include <SDL.h>
+
+#include "ReplayLog.hpp"
+
+// Translucent birds replaying stored runs alongside the player. Ghost state is kept in parallel arrays so all ghosts are
+// advanced in one pass, and all of them are drawn with a single geometry submission
+class GhostSystem{
+
+public:
+
+    // Most ghosts shown at once
+    static const int MAX_GHOSTS = 512;
+
+    // Opacity of ghost birds
+    static const Uint8 GHOST_ALPHA = 96;
+
+    // Initializes internal variables
+    GhostSystem();
+
+    // Deallocates memory
+    ~GhostSystem() = default;
+
+    // Replaces ghosts with the first MAX_GHOSTS of runs, all starting at the beginning
+    void setRuns( const std::vector<ReplayRun>& runs );
+
+    // Removes all ghosts
+    void clear();
+
+    // Moves all ghosts back to the start of their runs ( for going back in time )
+    void restart();
+
+    // Moves every ghost to where its run was at given time since the start ( in milliseconds )
+    void update( const Uint32 time );
+
+    // Renders ghosts still alive with texture clip of texture in one batch
+    void render( SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& clip, const int camPosX, const int camPosY );
+
+    // Gets number of loaded ghosts
+    int getNumGhosts() const;
+
+private:
+
+    // Number of loaded ghosts
+    int mNumGhosts;
+
+    // Time since the start of the runs of the last update ( in milliseconds )
+    Uint32 mTime;
+
+    // Flap times of every ghost, one run after another
+    std::vector<Uint32> mFlapTimes;
+
+    // Index of the next flap in mFlapTimes and index one past the last flap of each ghost
+    std::vector<int> mNextFlap;
+    std::vector<int> mFlapEnd;
+
+    // Start time ( in milliseconds ), Y position and Y velocity of the current free fall of each ghost
+    std::vector<Uint32> mSegmentTime;
+    std::vector<float> mSegmentY;
+    std::vector<float> mSegmentVelY;
+
+    // Time of death of each ghost ( in milliseconds )
+    std::vector<Uint32> mDeathTime;
+
+    // Y position and Y velocity of each ghost at the last update
+    std::vector<float> mPosY;
+    std::vector<float> mVelY;
+
+    // Vertices ( four per ghost ) and indices ( six per ghost ) of the batch
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;
+};
+
+#endif // _GHOSTSYSTEM_HPP_INCLUDED
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <vector>
+
+#include <SDL.h>
+
+#include "CollisionDetection.hpp"
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+HeadlessGame::HeadlessGame()
+{
+    mPosX = PHYS_fromDouble( PLAYER_START_X );
+    mPosY = PHYS_fromDouble( PLAYER_START_Y );
+    mVelY = PHYS_fromDouble( 0.0 );
+
+    mScore = 0;
+    mNextPipe = 0;
+    mSeed = 0;
+
+    mAlive = true;
+
+    mPhysicsMode = PHYSICS_NORMAL;
+
+    mLevel.reserve( NUM_OBSTACLES );
+}
+
+void HeadlessGame::reset( const LevelGenerator& generator, const int seed, const PhysicsMode mode )
+{
+    mPhysicsMode = mode;
+
+    mPosX = PHYS_fromDouble( PLAYER_START_X );
+    mPosY = PHYS_fromDouble( PLAYER_START_Y );
+    mVelY = PHYS_fromDouble( 0.0 );
+
+    mScore = 0;
+    mNextPipe = 0;
+    mSeed = seed;
+
+    mAlive = true;
+
+    generator.generate( mSeed, mLevel, INITIAL_PIPES );
+}
+
+bool HeadlessGame::step( const LevelGenerator& generator, const bool flap, const double duration )
+{
+    switch( mPhysicsMode )
+    {
+        case PHYSICS_EASY:
+            return stepWith<EasyPhysics>( generator, flap, duration );
+        case PHYSICS_HARD:
+            return stepWith<HardPhysics>( generator, flap, duration );
+        case PHYSICS_LOW_GRAVITY:
+            return stepWith<LowGravityPhysics>( generator, flap, duration );
+        default:
+            return stepWith<NormalPhysics>( generator, flap, duration );
+    }
+}
+
+template<class Profile>
+bool HeadlessGame::stepWith( const LevelGenerator& generator, const bool flap, const double duration )
+{
+    if( !mAlive )
+    {
+        return false;
+    }
+
+#ifdef FIXED_POINT_PHYSICS
+    if( flap )
+    {
+        mVelY = -FixedProfile<Profile>::FLAP_HEIGHT;
+    }
+
+    // Same as below with integers only
+    FixedBody body = { mPosX, mPosY, mVelY };
+    const FixedTime time = FX_toTime( duration );
+    const Sint64 reach = Sint64( body.posX ) + PLAYER_WIDTH * FIXED_ONE +
+                         FX_shiftRound( Sint64( FixedProfile<Profile>::CAMERA_VELOCITY ) * time, FIXED_TIME_BITS );
+    bool collided = false;
+    FixedTime moveTime = time;
+    for( size_t i = mNextPipe; i < mLevel.size() && Sint64( mLevel[ i ].getTopRect().x ) * FIXED_ONE < reach; ++i )
+    {
+        if( FX_checkPipeCollision<Profile>( body, time, mLevel[ i ].getTopRect(), mLevel[ i ].getBotRect(), &moveTime ) )
+        {
+            collided = true;
+            break;
+        }
+    }
+
+    FX_move<Profile>( body, moveTime );
+    mPosX = body.posX;
+    mPosY = std::max( body.posY, 0 );
+    mVelY = body.velY;
+#else
+    if( flap )
+    {
+        mVelY = -Profile::FLAP_HEIGHT;
+    }
+
+    // Check collision with the pipes the player can reach during the move along the whole path. Pipes are sorted by X, so
+    // the first one hit is the earliest impact
+    bool collided = false;
+    double moveTime = duration;
+    for( size_t i = mNextPipe; i < mLevel.size() && mLevel[ i ].getTopRect().x < mPosX + PLAYER_WIDTH + Profile::CAMERA_VELOCITY * duration; ++i )
+    {
+        double topImpact = duration, botImpact = duration;
+        bool hitTop = CD_checkSweptCollision( mPosX, mPosY, PLAYER_WIDTH, PLAYER_HEIGHT, Profile::CAMERA_VELOCITY, mVelY, Profile::GRAVITY, duration, mLevel[ i ].getTopRect(), &topImpact );
+        bool hitBot = CD_checkSweptCollision( mPosX, mPosY, PLAYER_WIDTH, PLAYER_HEIGHT, Profile::CAMERA_VELOCITY, mVelY, Profile::GRAVITY, duration, mLevel[ i ].getBotRect(), &botImpact );
+        if( hitTop || hitBot )
+        {
+            collided = true;
+            moveTime = std::min( hitTop ? topImpact : duration, hitBot ? botImpact : duration );
+            break;
+        }
+    }
+
+    // Like Player::move, only move up to the point of impact ( of the box, which can come before the first pixel contact )
+    mPosX += Profile::CAMERA_VELOCITY * moveTime;
+    mPosY = PHYS_moveY<Profile>( mPosY, mVelY, moveTime );
+    mVelY = PHYS_moveVelY<Profile>( mVelY, moveTime );
+
+    if( mPosY < 0 )
+    {
+        mPosY = 0;
+    }
+#endif // FIXED_POINT_PHYSICS
+
+    // Count passed pipes and skip the ones behind the player
+    while( mScore < int( mLevel.size() ) && PHYS_fromDouble( mLevel[ mScore ].getTopRect().x ) < mPosX )
+    {
+        ++mScore;
+    }
+    while( mNextPipe < int( mLevel.size() ) &&
+           PHYS_fromDouble( mLevel[ mNextPipe ].getTopRect().x + mLevel[ mNextPipe ].getTopRect().w ) <= mPosX )
+    {
+        ++mNextPipe;
+    }
+
+    if( collided || mPosY + PHYS_fromDouble( PLAYER_HEIGHT ) > PHYS_fromDouble( SCREEN_HEIGHT ) )
+    {
+        mAlive = false;
+    }
+
+    // Generate more of the level if the player is getting close to the end of the generated part
+    int numPipes = mLevel.size();
+    if( mAlive && numPipes < NUM_OBSTACLES && mNextPipe + 2 >= numPipes )
+    {
+        generator.generate( mSeed, mLevel, std::min( 2 * numPipes, NUM_OBSTACLES ) );
+    }
+
+    return mAlive;
+}
+
+void HeadlessGame::saveState( HeadlessState& state ) const
+{
+    state.posX = mPosX;
+    state.posY = mPosY;
+    state.velY = mVelY;
+    state.score = mScore;
+    state.nextPipe = mNextPipe;
+    state.alive = mAlive;
+}
+
+void HeadlessGame::restoreState( const HeadlessState& state )
+{
+    mPosX = state.posX;
+    mPosY = state.posY;
+    mVelY = state.velY;
+    mScore = state.score;
+    mNextPipe = state.nextPipe;
+    mAlive = state.alive;
+}
+
+double HeadlessGame::getPosX() const
+{
+    return PHYS_toDouble( mPosX );
+}
+
+double HeadlessGame::getPosY() const
+{
+    return PHYS_toDouble( mPosY );
+}
+
+double HeadlessGame::getVelY() const
+{
+    return PHYS_toDouble( mVelY );
+}
+
+int HeadlessGame::getScore() const
+{
+    return mScore;
+}
+
+int HeadlessGame::getNextPipe() const
+{
+    return mNextPipe;
+}
+
+const std::vector<Pipe>& HeadlessGame::getLevel() const
+{
+    return mLevel;
+}
+
+PhysicsMode HeadlessGame::getPhysicsMode() const
+{
+    return mPhysicsMode;
+}
+
+bool HeadlessGame::isAlive() const
+{
+    return mAlive;
+}
+
+bool HeadlessGame::isFinished() const
+{
+    return mNextPipe == NUM_OBSTACLES;
+}
@@ -0,0 +1,99 @@
+#ifndef _HEADLESSGAME_HPP_INCLUDED
+#define _HEADLESSGAME_HPP_INCLUDED
+
+#include <vector>
+
+#include <SDL.h>
+
+#include "FixedPhysics.hpp"
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Everything that changes while a headless game steps. The level is left out because it only grows and its prefix is
+// the same for a seed
+struct HeadlessState{
+    PhysicsScalar posX, posY, velY;
+    Sint32 score;
+    Sint32 nextPipe;
+    Uint8 alive;
+};
+
+// One game without window, textures or sound: the player moves with the game physics and a swept collision of the player
+// collider box. Without sprites there are no alpha masks, so unlike Player::move there is no pixel accurate check after the
+// box hits and the headless player dies on some pipe corners the bird in the game clears. Used by the training environment,
+// the simulation server and rollback versus
+class HeadlessGame{
+
+public:
+
+    // Number of pipes generated when a game starts. Most games end early, so the rest of the level is generated in doubling
+    // steps only when the player gets close to its end
+    static const int INITIAL_PIPES = 16;
+
+    // Initializes internal variables
+    HeadlessGame();
+
+    // Deallocates memory
+    ~HeadlessGame() = default;
+
+    // Starts a new game on the level of given seed with the physics of mode. Reuses the memory of the last level
+    void reset( const LevelGenerator& generator, const int seed, const PhysicsMode mode = PHYSICS_NORMAL );
+
+    // Flaps if requested and moves the player for duration ( in seconds ). Returns whether player is still alive
+    bool step( const LevelGenerator& generator, const bool flap, const double duration );
+
+    PhysicsMode getPhysicsMode() const;
+
+    // Copies the changing state of the game into state
+    void saveState( HeadlessState& state ) const;
+
+    // Puts game back into a state saved on the current level
+    void restoreState( const HeadlessState& state );
+
+    double getPosX() const;
+    double getPosY() const;
+    double getVelY() const;
+
+    // Gets number of pipes whose left side the player has passed
+    int getScore() const;
+
+    // Gets index of the first pipe that is not completely behind the player
+    int getNextPipe() const;
+
+    // Gets generated part of the level
+    const std::vector<Pipe>& getLevel() const;
+
+    bool isAlive() const;
+
+    // Checks whether the player got past every pipe of the level
+    bool isFinished() const;
+
+private:
+
+    // Step with the constants of a physics profile
+    template<class Profile>
+    bool stepWith( const LevelGenerator& generator, const bool flap, const double duration );
+
+    // Physics of the current game
+    PhysicsMode mPhysicsMode;
+
+    // Position and Y velocity of the player ( same units as Player, in fixed point in builds with fixed-point physics )
+    PhysicsScalar mPosX, mPosY, mVelY;
+
+    // Number of pipes whose left side the player has passed
+    int mScore;
+
+    // Index of the first pipe that is not completely behind the player
+    int mNextPipe;
+
+    // Seed of the current level
+    int mSeed;
+
+    bool mAlive;
+
+    // Generated part of the current level
+    std::vector<Pipe> mLevel;
+};
+
+#endif // _HEADLESSGAME_HPP_INCLUDED
@@ -49,7 +49,13 @@ void LTexture::renderStretched( SDL_Renderer* renderer, const int x, const int y
 
 bool LTexture::loadFromFile( SDL_Renderer* renderer, const std::string& path, const SDL_Color* colorKey )
 {
-    SDL_Surface* loadedSurface = IMG_Load( path.c_str() );
+    return loadFromRW( renderer, SDL_RWFromFile( path.c_str(), "rb" ), path, colorKey );
+}
+
+bool LTexture::loadFromRW( SDL_Renderer* renderer, SDL_RWops* source, const std::string& path, const SDL_Color* colorKey )
+{
+    // Source is closed by the loader, also when loading fails
+    SDL_Surface* loadedSurface = IMG_Load_RW( source, 1 );
     if( loadedSurface == nullptr )
     {
         printf( "Could not load surface from path %s ! IMG_Error: %s\n", path.c_str(), IMG_GetError() );
@@ -68,16 +74,7 @@ bool LTexture::loadFromFile( SDL_Renderer* renderer, const std::string& path, co
         else
         {
             // Attempt to create a texture from our loaded surface
-            mTexture = SDL_CreateTextureFromSurface( renderer, loadedSurface );
-            if( mTexture == nullptr )
-            {
-                printf( "Could not create texture from surface %s ! SDL_Error: %s\n", path.c_str(), SDL_GetError() );
-            }
-            else
-            {
-                mWidth = loadedSurface->w;
-                mHeight = loadedSurface->h;
-            }
+            loadFromSurface( renderer, loadedSurface, path );
         }
         // Free unnecessary surface
         SDL_FreeSurface( loadedSurface );
@@ -86,6 +83,22 @@ bool LTexture::loadFromFile( SDL_Renderer* renderer, const std::string& path, co
     return mTexture != nullptr;
 }
 
+bool LTexture::loadFromSurface( SDL_Renderer* renderer, SDL_Surface* surface, const std::string& path )
+{
+    mTexture = SDL_CreateTextureFromSurface( renderer, surface );
+    if( mTexture == nullptr )
+    {
+        printf( "Could not create texture from surface %s ! SDL_Error: %s\n", path.c_str(), SDL_GetError() );
+    }
+    else
+    {
+        mWidth = surface->w;
+        mHeight = surface->h;
+    }
+
+    return mTexture != nullptr;
+}
+
 bool LTexture::loadFromRenderedText( SDL_Renderer* renderer, const std::string& text, TTF_Font* textFont, const SDL_Color textColor )
 {
     // Attempt to create surface from given text
@@ -139,4 +152,8 @@ int LTexture::getHeight() const
     return mHeight;
 }
 
+SDL_Texture* LTexture::getTexture() const
+{
+    return mTexture;
+}
 
@@ -26,6 +26,12 @@ public:
     // Loads image from given path. Returns whether load was successful. Optional color keying
     bool loadFromFile( SDL_Renderer* renderer, const std::string& path, const SDL_Color* colorKey = nullptr );
 
+    // Loads image from source ( closed afterwards ), path is only used in error messages. Returns whether load was successful
+    bool loadFromRW( SDL_Renderer* renderer, SDL_RWops* source, const std::string& path, const SDL_Color* colorKey = nullptr );
+
+    // Creates texture from surface ( still owned by the caller ), path is only used in error messages. Returns whether it succeeded
+    bool loadFromSurface( SDL_Renderer* renderer, SDL_Surface* surface, const std::string& path );
+
     // Creates texture from text with given font, text size, and text color
     bool loadFromRenderedText( SDL_Renderer* renderer, const std::string& text, TTF_Font* textFont, const SDL_Color textColor = { 0, 0, 0, 255 } );
 
@@ -42,6 +48,9 @@ public:
     int getWidth() const;
     int getHeight() const;
 
+    // Gets the hardware texture for batched rendering
+    SDL_Texture* getTexture() const;
+
     //Set texture width/height for custom rendering dimensions
     // void setWidth( int w );
     // void setHeight( int h );
@@ -93,3 +93,18 @@ void LTimer::reset()
     stop();
     start();
 }
+
+void LTimer::setTicks( const Uint32 ticks )
+{
+    if( mStarted )
+    {
+        if( mPaused )
+        {
+            mPausedTicks = ticks;
+        }
+        else
+        {
+            mStartedTicks = SDL_GetTicks() - ticks;
+        }
+    }
+}
@@ -17,6 +17,9 @@ public:
     // Resets the timer
     void reset();
 
+    // Moves the timer so it reads given ticks now, keeping it paused or running
+    void setTicks( const Uint32 ticks );
+
     Uint32 getTicks() const;
     double getTicksSeconds() const;
 
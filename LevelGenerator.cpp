@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <string>
 #include <random>
@@ -8,6 +10,8 @@
 #include <SDL.h>
 
 #include "LevelGenerator.hpp"
+#include "LevelSolver.hpp"
+#include "Physics.hpp"
 #include "constants.hpp"
 
 Pipe::Pipe( int x, int y, int w, int h )
@@ -21,6 +25,67 @@ Pipe::Pipe( int x, int y, int w, int h )
     mBottomRect.y = mTopRect.y + mTopRect.h + PIPE_GAP;
     mBottomRect.w = w;
     mBottomRect.h = SCREEN_HEIGHT - mBottomRect.y;
+
+    mBaseTopHeight = mTopRect.h;
+    mBaseBotY = mBottomRect.y;
+
+    mMotion = { PIPE_STATIC, 0, 1, 0 };
+}
+
+void Pipe::setMotion( const PipeMotion motion, const int amplitude, const int period, const int phase )
+{
+    mMotion = { motion, amplitude, std::max( period, 1 ), phase };
+
+    // Static pipes go back to where they were generated
+    mTopRect.h = mBaseTopHeight;
+    mBottomRect.y = mBaseBotY;
+    mBottomRect.h = SCREEN_HEIGHT - mBaseBotY;
+    update( 0 );
+}
+
+void Pipe::update( const Uint32 time )
+{
+    if( mMotion.type == PIPE_STATIC )
+    {
+        return;
+    }
+
+    int topShift, botShift;
+    getGapShift( mMotion, time, &topShift, &botShift );
+
+    mTopRect.h = mBaseTopHeight + topShift;
+    mBottomRect.y = mBaseBotY + botShift;
+    mBottomRect.h = SCREEN_HEIGHT - mBottomRect.y;
+}
+
+void Pipe::getGapShift( const GapMotion& motion, const Uint32 time, int* topShift, int* botShift )
+{
+    *topShift = *botShift = 0;
+    if( motion.type == PIPE_STATIC )
+    {
+        return;
+    }
+
+    double angle = 2.0 * M_PI * ( ( time + motion.phase ) % motion.period ) / motion.period;
+
+    if( motion.type == PIPE_OSCILLATING )
+    {
+        int offset = std::lround( motion.amplitude * std::sin( angle ) );
+        *topShift = offset;
+        *botShift = offset;
+    }
+    else
+    {
+        // Fully open at the start of the period and closed by the amplitude halfway through
+        int narrowing = std::lround( motion.amplitude * ( 1.0 - std::cos( angle ) ) / 4 );
+        *topShift = narrowing;
+        *botShift = -narrowing;
+    }
+}
+
+bool Pipe::isMoving() const
+{
+    return mMotion.type != PIPE_STATIC;
 }
 
 SDL_Rect Pipe::getTopRect() const
@@ -33,6 +98,21 @@ SDL_Rect Pipe::getBotRect() const
     return mBottomRect;
 }
 
+const GapMotion& Pipe::getMotion() const
+{
+    return mMotion;
+}
+
+int Pipe::getBaseTopHeight() const
+{
+    return mBaseTopHeight;
+}
+
+int Pipe::getBaseBotY() const
+{
+    return mBaseBotY;
+}
+
 void Pipe::render( SDL_Renderer* renderer, const SDL_Rect camera, LTexture& srcTexture, SDL_Rect topClip, SDL_Rect botClip ) const
 {
     SDL_Rect renderRectTop = { mTopRect.x - camera.x, mTopRect.y - camera.y, mTopRect.w, mTopRect.h };
@@ -52,43 +132,147 @@ void Pipe::render( SDL_Renderer* renderer, const SDL_Rect camera, LTexture& srcT
     srcTexture.renderStretched( renderer, renderRectBot.x, renderRectBot.y, &renderRectBot, &botClip );
 }
 
-std::vector<Pipe> LevelGenerator::generate( const int seed )
+LevelGenerator::LevelGenerator( const PhysicsMode mode )
 {
-    std::vector<Pipe> level;
+    mPhysicsMode = mode;
+    mMinChange = DEFAULT_MIN_CHANGE;
+    mMaxChange = DEFAULT_MAX_CHANGE;
+    mMovingFraction = 0.0;
 
-    std::mt19937 generatorRandomEngine( seed );
+    // All gaps lie well inside the screen so whether a transition is feasible only depends on the change of height.
+    // Find the largest climb and drop with binary searches, starting from the highest gap so the ceiling is accounted for
+    int heightRange = PIPE_MAX_HEIGHT - PIPE_MIN_HEIGHT;
+    int maxClimb = 0, maxDrop = 0;
 
-    std::uniform_int_distribution<int> generatorDist( PIPE_MIN_HEIGHT, PIPE_MAX_HEIGHT );
-    auto pipeGen = std::bind( generatorDist, std::ref(generatorRandomEngine) );
+    int low = 0, high = heightRange;
+    while( low < high )
+    {
+        int change = ( low + high + 1 ) / 2;
+        if( checkTransition( PIPE_MIN_HEIGHT + change, PIPE_MIN_HEIGHT ) )
+        {
+            low = change;
+        }
+        else
+        {
+            high = change - 1;
+        }
+    }
+    maxClimb = low;
 
-    int currentPipePosX = STARTING_OFFSET;
-    for( int i = 0; i < NUM_OBSTACLES; ++i )
+    low = 0; high = heightRange;
+    while( low < high )
     {
-        int currentPipeHeight = pipeGen();
-        level.push_back( Pipe( currentPipePosX, 0, BLOCK_WIDTH, currentPipeHeight ) );
-        currentPipePosX += 3 * BLOCK_WIDTH;
+        int change = ( low + high + 1 ) / 2;
+        if( checkTransition( PIPE_MIN_HEIGHT, PIPE_MIN_HEIGHT + change ) )
+        {
+            low = change;
+        }
+        else
+        {
+            high = change - 1;
+        }
     }
+    maxDrop = low;
 
-    return level;
+    // Fill reachability table
+    mMinNextHeight.resize( heightRange + 1 );
+    mMaxNextHeight.resize( heightRange + 1 );
+    for( int height = PIPE_MIN_HEIGHT; height <= PIPE_MAX_HEIGHT; ++height )
+    {
+        mMinNextHeight[ height - PIPE_MIN_HEIGHT ] = std::max( height - maxClimb, PIPE_MIN_HEIGHT );
+        mMaxNextHeight[ height - PIPE_MIN_HEIGHT ] = std::min( height + maxDrop, PIPE_MAX_HEIGHT );
+    }
 }
 
-std::vector<Pipe> LevelGenerator::generate()
+bool LevelGenerator::checkTransition( const int fromHeight, const int toHeight ) const
 {
+    // Two pipes of each height let the player settle into the first gap and require him to stay in the second
     std::vector<Pipe> level;
+    int pipePosX = PLAYER_START_X + PLAYER_WIDTH + PIPE_SPACING;
+    for( int i = 0; i < 4; ++i )
+    {
+        level.push_back( Pipe( pipePosX, 0, BLOCK_WIDTH, i < 2 ? fromHeight : toHeight ) );
+        pipePosX += PIPE_SPACING;
+    }
 
-    std::mt19937 generatorRandomEngine( time( nullptr ) );
+    LevelSolver solver( LevelSolver::DEFAULT_TICK_DURATION, mPhysicsMode );
+    return solver.solve( level );
+}
+
+void LevelGenerator::setMovingFraction( const double movingFraction )
+{
+    mMovingFraction = std::max( 0.0, std::min( movingFraction, 1.0 ) );
+}
+
+void LevelGenerator::setDifficulty( const double minChange, const double maxChange )
+{
+    mMinChange = std::max( 0.0, std::min( minChange, 1.0 ) );
+    mMaxChange = std::max( mMinChange, std::min( maxChange, 1.0 ) );
+}
+
+std::vector<Pipe> LevelGenerator::generate( const int seed )
+{
+    std::vector<Pipe> level;
+    generate( seed, level );
+
+    return level;
+}
+
+void LevelGenerator::generate( const int seed, std::vector<Pipe>& level, const int numPipes ) const
+{
+    level.clear();
+    level.reserve( numPipes );
+
+    std::mt19937 generatorRandomEngine( seed );
 
     std::uniform_int_distribution<int> generatorDist( PIPE_MIN_HEIGHT, PIPE_MAX_HEIGHT );
-    auto pipeGen = std::bind( generatorDist, std::ref(generatorRandomEngine) );
+    std::uniform_real_distribution<double> changeDist( mMinChange, mMaxChange );
+    std::bernoulli_distribution climbDist( 0.5 );
+
+    // The first pipe can have any height since the player has the warmup to get to it
+    int currentPipeHeight = generatorDist( generatorRandomEngine );
 
     int currentPipePosX = STARTING_OFFSET;
-    for( int i = 0; i < NUM_OBSTACLES; ++i )
+    for( int i = 0; i < numPipes; ++i )
     {
-        int currentPipeHeight = pipeGen();
         level.push_back( Pipe( currentPipePosX, 0, BLOCK_WIDTH, currentPipeHeight ) );
-        currentPipePosX += 3 * BLOCK_WIDTH;
+        currentPipePosX += PIPE_SPACING;
+
+        // Draw the next height from the chosen band of the reachable heights, climbing or dropping
+        int maxClimb = currentPipeHeight - mMinNextHeight[ currentPipeHeight - PIPE_MIN_HEIGHT ];
+        int maxDrop = mMaxNextHeight[ currentPipeHeight - PIPE_MIN_HEIGHT ] - currentPipeHeight;
+        bool climb = maxDrop == 0 || ( maxClimb != 0 && climbDist( generatorRandomEngine ) );
+        int change = std::lround( changeDist( generatorRandomEngine ) * ( climb ? maxClimb : maxDrop ) );
+        currentPipeHeight += climb ? -change : change;
     }
 
-    return level;
+    if( mMovingFraction <= 0.0 )
+    {
+        return;
+    }
+
+    // Moving gaps come from an engine of their own so adding them does not change the heights of the level
+    std::mt19937 motionRandomEngine( seed ^ 0x5bd1e995 );
+    std::bernoulli_distribution movingDist( mMovingFraction );
+    std::bernoulli_distribution closingDist( 0.5 );
+    std::uniform_int_distribution<int> periodDist( PIPE_MIN_MOTION_PERIOD, PIPE_MAX_MOTION_PERIOD );
+
+    for( int i = PIPE_STATIC_START; i < numPipes; ++i )
+    {
+        if( !movingDist( motionRandomEngine ) )
+        {
+            continue;
+        }
+
+        bool closing = closingDist( motionRandomEngine );
+        int period = periodDist( motionRandomEngine );
+        std::uniform_int_distribution<int> phaseDist( 0, period - 1 );
+        level[ i ].setMotion( closing ? PIPE_CLOSING : PIPE_OSCILLATING, closing ? PIPE_MAX_CLOSING : PIPE_MAX_OSCILLATION,
+                              period, phaseDist( motionRandomEngine ) );
+    }
 }
 
+std::vector<Pipe> LevelGenerator::generate()
+{
+    return generate( time( nullptr ) );
+}
@@ -8,6 +8,7 @@
 
 #include "constants.hpp"
 #include "LTexture.hpp"
+#include "Physics.hpp"
 
 const int NUM_OBSTACLES = 1024;
 // Width of 1 unit of ground
@@ -22,6 +23,34 @@ const int PIPE_MAX_HEIGHT = SCREEN_HEIGHT / 2 - PIPE_GAP / 2;
 const int PIPE_MAX_Y = SCREEN_HEIGHT - BIRD_LENGTH;
 // Space for "warmup" before pipes start appearing
 const int STARTING_OFFSET = 15 * BIRD_LENGTH;
+// Horizontal distance between two consecutive pipes
+const int PIPE_SPACING = 3 * BLOCK_WIDTH;
+// Largest distance ( in pixels ) an oscillating gap moves away from where it was generated and a closing gap narrows by
+const int PIPE_MAX_OSCILLATION = BIRD_LENGTH / 2;
+const int PIPE_MAX_CLOSING = BIRD_LENGTH;
+// Shortest and longest time ( in milliseconds ) a moving gap takes to move back to where it started
+const int PIPE_MIN_MOTION_PERIOD = 1500;
+const int PIPE_MAX_MOTION_PERIOD = 4000;
+// Number of static pipes at the start of levels with moving gaps
+const int PIPE_STATIC_START = 3;
+
+// How the gap of a pipe moves over time
+enum PipeMotion{
+    // Gap stays where it was generated
+    PIPE_STATIC,
+    // Gap moves up and down around where it was generated
+    PIPE_OSCILLATING,
+    // Gap narrows and widens around its center
+    PIPE_CLOSING
+};
+
+// Motion of a gap: by up to amplitude pixels once every period ( in milliseconds ), starting phase milliseconds into it
+struct GapMotion{
+    PipeMotion type;
+    int amplitude;
+    int period;
+    int phase;
+};
 
 class Pipe{
 
@@ -34,32 +63,88 @@ public:
     // Renders pipes at their coordinates ( with their dimensions ) using provided texture with optional clipping
     void render( SDL_Renderer* renderer, const SDL_Rect camera, LTexture& stcTexture, SDL_Rect topClip, SDL_Rect botClip ) const;
 
+    // Makes the gap move by up to amplitude pixels once every period ( in milliseconds ), starting phase milliseconds into it
+    void setMotion( const PipeMotion motion, const int amplitude, const int period, const int phase );
+
+    // Moves the gap to where it is at given time since the start of the run ( in milliseconds ). The X position never changes,
+    // so pipes stay sorted and only the ones near the player have to be updated
+    void update( const Uint32 time );
+
+    bool isMoving() const;
+
     SDL_Rect getTopRect() const;
     SDL_Rect getBotRect() const;
 
+    // Gets the motion of the gap and where its edges were generated ( bottom of the top rect and top of the bottom rect )
+    const GapMotion& getMotion() const;
+    int getBaseTopHeight() const;
+    int getBaseBotY() const;
+
+    // Gets how far the top and the bottom edge of a gap with motion have moved down from where they were generated at given
+    // time since the start of the run ( in milliseconds )
+    static void getGapShift( const GapMotion& motion, const Uint32 time, int* topShift, int* botShift );
+
 private:
 
     SDL_Rect mTopRect;
     SDL_Rect mBottomRect;
+
+    // Height of the top rect and Y position of the bottom rect as generated
+    int mBaseTopHeight;
+    int mBaseBotY;
+
+    // Motion of the gap
+    GapMotion mMotion;
 };
 
 class LevelGenerator{
 
 public:
 
-    LevelGenerator() = default;
+    // Fractions of the feasible height change used by default
+    static constexpr double DEFAULT_MIN_CHANGE = 0.0;
+    static constexpr double DEFAULT_MAX_CHANGE = 0.8;
+
+    // Builds the table of pipe heights reachable from each pipe height with the physics of mode
+    LevelGenerator( const PhysicsMode mode = PHYSICS_NORMAL );
 
     ~LevelGenerator() = default;
 
     // Generates level ( with seed )
     std::vector<Pipe> generate( const int seed );
 
+    // Generates first numPipes pipes of level ( with seed ) into existing vector, reusing its memory. Generating more pipes
+    // of the same seed later gives the same first pipes
+    void generate( const int seed, std::vector<Pipe>& level, const int numPipes = NUM_OBSTACLES ) const;
+
     // Generate level ( without seed )
     std::vector<Pipe> generate();
 
+    // Sets the band ( fractions from 0 to 1 ) of the feasible height change from which each pipe height is drawn.
+    // 0 keeps the height of the previous pipe and 1 is the largest change the player can still follow
+    void setDifficulty( const double minChange, const double maxChange );
+
+    // Sets the fraction ( from 0 to 1 ) of pipes after the first few that get a moving gap. Moving gaps are drawn from their
+    // own random engine, so the pipe heights of a seed stay the same. Levels with moving gaps have to be checked by LevelSolver
+    void setMovingFraction( const double movingFraction );
+
 private:
 
+    // Checks whether the player can get from a gap with pipe height fromHeight to one with pipe height toHeight
+    bool checkTransition( const int fromHeight, const int toHeight ) const;
+
+    // Lowest and highest height of the next pipe reachable from each pipe height ( indexed by height - PIPE_MIN_HEIGHT )
+    std::vector<int> mMinNextHeight;
+    std::vector<int> mMaxNextHeight;
+
+    // Physics the reachable heights are found for
+    PhysicsMode mPhysicsMode;
+
+    // Band of the feasible height change used when generating
+    double mMinChange, mMaxChange;
 
+    // Fraction of pipes with a moving gap
+    double mMovingFraction;
 };
 
 #endif // _LEVELGENERATOR_HPP_INCLUDED
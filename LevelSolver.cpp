@@ -0,0 +1,420 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelSolver.hpp"
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Mask of bits [ low, high ] of a word
+static Uint64 LS_wordMask( const int low, const int high )
+{
+    Uint64 upToHigh = high >= 63 ? ~Uint64( 0 ) : ( Uint64( 1 ) << ( high + 1 ) ) - 1;
+    return upToHigh & ~( ( Uint64( 1 ) << low ) - 1 );
+}
+
+LevelSolver::LevelSolver( const int tickDuration, const PhysicsMode mode )
+{
+    mTickDuration = tickDuration;
+    mPhysics = PHYS_getValues( mode );
+    mNumTicks = 0;
+    mFirstImpassablePipe = -1;
+
+    // Flight after a flap lasts until even a flap from the top of the screen would hit the ground
+    for( int tick = 0; mFlightOffsets.empty() || mFlightOffsets.back() < NUM_CELLS; ++tick )
+    {
+        double y = PHYS_moveY( mPhysics, 0.0, -mPhysics.flapHeight, tick * mTickDuration / 1000.0 );
+        mFlightOffsets.push_back( std::lround( y / Y_CELL_SIZE ) );
+    }
+
+    // The player falls from the start position until his first flap
+    for( int tick = 0; mStartCells.empty() || mStartCells.back() < NUM_CELLS; ++tick )
+    {
+        double y = PHYS_moveY( mPhysics, PLAYER_START_Y, 0.0, tick * mTickDuration / 1000.0 );
+        mStartCells.push_back( std::lround( y / Y_CELL_SIZE ) );
+    }
+}
+
+bool LevelSolver::keepRange( CellSet& set, const int low, const int high )
+{
+    int newLow = std::max( set.low, low );
+    int newHigh = std::min( set.high, high );
+
+    // If the set is already inside the range
+    if( newLow == set.low && newHigh == set.high )
+    {
+        return newLow <= newHigh;
+    }
+
+    int firstWord = std::max( set.low, 0 ) / 64;
+    int lastWord = std::min( set.high, NUM_CELLS - 1 ) / 64;
+    set.low = NUM_CELLS;
+    set.high = -1;
+
+    for( int i = firstWord; i <= lastWord; ++i )
+    {
+        int wordLow = std::max( newLow - i * 64, 0 );
+        int wordHigh = std::min( newHigh - i * 64, 63 );
+        set.words[ i ] &= wordLow <= wordHigh ? LS_wordMask( wordLow, wordHigh ) : 0;
+
+        // Tighten bounds to the cells that are left
+        if( set.words[ i ] != 0 )
+        {
+            set.low = std::min( set.low, i * 64 + __builtin_ctzll( set.words[ i ] ) );
+            set.high = i * 64 + 63 - __builtin_clzll( set.words[ i ] );
+        }
+    }
+
+    return set.low <= set.high;
+}
+
+void LevelSolver::addShifted( CellSet& destination, const CellSet& source, const int offset )
+{
+    int low = std::max( source.low + offset, 0 );
+    int high = std::min( source.high + offset, NUM_CELLS - 1 );
+
+    // If no cell of source lands inside the screen
+    if( low > high )
+    {
+        return;
+    }
+
+    int wordShift = offset >= 0 ? offset / 64 : -( ( -offset + 63 ) / 64 );
+    int bitShift = offset - wordShift * 64;
+    for( int i = low / 64; i <= high / 64; ++i )
+    {
+        // Cells of destination word i come from source words i - wordShift and i - wordShift - 1
+        int from = i - wordShift;
+        Uint64 word = 0;
+        if( from >= 0 && from < CELL_WORDS )
+        {
+            word |= source.words[ from ] << bitShift;
+        }
+        if( bitShift != 0 && from >= 1 && from - 1 < CELL_WORDS )
+        {
+            word |= source.words[ from - 1 ] >> ( 64 - bitShift );
+        }
+        destination.words[ i ] |= word & LS_wordMask( std::max( low - i * 64, 0 ), std::min( high - i * 64, 63 ) );
+    }
+
+    destination.low = std::min( destination.low, low );
+    destination.high = std::max( destination.high, high );
+}
+
+void LevelSolver::addRange( CellSet& set, const int low, const int high )
+{
+    for( int i = std::max( low, 0 ) / 64; i <= std::min( high, NUM_CELLS - 1 ) / 64; ++i )
+    {
+        set.words[ i ] |= LS_wordMask( std::max( low - i * 64, 0 ), std::min( high - i * 64, 63 ) );
+    }
+
+    if( low <= high )
+    {
+        set.low = std::min( set.low, low );
+        set.high = std::max( set.high, high );
+    }
+}
+
+bool LevelSolver::hasCell( const CellSet& set, const int cell )
+{
+    return cell >= set.low && cell <= set.high && ( ( set.words[ cell / 64 ] >> ( cell % 64 ) ) & 1 );
+}
+
+void LevelSolver::removeCell( CellSet& set, const int cell )
+{
+    set.words[ cell / 64 ] &= ~( Uint64( 1 ) << ( cell % 64 ) );
+}
+
+void LevelSolver::buildRanges( const std::vector<Pipe>& level )
+{
+    // The level is passed once the player is completely past the last pipe
+    SDL_Rect lastPipe = level.back().getTopRect();
+    double tickDistance = mPhysics.cameraVelocity * mTickDuration / 1000.0;
+    mNumTicks = std::ceil( ( lastPipe.x + lastPipe.w - PLAYER_START_X ) / tickDistance ) + 1;
+
+    mRanges.resize( mNumTicks );
+    mTickPipes.resize( mNumTicks );
+
+    size_t pipe = 0;
+    for( int tick = 0; tick < mNumTicks; ++tick )
+    {
+        // Pipes are checked for one tick of movement on either side so contact between ticks is not missed
+        double left = PLAYER_START_X + tick * tickDistance - tickDistance;
+        double right = PLAYER_START_X + tick * tickDistance + PLAYER_WIDTH + tickDistance;
+
+        while( pipe < level.size() && level[ pipe ].getTopRect().x + level[ pipe ].getTopRect().w <= left )
+        {
+            ++pipe;
+        }
+
+        // Ranges are shrunk by a cell on each side to cover rounding of positions to cells
+        mRanges[ tick ].low = CELL_MARGIN;
+        mRanges[ tick ].high = NUM_CELLS - 1 - CELL_MARGIN;
+
+        // Ticks between pipes belong to the next pipe
+        mTickPipes[ tick ] = std::min( pipe, level.size() - 1 );
+
+        // Overlapping pipes ( if the player is wide enough to touch two at once ) narrow the range further
+        for( size_t i = pipe; i < level.size() && level[ i ].getTopRect().x < right; ++i )
+        {
+            mTickPipes[ tick ] = i;
+
+            // Moving gaps are taken where they are one tick before, at and one tick after the tick, since the player
+            // reaches the X position of the tick at its time
+            Pipe movingPipe = level[ i ];
+            int numSamples = movingPipe.isMoving() ? 3 : 1;
+            for( int sample = 0; sample < numSamples; ++sample )
+            {
+                if( movingPipe.isMoving() )
+                {
+                    movingPipe.update( std::max( tick + sample - 1, 0 ) * mTickDuration );
+                }
+
+                SDL_Rect topRect = movingPipe.getTopRect();
+                SDL_Rect botRect = movingPipe.getBotRect();
+                int low = ( topRect.y + topRect.h + Y_CELL_SIZE - 1 ) / Y_CELL_SIZE + CELL_MARGIN;
+                int high = ( botRect.y - PLAYER_HEIGHT ) / Y_CELL_SIZE - CELL_MARGIN;
+                mRanges[ tick ].low = std::max( mRanges[ tick ].low, low );
+                mRanges[ tick ].high = std::min( mRanges[ tick ].high, high );
+            }
+        }
+    }
+}
+
+bool LevelSolver::solve( const std::vector<Pipe>& level, const bool findFlaps )
+{
+    mFirstImpassablePipe = -1;
+    mFlapTimes.clear();
+
+    // An empty level is always passable
+    if( level.empty() )
+    {
+        return true;
+    }
+
+    buildRanges( level );
+
+    if( !searchForward() )
+    {
+        return false;
+    }
+
+    if( findFlaps )
+    {
+        searchBackward();
+        buildWitness();
+    }
+
+    return true;
+}
+
+bool LevelSolver::searchForward()
+{
+    // Flap cells of the last ticks that are still in flight, indexed by flap tick modulo the longest flight
+    int maxFlight = mFlightOffsets.size() - 1;
+    std::vector<CellSet> inFlight( maxFlight + 1, CellSet() );
+
+    // Whether the player can still be on his first fall from the start position
+    bool startAlive = true;
+
+    for( int tick = 0; tick < mNumTicks; ++tick )
+    {
+        const CellRange& range = mRanges[ tick ];
+        CellSet flapCells;
+
+        if( startAlive )
+        {
+            int cell = tick < int( mStartCells.size() ) ? mStartCells[ tick ] : NUM_CELLS;
+            startAlive = cell >= range.low && cell <= range.high;
+            if( startAlive )
+            {
+                addRange( flapCells, cell, cell );
+            }
+        }
+
+        // Everything still in flight can flap at this tick
+        for( int flight = 1; flight <= std::min( tick, maxFlight ); ++flight )
+        {
+            CellSet& flown = inFlight[ ( tick - flight ) % ( maxFlight + 1 ) ];
+            int offset = mFlightOffsets[ flight ];
+            if( keepRange( flown, range.low - offset, range.high - offset ) )
+            {
+                addShifted( flapCells, flown, offset );
+            }
+        }
+
+        // If no state survived this tick
+        if( flapCells.low > flapCells.high )
+        {
+            mFirstImpassablePipe = mTickPipes[ tick ];
+            return false;
+        }
+
+        inFlight[ tick % ( maxFlight + 1 ) ] = flapCells;
+    }
+
+    return true;
+}
+
+void LevelSolver::searchBackward()
+{
+    int maxFlight = mFlightOffsets.size() - 1;
+    int lastTick = mNumTicks - 1;
+
+    mGoodCells.assign( mNumTicks, CellSet() );
+
+    // Being alive at the last tick is enough
+    addRange( mGoodCells[ lastTick ], mRanges[ lastTick ].low, mRanges[ lastTick ].high );
+
+    for( int tick = lastTick - 1; tick >= 0; --tick )
+    {
+        CellSet& goodCells = mGoodCells[ tick ];
+
+        // Flap cells that survive the whole flight so far, shrinks with every tick of flight
+        int flightLow = mRanges[ tick ].low;
+        int flightHigh = mRanges[ tick ].high;
+
+        for( int flight = 1; flight <= maxFlight && tick + flight <= lastTick; ++flight )
+        {
+            const CellRange& range = mRanges[ tick + flight ];
+            int offset = mFlightOffsets[ flight ];
+            flightLow = std::max( flightLow, range.low - offset );
+            flightHigh = std::min( flightHigh, range.high - offset );
+
+            // If no flap cell survives this long
+            if( flightLow > flightHigh )
+            {
+                break;
+            }
+
+            // Flight reaching the last tick passes the level
+            if( tick + flight == lastTick )
+            {
+                addRange( goodCells, flightLow, flightHigh );
+                break;
+            }
+
+            // Otherwise flight must end in a good cell
+            CellSet landing;
+            addShifted( landing, mGoodCells[ tick + flight ], -offset );
+            if( keepRange( landing, flightLow, flightHigh ) )
+            {
+                addShifted( goodCells, landing, 0 );
+            }
+        }
+    }
+}
+
+bool LevelSolver::isAlive( const double posY, const int tick ) const
+{
+    // Exact positions are checked against ranges without the rounding margin
+    return posY >= ( mRanges[ tick ].low - CELL_MARGIN ) * Y_CELL_SIZE && posY <= ( mRanges[ tick ].high + CELL_MARGIN ) * Y_CELL_SIZE;
+}
+
+bool LevelSolver::findFlaps( const int tick, const double posY, const double velY, const int minFlight, std::vector<Flap>& flaps ) const
+{
+    std::vector<Flap> edgeFlaps;
+    flaps.clear();
+
+    for( int flight = 0; tick + flight < mNumTicks; ++flight )
+    {
+        double y = PHYS_moveY( mPhysics, posY, velY, flight * mTickDuration / 1000.0 );
+        if( !isAlive( y, tick + flight ) )
+        {
+            break;
+        }
+
+        // If the flight reaches the end of the level
+        if( tick + flight == mNumTicks - 1 )
+        {
+            return true;
+        }
+
+        int cell = std::lround( y / Y_CELL_SIZE );
+        if( flight < minFlight || cell < 0 || cell >= NUM_CELLS || !hasCell( mGoodCells[ tick + flight ], cell ) )
+        {
+            continue;
+        }
+
+        // Flaps with good neighbouring cells are tried first since exact positions differ from cells by rounding
+        Flap flap = { tick + flight, y };
+        if( hasCell( mGoodCells[ tick + flight ], cell - 1 ) && hasCell( mGoodCells[ tick + flight ], cell + 1 ) )
+        {
+            flaps.push_back( flap );
+        }
+        else
+        {
+            edgeFlaps.push_back( flap );
+        }
+    }
+
+    // Longest flights are tried first
+    flaps.insert( flaps.begin(), edgeFlaps.begin(), edgeFlaps.end() );
+
+    return false;
+}
+
+void LevelSolver::buildWitness()
+{
+    // Depth first search over flaps, options of each flap on the path are kept until they are all tried
+    std::vector<Flap> path;
+    std::vector< std::vector<Flap> > options( 1 );
+
+    // If the player gets through the level without flapping
+    if( findFlaps( 0, PLAYER_START_Y, 0.0, 0, options.back() ) )
+    {
+        return;
+    }
+
+    while( !options.empty() )
+    {
+        // If every flap after the last flap on the path failed, the last flap fails too
+        if( options.back().empty() )
+        {
+            options.pop_back();
+            if( !path.empty() )
+            {
+                removeCell( mGoodCells[ path.back().tick ], std::lround( path.back().posY / Y_CELL_SIZE ) );
+                path.pop_back();
+            }
+            continue;
+        }
+
+        Flap flap = options.back().back();
+        options.back().pop_back();
+
+        // If the cell of the flap already failed from another position
+        if( !hasCell( mGoodCells[ flap.tick ], std::lround( flap.posY / Y_CELL_SIZE ) ) )
+        {
+            continue;
+        }
+
+        path.push_back( flap );
+        options.push_back( std::vector<Flap>() );
+        if( findFlaps( flap.tick, flap.posY, -mPhysics.flapHeight, 1, options.back() ) )
+        {
+            for( const Flap& f : path )
+            {
+                mFlapTimes.push_back( f.tick * mTickDuration );
+            }
+            return;
+        }
+    }
+
+    // Should not happen since every good cell can reach the end
+    printf( "Could not build flap sequence of solved level!\n" );
+}
+
+int LevelSolver::getFirstImpassablePipe() const
+{
+    return mFirstImpassablePipe;
+}
+
+const std::vector<int>& LevelSolver::getFlapTimes() const
+{
+    return mFlapTimes;
+}
@@ -0,0 +1,121 @@
+#ifndef _LEVELSOLVER_HPP_INCLUDED
+#define _LEVELSOLVER_HPP_INCLUDED
+
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Checks whether a level can be passed by searching all reachable player states.
+// A state is the tick ( which determines X ), the height of the last flap and the time since it ( which determine Y and Y velocity ).
+// Flap heights at each tick are kept in bitsets of vertical cells so states reaching the same cell are merged
+class LevelSolver{
+
+public:
+
+    // Default duration of one search step ( in milliseconds ), flaps can only happen at step boundaries
+    static const int DEFAULT_TICK_DURATION = 32;
+
+    // Vertical resolution of the search ( in pixels )
+    static const int Y_CELL_SIZE = 2;
+
+    // Initializes internal variables for the physics of mode
+    LevelSolver( const int tickDuration = DEFAULT_TICK_DURATION, const PhysicsMode mode = PHYSICS_NORMAL );
+
+    // Deallocates memory
+    ~LevelSolver() = default;
+
+    // Checks whether the player can get past every pipe of the level. If findFlaps is set also finds a sequence of flaps
+    // that does it. Returns whether level is passable
+    bool solve( const std::vector<Pipe>& level, const bool findFlaps = false );
+
+    // Gets index of the first pipe that can not be passed ( -1 if level is passable )
+    int getFirstImpassablePipe() const;
+
+    // Gets times ( in milliseconds since the player was created ) of flaps that pass the level
+    const std::vector<int>& getFlapTimes() const;
+
+private:
+
+    // Number of vertical cells and 64 bit words needed to store one bitset of cells
+    static const int NUM_CELLS = ( SCREEN_HEIGHT - PLAYER_HEIGHT ) / Y_CELL_SIZE + 1;
+    static const int CELL_WORDS = ( NUM_CELLS + 63 ) / 64;
+
+    // Number of cells the alive ranges are shrunk by to cover rounding of positions to cells
+    static const int CELL_MARGIN = 1;
+
+    // Bitset of vertical cells
+    struct CellSet{
+        Uint64 words[ CELL_WORDS ] = {};
+        // Lowest and highest cell in the set ( low > high if set is empty )
+        int low = NUM_CELLS, high = -1;
+    };
+
+    // A flap of the player at given tick and position ( in pixels )
+    struct Flap{
+        int tick;
+        double posY;
+    };
+
+    // Range of cells in which the player is alive at a tick
+    struct CellRange{
+        int low, high;
+    };
+
+    // Computes the alive range for every tick of the level and stores the pipe each tick is checked against
+    void buildRanges( const std::vector<Pipe>& level );
+
+    // Searches forward from the start position. Returns whether any state gets to the end of the level
+    bool searchForward();
+
+    // Searches backward from the end of the level for flap cells from which the end can still be reached
+    void searchBackward();
+
+    // Replays the level with exact physics choosing flaps that stay inside the cells found by searchBackward
+    void buildWitness();
+
+    // Finds flaps ( at least minFlight ticks after tick ) that land in cells found by searchBackward, ordered so the most
+    // promising is last. Returns true instead if the player gets to the end of the level without flapping
+    bool findFlaps( const int tick, const double posY, const double velY, const int minFlight, std::vector<Flap>& flaps ) const;
+
+    // Checks whether position ( in pixels ) is inside the alive range at tick
+    bool isAlive( const double posY, const int tick ) const;
+
+    // Cell set operations
+    static bool keepRange( CellSet& set, const int low, const int high );
+    static void addShifted( CellSet& destination, const CellSet& source, const int offset );
+    static void addRange( CellSet& set, const int low, const int high );
+    static bool hasCell( const CellSet& set, const int cell );
+    static void removeCell( CellSet& set, const int cell );
+
+    // Duration of one search step ( in milliseconds )
+    int mTickDuration;
+
+    // Physics the player moves with ( the solver runs once per level, so values are fine here )
+    PhysicsValues mPhysics;
+
+    // Number of ticks needed to pass the level
+    int mNumTicks;
+
+    // Offset ( in cells ) from the flap cell after given number of ticks of flight
+    std::vector<int> mFlightOffsets;
+
+    // Cell of the player after given number of ticks of falling from the start position before his first flap
+    std::vector<int> mStartCells;
+
+    // Alive range and the pipe that limits it ( or the next pipe ) for every tick
+    std::vector<CellRange> mRanges;
+    std::vector<int> mTickPipes;
+
+    // Cells at which the player can flap at each tick and still reach the end of the level
+    std::vector<CellSet> mGoodCells;
+
+    // Search results
+    int mFirstImpassablePipe;
+    std::vector<int> mFlapTimes;
+};
+
+#endif // _LEVELSOLVER_HPP_INCLUDED
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "ObservationRenderer.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Fills length bytes at dst with shade, 16 bytes per store where SSE2 is available
+static void OR_fillSpan( Uint8* dst, int length, const Uint8 shade )
+{
+#ifdef __SSE2__
+    const __m128i shades = _mm_set1_epi8( char( shade ) );
+    for( ; length >= 16; length -= 16, dst += 16 )
+    {
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( dst ), shades );
+    }
+#endif
+
+    for( ; length > 0; --length )
+    {
+        *dst++ = shade;
+    }
+}
+
+ObservationRenderer::ObservationRenderer( const int frameWidth, const int frameHeight )
+{
+    mFrameWidth = frameWidth;
+    mFrameHeight = frameHeight;
+
+    mScaleX = double( frameWidth ) / SCREEN_WIDTH;
+    mScaleY = double( frameHeight ) / SCREEN_HEIGHT;
+}
+
+ObservationRenderer::FrameRect ObservationRenderer::toFrame( const int x, const int y, const int w, const int h, const Uint8 shade ) const
+{
+    FrameRect rect;
+    rect.x0 = std::max( 0, int( std::lround( x * mScaleX ) ) );
+    rect.y0 = std::max( 0, int( std::lround( y * mScaleY ) ) );
+    rect.x1 = std::min( mFrameWidth, int( std::lround( ( x + w ) * mScaleX ) ) );
+    rect.y1 = std::min( mFrameHeight, int( std::lround( ( y + h ) * mScaleY ) ) );
+    rect.shade = shade;
+
+    return rect;
+}
+
+void ObservationRenderer::render( const std::vector<Pipe>& pipes, const int firstPipe, const double posX, const double posY, Uint8* frame ) const
+{
+    // The camera follows the player like in the game
+    int cameraX = int( posX ) - PLAYER_START_X;
+
+    // Collect visible rectangles in drawing order, the player last so he is on top
+    FrameRect rects[ MAX_RECTS ];
+    int numRects = 0;
+    for( size_t i = std::max( firstPipe, 0 ); i < pipes.size() && numRects + 3 <= MAX_RECTS; ++i )
+    {
+        SDL_Rect topRect = pipes[ i ].getTopRect();
+        SDL_Rect botRect = pipes[ i ].getBotRect();
+        if( topRect.x >= cameraX + SCREEN_WIDTH )
+        {
+            break;
+        }
+        if( topRect.x + topRect.w <= cameraX )
+        {
+            continue;
+        }
+
+        rects[ numRects++ ] = toFrame( topRect.x - cameraX, topRect.y, topRect.w, topRect.h, PIPE_SHADE );
+        rects[ numRects++ ] = toFrame( botRect.x - cameraX, botRect.y, botRect.w, botRect.h, PIPE_SHADE );
+    }
+    rects[ numRects++ ] = toFrame( PLAYER_START_X, int( posY ), PLAYER_WIDTH, PLAYER_HEIGHT, PLAYER_SHADE );
+
+    // Rows only change where a rectangle starts or ends, so split the frame into bands of equal rows
+    int edges[ 2 * MAX_RECTS + 2 ];
+    int numEdges = 0;
+    edges[ numEdges++ ] = 0;
+    edges[ numEdges++ ] = mFrameHeight;
+    for( int i = 0; i < numRects; ++i )
+    {
+        if( rects[ i ].x0 < rects[ i ].x1 && rects[ i ].y0 < rects[ i ].y1 )
+        {
+            edges[ numEdges++ ] = rects[ i ].y0;
+            edges[ numEdges++ ] = rects[ i ].y1;
+        }
+    }
+    std::sort( edges, edges + numEdges );
+    numEdges = std::unique( edges, edges + numEdges ) - edges;
+
+    for( int band = 0; band + 1 < numEdges; ++band )
+    {
+        int bandBegin = edges[ band ], bandEnd = edges[ band + 1 ];
+        Uint8* firstRow = frame + bandBegin * mFrameWidth;
+
+        // Draw first row of the band from its spans
+        OR_fillSpan( firstRow, mFrameWidth, BACKGROUND_SHADE );
+        for( int i = 0; i < numRects; ++i )
+        {
+            const FrameRect& rect = rects[ i ];
+            if( rect.y0 <= bandBegin && bandBegin < rect.y1 && rect.x0 < rect.x1 )
+            {
+                OR_fillSpan( firstRow + rect.x0, rect.x1 - rect.x0, rect.shade );
+            }
+        }
+
+        // Copy it to the rest of the band
+        for( int y = bandBegin + 1; y < bandEnd; ++y )
+        {
+            memcpy( frame + y * mFrameWidth, firstRow, mFrameWidth );
+        }
+    }
+}
+
+int ObservationRenderer::getFrameWidth() const
+{
+    return mFrameWidth;
+}
+
+int ObservationRenderer::getFrameHeight() const
+{
+    return mFrameHeight;
+}
@@ -0,0 +1,61 @@
+#ifndef _OBSERVATIONRENDERER_HPP_INCLUDED
+#define _OBSERVATIONRENDERER_HPP_INCLUDED
+
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "constants.hpp"
+
+// Draws low resolution grayscale frames of the game on the CPU, without SDL textures, for agents that learn from pixels.
+// The scene is flat shaded ( background, pipes and the player collider ), so every row of a frame is made of a few spans
+// and rows only change at the edges of pipes and the player. Each band of equal rows is drawn once with SIMD span fills
+// and copied to the other rows of the band
+class ObservationRenderer{
+
+public:
+
+    // Default frame size ( in pixels )
+    static const int DEFAULT_FRAME_SIZE = 84;
+
+    // Shades of the scene
+    static const Uint8 BACKGROUND_SHADE = 200;
+    static const Uint8 PIPE_SHADE = 80;
+    static const Uint8 PLAYER_SHADE = 255;
+
+    // Initializes internal variables
+    ObservationRenderer( const int frameWidth = DEFAULT_FRAME_SIZE, const int frameHeight = DEFAULT_FRAME_SIZE );
+
+    // Deallocates memory
+    ~ObservationRenderer() = default;
+
+    // Draws the screen the camera sees with the player at ( posX, posY ) into frame ( frameWidth * frameHeight bytes, row
+    // by row ). Pipes before firstPipe are known to be behind the camera
+    void render( const std::vector<Pipe>& pipes, const int firstPipe, const double posX, const double posY, Uint8* frame ) const;
+
+    int getFrameWidth() const;
+    int getFrameHeight() const;
+
+private:
+
+    // Most rectangles drawn in a frame ( visible pipes and the player )
+    static const int MAX_RECTS = 8;
+
+    // Rectangle in frame pixels
+    struct FrameRect{
+        int x0, y0, x1, y1;
+        Uint8 shade;
+    };
+
+    // Converts rectangle in screen pixels to frame pixels
+    FrameRect toFrame( const int x, const int y, const int w, const int h, const Uint8 shade ) const;
+
+    // Size of the frame
+    int mFrameWidth, mFrameHeight;
+
+    // Frame pixels per screen pixel
+    double mScaleX, mScaleY;
+};
+
+#endif // _OBSERVATIONRENDERER_HPP_INCLUDED
@@ -0,0 +1,169 @@
+#ifndef _PHYSICS_HPP_INCLUDED
+#define _PHYSICS_HPP_INCLUDED
+
+#include <cstring>
+
+#include "constants.hpp"
+
+// Dimensions of the player character
+const int PLAYER_WIDTH = BIRD_LENGTH;
+const int PLAYER_HEIGHT = ( BIRD_LENGTH * 24 ) / 34;
+
+// Height ( in pixels ) of a wing flap ( upward velocity given by a flap in px/s )
+const int FLAP_HEIGHT = BIRD_LENGTH * 4.35;
+
+// Position at which the player character starts
+const int PLAYER_START_X = 2 * BIRD_LENGTH;
+const int PLAYER_START_Y = SCREEN_HEIGHT / 2 - PLAYER_HEIGHT / 2;
+
+// Angle ( in degrees ) the bird is turned to by a flap and largest angle it turns to ( nose down )
+constexpr double BIRD_ROTATION_AFTER_FLAP = -22.0;
+constexpr double BIRD_ROTATION_MAX = 90.0;
+
+// Frames of the flap animation of the bird
+enum BirdFrame{
+    BIRD_FRAME_NEUTRAL,
+    BIRD_FRAME_UP,
+    BIRD_FRAME_DOWN,
+    BIRD_FRAME_TOTAL
+};
+
+// Duration of each frame of the flap animation ( in milliseconds ) and the frames shown after a flap ( neutral afterwards )
+const int BIRD_ANIMATION_FRAME_DURATION = 60;
+const BirdFrame BIRD_FLAP_ANIMATION[] = { BIRD_FRAME_UP, BIRD_FRAME_NEUTRAL, BIRD_FRAME_DOWN, BIRD_FRAME_NEUTRAL,
+                                          BIRD_FRAME_UP, BIRD_FRAME_NEUTRAL, BIRD_FRAME_DOWN, BIRD_FRAME_NEUTRAL };
+const int BIRD_FLAP_ANIMATION_LENGTH = sizeof( BIRD_FLAP_ANIMATION ) / sizeof( BIRD_FLAP_ANIMATION[ 0 ] );
+
+// Gets frame of the flap animation shown given time ( in milliseconds ) after the last flap
+inline BirdFrame PHYS_getBirdFrame( const double timeSinceFlap )
+{
+    const int index = int( timeSinceFlap / BIRD_ANIMATION_FRAME_DURATION );
+    return index >= 0 && index < BIRD_FLAP_ANIMATION_LENGTH ? BIRD_FLAP_ANIMATION[ index ] : BIRD_FRAME_NEUTRAL;
+}
+
+// Game modes with physics of their own
+enum PhysicsMode{
+    PHYSICS_NORMAL,
+    PHYSICS_EASY,
+    PHYSICS_HARD,
+    PHYSICS_LOW_GRAVITY,
+    PHYSICS_TOTAL
+};
+
+// Physics constants of a game mode. Step functions take a profile as template parameter, so each mode gets a
+// specialization with its constants folded in and the mode is only looked at once per step. All profiles keep the
+// height of a flap close to the normal one, so levels generated for one mode mostly suit the others
+struct NormalPhysics{
+    static const PhysicsMode MODE = PHYSICS_NORMAL;
+    // Gravity ( in px/s^2 )
+    static constexpr double GRAVITY = ::GRAVITY;
+    // Upward velocity given by a flap and camera velocity ( in px/s )
+    static const int FLAP_HEIGHT = ::FLAP_HEIGHT;
+    static const int CAMERA_VELOCITY = ::CAMERA_VELOCITY;
+    // Speed at which the rotation speed of the bird changes and time ( in milliseconds ) after a flap before it turns down
+    static constexpr double ROTATION_SPEED = 500.0;
+    static const int FLAP_AIR_TIME = 480;
+};
+
+// Slower scrolling with gentler flaps
+struct EasyPhysics{
+    static const PhysicsMode MODE = PHYSICS_EASY;
+    static constexpr double GRAVITY = ::GRAVITY * 0.85;
+    static const int FLAP_HEIGHT = ::FLAP_HEIGHT * 0.92;
+    static const int CAMERA_VELOCITY = ::CAMERA_VELOCITY * 0.85;
+    static constexpr double ROTATION_SPEED = 425.0;
+    static const int FLAP_AIR_TIME = 560;
+};
+
+// Faster scrolling with snappier flaps
+struct HardPhysics{
+    static const PhysicsMode MODE = PHYSICS_HARD;
+    static constexpr double GRAVITY = ::GRAVITY * 1.15;
+    static const int FLAP_HEIGHT = ::FLAP_HEIGHT * 1.07;
+    static const int CAMERA_VELOCITY = ::CAMERA_VELOCITY * 1.2;
+    static constexpr double ROTATION_SPEED = 575.0;
+    static const int FLAP_AIR_TIME = 420;
+};
+
+// Half gravity with flaps that rise as high as normal ones, but slowly
+struct LowGravityPhysics{
+    static const PhysicsMode MODE = PHYSICS_LOW_GRAVITY;
+    static constexpr double GRAVITY = ::GRAVITY * 0.5;
+    static const int FLAP_HEIGHT = ::FLAP_HEIGHT * 0.7071;
+    static const int CAMERA_VELOCITY = ::CAMERA_VELOCITY;
+    static constexpr double ROTATION_SPEED = 250.0;
+    static const int FLAP_AIR_TIME = 680;
+};
+
+// Physics constants of a game mode as values, for code that runs once per level rather than once per step
+struct PhysicsValues{
+    double gravity;
+    int flapHeight;
+    int cameraVelocity;
+    double rotationSpeed;
+    int flapAirTime;
+};
+
+template<class Profile>
+inline PhysicsValues PHYS_getValues()
+{
+    return { Profile::GRAVITY, Profile::FLAP_HEIGHT, Profile::CAMERA_VELOCITY, Profile::ROTATION_SPEED, Profile::FLAP_AIR_TIME };
+}
+
+inline PhysicsValues PHYS_getValues( const PhysicsMode mode )
+{
+    switch( mode )
+    {
+        case PHYSICS_EASY:
+            return PHYS_getValues<EasyPhysics>();
+        case PHYSICS_HARD:
+            return PHYS_getValues<HardPhysics>();
+        case PHYSICS_LOW_GRAVITY:
+            return PHYS_getValues<LowGravityPhysics>();
+        default:
+            return PHYS_getValues<NormalPhysics>();
+    }
+}
+
+// Gets name of mode as given on the command line
+inline const char* PHYS_getModeName( const PhysicsMode mode )
+{
+    const char* const names[ PHYSICS_TOTAL ] = { "normal", "easy", "hard", "low-gravity" };
+    return mode >= 0 && mode < PHYSICS_TOTAL ? names[ mode ] : "unknown";
+}
+
+// Finds mode with given name. Returns whether there is one
+inline bool PHYS_parseMode( const char* name, PhysicsMode& mode )
+{
+    for( int i = 0; i < PHYSICS_TOTAL; ++i )
+    {
+        if( strcmp( name, PHYS_getModeName( PhysicsMode( i ) ) ) == 0 )
+        {
+            mode = PhysicsMode( i );
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Vertical position after falling for given time ( in seconds ) with given starting vertical velocity
+template<class Profile = NormalPhysics>
+inline double PHYS_moveY( const double posY, const double velY, const double time )
+{
+    return posY + ( Profile::GRAVITY * time * time ) / 2 + velY * time;
+}
+
+inline double PHYS_moveY( const PhysicsValues& physics, const double posY, const double velY, const double time )
+{
+    return posY + ( physics.gravity * time * time ) / 2 + velY * time;
+}
+
+// Vertical velocity after falling for given time ( in seconds )
+template<class Profile = NormalPhysics>
+inline double PHYS_moveVelY( const double velY, const double time )
+{
+    return velY + Profile::GRAVITY * time;
+}
+
+#endif // _PHYSICS_HPP_INCLUDED
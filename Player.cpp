@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <cstdio>
@@ -10,16 +12,51 @@
 #include "LTimer.hpp"
 #include "constants.hpp"
 #include "Player.hpp"
+#include "AssetBundle.hpp"
 #include "CollisionDetection.hpp"
+#include "CollisionMask.hpp"
+#include "FixedPhysics.hpp"
 #include "LevelGenerator.hpp"
+#include "Physics.hpp"
 #include "ScoreTracker.hpp"
+#include "SpriteAtlas.hpp"
 
-Player::Player( Game* game, int currentTicks )
+// Gets the earliest time after start ( in seconds ) at which a fall from posY with velocity velY reaches y, or a negative time
+// if it never does
+static double PL_timeToReach( const PhysicsValues& physics, const double posY, const double velY, const double y, const double start )
 {
-    mPosX = PLAYER_CAMERA_OFFSET;
-    mPosY = SCREEN_HEIGHT / 2 - PLAYER_HEIGHT / 2;
+    // Solve gravity / 2 * t^2 + velY * t + posY - y = 0
+    const double a = physics.gravity / 2, b = velY, c = posY - y;
+    if( a == 0.0 )
+    {
+        return b != 0.0 && -c / b > start ? -c / b : -1.0;
+    }
 
-    mVelY = 0.0; mVelX = CAMERA_VELOCITY;
+    const double discriminant = b * b - 4 * a * c;
+    if( discriminant < 0.0 )
+    {
+        return -1.0;
+    }
+
+    const double root = std::sqrt( discriminant );
+    const double first = std::min( ( -b - root ) / ( 2 * a ), ( -b + root ) / ( 2 * a ) );
+    const double second = std::max( ( -b - root ) / ( 2 * a ), ( -b + root ) / ( 2 * a ) );
+    if( first > start )
+    {
+        return first;
+    }
+    return second > start ? second : -1.0;
+}
+
+Player::Player( Game* game, int currentTicks, SDL_Surface* spriteSheet, const PhysicsMode mode )
+{
+    mPhysicsMode = mode;
+    mPhysics = PHYS_getValues( mode );
+
+    mPosX = PLAYER_START_X;
+    mPosY = PLAYER_START_Y;
+
+    mVelY = 0.0; mVelX = mPhysics.cameraVelocity;
 
     mLastMove = currentTicks;
 
@@ -32,15 +69,7 @@ Player::Player( Game* game, int currentTicks )
 
     mGamePointer = game;
 
-    if( !mSpriteSheet.loadFromFile( mGamePointer->getRenderer(), "assets/sprite_sheet.png" ) )
-    {
-        printf( "Could not load player sprite sheet!\n" );
-    }
-
-    mPlayerTextureClip.x = 6;
-    mPlayerTextureClip.y = 982;
-    mPlayerTextureClip.w = 34;
-    mPlayerTextureClip.h = 24;
+    mPlayerTextureClip = SPRITE_CLIPS[ SPRITE_BIRD_UP ];
 
     mPlayerTextureStretchRect.x = mPosX;
     mPlayerTextureStretchRect.y = mPosY;
@@ -49,7 +78,7 @@ Player::Player( Game* game, int currentTicks )
 
     mRotationAngle = 0.0;
 
-    mRotationSpeed = ROTATION_SPEED;
+    mRotationSpeed = mPhysics.rotationSpeed;
 
     mCurrentScore = 0;
 
@@ -57,58 +86,72 @@ Player::Player( Game* game, int currentTicks )
 
     mScoreTracker = new ScoreTracker( mGamePointer, this );
 
-    mAnimationClips.reserve( FLAP_TOTAL );
+    mAnimationClips.resize( BIRD_FRAME_TOTAL );
 
-    // Set animation neutral clip rect
-    mAnimationClips[ FLAP_NEUTRAL ].x = 62;
-    mAnimationClips[ FLAP_NEUTRAL ].y = 982;
-    mAnimationClips[ FLAP_NEUTRAL ].w = 34;
-    mAnimationClips[ FLAP_NEUTRAL ].h = 24;
+    // Set animation clip rects
+    mAnimationClips[ BIRD_FRAME_NEUTRAL ] = SPRITE_CLIPS[ SPRITE_BIRD_NEUTRAL ];
+    mAnimationClips[ BIRD_FRAME_UP ] = SPRITE_CLIPS[ SPRITE_BIRD_UP ];
+    mAnimationClips[ BIRD_FRAME_DOWN ] = SPRITE_CLIPS[ SPRITE_BIRD_DOWN ];
 
-    // Set animation flapping up clip rect
-    mAnimationClips[ FLAP_UP ].x = 6;
-    mAnimationClips[ FLAP_UP ].y = 982;
-    mAnimationClips[ FLAP_UP ].w = 34;
-    mAnimationClips[ FLAP_UP ].h = 24;
-
-    // Set animation flapping down clip rect
-    mAnimationClips[ FLAP_DOWN ].x = 118;
-    mAnimationClips[ FLAP_DOWN ].y = 982;
-    mAnimationClips[ FLAP_DOWN ].w = 34;
-    mAnimationClips[ FLAP_DOWN ].h = 24;
+    mCurrentTexture = BIRD_FRAME_UP;
 
+    loadCollisionMasks( spriteSheet );
 
     // Load sound effects
     mSoundEffects.reserve( SFX_TOTAL );
 
-    mSoundEffects[ SFX_FLAP ] = Mix_LoadWAV( "assets/sounds/sfx_wing.ogg" );
+    mSoundEffects[ SFX_FLAP ] = Mix_LoadWAV_RW( AB_openAsset( "assets/sounds/sfx_wing.ogg" ), 1 );
     if( mSoundEffects[ SFX_FLAP ] == nullptr )
     {
         printf( "Could not load SFX_FLAP sound effect! Mix_Error: %s\n", Mix_GetError() );
     }
 
-    mSoundEffects[ SFX_GET_POINT ] = Mix_LoadWAV( "assets/sounds/sfx_point.ogg" );
+    mSoundEffects[ SFX_GET_POINT ] = Mix_LoadWAV_RW( AB_openAsset( "assets/sounds/sfx_point.ogg" ), 1 );
     if( mSoundEffects[ SFX_GET_POINT ] == nullptr )
     {
         printf( "Could not load SFX_GET_POINT sound effect! Mix_Error: %s\n", Mix_GetError() );
     }
 
-    mSoundEffects[ SFX_HIT ] = Mix_LoadWAV( "assets/sounds/sfx_hit.ogg" );
+    mSoundEffects[ SFX_HIT ] = Mix_LoadWAV_RW( AB_openAsset( "assets/sounds/sfx_hit.ogg" ), 1 );
     if( mSoundEffects[ SFX_HIT ] == nullptr )
     {
         printf( "Could not load SFX_HIT sound effect! Mix_Error: %s\n", Mix_GetError() );
     }
 
-    mSoundEffects[ SFX_DIE ] = Mix_LoadWAV( "assets/sounds/sfx_die.ogg" );
+    mSoundEffects[ SFX_DIE ] = Mix_LoadWAV_RW( AB_openAsset( "assets/sounds/sfx_die.ogg" ), 1 );
     if( mSoundEffects[ SFX_DIE ] == nullptr )
     {
         printf( "Could not load SFX_DIE sound effect! Mix_Error: %s\n", Mix_GetError() );
     }
 }
 
+void Player::reset( const int currentTicks )
+{
+    mPosX = PLAYER_START_X;
+    mPosY = PLAYER_START_Y;
+
+    mVelY = 0.0; mVelX = mPhysics.cameraVelocity;
+
+    mLastMove = currentTicks;
+    mLastFlap = currentTicks;
+
+    mRotationAngle = 0.0;
+    mRotationSpeed = mPhysics.rotationSpeed;
+
+    mCurrentScore = 0;
+
+    mAlive = true;
+
+    mCurrentTexture = BIRD_FRAME_UP;
+    mPlayerTextureClip = mAnimationClips[ mCurrentTexture ];
+
+    shiftCollider();
+    mScoreTracker->updateScore();
+}
+
 void Player::render( int camPosX, int camPosY )
 {
-    mSpriteSheet.renderStretched( mGamePointer->getRenderer(), mPosX - camPosX, mPosY - camPosY, &mPlayerTextureStretchRect, &mPlayerTextureClip, mRotationAngle );
+    mGamePointer->getSpriteSheet().renderStretched( mGamePointer->getRenderer(), mPosX - camPosX, mPosY - camPosY, &mPlayerTextureStretchRect, &mPlayerTextureClip, mRotationAngle );
 }
 
 void Player::handleEvent( SDL_Event& e )
@@ -118,11 +161,11 @@ void Player::handleEvent( SDL_Event& e )
         if( e.key.keysym.sym == SDLK_SPACE )
         {
             // Adjust player velocity
-            mVelY = -FLAP_HEIGHT;
+            mVelY = -mPhysics.flapHeight;
             // Reset player rotation speed to return him to neutral position fast
-            mRotationSpeed = -500;
+            mRotationSpeed = -mPhysics.rotationSpeed;
             // Set player rotation to neutral
-            mRotationAngle = ROTATION_AFTER_FLAP;
+            mRotationAngle = BIRD_ROTATION_AFTER_FLAP;
             // Record last flap time
             mLastFlap = mGamePointer->getTicks();
             // Play flap sound effect
@@ -148,52 +191,189 @@ bool Player::checkCollision( const Pipe& collisionPipe )
     return false;
 }
 
-bool Player::move( const std::vector<Pipe>& pipes, const int currentTime )
+void Player::loadCollisionMasks( SDL_Surface* spriteSheet )
+{
+    mCollisionMasks.assign( BIRD_FRAME_TOTAL * NUM_ROTATION_BUCKETS, CollisionMask() );
+
+    if( spriteSheet == nullptr )
+    {
+        printf( "Could not load player collision masks without a sprite sheet!\n" );
+        return;
+    }
+
+    for( int frame = 0; frame < BIRD_FRAME_TOTAL; ++frame )
+    {
+        for( int bucket = 0; bucket < NUM_ROTATION_BUCKETS; ++bucket )
+        {
+            double angle = BIRD_ROTATION_AFTER_FLAP + bucket * ROTATION_BUCKET_SIZE;
+            mCollisionMasks[ frame * NUM_ROTATION_BUCKETS + bucket ].build( spriteSheet, mAnimationClips[ frame ], mPlayerTextureStretchRect.w, mPlayerTextureStretchRect.h, angle );
+        }
+    }
+}
+
+const CollisionMask& Player::getCollisionMask() const
+{
+    int bucket = std::lround( ( mRotationAngle - BIRD_ROTATION_AFTER_FLAP ) / ROTATION_BUCKET_SIZE );
+    bucket = std::max( 0, std::min( bucket, NUM_ROTATION_BUCKETS - 1 ) );
+
+    return mCollisionMasks[ mCurrentTexture * NUM_ROTATION_BUCKETS + bucket ];
+}
+
+template<class Profile>
+bool Player::checkMaskCollision( const SDL_Rect& rect, const double startTime, const double endTime, double* timeOfImpact ) const
+{
+    const CollisionMask& mask = getCollisionMask();
+
+    // Sample the path often enough that the player never moves more than a pixel between samples
+    double speedY = std::max( std::fabs( PHYS_moveVelY<Profile>( mVelY, startTime ) ), std::fabs( PHYS_moveVelY<Profile>( mVelY, endTime ) ) );
+    double distance = ( std::fabs( mVelX ) + speedY ) * ( endTime - startTime );
+    int samples = std::min( int( std::ceil( distance ) ), int( MAX_MASK_SAMPLES ) );
+
+    for( int i = 0; i <= samples; ++i )
+    {
+        double t = samples == 0 ? startTime : startTime + ( endTime - startTime ) * i / samples;
+        double x = mPosX + mVelX * t;
+        double y = PHYS_moveY<Profile>( mPosY, mVelY, t );
+        if( mask.checkCollision( int( x ), int( y ), rect ) )
+        {
+            *timeOfImpact = t;
+            return true;
+        }
+    }
+
+    // If mask never overlaps rect
+    return false;
+}
+
+bool Player::checkSweptCollision( const World& world, const Entity first, const Entity last, const double duration,
+                                  double* timeOfImpact ) const
+{
+    switch( mPhysicsMode )
+    {
+        case PHYSICS_EASY:
+            return checkSweptCollisionWith<EasyPhysics>( world, first, last, duration, timeOfImpact );
+        case PHYSICS_HARD:
+            return checkSweptCollisionWith<HardPhysics>( world, first, last, duration, timeOfImpact );
+        case PHYSICS_LOW_GRAVITY:
+            return checkSweptCollisionWith<LowGravityPhysics>( world, first, last, duration, timeOfImpact );
+        default:
+            return checkSweptCollisionWith<NormalPhysics>( world, first, last, duration, timeOfImpact );
+    }
+}
+
+template<class Profile>
+bool Player::checkSweptCollisionWith( const World& world, const Entity first, const Entity last, const double duration,
+                                      double* timeOfImpact ) const
+{
+    // Tight box around the opaque pixels of the player, used for the broadphase
+    SDL_Rect bounds = getCollisionMask().getBounds();
+    double boundsX = mPosX + bounds.x;
+    double boundsY = mPosY + bounds.y;
+
+    // Horizontal span covered by the player during the move
+    double sweepBegin = boundsX;
+    double sweepEnd = boundsX + mVelX * duration + bounds.w;
+
+    // Only colliders the player passes horizontally during the move are swept against
+    bool collided = false;
+    double earliestImpact = duration;
+    world.forEachCollider( sweepBegin, sweepEnd, first, last, [&]( const SDL_Rect& rect )
+    {
+        // Broadphase: earliest moment the bounding box touches the collider
+        double impact;
+        if( !CD_checkSweptCollision( boundsX, boundsY, bounds.w, bounds.h, mVelX, mVelY, Profile::GRAVITY, duration, rect, &impact ) )
+        {
+            return;
+        }
+
+        // Narrowphase: walk the mask along the path until the bounding box leaves the collider horizontally
+        double exitTime = duration;
+        if( mVelX > 0 )
+        {
+            exitTime = std::min( exitTime, ( rect.x + rect.w - boundsX ) / mVelX );
+        }
+        if( checkMaskCollision<Profile>( rect, impact, exitTime, &impact ) && ( !collided || impact < earliestImpact ) )
+        {
+            earliestImpact = impact;
+            collided = true;
+        }
+    } );
+
+    if( collided && timeOfImpact != nullptr )
+    {
+        *timeOfImpact = earliestImpact;
+    }
+
+    return collided;
+}
+
+bool Player::move( const World& world, const Entity first, const Entity last, const int currentTime )
+{
+    switch( mPhysicsMode )
+    {
+        case PHYSICS_EASY:
+            return moveWith<EasyPhysics>( world, first, last, currentTime );
+        case PHYSICS_HARD:
+            return moveWith<HardPhysics>( world, first, last, currentTime );
+        case PHYSICS_LOW_GRAVITY:
+            return moveWith<LowGravityPhysics>( world, first, last, currentTime );
+        default:
+            return moveWith<NormalPhysics>( world, first, last, currentTime );
+    }
+}
+
+template<class Profile>
+bool Player::moveWith( const World& world, const Entity first, const Entity last, const int currentTime )
 {
     // Get time passed in milliseconds
     double timePassed = double ( currentTime - mLastMove );
     // Adjust time passed to seconds
     timePassed /= 1000.f;
 
-    /* FOR TRAJECTORY DRAWING
-    gPoints.push_back( SDL_Point{ mPosX, mPosY } );
-    */
+    // Check collision along the whole path of this move so the player can not tunnel through pipes on long frames
+    double timeOfImpact = 0.0;
+    if( mAlive && checkSweptCollisionWith<Profile>( world, first, last, timePassed, &timeOfImpact ) )
+    {
+        Mix_PlayChannel( -1, mSoundEffects[ SFX_HIT ], 0 );
+        Mix_PlayChannel( -1, mSoundEffects[ SFX_DIE ], 0 );
+        mAlive = false;
+
+        // Only move player up to the point of impact
+        timePassed = timeOfImpact;
+    }
 
+#ifdef FIXED_POINT_PHYSICS
+    // The position and velocity always hold fixed-point values, so they convert back and forth exactly
+    FixedBody body = { Fixed( FX_fromDouble( mPosX ) ), Fixed( FX_fromDouble( mPosY ) ), Fixed( FX_fromDouble( mVelY ) ) };
+    FX_move<Profile>( body, FX_toTime( timePassed ) );
+    mPosX = FX_toDouble( body.posX );
+    mPosY = FX_toDouble( body.posY );
+    mVelY = FX_toDouble( body.velY );
+#else
     mPosX += mVelX * timePassed;
 
-    mPosY = mPosY + ( GRAVITY * timePassed * timePassed ) / 2 + mVelY * timePassed;
+    mPosY = PHYS_moveY<Profile>( mPosY, mVelY, timePassed );
 
-    mVelY = mVelY + GRAVITY * timePassed;
+    mVelY = PHYS_moveVelY<Profile>( mVelY, timePassed );
+#endif // FIXED_POINT_PHYSICS
 
     // If flap is finished start rotating
-    if( mGamePointer->getTicks() - mLastFlap > FLAP_AIR_TIME )
+    if( mGamePointer->getTicks() - mLastFlap > Profile::FLAP_AIR_TIME )
     {
         mRotationAngle += mRotationSpeed * timePassed;
     }
 
-    if( mRotationAngle < ROTATION_AFTER_FLAP )
+    if( mRotationAngle < BIRD_ROTATION_AFTER_FLAP )
     {
-        mRotationAngle = ROTATION_AFTER_FLAP;
+        mRotationAngle = BIRD_ROTATION_AFTER_FLAP;
         mRotationSpeed = 0;
     }
-    if( mRotationAngle > 90 )
+    if( mRotationAngle > BIRD_ROTATION_MAX )
     {
-        mRotationAngle = 90;
+        mRotationAngle = BIRD_ROTATION_MAX;
     }
 
-    mRotationSpeed += ROTATION_SPEED * timePassed;
-
-    // Check collision with new player position
-    for( size_t i = 0; i < pipes.size(); ++i )
-    {
-        if( checkCollision( pipes[ i ] ) && mAlive == true )
-        {
-            Mix_PlayChannel( -1, mSoundEffects[ SFX_HIT ], 0 );
-            Mix_PlayChannel( -1, mSoundEffects[ SFX_DIE ], 0 );
-            mAlive = false;
-            break;
-        }
-    }
+    mRotationSpeed += Profile::ROTATION_SPEED * timePassed;
 
     if( mPosY < 0 /*- mPlayerTextureStretchRect.h / 2*/ )
     {
@@ -206,62 +386,101 @@ bool Player::move( const std::vector<Pipe>& pipes, const int currentTime )
 
     mLastMove = currentTime;
     shiftCollider();
-
-    // Update the players score after move
-    updateScore();
     mScoreTracker->updateScore();
 
     // Choose texture to display
-    switch( ( mGamePointer->getTicks() - mLastFlap ) / ANIMATION_FRAME_DURATION )
-    {
-        case 0:
-            mPlayerTextureClip = mAnimationClips[ FLAP_UP ];
-            break;
-        case 1:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        case 2:
-            mPlayerTextureClip = mAnimationClips[ FLAP_DOWN ];
-            break;
-        case 3:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        case 4:
-            mPlayerTextureClip = mAnimationClips[ FLAP_UP ];
-            break;
-        case 5:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        case 6:
-            mPlayerTextureClip = mAnimationClips[ FLAP_DOWN ];
-            break;
-        case 7:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        /*
-        case 8:
-            mPlayerTextureClip = mAnimationClips[ FLAP_UP ];
-            break;
-        case 9:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        case 10:
-            mPlayerTextureClip = mAnimationClips[ FLAP_DOWN ];
-            break;
-        case 11:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-        */
-        default:
-            mPlayerTextureClip = mAnimationClips[ FLAP_NEUTRAL ];
-            break;
-    }
+    mCurrentTexture = PHYS_getBirdFrame( mGamePointer->getTicks() - mLastFlap );
+
+    mPlayerTextureClip = mAnimationClips[ mCurrentTexture ];
 
 
     // Return whether player is alive
     return mAlive;
 }
 
+int Player::predictTrajectory( const World& world, const Entity first, const Entity last, const int duration, const int camPosX,
+                               const int camPosY, SDL_Point* points, const int maxPoints, bool* impact ) const
+{
+    double endTime = duration / 1000.0;
+    bool collided = false;
+
+    double groundTime = PL_timeToReach( mPhysics, mPosY, mVelY, SCREEN_HEIGHT - PLAYER_HEIGHT, 0.0 );
+    if( groundTime >= 0.0 && groundTime < endTime )
+    {
+        endTime = groundTime;
+        collided = true;
+    }
+
+    // The collider of the player is swept against every collider it passes before the path ends ( moving gaps are taken
+    // where they are now )
+    const double sweepEnd = mPosX + mVelX * endTime + PLAYER_WIDTH;
+    world.forEachCollider( mPosX, sweepEnd, first, last, [&]( const SDL_Rect& rect )
+    {
+        double hitTime;
+        if( CD_checkSweptCollision( mPosX, mPosY, PLAYER_WIDTH, PLAYER_HEIGHT, mVelX, mVelY, mPhysics.gravity, endTime, rect, &hitTime ) &&
+            hitTime < endTime )
+        {
+            endTime = hitTime;
+            collided = true;
+        }
+    } );
+
+    if( impact != nullptr )
+    {
+        *impact = collided;
+    }
+
+    if( maxPoints < 2 )
+    {
+        return 0;
+    }
+
+    // The player is held at the top of the screen, so the path is too
+    for( int i = 0; i < maxPoints; ++i )
+    {
+        double time = endTime * i / ( maxPoints - 1 );
+        double posY = std::max( PHYS_moveY( mPhysics, mPosY, mVelY, time ), 0.0 );
+        points[ i ].x = int( mPosX + mVelX * time ) + PLAYER_WIDTH / 2 - camPosX;
+        points[ i ].y = int( posY ) + PLAYER_HEIGHT / 2 - camPosY;
+    }
+
+    return maxPoints;
+}
+
+void Player::saveState( PlayerState& state ) const
+{
+    state.posX = mPosX;
+    state.posY = mPosY;
+    state.velX = mVelX;
+    state.velY = mVelY;
+    state.rotationAngle = mRotationAngle;
+    state.rotationSpeed = mRotationSpeed;
+    state.lastMove = mLastMove;
+    state.lastFlap = mLastFlap;
+    state.score = mCurrentScore;
+    state.alive = mAlive;
+    state.texture = mCurrentTexture;
+}
+
+void Player::restoreState( const PlayerState& state )
+{
+    mPosX = state.posX;
+    mPosY = state.posY;
+    mVelX = state.velX;
+    mVelY = state.velY;
+    mRotationAngle = state.rotationAngle;
+    mRotationSpeed = state.rotationSpeed;
+    mLastMove = state.lastMove;
+    mLastFlap = state.lastFlap;
+    mCurrentScore = state.score;
+    mAlive = state.alive;
+    mCurrentTexture = BirdFrame( state.texture );
+
+    mPlayerTextureClip = mAnimationClips[ mCurrentTexture ];
+    shiftCollider();
+    mScoreTracker->updateScore();
+}
+
 void Player::shiftCollider()
 {
     mCollider.x = mPosX;
@@ -278,24 +497,16 @@ bool Player::isAlive() const
     return mAlive;
 }
 
-void Player::updateScore()
+void Player::addPoints( const int points )
 {
-    std::vector<Pipe> pipes = mGamePointer->getPipes();
-    int score = 0;
-    for( auto p : pipes )
+    if( points <= 0 )
     {
-        if( p.getTopRect().x < mPosX )
-            ++score;
-        else
-            break;
+        return;
     }
 
-    if( score > mCurrentScore )
-    {
-        Mix_PlayChannel( -1, mSoundEffects[ SFX_GET_POINT ], 0 );
-    }
-
-    mCurrentScore = score;
+    Mix_PlayChannel( -1, mSoundEffects[ SFX_GET_POINT ], 0 );
+    mCurrentScore += points;
+    mScoreTracker->updateScore();
 }
 
 void Player::renderScore()
@@ -4,12 +4,16 @@
 #include <string>
 #include <vector>
 
+#include "CollisionMask.hpp"
 #include "Game.hpp"
 #include "LTexture.hpp"
 #include "LTimer.hpp"
 #include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "RewindBuffer.hpp"
 #include "constants.hpp"
 #include "ScoreTracker.hpp"
+#include "World.hpp"
 
 class Game;
 class ScoreTracker;
@@ -21,37 +25,30 @@ struct Circle{
 
 class Player{
 
-// static const int NUM_ANIMATION_TEXTURES = ??
-// Dimensions of the player character
-static const int PLAYER_WIDTH = BIRD_LENGTH;
-static const int PLAYER_HEIGHT = ( BIRD_LENGTH * 24 ) / 34;
+// Size ( in degrees ) of the rotation ranges that share one collision mask
+static constexpr double ROTATION_BUCKET_SIZE = 4.f;
 
-// Height ( in pixels ) of a wing flap ( increase in Y )
-static const int FLAP_HEIGHT =  BIRD_LENGTH * 4.35;
+// Number of collision masks for each animation frame
+static const int NUM_ROTATION_BUCKETS = int( ( BIRD_ROTATION_MAX - BIRD_ROTATION_AFTER_FLAP ) / ROTATION_BUCKET_SIZE ) + 1;
 
-// Speed at which birds rotation speed changes
-static constexpr double ROTATION_SPEED = 500.f;
-
-// Angle at which the bird is rotated to after a flap
-static constexpr double ROTATION_AFTER_FLAP = -22.f;
-
-// Duration of each frame of the flap animation in milliseconds
-static const int ANIMATION_FRAME_DURATION = 60;
-
-// Air time that a flap gives in milliseconds ( ANIMATION_FRAME_DURATION * number of animation frames )
-static const int FLAP_AIR_TIME = ANIMATION_FRAME_DURATION * 8;
+// Upper limit of mask tests done along the path for a single pipe in one move
+static const int MAX_MASK_SAMPLES = 512;
 
 public:
 
     // How far the player is from the leftmost side of the camera
-    static const int PLAYER_CAMERA_OFFSET = 2 * BIRD_LENGTH;
+    static const int PLAYER_CAMERA_OFFSET = PLAYER_START_X;
 
-    // Initializes internal variables
-    Player( Game* game, int currentTicks );
+    // Initializes internal variables and builds collision masks from the decoded sprite atlas ( RGBA32, only read here ). The
+    // player moves with the physics of mode ( rotation speed and flap air time included )
+    Player( Game* game, int currentTicks, SDL_Surface* spriteSheet, const PhysicsMode mode = PHYSICS_NORMAL );
 
     // Deallocates memory
     ~Player() = default;
 
+    // Puts player back at the start of a run at given ticks, keeping loaded assets
+    void reset( const int currentTicks );
+
     // Renders player character
     void render( int camPosX, int camPosY );
 
@@ -61,20 +58,55 @@ public:
     // Handles event
     void handleEvent( SDL_Event& e );
 
-    // Moves player character. Return true if move was successful and false if there was collision ( player dies )
-    bool move( const std::vector<Pipe>& pipes, const int currentTime );
+    // Moves player character, colliding with the colliders of world between entities first and last ( the ones near the
+    // camera ). Return true if move was successful and false if there was collision ( player dies )
+    bool move( const World& world, const Entity first, const Entity last, const int currentTime );
 
     // Checks collision with set of pipes
     bool checkCollision( const Pipe& collisionPipe );
 
+    // Checks pixel accurate collision with the colliders of world between entities first and last along the path the player
+    // travels in given duration ( in seconds ). Sets timeOfImpact to the moment of the earliest collision
+    bool checkSweptCollision( const World& world, const Entity first, const Entity last, const double duration,
+                              double* timeOfImpact = nullptr ) const;
+
     bool isAlive() const;
 
     int getScore() const{ return mCurrentScore; }
 
+    double getPosX() const{ return mPosX; }
+
+    // Adds points scored by passing obstacles, playing the point sound if there are any
+    void addPoints( const int points );
+
+    // Predicts the path of the center of the player for the next duration ( in milliseconds ) if he does not flap, solving
+    // where his collider first touches a collider of world ( between entities first and last ) or the ground instead of
+    // stepping. Writes up to maxPoints points along the path ( relative to the camera ) into points, the last one at the end
+    // of the path, and returns how many. Sets impact to whether the path ends in a collision
+    int predictTrajectory( const World& world, const Entity first, const Entity last, const int duration, const int camPosX,
+                           const int camPosY, SDL_Point* points, const int maxPoints, bool* impact ) const;
+
+    // Copies everything that changes while moving into state
+    void saveState( PlayerState& state ) const;
+
+    // Puts player back into a saved state ( without playing any sounds )
+    void restoreState( const PlayerState& state );
+
     // Accessor function for the player collider
     SDL_Rect getCollider();
 
 private:
+    // Physics the player moves with, as mode for picking the step specialization and as values for everything else
+    PhysicsMode mPhysicsMode;
+    PhysicsValues mPhysics;
+
+    // Moves and checks collision with the constants of a physics profile
+    template<class Profile>
+    bool moveWith( const World& world, const Entity first, const Entity last, const int currentTime );
+    template<class Profile>
+    bool checkSweptCollisionWith( const World& world, const Entity first, const Entity last, const double duration,
+                                  double* timeOfImpact ) const;
+
     // The position of the player
     double mPosX, mPosY;
 
@@ -102,9 +134,6 @@ private:
     // Shifts collider position after player moves
     void shiftCollider();
 
-    // The sprite sheet for the player character
-    LTexture mSpriteSheet;
-
     // The texture of the player character
     SDL_Rect mPlayerTextureClip;
 
@@ -120,23 +149,30 @@ private:
     // The score tracker for the player
     ScoreTracker* mScoreTracker;
 
-    // Updates player score
-    void updateScore();
-
-    enum PlayerTexture{ FLAP_NEUTRAL = 0, FLAP_UP, FLAP_DOWN, FLAP_TOTAL  };
-
     // The set of textures required for animating the player character
     std::vector<SDL_Rect> mAnimationClips;
 
+    // The animation frame currently displayed
+    BirdFrame mCurrentTexture;
+
+    // Collision masks for every animation frame and rotation bucket ( indexed by frame * NUM_ROTATION_BUCKETS + bucket )
+    std::vector<CollisionMask> mCollisionMasks;
+
+    // Builds collision masks from the alpha channel of the animation clips in the RGBA32 sprite atlas
+    void loadCollisionMasks( SDL_Surface* spriteSheet );
+
+    // Gets collision mask for the current animation frame and rotation
+    const CollisionMask& getCollisionMask() const;
+
+    // Checks collision of the collision mask with rect along the path starting at given time ( in seconds ) of the move and
+    // ending at endTime. Sets timeOfImpact to the first moment the mask overlaps rect
+    template<class Profile>
+    bool checkMaskCollision( const SDL_Rect& rect, const double startTime, const double endTime, double* timeOfImpact ) const;
+
     enum SoundEffects{ SFX_FLAP = 0, SFX_GET_POINT, SFX_HIT, SFX_DIE, SFX_TOTAL };
 
     // The set of sound effects
     std::vector<Mix_Chunk*> mSoundEffects;
-
-public:
-    /* TRAJECTORY
-    std::vector<SDL_Point> gPoints;
-    */
 };
 
 #endif // _PLAYER_HPP_INCLUDED
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <SDL.h>
+
+#include "CollisionDetection.hpp"
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "ReferenceBot.hpp"
+#include "constants.hpp"
+
+// Time ( in seconds ) until the player falls from posY down to targetY ( infinity if he never gets there )
+static double RB_fallTime( const double posY, const double velY, const double targetY )
+{
+    // If the player is already falling below the target
+    if( posY >= targetY && velY >= 0 )
+    {
+        return 0.0;
+    }
+
+    // Solve posY + velY * t + GRAVITY * t^2 / 2 = targetY for the later root
+    double discriminant = velY * velY + 2 * GRAVITY * ( targetY - posY );
+    if( discriminant < 0 )
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return std::max( ( -velY + std::sqrt( discriminant ) ) / GRAVITY, 0.0 );
+}
+
+// Height ( in pixels ) the player rises after a flap
+static const double FLAP_RISE = double( FLAP_HEIGHT ) * FLAP_HEIGHT / ( 2 * GRAVITY );
+
+// Velocity ( in pixels per second ) the player has to slow down to before flapping again on a climb
+static const double REFLAP_VELOCITY = -FLAP_HEIGHT / 2.0;
+
+// Time ( in seconds ) from a flap until the player falls back to the height of the flap
+static const double FLAP_CYCLE_TIME = 2.0 * FLAP_HEIGHT / GRAVITY;
+
+// Tolerance ( in seconds ) for decisions timed to a moment
+static const double TIME_EPSILON = 1e-9;
+
+ReferenceBot::ReferenceBot( const int flapMargin )
+{
+    mFlapMargin = flapMargin;
+    mNumFlaps = 0;
+
+    mDeathX = 0.0; mDeathY = 0.0;
+}
+
+int ReferenceBot::play( const std::vector<Pipe>& level )
+{
+    double posX = PLAYER_START_X;
+    double posY = PLAYER_START_Y;
+    double velY = 0.0;
+
+    mNumFlaps = 0;
+
+    size_t nextPipe = 0;
+    while( nextPipe < level.size() )
+    {
+        SDL_Rect topRect = level[ nextPipe ].getTopRect();
+        SDL_Rect botRect = level[ nextPipe ].getBotRect();
+
+        // If the gap after the next one is not higher, fall as low as possible and leave the next pipe without flapping if
+        // the player gets past it before falling onto it. If he can not, time the last flap so he leaves the pipe falling
+        // back to the height of the flap, which gives the most speed for the drop to the following gap
+        double lowestY = botRect.y - PLAYER_HEIGHT - mFlapMargin / 2;
+        double exitTime = ( topRect.x + topRect.w - posX ) / CAMERA_VELOCITY;
+        double targetY = lowestY;
+        bool dropping = nextPipe + 1 == level.size() || level[ nextPipe + 1 ].getBotRect().y >= botRect.y;
+        bool canSkipFlap = exitTime < RB_fallTime( posY, velY, lowestY );
+        bool canTimeFlap = posY - FLAP_RISE >= topRect.y + topRect.h + mFlapMargin;
+
+        // Otherwise flap just above the bottom of the next gap, but climb as high as the next gap allows without hitting
+        // its top pipe at the top of a flap, so the climb between the two gaps is as short as possible
+        if( !dropping )
+        {
+            double followingTargetY = level[ nextPipe + 1 ].getBotRect().y - PLAYER_HEIGHT - mFlapMargin;
+            double highestTargetY = topRect.y + topRect.h + FLAP_RISE + mFlapMargin;
+            targetY = std::min( double( botRect.y - PLAYER_HEIGHT - mFlapMargin ), std::max( followingTargetY, highestTargetY ) );
+        }
+
+        // Flap if the player is below the target height, unless he is still rising fast from the last flap
+        bool flap;
+        if( dropping )
+        {
+            flap = velY >= 0 && !canSkipFlap && ( posY >= targetY || ( canTimeFlap && exitTime <= FLAP_CYCLE_TIME + TIME_EPSILON ) );
+        }
+        else
+        {
+            flap = velY >= REFLAP_VELOCITY && posY >= targetY;
+        }
+
+        if( flap )
+        {
+            velY = -FLAP_HEIGHT;
+            ++mNumFlaps;
+        }
+
+        // Move until the next decision: passing the next pipe, slowing down enough to flap again while below the target
+        // height, the top of a flap, falling to the target height or the time for the last flap before a drop
+        double decisionTime;
+        double decisionVelY = 0.0;
+        bool rising = velY < 0;
+        bool reachesTarget = false;
+        if( rising )
+        {
+            decisionVelY = !dropping && posY >= targetY && velY < REFLAP_VELOCITY ? REFLAP_VELOCITY : 0.0;
+            decisionTime = ( decisionVelY - velY ) / GRAVITY;
+        }
+        else if( dropping && canSkipFlap )
+        {
+            decisionTime = std::numeric_limits<double>::infinity();
+        }
+        else
+        {
+            decisionTime = RB_fallTime( posY, velY, targetY );
+            reachesTarget = true;
+            if( dropping && canTimeFlap && exitTime - FLAP_CYCLE_TIME > TIME_EPSILON && exitTime - FLAP_CYCLE_TIME < decisionTime )
+            {
+                decisionTime = exitTime - FLAP_CYCLE_TIME;
+                reachesTarget = false;
+            }
+        }
+        bool passesPipe = exitTime <= decisionTime;
+        double duration = std::min( exitTime, decisionTime );
+
+        // Check for hitting the ground or one of the pipes the player can reach during the move
+        double impact = RB_fallTime( posY, velY, SCREEN_HEIGHT - PLAYER_HEIGHT );
+        int impactPipe = impact < duration ? nextPipe : -1;
+        for( size_t i = nextPipe; i < level.size() && level[ i ].getTopRect().x < posX + PLAYER_WIDTH + CAMERA_VELOCITY * duration; ++i )
+        {
+            double pipeImpact;
+            if( ( CD_checkSweptCollision( posX, posY, PLAYER_WIDTH, PLAYER_HEIGHT, CAMERA_VELOCITY, velY, GRAVITY, duration, level[ i ].getTopRect(), &pipeImpact ) ||
+                  CD_checkSweptCollision( posX, posY, PLAYER_WIDTH, PLAYER_HEIGHT, CAMERA_VELOCITY, velY, GRAVITY, duration, level[ i ].getBotRect(), &pipeImpact ) ) &&
+                ( impactPipe < 0 || pipeImpact < impact ) )
+            {
+                impact = pipeImpact;
+                impactPipe = i;
+            }
+        }
+
+        // If the player dies during the move
+        if( impactPipe >= 0 )
+        {
+            mDeathX = posX + CAMERA_VELOCITY * impact;
+            mDeathY = PHYS_moveY( posY, velY, impact );
+            return impactPipe;
+        }
+
+        posX += CAMERA_VELOCITY * duration;
+        posY = PHYS_moveY( posY, velY, duration );
+        velY = PHYS_moveVelY( velY, duration );
+
+        // Snap to the decision point so rounding can not cause another tiny move
+        if( passesPipe )
+        {
+            posX = topRect.x + topRect.w;
+            ++nextPipe;
+        }
+        else if( rising )
+        {
+            velY = decisionVelY;
+        }
+        else if( reachesTarget )
+        {
+            posY = targetY;
+        }
+    }
+
+    mDeathX = posX;
+    mDeathY = posY;
+
+    return level.size();
+}
+
+int ReferenceBot::getNumFlaps() const
+{
+    return mNumFlaps;
+}
+
+double ReferenceBot::getDeathX() const
+{
+    return mDeathX;
+}
+
+double ReferenceBot::getDeathY() const
+{
+    return mDeathY;
+}
@@ -0,0 +1,50 @@
+#ifndef _REFERENCEBOT_HPP_INCLUDED
+#define _REFERENCEBOT_HPP_INCLUDED
+
+#include <vector>
+
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "constants.hpp"
+
+// Simple bot used to measure levels. It plays like a careful beginner: it flaps when the player falls to just above the
+// bottom of the next gap, climbs early before higher gaps and times its last flap before drops, but never plans further
+// than the next two pipes, so it dies where consecutive gaps are hard to follow. The level is simulated from decision to
+// decision with exact physics and swept collision, so no time steps are needed
+class ReferenceBot{
+
+public:
+
+    // How far above the bottom of the next gap the bot flaps ( in pixels )
+    static const int DEFAULT_FLAP_MARGIN = BIRD_LENGTH / 4;
+
+    // Initializes internal variables
+    ReferenceBot( const int flapMargin = DEFAULT_FLAP_MARGIN );
+
+    // Deallocates memory
+    ~ReferenceBot() = default;
+
+    // Plays level until the player dies or passes every pipe. Returns index of the pipe at which the player died
+    // ( size of the level if he passed it )
+    int play( const std::vector<Pipe>& level );
+
+    // Gets number of flaps of the last play
+    int getNumFlaps() const;
+
+    // Gets position of the player at the moment he died in the last play ( or where he left the level )
+    double getDeathX() const;
+    double getDeathY() const;
+
+private:
+
+    // Height above the bottom of the gap at which the bot flaps
+    int mFlapMargin;
+
+    // Number of flaps of the last play
+    int mNumFlaps;
+
+    // Position of the player at the end of the last play
+    double mDeathX, mDeathY;
+};
+
+#endif // _REFERENCEBOT_HPP_INCLUDED
@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "HeadlessGame.hpp"
+#include "Physics.hpp"
+#include "ReplayExporter.hpp"
+#include "SpriteAtlas.hpp"
+#include "constants.hpp"
+
+// Overlay drawn over the scene once the player is dead
+static const char* const RE_DEAD_PATH = "assets/dead.png";
+
+// Sprite of each frame of the flap animation
+static const int RE_BIRD_SPRITES[ BIRD_FRAME_TOTAL ] = { SPRITE_BIRD_NEUTRAL, SPRITE_BIRD_UP, SPRITE_BIRD_DOWN };
+
+// Size the bird is stretched to
+static const SDL_Rect RE_PLAYER_STRETCH_RECT = { 0, 0, PLAYER_WIDTH, PLAYER_HEIGHT };
+
+// Offset of the score from the center of the screen, same as in ScoreTracker
+static const int RE_SCORE_OFFSET = BIRD_LENGTH / 2;
+
+// Renders score centered at the top like ScoreTracker::render
+static void RE_renderScore( SDL_Renderer* renderer, LTexture& spriteSheet, int score )
+{
+    // Digits in reverse order
+    int digits[ 16 ];
+    int numDigits = 0;
+    do
+    {
+        digits[ numDigits++ ] = score % 10;
+        score /= 10;
+    } while( score > 0 && numDigits < 16 );
+
+    int totalWidth = 0;
+    for( int i = 0; i < numDigits; ++i )
+    {
+        totalWidth += SPRITE_CLIPS[ SPRITE_DIGIT_0 + digits[ i ] ].w;
+    }
+
+    int renderX = SCREEN_WIDTH / 2 - totalWidth / 2 + RE_SCORE_OFFSET;
+    int renderY = SCREEN_HEIGHT / 8;
+    for( int i = numDigits - 1; i >= 0; --i )
+    {
+        const SDL_Rect& clip = SPRITE_CLIPS[ SPRITE_DIGIT_0 + digits[ i ] ];
+        spriteSheet.render( renderer, renderX, renderY, &clip );
+        renderX += clip.w;
+    }
+}
+
+ReplayExporter::ReplayExporter()
+{
+    mNextFrame = 0;
+    mFailed = false;
+
+    mNumWritten = 0;
+}
+
+void ReplayExporter::simulate( const LevelGenerator& generator, const ReplayRun& run )
+{
+    mFrames.clear();
+
+    HeadlessGame game;
+    game.reset( generator, run.seed );
+
+    // Times since the start of the run ( in milliseconds )
+    double time = 0.0;
+    double lastFlap = 0.0;
+
+    double rotationAngle = 0.0;
+    double rotationSpeed = NormalPhysics::ROTATION_SPEED;
+
+    size_t nextFlap = 0;
+    int firstPipe = 0;
+    int deathFrames = 0;
+
+    // Moves player for duration ( in milliseconds ), flapping first if requested, and turns the bird like Player::move
+    auto move = [ & ]( const bool flap, const double duration )
+    {
+        if( flap )
+        {
+            rotationSpeed = -NormalPhysics::ROTATION_SPEED;
+            rotationAngle = BIRD_ROTATION_AFTER_FLAP;
+            lastFlap = time;
+        }
+
+        game.step( generator, flap, duration / 1000.0 );
+        time += duration;
+
+        if( time - lastFlap > NormalPhysics::FLAP_AIR_TIME )
+        {
+            rotationAngle += rotationSpeed * duration / 1000.0;
+        }
+        if( rotationAngle < BIRD_ROTATION_AFTER_FLAP )
+        {
+            rotationAngle = BIRD_ROTATION_AFTER_FLAP;
+            rotationSpeed = 0.0;
+        }
+        rotationAngle = std::min( rotationAngle, BIRD_ROTATION_MAX );
+        rotationSpeed += NormalPhysics::ROTATION_SPEED * duration / 1000.0;
+    };
+
+    for( int frame = 0; deathFrames < DEATH_FRAMES; ++frame )
+    {
+        // The run ends where the player died in the game, even if the headless collider would still let him through
+        const double frameTime = std::min( frame * 1000.0 / FRAME_RATE, double( run.duration ) );
+        if( game.isAlive() && time < run.duration )
+        {
+            // Split the frame at its flaps so each one happens at its recorded time
+            bool flap = false;
+            while( nextFlap < run.flapTimes.size() && run.flapTimes[ nextFlap ] <= frameTime && game.isAlive() )
+            {
+                move( flap, std::max( run.flapTimes[ nextFlap ] - time, 0.0 ) );
+                flap = true;
+                ++nextFlap;
+            }
+            if( game.isAlive() )
+            {
+                move( flap, frameTime - time );
+            }
+        }
+
+        ExportFrame exportFrame;
+        exportFrame.posX = game.getPosX();
+        exportFrame.posY = game.getPosY();
+        exportFrame.rotationAngle = rotationAngle;
+        exportFrame.score = game.getScore();
+        exportFrame.alive = game.isAlive() && time < run.duration;
+
+        exportFrame.sprite = RE_BIRD_SPRITES[ PHYS_getBirdFrame( time - lastFlap ) ];
+
+        // Skip pipes that went off the left side of the screen
+        const std::vector<Pipe>& level = game.getLevel();
+        const int cameraX = int( exportFrame.posX ) - PLAYER_START_X;
+        while( firstPipe < int( level.size() ) &&
+               level[ firstPipe ].getTopRect().x + level[ firstPipe ].getTopRect().w < cameraX )
+        {
+            ++firstPipe;
+        }
+        exportFrame.firstPipe = firstPipe;
+
+        mFrames.push_back( exportFrame );
+
+        if( !exportFrame.alive )
+        {
+            ++deathFrames;
+        }
+    }
+
+    // Generate the level up to the right side of the last frame
+    mLevel = game.getLevel();
+    const int lastCameraX = int( mFrames.back().posX ) - PLAYER_START_X;
+    while( int( mLevel.size() ) < NUM_OBSTACLES && mLevel.back().getTopRect().x <= lastCameraX + SCREEN_WIDTH )
+    {
+        generator.generate( run.seed, mLevel, std::min( int( mLevel.size() ) * 2, NUM_OBSTACLES ) );
+    }
+}
+
+bool ReplayExporter::exportFrames( const std::string& path, const ExportFormat format, unsigned numThreads )
+{
+    if( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    FILE* file = nullptr;
+    if( format == EXPORT_RGBA )
+    {
+        file = fopen( path.c_str(), "wb" );
+        if( file == nullptr )
+        {
+            printf( "Could not open %s for writing!\n", path.c_str() );
+            return false;
+        }
+    }
+
+    mNextFrame = 0;
+    mFailed = false;
+    mNumWritten = 0;
+
+    // PNG frames are saved by the workers, so only the RGBA stream needs a reorder window
+    const int frameSize = SCREEN_WIDTH * SCREEN_HEIGHT * 4;
+    const int windowSize = format == EXPORT_RGBA ? int( numThreads ) * FRAMES_PER_THREAD : 0;
+    mSlots.assign( windowSize, std::vector<Uint8>( frameSize ) );
+    mSlotReady.assign( windowSize, false );
+
+    std::vector<std::thread> threads;
+    for( unsigned i = 0; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( &ReplayExporter::renderFrames, this, path, format ) );
+    }
+
+    // Write RGBA frames in order as they are finished
+    for( int frame = 0; format == EXPORT_RGBA && frame < int( mFrames.size() ); ++frame )
+    {
+        const int slot = frame % windowSize;
+        {
+            std::unique_lock<std::mutex> lock( mWindowMutex );
+            mSlotFilled.wait( lock, [ & ]{ return mSlotReady[ slot ] || mFailed; } );
+            if( mFailed )
+            {
+                break;
+            }
+        }
+
+        if( fwrite( mSlots[ slot ].data(), 1, frameSize, file ) != size_t( frameSize ) )
+        {
+            printf( "Could not write frame %d to %s!\n", frame, path.c_str() );
+            fail();
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( mWindowMutex );
+            mSlotReady[ slot ] = false;
+            ++mNumWritten;
+        }
+        mSlotFreed.notify_all();
+    }
+
+    for( std::thread& thread : threads )
+    {
+        thread.join();
+    }
+
+    if( file != nullptr )
+    {
+        fclose( file );
+    }
+
+    mSlots.clear();
+    mSlotReady.clear();
+
+    return !mFailed;
+}
+
+void ReplayExporter::renderFrames( const std::string& path, const ExportFormat format )
+{
+    // Each worker draws into its own surface
+    SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat( 0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32 );
+    SDL_Renderer* renderer = target != nullptr ? SDL_CreateSoftwareRenderer( target ) : nullptr;
+    if( renderer == nullptr )
+    {
+        printf( "Could not create software renderer! SDL_Error: %s\n", SDL_GetError() );
+        SDL_FreeSurface( target );
+        fail();
+        return;
+    }
+
+    LTexture spriteSheet, deadTexture;
+    if( !spriteSheet.loadFromFile( renderer, SPRITE_ATLAS_PATH ) || !deadTexture.loadFromFile( renderer, RE_DEAD_PATH ) )
+    {
+        fail();
+    }
+
+    const int windowSize = int( mSlots.size() );
+    for( int frame = mNextFrame++; frame < int( mFrames.size() ) && !mFailed; frame = mNextFrame++ )
+    {
+        renderFrame( renderer, spriteSheet, deadTexture, frame );
+
+        if( format == EXPORT_PNG )
+        {
+            char fileName[ 32 ];
+            snprintf( fileName, sizeof( fileName ), "/frame_%06d.png", frame );
+            SDL_RenderFlush( renderer );
+            if( IMG_SavePNG( target, ( path + fileName ).c_str() ) != 0 )
+            {
+                printf( "Could not save frame %s%s! IMG_Error: %s\n", path.c_str(), fileName, IMG_GetError() );
+                fail();
+            }
+            continue;
+        }
+
+        // Frames more than the window ahead of the writer wait for their slot
+        const int slot = frame % windowSize;
+        {
+            std::unique_lock<std::mutex> lock( mWindowMutex );
+            mSlotFreed.wait( lock, [ & ]{ return frame < mNumWritten + windowSize || mFailed; } );
+        }
+        if( mFailed )
+        {
+            break;
+        }
+
+        if( SDL_RenderReadPixels( renderer, nullptr, SDL_PIXELFORMAT_RGBA32, mSlots[ slot ].data(), SCREEN_WIDTH * 4 ) != 0 )
+        {
+            printf( "Could not read frame %d! SDL_Error: %s\n", frame, SDL_GetError() );
+            fail();
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( mWindowMutex );
+            mSlotReady[ slot ] = true;
+        }
+        mSlotFilled.notify_one();
+    }
+
+    // Textures belong to the renderer, so they go first
+    spriteSheet.free();
+    deadTexture.free();
+    SDL_DestroyRenderer( renderer );
+    SDL_FreeSurface( target );
+}
+
+void ReplayExporter::renderFrame( SDL_Renderer* renderer, LTexture& spriteSheet, LTexture& deadTexture, const int frame ) const
+{
+    const ExportFrame& state = mFrames[ frame ];
+    const SDL_Rect camera = { int( state.posX ) - PLAYER_START_X, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+
+    SDL_SetRenderDrawColor( renderer, 0xff, 0xff, 0xff, 0xff );
+    SDL_RenderClear( renderer );
+
+    spriteSheet.renderStretched( renderer, 0, 0, &FULL_SCREEN_STRETCH_RECT, &SPRITE_CLIPS[ SPRITE_BACKGROUND ] );
+
+    for( int i = state.firstPipe; i < int( mLevel.size() ); ++i )
+    {
+        SDL_Rect topRect = mLevel[ i ].getTopRect();
+        if( topRect.x > camera.x + camera.w )
+        {
+            break;
+        }
+        if( topRect.x >= camera.x - topRect.w )
+        {
+            mLevel[ i ].render( renderer, camera, spriteSheet, SPRITE_CLIPS[ SPRITE_PIPE_TOP ], SPRITE_CLIPS[ SPRITE_PIPE_BOTTOM ] );
+        }
+    }
+
+    RE_renderScore( renderer, spriteSheet, state.score );
+
+    if( state.alive )
+    {
+        spriteSheet.renderStretched( renderer, int( state.posX - camera.x ), int( state.posY - camera.y ),
+                                     &RE_PLAYER_STRETCH_RECT, &SPRITE_CLIPS[ state.sprite ], state.rotationAngle );
+    }
+    else
+    {
+        deadTexture.renderStretched( renderer, 0, 0, &FULL_SCREEN_STRETCH_RECT );
+    }
+}
+
+void ReplayExporter::fail()
+{
+    {
+        std::lock_guard<std::mutex> lock( mWindowMutex );
+        mFailed = true;
+    }
+    mSlotFreed.notify_all();
+    mSlotFilled.notify_all();
+}
+
+int ReplayExporter::getNumFrames() const
+{
+    return int( mFrames.size() );
+}
@@ -0,0 +1,101 @@
+#ifndef _REPLAYEXPORTER_HPP_INCLUDED
+#define _REPLAYEXPORTER_HPP_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LTexture.hpp"
+#include "LevelGenerator.hpp"
+#include "ReplayLog.hpp"
+
+// Everything drawn in one video frame
+struct ExportFrame{
+    // Position and rotation of the player
+    double posX, posY;
+    double rotationAngle;
+    // Animation frame shown ( a SpriteId )
+    int sprite;
+    int score;
+    // Index of the first pipe that can be on screen
+    int firstPipe;
+    bool alive;
+};
+
+// Turns a replay into video frames without a window. The run is simulated headless once at the frame rate, which only
+// stores what each frame shows, then worker threads rasterize frames with their own software renderer the way
+// Game::render draws them. Frames are written to a raw RGBA stream in order through a bounded reorder window, or saved
+// as a numbered PNG sequence by the workers themselves
+class ReplayExporter{
+
+public:
+
+    // Video frames per second
+    static const int FRAME_RATE = 60;
+
+    // Frames shown after the death of the player
+    static const int DEATH_FRAMES = FRAME_RATE;
+
+    // Finished frames each worker may have waiting for the writer
+    static const int FRAMES_PER_THREAD = 4;
+
+    // Output formats
+    enum ExportFormat{ EXPORT_RGBA, EXPORT_PNG };
+
+    // Initializes internal variables
+    ReplayExporter();
+
+    // Deallocates memory
+    ~ReplayExporter() = default;
+
+    // Simulates run on its level and stores the contents of every frame up to a second after the death of the player
+    void simulate( const LevelGenerator& generator, const ReplayRun& run );
+
+    // Renders every frame with numThreads workers ( one per core if 0 ). EXPORT_RGBA writes SCREEN_WIDTH x SCREEN_HEIGHT
+    // RGBA frames one after another to the file ( or named pipe ) at path, EXPORT_PNG saves frame_000000.png and so on
+    // into the directory at path. Returns whether every frame was written
+    bool exportFrames( const std::string& path, const ExportFormat format, unsigned numThreads );
+
+    // Gets number of simulated frames
+    int getNumFrames() const;
+
+private:
+
+    // Renders frames claimed from mNextFrame until all are taken or writing failed
+    void renderFrames( const std::string& path, const ExportFormat format );
+
+    // Draws frame like Game::render does
+    void renderFrame( SDL_Renderer* renderer, LTexture& spriteSheet, LTexture& deadTexture, const int frame ) const;
+
+    // Stops all workers and the writer
+    void fail();
+
+    // Level of the run, long enough for the last frame
+    std::vector<Pipe> mLevel;
+
+    // Contents of every frame
+    std::vector<ExportFrame> mFrames;
+
+    // Next frame to be claimed by a worker
+    std::atomic<int> mNextFrame;
+
+    // Set when a frame could not be rendered or written, so all workers stop
+    std::atomic<bool> mFailed;
+
+    // Reorder window of the RGBA stream: pixels of the frames in flight ( slot is frame modulo window size ), whether each
+    // slot holds a finished frame and number of frames written so far
+    std::vector<std::vector<Uint8>> mSlots;
+    std::vector<bool> mSlotReady;
+    int mNumWritten;
+
+    // Guards the reorder window. Workers wait for free slots and the writer waits for the next frame
+    std::mutex mWindowMutex;
+    std::condition_variable mSlotFreed;
+    std::condition_variable mSlotFilled;
+};
+
+#endif // _REPLAYEXPORTER_HPP_INCLUDED
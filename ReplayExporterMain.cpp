@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "LevelGenerator.hpp"
+#include "ReplayExporter.hpp"
+#include "ReplayLog.hpp"
+#include "constants.hpp"
+
+// Log written by the game
+const std::string DEFAULT_REPLAY_LOG_PATH = "replays.rpl";
+
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    if( argc < 3 || argv[ 1 ][ 0 ] == '-' )
+    {
+        printUsage();
+        return 1;
+    }
+
+    int seed = atoi( argv[ 1 ] );
+    std::string outputPath = argv[ 2 ];
+    ReplayExporter::ExportFormat format = argc >= 4 && strcmp( argv[ 3 ], "png" ) == 0 ?
+                                          ReplayExporter::EXPORT_PNG : ReplayExporter::EXPORT_RGBA;
+    unsigned numThreads = argc >= 5 ? atoi( argv[ 4 ] ) : 0;
+    int rank = argc >= 6 ? std::max( atoi( argv[ 5 ] ), 1 ) : 1;
+    std::string logPath = argc >= 7 ? argv[ 6 ] : DEFAULT_REPLAY_LOG_PATH;
+
+    ReplayLog replayLog;
+    if( !replayLog.load( logPath ) )
+    {
+        return 1;
+    }
+    std::vector<ReplayRun> runs = replayLog.getBestRuns( seed, rank );
+    if( int( runs.size() ) < rank )
+    {
+        printf( "%s has only %d runs on seed %d!\n", logPath.c_str(), int( runs.size() ), seed );
+        return 1;
+    }
+
+    if( ( IMG_Init( IMG_INIT_PNG ) & IMG_INIT_PNG ) != IMG_INIT_PNG )
+    {
+        printf( "Could not initialize PNG loading! IMG_Error: %s\n", IMG_GetError() );
+        return 1;
+    }
+
+    Uint32 startTicks = SDL_GetTicks();
+
+    LevelGenerator generator;
+    ReplayExporter exporter;
+    exporter.simulate( generator, runs[ rank - 1 ] );
+
+    Uint32 simulatedTicks = SDL_GetTicks();
+
+    bool success = exporter.exportFrames( outputPath, format, numThreads );
+    if( success )
+    {
+        Uint32 time = std::max( SDL_GetTicks() - startTicks, 1u );
+        double framesPerSecond = exporter.getNumFrames() * 1000.0 / time;
+        printf( "Exported %d %dx%d frames of a run scoring %d ( simulated in %u ms ) in %u ms: %.1f frames per second, "
+                "%.1fx real time\n", exporter.getNumFrames(), SCREEN_WIDTH, SCREEN_HEIGHT, runs[ rank - 1 ].score,
+                simulatedTicks - startTicks, time, framesPerSecond, framesPerSecond / ReplayExporter::FRAME_RATE );
+    }
+
+    IMG_Quit();
+
+    return success ? 0 : 1;
+}
+
+void printUsage()
+{
+    printf( "Usage: ReplayExporter <seed> <output> [rgba|png] [numThreads] [rank] [replayLog]\n" );
+    printf( "  Renders the rank-th best run on seed from replayLog ( %s by default ).\n", DEFAULT_REPLAY_LOG_PATH.c_str() );
+    printf( "  rgba writes raw %dx%d frames at %d fps to the output file, e.g. for\n", SCREEN_WIDTH, SCREEN_HEIGHT,
+            ReplayExporter::FRAME_RATE );
+    printf( "    ffmpeg -f rawvideo -pix_fmt rgba -s %dx%d -r %d -i <output> run.mp4\n", SCREEN_WIDTH, SCREEN_HEIGHT,
+            ReplayExporter::FRAME_RATE );
+    printf( "  png saves frame_000000.png and so on into the output directory\n" );
+}
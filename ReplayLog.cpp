@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "ReplayLog.hpp"
+
+// Most flaps a stored run can have, anything above is treated as a corrupt file
+static const Uint32 RL_MAX_FLAPS = 1 << 20;
+
+ReplayLog::ReplayLog()
+{
+}
+
+bool ReplayLog::load( const std::string& path )
+{
+    mPath = path;
+    mRuns.clear();
+
+    FILE* logFile = fopen( path.c_str(), "rb" );
+    if( logFile == nullptr )
+    {
+        return true;
+    }
+
+    // Each run is its seed, score, duration and number of flaps followed by the flap times
+    bool success = true;
+    Sint32 header[ 4 ];
+    while( fread( header, sizeof( header ), 1, logFile ) == 1 )
+    {
+        ReplayRun run;
+        run.seed = header[ 0 ];
+        run.score = header[ 1 ];
+        run.duration = header[ 2 ];
+
+        Uint32 numFlaps = header[ 3 ];
+        if( numFlaps > RL_MAX_FLAPS )
+        {
+            success = false;
+            break;
+        }
+
+        run.flapTimes.resize( numFlaps );
+        if( numFlaps > 0 && fread( run.flapTimes.data(), sizeof( Uint32 ), numFlaps, logFile ) != numFlaps )
+        {
+            success = false;
+            break;
+        }
+
+        mRuns.push_back( run );
+    }
+
+    if( !success )
+    {
+        printf( "Replay log %s is corrupt, loaded %d runs!\n", path.c_str(), int( mRuns.size() ) );
+    }
+
+    fclose( logFile );
+
+    return success;
+}
+
+bool ReplayLog::addRun( const ReplayRun& run )
+{
+    mRuns.push_back( run );
+
+    FILE* logFile = fopen( mPath.c_str(), "ab" );
+    if( logFile == nullptr )
+    {
+        printf( "Could not open replay log %s!\n", mPath.c_str() );
+        return false;
+    }
+
+    Sint32 header[ 4 ] = { run.seed, run.score, Sint32( run.duration ), Sint32( run.flapTimes.size() ) };
+    bool success = fwrite( header, sizeof( header ), 1, logFile ) == 1 &&
+                   fwrite( run.flapTimes.data(), sizeof( Uint32 ), run.flapTimes.size(), logFile ) == run.flapTimes.size();
+    if( !success )
+    {
+        printf( "Could not write replay log %s!\n", mPath.c_str() );
+    }
+
+    fclose( logFile );
+
+    return success;
+}
+
+std::vector<ReplayRun> ReplayLog::getBestRuns( const int seed, const int maxRuns ) const
+{
+    std::vector<ReplayRun> runs;
+    for( const ReplayRun& run : mRuns )
+    {
+        if( run.seed == seed )
+        {
+            runs.push_back( run );
+        }
+    }
+
+    // Highest scores first, longer runs first among equal scores
+    std::sort( runs.begin(), runs.end(), []( const ReplayRun& a, const ReplayRun& b )
+    {
+        return a.score != b.score ? a.score > b.score : a.duration > b.duration;
+    } );
+    if( int( runs.size() ) > maxRuns )
+    {
+        runs.resize( std::max( maxRuns, 0 ) );
+    }
+
+    return runs;
+}
+
+const std::vector<ReplayRun>& ReplayLog::getRuns() const
+{
+    return mRuns;
+}
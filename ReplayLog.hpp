@@ -0,0 +1,52 @@
+#ifndef _REPLAYLOG_HPP_INCLUDED
+#define _REPLAYLOG_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+// Inputs of one finished run
+struct ReplayRun{
+    // Seed of the level the run was played on
+    Sint32 seed;
+    Sint32 score;
+    // Time from the start of the run to the death of the player ( in milliseconds )
+    Uint32 duration;
+    // Times of the flaps since the start of the run ( in milliseconds )
+    std::vector<Uint32> flapTimes;
+};
+
+// Stores input logs of finished runs in a file so they can be replayed as ghosts
+class ReplayLog{
+
+public:
+
+    // Initializes internal variables
+    ReplayLog();
+
+    // Deallocates memory
+    ~ReplayLog() = default;
+
+    // Loads all runs from the log file at path. A missing file is an empty log. Returns whether log could be read
+    bool load( const std::string& path );
+
+    // Adds run to the log and appends it to the log file. Returns whether run was saved
+    bool addRun( const ReplayRun& run );
+
+    // Gets up to maxRuns runs with the highest scores played on the level of seed
+    std::vector<ReplayRun> getBestRuns( const int seed, const int maxRuns ) const;
+
+    // Gets every run in the order they were added
+    const std::vector<ReplayRun>& getRuns() const;
+
+private:
+
+    // Path of the log file
+    std::string mPath;
+
+    // Every run of the log
+    std::vector<ReplayRun> mRuns;
+};
+
+#endif // _REPLAYLOG_HPP_INCLUDED
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstdio>
+
+#include <SDL.h>
+
+#include "ResolutionScaler.hpp"
+
+ResolutionScaler::ResolutionScaler()
+{
+    mRenderer = nullptr;
+    mTarget = nullptr;
+
+    mWidth = 0; mHeight = 0;
+
+    mScale = 1.0;
+
+    mFrameStart = 0;
+    mFrameTime = 0.0;
+
+    mSlowFrames = 0; mFastFrames = 0;
+}
+
+ResolutionScaler::~ResolutionScaler()
+{
+    free();
+}
+
+bool ResolutionScaler::init( SDL_Renderer* renderer, const int width, const int height )
+{
+    free();
+
+    mRenderer = renderer;
+    mWidth = width;
+    mHeight = height;
+    mScale = 1.0;
+    mFrameTime = 0.0;
+    mSlowFrames = 0; mFastFrames = 0;
+
+    // The target keeps full size so changing the scale only changes how much of it is used
+    mTarget = SDL_CreateTexture( renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height );
+    if( mTarget == nullptr )
+    {
+        printf( "Could not create offscreen render target! SDL_Error: %s\n", SDL_GetError() );
+        return false;
+    }
+
+    SDL_SetTextureScaleMode( mTarget, SDL_ScaleModeLinear );
+
+    return true;
+}
+
+void ResolutionScaler::free()
+{
+    if( mTarget != nullptr )
+    {
+        SDL_DestroyTexture( mTarget );
+        mTarget = nullptr;
+    }
+}
+
+void ResolutionScaler::beginFrame()
+{
+    mFrameStart = SDL_GetPerformanceCounter();
+
+    if( mTarget != nullptr )
+    {
+        SDL_SetRenderTarget( mRenderer, mTarget );
+        SDL_RenderSetScale( mRenderer, float( mScale ), float( mScale ) );
+    }
+}
+
+void ResolutionScaler::presentFrame()
+{
+    if( mTarget != nullptr )
+    {
+        // Stretch the used part of the target over the whole window
+        SDL_Rect sourceRect = { 0, 0, int( mWidth * mScale + 0.5 ), int( mHeight * mScale + 0.5 ) };
+
+        SDL_SetRenderTarget( mRenderer, nullptr );
+        SDL_RenderSetScale( mRenderer, 1.f, 1.f );
+        SDL_RenderCopy( mRenderer, mTarget, &sourceRect, nullptr );
+    }
+
+    SDL_RenderPresent( mRenderer );
+
+    if( mTarget == nullptr )
+    {
+        return;
+    }
+
+    double frameTime = double( SDL_GetPerformanceCounter() - mFrameStart ) * 1000.0 / SDL_GetPerformanceFrequency();
+    mFrameTime = mFrameTime == 0.0 ? frameTime : mFrameTime + ( frameTime - mFrameTime ) * FRAME_TIME_SMOOTHING;
+
+    // Count how long the frame time stayed out of range, any frame inside the range restarts the count
+    mSlowFrames = mFrameTime > TARGET_FRAME_TIME * DOWNSCALE_LOAD ? mSlowFrames + 1 : 0;
+    mFastFrames = mFrameTime < TARGET_FRAME_TIME * UPSCALE_LOAD ? mFastFrames + 1 : 0;
+
+    double scale = mScale;
+    if( mSlowFrames >= FRAMES_BEFORE_DOWNSCALE )
+    {
+        scale = std::max( mScale - SCALE_STEP, double( MIN_SCALE ) );
+    }
+    else if( mFastFrames >= FRAMES_BEFORE_UPSCALE )
+    {
+        scale = std::min( mScale + SCALE_STEP, 1.0 );
+    }
+
+    if( scale != mScale )
+    {
+        // Let the new scale settle before judging it
+        mScale = scale;
+        mSlowFrames = 0;
+        mFastFrames = 0;
+    }
+}
+
+double ResolutionScaler::getScale() const
+{
+    return mScale;
+}
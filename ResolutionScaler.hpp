@@ -0,0 +1,75 @@
+#ifndef _RESOLUTIONSCALER_HPP_INCLUDED
+#define _RESOLUTIONSCALER_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Renders frames into an offscreen target at a fraction of the window resolution and upscales them to the window. The
+// fraction follows the measured frame time: it drops quickly when frames run over budget and recovers slowly once they are
+// well within it, so the resolution does not oscillate
+class ResolutionScaler{
+
+public:
+
+    // Frame time the scaler tries to keep ( in milliseconds )
+    static constexpr double TARGET_FRAME_TIME = 1000.0 / 60.0;
+
+    // Frame times above DOWNSCALE_LOAD and below UPSCALE_LOAD of TARGET_FRAME_TIME change the resolution
+    static constexpr double DOWNSCALE_LOAD = 0.85;
+    static constexpr double UPSCALE_LOAD = 0.5;
+
+    // Number of consecutive frames out of the range before the resolution changes
+    static const int FRAMES_BEFORE_DOWNSCALE = 8;
+    static const int FRAMES_BEFORE_UPSCALE = 120;
+
+    // Lowest resolution scale and the size of each change
+    static constexpr double MIN_SCALE = 0.5;
+    static constexpr double SCALE_STEP = 0.125;
+
+    // Smoothing of the measured frame time ( weight of the newest frame )
+    static constexpr double FRAME_TIME_SMOOTHING = 0.2;
+
+    // Initializes internal variables
+    ResolutionScaler();
+
+    // Deallocates memory
+    ~ResolutionScaler();
+
+    // Creates offscreen target of given size for renderer. Returns whether it succeeded, if not frames are rendered
+    // directly at full resolution
+    bool init( SDL_Renderer* renderer, const int width, const int height );
+
+    // Frees offscreen target
+    void free();
+
+    // Redirects rendering into the scaled offscreen target. Everything is still drawn in window coordinates
+    void beginFrame();
+
+    // Upscales offscreen target to the window, presents it and adapts the scale to the time the frame took
+    void presentFrame();
+
+    // Gets current resolution scale ( 1 is full resolution )
+    double getScale() const;
+
+private:
+
+    // Renderer and its offscreen target
+    SDL_Renderer* mRenderer;
+    SDL_Texture* mTarget;
+
+    // Full resolution
+    int mWidth, mHeight;
+
+    // Current resolution scale
+    double mScale;
+
+    // Start of the current frame ( in performance counter ticks )
+    Uint64 mFrameStart;
+
+    // Smoothed frame time ( in milliseconds )
+    double mFrameTime;
+
+    // Consecutive frames over and under budget
+    int mSlowFrames, mFastFrames;
+};
+
+#endif // _RESOLUTIONSCALER_HPP_INCLUDED
@@ -0,0 +1,55 @@
+#include <SDL.h>
+
+#include "RewindBuffer.hpp"
+
+RewindBuffer::RewindBuffer()
+{
+    mNewest = CAPACITY - 1;
+    mSize = 0;
+}
+
+void RewindBuffer::clear()
+{
+    mNewest = CAPACITY - 1;
+    mSize = 0;
+}
+
+void RewindBuffer::push( const WorldSnapshot& snapshot )
+{
+    mNewest = mNewest + 1 == CAPACITY ? 0 : mNewest + 1;
+    mSnapshots[ mNewest ] = snapshot;
+
+    if( mSize < CAPACITY )
+    {
+        ++mSize;
+    }
+}
+
+bool RewindBuffer::rewindTo( const Uint32 time, WorldSnapshot& snapshot )
+{
+    if( mSize == 0 )
+    {
+        return false;
+    }
+
+    // Drop newer snapshots but always keep the oldest one to restore
+    while( mSize > 1 && mSnapshots[ mNewest ].time > time )
+    {
+        mNewest = mNewest == 0 ? CAPACITY - 1 : mNewest - 1;
+        --mSize;
+    }
+
+    snapshot = mSnapshots[ mNewest ];
+
+    return true;
+}
+
+Uint32 RewindBuffer::getLatestTime() const
+{
+    return mSize > 0 ? mSnapshots[ mNewest ].time : 0;
+}
+
+int RewindBuffer::getSize() const
+{
+    return mSize;
+}
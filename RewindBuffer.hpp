@@ -0,0 +1,74 @@
+#ifndef _REWINDBUFFER_HPP_INCLUDED
+#define _REWINDBUFFER_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Everything that changes while the player moves
+struct PlayerState{
+    double posX, posY;
+    double velX, velY;
+    double rotationAngle, rotationSpeed;
+    // Game ticks of the last move and the last flap ( in milliseconds )
+    Sint32 lastMove, lastFlap;
+    // Number of pipes passed, which is also the index of the next pipe
+    Sint32 score;
+    Uint8 alive;
+    // Animation frame shown
+    Uint8 texture;
+};
+
+// State of a run at one moment
+struct WorldSnapshot{
+    // Game ticks at which the snapshot was taken ( in milliseconds )
+    Uint32 time;
+    PlayerState player;
+    // Number of flaps recorded for the replay log up to the snapshot
+    Sint32 numFlaps;
+};
+
+// Fixed size ring of the latest snapshots of a run. Snapshots are plain data copied into preallocated slots, so taking
+// one costs a few stores and rewinding never allocates
+class RewindBuffer{
+
+public:
+
+    // Time between two snapshots ( in milliseconds )
+    static const int SNAPSHOT_INTERVAL = 1000 / 60;
+
+    // Number of snapshots kept, enough for REWIND_SECONDS seconds
+    static const int REWIND_SECONDS = 10;
+    static const int CAPACITY = REWIND_SECONDS * 1000 / SNAPSHOT_INTERVAL;
+
+    // Initializes internal variables
+    RewindBuffer();
+
+    // Deallocates memory
+    ~RewindBuffer() = default;
+
+    // Removes all snapshots
+    void clear();
+
+    // Adds snapshot, overwriting the oldest one if buffer is full
+    void push( const WorldSnapshot& snapshot );
+
+    // Removes snapshots newer than time and gets the newest one left ( or the oldest one if all are newer ), which stays in
+    // the buffer. Returns false if buffer is empty
+    bool rewindTo( const Uint32 time, WorldSnapshot& snapshot );
+
+    // Gets time of the newest snapshot ( 0 if buffer is empty )
+    Uint32 getLatestTime() const;
+
+    // Gets number of stored snapshots
+    int getSize() const;
+
+private:
+
+    // Snapshot slots and the index of the newest snapshot
+    WorldSnapshot mSnapshots[ CAPACITY ];
+    int mNewest;
+
+    // Number of stored snapshots
+    int mSize;
+};
+
+#endif // _REWINDBUFFER_HPP_INCLUDED
@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <SDL.h>
+
+#include "RollbackSession.hpp"
+
+// Input guessed for remote ticks that have not arrived. Flaps are single ticks, so not flapping is right far more often
+// than repeating the last input
+static const Uint8 RS_PREDICTED_INPUT = 0;
+
+// Bytes of a packet without its inputs
+static const int RS_HEADER_SIZE = offsetof( RollbackPacket, inputs );
+
+// Adds bytes to an FNV-1a hash
+static Uint32 RS_hash( Uint32 hash, const void* data, const size_t size )
+{
+    const Uint8* bytes = static_cast<const Uint8*>( data );
+    for( size_t i = 0; i < size; ++i )
+    {
+        hash = ( hash ^ bytes[ i ] ) * 16777619u;
+    }
+
+    return hash;
+}
+
+// Hashes states of both birds field by field ( padding bytes are not part of the state )
+static Uint32 RS_checksum( const HeadlessState* states )
+{
+    Uint32 hash = 2166136261u;
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        hash = RS_hash( hash, &states[ i ].posX, sizeof( states[ i ].posX ) );
+        hash = RS_hash( hash, &states[ i ].posY, sizeof( states[ i ].posY ) );
+        hash = RS_hash( hash, &states[ i ].velY, sizeof( states[ i ].velY ) );
+        hash = RS_hash( hash, &states[ i ].score, sizeof( states[ i ].score ) );
+        hash = RS_hash( hash, &states[ i ].nextPipe, sizeof( states[ i ].nextPipe ) );
+        hash = RS_hash( hash, &states[ i ].alive, sizeof( states[ i ].alive ) );
+    }
+
+    return hash;
+}
+
+RollbackSession::RollbackSession()
+{
+    mSocket = -1;
+    mRemotePort = 0;
+
+    mLatency = 0; mJitter = 0; mLossPercent = 0;
+    mLastQueueTime = 0;
+
+    mLocalPlayer = 0;
+
+    mTick = 0;
+    mConfirmedTick = -1;
+    mRemoteAckTick = -1;
+
+    memset( mInputs, 0, sizeof( mInputs ) );
+    memset( mChecksums, 0, sizeof( mChecksums ) );
+
+    mRollbackTick = -1;
+
+    for( int i = 0; i < HISTORY_SIZE; ++i )
+    {
+        mRemoteChecksumTicks[ i ] = -1;
+        mRemoteChecksums[ i ] = 0;
+    }
+    mCheckedTick = -1;
+
+    mNumRollbacks = 0; mNumResimulated = 0; mMaxRollback = 0;
+    mNumStalls = 0;
+    mNumChecksums = 0; mNumDesyncs = 0;
+}
+
+RollbackSession::~RollbackSession()
+{
+    if( mSocket >= 0 )
+    {
+        close( mSocket );
+    }
+}
+
+bool RollbackSession::init( const int localPort, const int remotePort, const int localPlayer, const int seed,
+                            const int latency, const int jitter, const int lossPercent )
+{
+    mSocket = socket( AF_INET, SOCK_DGRAM, 0 );
+    if( mSocket < 0 )
+    {
+        printf( "Could not create socket! Error: %s\n", strerror( errno ) );
+        return false;
+    }
+
+    sockaddr_in address;
+    memset( &address, 0, sizeof( address ) );
+    address.sin_family = AF_INET;
+    address.sin_port = htons( localPort );
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    if( bind( mSocket, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0 )
+    {
+        printf( "Could not bind to port %d! Error: %s\n", localPort, strerror( errno ) );
+        return false;
+    }
+
+    int flags = fcntl( mSocket, F_GETFL, 0 );
+    if( flags < 0 || fcntl( mSocket, F_SETFL, flags | O_NONBLOCK ) != 0 )
+    {
+        printf( "Could not make socket non-blocking! Error: %s\n", strerror( errno ) );
+        return false;
+    }
+
+    mRemotePort = remotePort;
+    mLocalPlayer = localPlayer;
+
+    mLatency = std::max( latency, 0 );
+    mJitter = std::max( jitter, 0 );
+    mLossPercent = std::min( std::max( lossPercent, 0 ), 100 );
+    mNetworkRandom.seed( localPort );
+
+    // Both birds fly the same level
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        mGames[ i ].reset( mGenerator, seed );
+    }
+
+    return true;
+}
+
+void RollbackSession::poll()
+{
+    RollbackPacket packet;
+    while( true )
+    {
+        ssize_t received = recv( mSocket, &packet, sizeof( packet ), 0 );
+        if( received < 0 )
+        {
+            // Nothing left to read ( or the other peer is not up yet )
+            break;
+        }
+        if( received >= RS_HEADER_SIZE && packet.magic == PACKET_MAGIC && packet.numInputs >= 0 &&
+            packet.numInputs <= ROLLBACK_PACKET_INPUTS && received >= RS_HEADER_SIZE + packet.numInputs )
+        {
+            receivePacket( packet );
+        }
+    }
+
+    // Go back to the first mispredicted tick and simulate again up to the present
+    if( mRollbackTick >= 0 )
+    {
+        const int lastTick = mTick;
+        for( int i = 0; i < VERSUS_PLAYERS; ++i )
+        {
+            mGames[ i ].restoreState( mStates[ mRollbackTick % HISTORY_SIZE ][ i ] );
+        }
+        for( int tick = mRollbackTick; tick < lastTick; ++tick )
+        {
+            simulateTick( tick );
+        }
+
+        ++mNumRollbacks;
+        mNumResimulated += lastTick - mRollbackTick;
+        mMaxRollback = std::max( mMaxRollback, lastTick - mRollbackTick );
+        mRollbackTick = -1;
+    }
+
+    // Compare states of ticks that are final on both peers ( ticks whose checksum was lost are skipped )
+    const int finalTick = std::min( mTick - 1, mConfirmedTick + 1 );
+    for( int tick = std::max( mCheckedTick + 1, mTick - HISTORY_SIZE ); tick <= finalTick; ++tick )
+    {
+        const int slot = tick % HISTORY_SIZE;
+        if( mRemoteChecksumTicks[ slot ] != tick )
+        {
+            continue;
+        }
+
+        ++mNumChecksums;
+        if( mChecksums[ slot ] != mRemoteChecksums[ slot ] )
+        {
+            ++mNumDesyncs;
+            printf( "Desync at tick %d!\n", tick );
+        }
+        mCheckedTick = tick;
+    }
+
+    // Without this a lost packet is never replaced once advance stops sending, and the other peer waits forever
+    if( mRemoteAckTick < mTick - 1 && SDL_GetTicks() - mLastQueueTime >= RESEND_INTERVAL )
+    {
+        queuePacket();
+    }
+
+    flushPackets();
+}
+
+bool RollbackSession::advance( const bool flap )
+{
+    if( mTick - mConfirmedTick > MAX_PREDICTION )
+    {
+        ++mNumStalls;
+        queuePacket();
+        return false;
+    }
+
+    const int slot = mTick % HISTORY_SIZE;
+    mInputs[ mLocalPlayer ][ slot ] = flap;
+    if( mTick > mConfirmedTick )
+    {
+        mInputs[ 1 - mLocalPlayer ][ slot ] = RS_PREDICTED_INPUT;
+    }
+
+    simulateTick( mTick );
+    ++mTick;
+
+    queuePacket();
+
+    return true;
+}
+
+void RollbackSession::simulateTick( const int tick )
+{
+    const int slot = tick % HISTORY_SIZE;
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        mGames[ i ].saveState( mStates[ slot ][ i ] );
+    }
+    mChecksums[ slot ] = RS_checksum( mStates[ slot ] );
+
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        if( mGames[ i ].isAlive() )
+        {
+            mGames[ i ].step( mGenerator, mInputs[ i ][ slot ] != 0, TICK_DURATION );
+        }
+    }
+}
+
+void RollbackSession::receivePacket( const RollbackPacket& packet )
+{
+    mRemoteAckTick = std::max( mRemoteAckTick, int( packet.ackTick ) );
+    if( packet.checksumTick > mCheckedTick )
+    {
+        mRemoteChecksumTicks[ packet.checksumTick % HISTORY_SIZE ] = packet.checksumTick;
+        mRemoteChecksums[ packet.checksumTick % HISTORY_SIZE ] = packet.checksum;
+    }
+
+    // Inputs must follow the last known one without a gap ( older packets can arrive after newer ones )
+    if( packet.firstTick > mConfirmedTick + 1 )
+    {
+        return;
+    }
+
+    const int remotePlayer = 1 - mLocalPlayer;
+    for( int tick = mConfirmedTick + 1; tick < packet.firstTick + packet.numInputs; ++tick )
+    {
+        const Uint8 input = packet.inputs[ tick - packet.firstTick ];
+        const int slot = tick % HISTORY_SIZE;
+        if( tick < mTick && mInputs[ remotePlayer ][ slot ] != input && ( mRollbackTick < 0 || tick < mRollbackTick ) )
+        {
+            mRollbackTick = tick;
+        }
+        mInputs[ remotePlayer ][ slot ] = input;
+        mConfirmedTick = tick;
+    }
+}
+
+void RollbackSession::queuePacket()
+{
+    DelayedPacket delayed;
+    RollbackPacket& packet = delayed.packet;
+    packet.magic = PACKET_MAGIC;
+    packet.firstTick = mRemoteAckTick + 1;
+    packet.numInputs = std::min( mTick - packet.firstTick, ROLLBACK_PACKET_INPUTS );
+    packet.ackTick = mConfirmedTick;
+    for( int i = 0; i < packet.numInputs; ++i )
+    {
+        packet.inputs[ i ] = mInputs[ mLocalPlayer ][ ( packet.firstTick + i ) % HISTORY_SIZE ];
+    }
+
+    // Latest state that no remote input can change anymore
+    packet.checksumTick = std::min( mTick - 1, mConfirmedTick + 1 );
+    packet.checksum = packet.checksumTick >= 0 ? mChecksums[ packet.checksumTick % HISTORY_SIZE ] : 0;
+
+    mLastQueueTime = SDL_GetTicks();
+    if( int( mNetworkRandom() % 100 ) < mLossPercent )
+    {
+        return;
+    }
+
+    delayed.sendTime = SDL_GetTicks() + mLatency + ( mJitter > 0 ? mNetworkRandom() % ( mJitter + 1 ) : 0 );
+    mDelayedPackets.push_back( delayed );
+
+    flushPackets();
+}
+
+void RollbackSession::flushPackets()
+{
+    sockaddr_in address;
+    memset( &address, 0, sizeof( address ) );
+    address.sin_family = AF_INET;
+    address.sin_port = htons( mRemotePort );
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+    // Jitter can make later packets due first, which reorders them like a real network
+    const Uint32 time = SDL_GetTicks();
+    for( std::deque<DelayedPacket>::iterator it = mDelayedPackets.begin(); it != mDelayedPackets.end(); )
+    {
+        if( it->sendTime > time )
+        {
+            ++it;
+            continue;
+        }
+
+        sendto( mSocket, &it->packet, RS_HEADER_SIZE + it->packet.numInputs, 0, reinterpret_cast<sockaddr*>( &address ),
+                sizeof( address ) );
+        it = mDelayedPackets.erase( it );
+    }
+}
+
+const HeadlessGame& RollbackSession::getGame( const int player ) const
+{
+    return mGames[ player ];
+}
+
+int RollbackSession::getLocalPlayer() const
+{
+    return mLocalPlayer;
+}
+
+int RollbackSession::getTick() const
+{
+    return mTick;
+}
+
+int RollbackSession::getConfirmedTick() const
+{
+    return mConfirmedTick;
+}
+
+bool RollbackSession::isOver() const
+{
+    const int finalTick = std::min( mTick - 1, mConfirmedTick + 1 );
+    if( finalTick < 0 )
+    {
+        return false;
+    }
+
+    // Dead birds stay dead, so the latest final state decides
+    for( int i = 0; i < VERSUS_PLAYERS; ++i )
+    {
+        if( mStates[ finalTick % HISTORY_SIZE ][ i ].alive )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int RollbackSession::getNumRollbacks() const
+{
+    return mNumRollbacks;
+}
+
+int RollbackSession::getNumResimulated() const
+{
+    return mNumResimulated;
+}
+
+int RollbackSession::getMaxRollback() const
+{
+    return mMaxRollback;
+}
+
+int RollbackSession::getNumStalls() const
+{
+    return mNumStalls;
+}
+
+int RollbackSession::getNumChecksums() const
+{
+    return mNumChecksums;
+}
+
+int RollbackSession::getNumDesyncs() const
+{
+    return mNumDesyncs;
+}
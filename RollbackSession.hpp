@@ -0,0 +1,182 @@
+#ifndef _ROLLBACKSESSION_HPP_INCLUDED
+#define _ROLLBACKSESSION_HPP_INCLUDED
+
+#include <deque>
+#include <random>
+
+#include <SDL.h>
+
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+
+// Number of birds in a versus game
+const int VERSUS_PLAYERS = 2;
+
+// Most inputs carried by one packet
+const int ROLLBACK_PACKET_INPUTS = 64;
+
+// Datagram sent to the other peer every tick. It carries every local input the peer has not acknowledged yet, so a lost
+// packet is covered by the next one
+struct RollbackPacket{
+    Uint32 magic;
+    // Tick of the first input and number of inputs carried
+    Sint32 firstTick;
+    Sint32 numInputs;
+    // Last tick up to which the sender has every input of the receiver
+    Sint32 ackTick;
+    // Tick whose starting state is final at the sender and the checksum of that state ( -1 if there is none yet )
+    Sint32 checksumTick;
+    Uint32 checksum;
+    // Flap of each tick from firstTick
+    Uint8 inputs[ ROLLBACK_PACKET_INPUTS ];
+};
+
+// Two player versus on the same seeded level with rollback netcode. The game advances in fixed ticks without waiting for
+// the other peer: its missing inputs are predicted, the state before every tick is saved, and when a real input arrives
+// that differs from the prediction the game is restored to that tick and simulated again up to the present. Both peers
+// simulate both birds, so the states of ticks with all inputs known must match, which is checked with checksums.
+// Packets go over UDP and can be delayed and dropped on purpose to test the netcode on loopback
+class RollbackSession{
+
+public:
+
+    // Duration of one tick ( in seconds )
+    static constexpr double TICK_DURATION = 1.0 / 60.0;
+
+    // Most ticks the game runs ahead of the last known remote input before it waits. Remote inputs arrive one-way latency
+    // late, so this is what lets the game keep its pace up to about 300 ms of latency
+    static const int MAX_PREDICTION = 20;
+
+    // Ticks of inputs and states kept, which bounds how far back a rollback can go
+    static const int HISTORY_SIZE = ROLLBACK_PACKET_INPUTS;
+
+    // Marks packets of this game
+    static const Uint32 PACKET_MAGIC = 0x464c5250;
+
+    // Shortest time between packets sent by poll while the other peer lacks local inputs ( in milliseconds ). Covers
+    // lost packets once advance stops sending, at the end of the game or while waiting
+    static const Uint32 RESEND_INTERVAL = 50;
+
+    // Most ticks a game loop should simulate in one frame to catch up after waiting for the other peer
+    static const int MAX_CATCH_UP_TICKS = 4;
+
+    // Time without any new remote input after which a game loop should give up on the other peer ( in milliseconds )
+    static const Uint32 PEER_TIMEOUT = 5000;
+
+    // Initializes internal variables
+    RollbackSession();
+
+    // Closes socket
+    ~RollbackSession();
+
+    // Binds UDP socket to localPort on loopback, sends to remotePort and starts level of given seed with the local bird
+    // being localPlayer. Outgoing packets are held back latency ( plus up to jitter ) milliseconds and lossPercent of
+    // them are dropped. Returns whether socket was set up
+    bool init( const int localPort, const int remotePort, const int localPlayer, const int seed,
+               const int latency = 0, const int jitter = 0, const int lossPercent = 0 );
+
+    // Receives remote inputs, rolls back and simulates again if a prediction was wrong, sends the unacknowledged local
+    // inputs again if nothing was sent for RESEND_INTERVAL and sends delayed packets whose time has come. Called at
+    // least once per tick
+    void poll();
+
+    // Simulates the next tick with given local input. Returns false without simulating if the game is too far ahead of
+    // the other peer and has to wait for its inputs
+    bool advance( const bool flap );
+
+    // Gets bird of given player
+    const HeadlessGame& getGame( const int player ) const;
+
+    int getLocalPlayer() const;
+
+    // Gets number of simulated ticks
+    int getTick() const;
+
+    // Gets last tick up to which every remote input is known ( -1 if none is )
+    int getConfirmedTick() const;
+
+    // Checks whether both birds are dead in a state that no remote input can change anymore
+    bool isOver() const;
+
+    // Rollback statistics: number of rollbacks, ticks simulated again and the deepest rollback ( in ticks )
+    int getNumRollbacks() const;
+    int getNumResimulated() const;
+    int getMaxRollback() const;
+
+    // Gets number of ticks the game waited for the other peer
+    int getNumStalls() const;
+
+    // Gets number of checksums compared and number of them that differed
+    int getNumChecksums() const;
+    int getNumDesyncs() const;
+
+private:
+
+    // Simulates tick with inputs stored for it, saving the state before it
+    void simulateTick( const int tick );
+
+    // Reads packet from the other peer
+    void receivePacket( const RollbackPacket& packet );
+
+    // Builds packet with unacknowledged local inputs and queues it for sending
+    void queuePacket();
+
+    // Sends queued packets whose delay has passed
+    void flushPackets();
+
+    // Packet waiting for its simulated delay
+    struct DelayedPacket{
+        Uint32 sendTime;
+        RollbackPacket packet;
+    };
+
+    // UDP socket and port of the other peer
+    int mSocket;
+    int mRemotePort;
+
+    // Simulated network conditions
+    int mLatency, mJitter, mLossPercent;
+    std::mt19937 mNetworkRandom;
+    std::deque<DelayedPacket> mDelayedPackets;
+
+    // Time the last packet was queued ( dropped or not )
+    Uint32 mLastQueueTime;
+
+    int mLocalPlayer;
+
+    LevelGenerator mGenerator;
+    HeadlessGame mGames[ VERSUS_PLAYERS ];
+
+    // Next tick to simulate
+    int mTick;
+
+    // Last tick up to which every remote input is known
+    int mConfirmedTick;
+
+    // Last tick up to which the other peer has every local input
+    int mRemoteAckTick;
+
+    // Input of each player per tick ( real or predicted ), indexed by tick modulo HISTORY_SIZE
+    Uint8 mInputs[ VERSUS_PLAYERS ][ HISTORY_SIZE ];
+
+    // States of both birds before each tick and their checksums
+    HeadlessState mStates[ HISTORY_SIZE ][ VERSUS_PLAYERS ];
+    Uint32 mChecksums[ HISTORY_SIZE ];
+
+    // Earliest tick whose remote input differed from the prediction since the last poll ( -1 if none did )
+    int mRollbackTick;
+
+    // Checksums received from the other peer and their ticks, indexed by tick modulo HISTORY_SIZE
+    int mRemoteChecksumTicks[ HISTORY_SIZE ];
+    Uint32 mRemoteChecksums[ HISTORY_SIZE ];
+
+    // Last tick whose checksum was compared
+    int mCheckedTick;
+
+    // Statistics
+    int mNumRollbacks, mNumResimulated, mMaxRollback;
+    int mNumStalls;
+    int mNumChecksums, mNumDesyncs;
+};
+
+#endif // _ROLLBACKSESSION_HPP_INCLUDED
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <SDL.h>
+
+#include "HeadlessGame.hpp"
+#include "Physics.hpp"
+#include "RollbackSession.hpp"
+#include "constants.hpp"
+
+// Ports of the two peers when both run in this process
+const int DEFAULT_PORTS[ VERSUS_PLAYERS ] = { 47000, 47001 };
+
+// How far above the bottom of the next gap the bot of each player flaps ( in pixels ). They differ so the birds split up
+const int BOT_FLAP_MARGINS[ VERSUS_PLAYERS ] = { BIRD_LENGTH / 4, BIRD_LENGTH / 2 };
+
+// Longest versus game ( in seconds )
+const int DEFAULT_MAX_SECONDS = 60;
+
+// Time given to the last packets after both birds died ( in milliseconds )
+const Uint32 LINGER_TIME = 500;
+
+
+bool botFlap( const HeadlessGame& game, const int flapMargin );
+int runVersus( const std::vector<int>& players, const int* localPorts, const int* remotePorts, const int seed,
+               const int latency, const int jitter, const int lossPercent, const int maxSeconds );
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    if( argc >= 6 && strcmp( argv[ 1 ], "--peer" ) == 0 )
+    {
+        // One peer of a game between two processes
+        int player = atoi( argv[ 2 ] ) != 0 ? 1 : 0;
+        int localPort = atoi( argv[ 3 ] );
+        int remotePort = atoi( argv[ 4 ] );
+        int seed = atoi( argv[ 5 ] );
+        int latency = argc >= 7 ? atoi( argv[ 6 ] ) : 0;
+        int jitter = argc >= 8 ? atoi( argv[ 7 ] ) : 0;
+        int lossPercent = argc >= 9 ? atoi( argv[ 8 ] ) : 0;
+        int maxSeconds = argc >= 10 ? atoi( argv[ 9 ] ) : DEFAULT_MAX_SECONDS;
+
+        return runVersus( std::vector<int>( 1, player ), &localPort, &remotePort, seed, latency, jitter, lossPercent,
+                          maxSeconds );
+    }
+    else if( argc >= 2 && argv[ 1 ][ 0 ] != '-' )
+    {
+        // Both peers in this process, talking over loopback
+        int seed = atoi( argv[ 1 ] );
+        int latency = argc >= 3 ? atoi( argv[ 2 ] ) : 0;
+        int jitter = argc >= 4 ? atoi( argv[ 3 ] ) : 0;
+        int lossPercent = argc >= 5 ? atoi( argv[ 4 ] ) : 0;
+        int maxSeconds = argc >= 6 ? atoi( argv[ 5 ] ) : DEFAULT_MAX_SECONDS;
+
+        std::vector<int> players = { 0, 1 };
+        int remotePorts[ VERSUS_PLAYERS ] = { DEFAULT_PORTS[ 1 ], DEFAULT_PORTS[ 0 ] };
+
+        return runVersus( players, DEFAULT_PORTS, remotePorts, seed, latency, jitter, lossPercent, maxSeconds );
+    }
+
+    printUsage();
+    return 1;
+}
+
+// Decides flap of a bot player the way ReferenceBot does: flap when falling to just above the bottom of the next gap
+bool botFlap( const HeadlessGame& game, const int flapMargin )
+{
+    const std::vector<Pipe>& level = game.getLevel();
+    int gapBottom = SCREEN_HEIGHT / 2 + PIPE_GAP / 2;
+    if( game.getNextPipe() < int( level.size() ) )
+    {
+        gapBottom = level[ game.getNextPipe() ].getBotRect().y;
+    }
+
+    return game.isAlive() && game.getVelY() >= 0 && game.getPosY() + PLAYER_HEIGHT > gapBottom - flapMargin;
+}
+
+// Plays versus with a session for each of players at real time ( the local birds are bots ) and prints the netcode
+// statistics. Returns 0 if no session desynced or lost its peer
+int runVersus( const std::vector<int>& players, const int* localPorts, const int* remotePorts, const int seed,
+               const int latency, const int jitter, const int lossPercent, const int maxSeconds )
+{
+    std::vector<RollbackSession> sessions( players.size() );
+    for( size_t i = 0; i < players.size(); ++i )
+    {
+        if( !sessions[ i ].init( localPorts[ i ], remotePorts[ i ], players[ i ], seed, latency, jitter, lossPercent ) )
+        {
+            return 1;
+        }
+    }
+
+    printf( "Versus on seed %d with %d ms latency, %d ms jitter and %d%% loss\n", seed, latency, jitter, lossPercent );
+
+    const int maxTicks = int( maxSeconds / RollbackSession::TICK_DURATION );
+    const Uint32 startTime = SDL_GetTicks();
+    Uint32 endTime = 0;
+
+    // Last confirmed tick of each session and when any of them last grew
+    std::vector<int> confirmedTicks( sessions.size(), -1 );
+    Uint32 progressTime = startTime;
+    bool timedOut = false;
+
+    for( int frame = 0; ; ++frame )
+    {
+        // Keep ticking at the fixed rate. Frame i should end with i + 1 ticks simulated
+        Uint32 frameTime = startTime + Uint32( frame * RollbackSession::TICK_DURATION * 1000 );
+        Uint32 time = SDL_GetTicks();
+        if( frameTime > time )
+        {
+            SDL_Delay( frameTime - time );
+        }
+
+        bool finished = true;
+        for( RollbackSession& session : sessions )
+        {
+            session.poll();
+
+            // Simulate the ticks missed while waiting for the other peer, a few per frame so catching up stays smooth
+            const HeadlessGame& localGame = session.getGame( session.getLocalPlayer() );
+            const int targetTick = std::min( frame + 1, maxTicks );
+            for( int step = 0; step < RollbackSession::MAX_CATCH_UP_TICKS && session.getTick() < targetTick; ++step )
+            {
+                if( !session.advance( botFlap( localGame, BOT_FLAP_MARGINS[ session.getLocalPlayer() ] ) ) )
+                {
+                    break;
+                }
+            }
+
+            finished = finished && ( session.isOver() || session.getConfirmedTick() >= maxTicks - 1 );
+        }
+
+        for( size_t i = 0; i < sessions.size(); ++i )
+        {
+            if( sessions[ i ].getConfirmedTick() > confirmedTicks[ i ] )
+            {
+                confirmedTicks[ i ] = sessions[ i ].getConfirmedTick();
+                progressTime = SDL_GetTicks();
+            }
+        }
+        if( !finished && SDL_GetTicks() - progressTime >= RollbackSession::PEER_TIMEOUT )
+        {
+            printf( "No inputs from the other peer for %u ms, giving up!\n", RollbackSession::PEER_TIMEOUT );
+            timedOut = true;
+            break;
+        }
+
+        if( finished && endTime == 0 )
+        {
+            endTime = SDL_GetTicks();
+        }
+        if( endTime != 0 && SDL_GetTicks() - endTime >= LINGER_TIME )
+        {
+            break;
+        }
+    }
+
+    int numDesyncs = 0;
+    for( const RollbackSession& session : sessions )
+    {
+        printf( "Player %d: %d ticks, scores %d:%d, %d rollbacks ( %d ticks simulated again, deepest %d ), "
+                "%d stalls, %d/%d checksums differed\n", session.getLocalPlayer(), session.getTick(),
+                session.getGame( 0 ).getScore(), session.getGame( 1 ).getScore(), session.getNumRollbacks(),
+                session.getNumResimulated(), session.getMaxRollback(), session.getNumStalls(), session.getNumDesyncs(),
+                session.getNumChecksums() );
+        numDesyncs += session.getNumDesyncs();
+    }
+
+    return numDesyncs == 0 && !timedOut ? 0 : 1;
+}
+
+void printUsage()
+{
+    printf( "Usage:\n" );
+    printf( "  RollbackVersus <seed> [latencyMs] [jitterMs] [lossPercent] [maxSeconds]\n" );
+    printf( "      plays both peers in this process over 127.0.0.1\n" );
+    printf( "  RollbackVersus --peer <player> <localPort> <remotePort> <seed> [latencyMs] [jitterMs] [lossPercent] "
+            "[maxSeconds]\n" );
+    printf( "      plays one peer, start another process as the other player\n" );
+}
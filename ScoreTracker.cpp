@@ -1,6 +1,5 @@
 #include <fstream>
 #include <iostream>
-#include <vector>
 
 #include <SDL.h>
 
@@ -8,6 +7,7 @@
 #include "ScoreTracker.hpp"
 #include "Player.hpp"
 #include "constants.hpp"
+#include "SpriteAtlas.hpp"
 
 ScoreTracker::ScoreTracker( Game* game, const Player* player )
 {
@@ -23,11 +23,6 @@ ScoreTracker::ScoreTracker( Game* game, const Player* player )
 
     mFileStream >> mMaxScore;
 
-    if( !mSpriteSheet.loadFromFile( game->getRenderer(), "assets/sprite_sheet.png" ) )
-    {
-        printf( "Could not load player sprite sheet!\n" );
-    }
-
     mFileStream.close();
 
     setClips();
@@ -50,87 +45,39 @@ void ScoreTracker::updateScore()
 
 void ScoreTracker::render()
 {
-    // The length of the score
-    int scoreDigits = 1;
+    // The digits of the score ( in reverse order ), kept on the stack since this runs every frame
+    int digits[ MAX_SCORE_DIGITS ];
+    int scoreDigits = 0;
     int tmpScore = mScore;
-    // The digits of the score (in reverse order)
-    std::vector<int> digits;
-    digits.push_back( tmpScore % 10 );
-    tmpScore /= 10;
-
-    while( tmpScore > 0 )
+    do
     {
-        ++scoreDigits;
-        digits.push_back( tmpScore % 10 );
+        digits[ scoreDigits++ ] = tmpScore % 10;
         tmpScore /= 10;
     }
+    while( tmpScore > 0 && scoreDigits < MAX_SCORE_DIGITS );
 
     // Calculate total width needed to render score
     int totalWidth = 0;
-    for( int i : digits )
+    for( int i = 0; i < scoreDigits; ++i )
     {
-        totalWidth += mTextureClips[ i ].w;
+        totalWidth += mTextureClips[ digits[ i ] ].w;
     }
     // Center score for rendering
     int renderX = SCREEN_WIDTH / 2 - totalWidth / 2 + PLAYER_SCORE_OFFSET;
     int renderY = SCREEN_HEIGHT / 8;
 
-    for( std::vector<int>::reverse_iterator iter = digits.rbegin(); iter != digits.rend(); ++iter )
+    for( int i = scoreDigits - 1; i >= 0; --i )
     {
-        mSpriteSheet.render( mGamePointer->getRenderer(), renderX, renderY, &mTextureClips[ *iter ] );
-        renderX += mTextureClips[ *iter ].w;
+        mGamePointer->getSpriteSheet().render( mGamePointer->getRenderer(), renderX, renderY, &mTextureClips[ digits[ i ] ] );
+        renderX += mTextureClips[ digits[ i ] ].w;
     }
 }
 
 void ScoreTracker::setClips()
 {
-    mTextureClips[ ST_0 ].x = 992;
-    mTextureClips[ ST_0 ].y = 120;
-    mTextureClips[ ST_0 ].w = 25;
-    mTextureClips[ ST_0 ].h = 36;
-
-    mTextureClips[ ST_1 ].x = 272;
-    mTextureClips[ ST_1 ].y = 910;
-    mTextureClips[ ST_1 ].w = 16;
-    mTextureClips[ ST_1 ].h = 36;
-
-    mTextureClips[ ST_2 ].x = 584;
-    mTextureClips[ ST_2 ].y = 320;
-    mTextureClips[ ST_2 ].w = 24;
-    mTextureClips[ ST_2 ].h = 36;
-
-    mTextureClips[ ST_3 ].x = 612;
-    mTextureClips[ ST_3 ].y = 320;
-    mTextureClips[ ST_3 ].w = 24;
-    mTextureClips[ ST_3 ].h = 36;
-
-    mTextureClips[ ST_4 ].x = 640;
-    mTextureClips[ ST_4 ].y = 320;
-    mTextureClips[ ST_4 ].w = 24;
-    mTextureClips[ ST_4 ].h = 36;
-
-    mTextureClips[ ST_5 ].x = 668;
-    mTextureClips[ ST_5 ].y = 320;
-    mTextureClips[ ST_5 ].w = 24;
-    mTextureClips[ ST_5 ].h = 36;
-
-    mTextureClips[ ST_6 ].x = 584;
-    mTextureClips[ ST_6 ].y = 368;
-    mTextureClips[ ST_6 ].w = 24;
-    mTextureClips[ ST_6 ].h = 36;
-
-    mTextureClips[ ST_7 ].x = 612;
-    mTextureClips[ ST_7 ].y = 368;
-    mTextureClips[ ST_7 ].w = 24;
-    mTextureClips[ ST_7 ].h = 36;
-
-    mTextureClips[ ST_8 ].x = 640;
-    mTextureClips[ ST_8 ].y = 368;
-    mTextureClips[ ST_8 ].w = 24;
-    mTextureClips[ ST_8 ].h = 36;
-
-    mTextureClips[ ST_9 ].x = 668;
-    mTextureClips[ ST_9 ].y = 368;
-    mTextureClips[ ST_9 ].w = 24;
-    mTextureClips[ ST_9 ].h = 36;
+    // Digit sprites are stored in order in the atlas
+    for( int digit = ST_0; digit < ST_TOTAL; ++digit )
+    {
+        mTextureClips[ digit ] = SPRITE_CLIPS[ SPRITE_DIGIT_0 + digit ];
+    }
 }
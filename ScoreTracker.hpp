@@ -16,6 +16,9 @@ class ScoreTracker{
 
 static const int PLAYER_SCORE_OFFSET = BIRD_LENGTH / 2;
 
+// Most digits a score can have
+static const int MAX_SCORE_DIGITS = 10;
+
 public:
     // Initializes internal variables and loads textures for bitmaping
     ScoreTracker( Game* game, const Player* player );
@@ -52,9 +55,6 @@ private:
 
     const Game* mGamePointer;
 
-    // Sprite sheet used for rendering score
-    LTexture mSpriteSheet;
-
 };
 
 #endif // _SCORE_TRACKER_H_INCLUDED
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "ReferenceBot.hpp"
+#include "SeedAnalyzer.hpp"
+#include "constants.hpp"
+
+// Orders seeds from hardest to easiest: earlier bot death, then bigger height changes, then more vertical travel
+static bool SA_isHarder( const SeedDifficulty& a, const SeedDifficulty& b )
+{
+    if( a.botDeathPipe != b.botDeathPipe )
+    {
+        return a.botDeathPipe < b.botDeathPipe;
+    }
+    if( a.maxHeightChange != b.maxHeightChange )
+    {
+        return a.maxHeightChange > b.maxHeightChange;
+    }
+    if( a.verticalTravel != b.verticalTravel )
+    {
+        return a.verticalTravel > b.verticalTravel;
+    }
+
+    return a.seed < b.seed;
+}
+
+SeedAnalyzer::SeedAnalyzer()
+{
+    mNextSeed = 0;
+}
+
+void SeedAnalyzer::analyze( const LevelGenerator& generator, const int firstSeed, const int numSeeds, unsigned numThreads )
+{
+    if( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    // Every seed has its own slot so threads never write to the same place
+    mResults.assign( std::max( numSeeds, 0 ), SeedDifficulty() );
+    mNextSeed = 0;
+
+    std::vector<std::thread> threads;
+    for( unsigned i = 1; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( &SeedAnalyzer::analyzeChunks, this, generator, firstSeed, numSeeds ) );
+    }
+    analyzeChunks( generator, firstSeed, numSeeds );
+
+    for( std::thread& thread : threads )
+    {
+        thread.join();
+    }
+
+    std::sort( mResults.begin(), mResults.end(), SA_isHarder );
+}
+
+void SeedAnalyzer::analyzeChunks( LevelGenerator generator, const int firstSeed, const int numSeeds )
+{
+    ReferenceBot bot;
+
+    int chunkStart;
+    while( ( chunkStart = mNextSeed.fetch_add( CHUNK_SIZE, std::memory_order_relaxed ) ) < numSeeds )
+    {
+        int chunkEnd = std::min( chunkStart + int( CHUNK_SIZE ), numSeeds );
+        for( int i = chunkStart; i < chunkEnd; ++i )
+        {
+            std::vector<Pipe> level = generator.generate( firstSeed + i );
+            mResults[ i ] = measure( firstSeed + i, level, bot.play( level ) );
+        }
+    }
+}
+
+SeedDifficulty SeedAnalyzer::measure( const int seed, const std::vector<Pipe>& level, const int botDeathPipe )
+{
+    SeedDifficulty difficulty;
+    difficulty.seed = seed;
+    difficulty.botDeathPipe = botDeathPipe;
+    difficulty.maxHeightChange = 0;
+    difficulty.verticalTravel = 0;
+
+    // Gap centers are compared since every gap has the same size
+    int lastCenterY = PLAYER_START_Y + PLAYER_HEIGHT / 2;
+    for( size_t i = 0; i < level.size(); ++i )
+    {
+        SDL_Rect topRect = level[ i ].getTopRect();
+        int centerY = topRect.y + topRect.h + PIPE_GAP / 2;
+        int change = std::abs( centerY - lastCenterY );
+
+        if( i > 0 )
+        {
+            difficulty.maxHeightChange = std::max( difficulty.maxHeightChange, change );
+        }
+        difficulty.verticalTravel += change;
+        lastCenterY = centerY;
+    }
+
+    return difficulty;
+}
+
+const std::vector<SeedDifficulty>& SeedAnalyzer::getResults() const
+{
+    return mResults;
+}
+
+bool SeedAnalyzer::writeIndex( const std::string& path ) const
+{
+    FILE* indexFile = fopen( path.c_str(), "wb" );
+    if( indexFile == nullptr )
+    {
+        printf( "Could not open index file %s for writing!\n", path.c_str() );
+        return false;
+    }
+
+    IndexHeader header = { INDEX_MAGIC, INDEX_VERSION, Uint32( mResults.size() ), NUM_OBSTACLES };
+    bool success = fwrite( &header, sizeof( header ), 1, indexFile ) == 1 &&
+                   fwrite( mResults.data(), sizeof( SeedDifficulty ), mResults.size(), indexFile ) == mResults.size();
+    if( !success )
+    {
+        printf( "Could not write index file %s!\n", path.c_str() );
+    }
+
+    if( fclose( indexFile ) != 0 )
+    {
+        success = false;
+    }
+
+    return success;
+}
+
+bool SeedAnalyzer::queryIndex( const std::string& path, const int minDeathPipe, const int maxDeathPipe, const int maxResults,
+                               std::vector<SeedDifficulty>& results )
+{
+    results.clear();
+
+    FILE* indexFile = fopen( path.c_str(), "rb" );
+    if( indexFile == nullptr )
+    {
+        printf( "Could not open index file %s!\n", path.c_str() );
+        return false;
+    }
+
+    IndexHeader header;
+    if( fread( &header, sizeof( header ), 1, indexFile ) != 1 || header.magic != INDEX_MAGIC || header.version != INDEX_VERSION )
+    {
+        printf( "%s is not a seed index file!\n", path.c_str() );
+        fclose( indexFile );
+        return false;
+    }
+
+    // Records are sorted by death pipe so binary search for the first record in range, reading only the probed records
+    bool success = true;
+    SeedDifficulty record;
+    long low = 0, high = header.numRecords;
+    while( low < high && success )
+    {
+        long middle = low + ( high - low ) / 2;
+        success = fseek( indexFile, sizeof( header ) + middle * sizeof( record ), SEEK_SET ) == 0 &&
+                  fread( &record, sizeof( record ), 1, indexFile ) == 1;
+        if( success && record.botDeathPipe < minDeathPipe )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    // Read records until one is out of range
+    if( success && fseek( indexFile, sizeof( header ) + low * sizeof( record ), SEEK_SET ) == 0 )
+    {
+        while( int( results.size() ) < maxResults && fread( &record, sizeof( record ), 1, indexFile ) == 1 &&
+               record.botDeathPipe <= maxDeathPipe )
+        {
+            results.push_back( record );
+        }
+    }
+
+    if( !success )
+    {
+        printf( "Could not read index file %s!\n", path.c_str() );
+    }
+
+    fclose( indexFile );
+
+    return success;
+}
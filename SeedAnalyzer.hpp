@@ -0,0 +1,81 @@
+#ifndef _SEEDANALYZER_HPP_INCLUDED
+#define _SEEDANALYZER_HPP_INCLUDED
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+
+// Difficulty metrics of the level generated from one seed
+struct SeedDifficulty{
+    Sint32 seed;
+    // Index of the pipe at which the reference bot died ( NUM_OBSTACLES if it passed the level )
+    Sint32 botDeathPipe;
+    // Largest height change between two consecutive gaps ( in pixels )
+    Sint32 maxHeightChange;
+    // Total vertical distance from the start position through the centers of all gaps ( in pixels )
+    Sint32 verticalTravel;
+};
+
+// Sweeps ranges of seeds through the level generator on all cores and measures how hard each level is.
+// Threads claim chunks of seeds with an atomic counter and write into their own slots of the result array, so no locks
+// are needed. Results are sorted from hardest to easiest and can be saved to an index file that is queried by bot death pipe
+class SeedAnalyzer{
+
+public:
+
+    // Identifies index files ( "SIDX" ) and their layout
+    static const Uint32 INDEX_MAGIC = 0x58444953;
+    static const Uint32 INDEX_VERSION = 1;
+
+    // Number of seeds a thread claims at once
+    static const int CHUNK_SIZE = 256;
+
+    // Initializes internal variables
+    SeedAnalyzer();
+
+    // Deallocates memory
+    ~SeedAnalyzer() = default;
+
+    // Analyzes numSeeds seeds starting at firstSeed with copies of the generator ( so its difficulty settings are used ).
+    // Uses one thread per core if numThreads is 0
+    void analyze( const LevelGenerator& generator, const int firstSeed, const int numSeeds, unsigned numThreads = 0 );
+
+    // Gets results of the last analysis sorted from hardest to easiest
+    const std::vector<SeedDifficulty>& getResults() const;
+
+    // Writes results of the last analysis to index file. Returns whether file was written
+    bool writeIndex( const std::string& path ) const;
+
+    // Reads from index file up to maxResults seeds at which the bot died between minDeathPipe and maxDeathPipe ( inclusive ),
+    // hardest first. Returns whether index could be read
+    static bool queryIndex( const std::string& path, const int minDeathPipe, const int maxDeathPipe, const int maxResults,
+                            std::vector<SeedDifficulty>& results );
+
+private:
+
+    // Header at the start of the index file, followed by the sorted records
+    struct IndexHeader{
+        Uint32 magic;
+        Uint32 version;
+        Uint32 numRecords;
+        Uint32 numObstacles;
+    };
+
+    // Claims and analyzes chunks of seeds until there are none left
+    void analyzeChunks( LevelGenerator generator, const int firstSeed, const int numSeeds );
+
+    // Measures one level
+    static SeedDifficulty measure( const int seed, const std::vector<Pipe>& level, const int botDeathPipe );
+
+    // Results of the last analysis
+    std::vector<SeedDifficulty> mResults;
+
+    // Index ( relative to the first seed ) of the next chunk to be claimed
+    std::atomic<int> mNextSeed;
+};
+
+#endif // _SEEDANALYZER_HPP_INCLUDED
@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "SeedAnalyzer.hpp"
+
+// Number of seeds printed by a query if no limit is given
+const int DEFAULT_QUERY_LIMIT = 20;
+
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    if( argc >= 5 && strcmp( argv[ 1 ], "--query" ) == 0 )
+    {
+        int limit = argc >= 6 ? atoi( argv[ 5 ] ) : DEFAULT_QUERY_LIMIT;
+
+        std::vector<SeedDifficulty> results;
+        if( !SeedAnalyzer::queryIndex( argv[ 2 ], atoi( argv[ 3 ] ), atoi( argv[ 4 ] ), limit, results ) )
+        {
+            return 1;
+        }
+
+        printf( "seed botDeathPipe maxHeightChange verticalTravel\n" );
+        for( const SeedDifficulty& result : results )
+        {
+            printf( "%d %d %d %d\n", result.seed, result.botDeathPipe, result.maxHeightChange, result.verticalTravel );
+        }
+    }
+    else if( argc >= 4 && argv[ 1 ][ 0 ] != '-' )
+    {
+        int firstSeed = atoi( argv[ 1 ] );
+        int numSeeds = atoi( argv[ 2 ] );
+        unsigned numThreads = argc >= 5 ? atoi( argv[ 4 ] ) : 0;
+
+        Uint32 startTicks = SDL_GetTicks();
+
+        LevelGenerator generator;
+        SeedAnalyzer analyzer;
+        analyzer.analyze( generator, firstSeed, numSeeds, numThreads );
+        if( !analyzer.writeIndex( argv[ 3 ] ) )
+        {
+            return 1;
+        }
+
+        printf( "Analyzed %d seeds in %u ms\n", numSeeds, SDL_GetTicks() - startTicks );
+    }
+    else
+    {
+        printUsage();
+        return 1;
+    }
+
+    return 0;
+}
+
+void printUsage()
+{
+    printf( "Usage:\n" );
+    printf( "  SeedAnalyzer <firstSeed> <numSeeds> <indexFile> [threads]\n" );
+    printf( "  SeedAnalyzer --query <indexFile> <minDeathPipe> <maxDeathPipe> [limit]\n" );
+}
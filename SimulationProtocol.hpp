@@ -0,0 +1,95 @@
+#ifndef _SIMULATIONPROTOCOL_HPP_INCLUDED
+#define _SIMULATIONPROTOCOL_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Binary protocol of the simulation server. Every message is a one byte type followed by the fixed size body of that type.
+// Both ends run on the same machine, so values are in host byte order and bodies are packed without padding.
+//
+// Client to server: SIM_CREATE_SESSION, SIM_INPUT, SIM_CLOSE_SESSION
+// Server to client: SIM_SESSION_CREATED, then every tick in which one of the client's sessions changed a SIM_TICK followed
+// by one SIM_STATE_DELTA per changed session
+
+enum SimMessageType : Uint8{
+    SIM_CREATE_SESSION = 1,
+    SIM_INPUT,
+    SIM_CLOSE_SESSION,
+    SIM_SESSION_CREATED,
+    SIM_TICK,
+    SIM_STATE_DELTA
+};
+
+// Units of the Y positions sent to clients per pixel
+const int SIM_POSITION_SCALE = 16;
+
+// Events of a session in one tick
+enum SimEvent : Uint8{
+    SIM_EVENT_FLAPPED = 1,
+    SIM_EVENT_SCORED = 2,
+    SIM_EVENT_DIED = 4,
+    SIM_EVENT_FINISHED = 8
+};
+
+#pragma pack( push, 1 )
+
+// Starts a session on the level of seed. requestId is sent back to match the answer
+struct SimCreateSession{
+    Uint32 requestId;
+    Sint32 seed;
+};
+
+// Makes the player of a session flap in the next tick
+struct SimInput{
+    Uint32 sessionId;
+};
+
+// Ends a session
+struct SimCloseSession{
+    Uint32 sessionId;
+};
+
+// Answer to SimCreateSession with the starting Y position of the player ( in SIM_POSITION_SCALE units )
+struct SimSessionCreated{
+    Uint32 requestId;
+    Uint32 sessionId;
+    Sint32 startY;
+};
+
+// Starts the deltas of one tick. The X position of every live player is known from the tick number
+struct SimTick{
+    Uint32 tick;
+};
+
+// Change of Y position ( in SIM_POSITION_SCALE units ) and events of a session in the last tick. The server keeps track of
+// the position the client reconstructs, so rounding errors never add up
+struct SimStateDelta{
+    Uint32 sessionId;
+    Sint16 deltaY;
+    Uint8 events;
+};
+
+#pragma pack( pop )
+
+// Gets size of the body of a message type ( -1 for unknown types )
+inline int SIM_getBodySize( const Uint8 type )
+{
+    switch( type )
+    {
+        case SIM_CREATE_SESSION:
+            return sizeof( SimCreateSession );
+        case SIM_INPUT:
+            return sizeof( SimInput );
+        case SIM_CLOSE_SESSION:
+            return sizeof( SimCloseSession );
+        case SIM_SESSION_CREATED:
+            return sizeof( SimSessionCreated );
+        case SIM_TICK:
+            return sizeof( SimTick );
+        case SIM_STATE_DELTA:
+            return sizeof( SimStateDelta );
+        default:
+            return -1;
+    }
+}
+
+#endif // _SIMULATIONPROTOCOL_HPP_INCLUDED
@@ -0,0 +1,609 @@
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <SDL.h>
+
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+#include "SimulationProtocol.hpp"
+#include "SimulationServer.hpp"
+
+// Tags of the epoll events that do not belong to a client
+static const Uint32 SS_LISTEN_TAG = 0xffffffff;
+static const Uint32 SS_TIMER_TAG = 0xfffffffe;
+
+// Most events taken from epoll at once
+static const int SS_MAX_EVENTS = 256;
+
+// Bytes read from a socket at once
+static const int SS_READ_SIZE = 64 * 1024;
+
+// Most bytes buffered for a client. Further bytes stay in the socket until the buffered messages are handled
+static const size_t SS_MAX_INPUT = 4 * SS_READ_SIZE;
+
+// Makes file descriptor non-blocking. Returns whether it succeeded
+static bool SS_setNonBlocking( const int fd )
+{
+    int flags = fcntl( fd, F_GETFL, 0 );
+    return flags >= 0 && fcntl( fd, F_SETFL, flags | O_NONBLOCK ) == 0;
+}
+
+// Converts Y position to protocol units
+static Sint32 SS_toProtocolY( const double posY )
+{
+    return Sint32( std::lround( posY * SIM_POSITION_SCALE ) );
+}
+
+SimulationServer::SimulationServer()
+{
+    mListenFd = -1;
+    mEpollFd = -1;
+    mTimerFd = -1;
+
+    mTickGeneration = 0;
+    mShardsDone = 0;
+    mStopping = false;
+
+    mTick = 0;
+    mTickDuration = DEFAULT_TICK_DURATION;
+
+    mRunning = false;
+}
+
+SimulationServer::~SimulationServer()
+{
+    // Stop workers
+    {
+        std::lock_guard<std::mutex> lock( mPoolMutex );
+        mStopping = true;
+    }
+    mWorkStart.notify_all();
+    for( std::thread& worker : mWorkers )
+    {
+        worker.join();
+    }
+
+    for( size_t i = 0; i < mClients.size(); ++i )
+    {
+        if( mClients[ i ].fd >= 0 )
+        {
+            close( mClients[ i ].fd );
+        }
+    }
+
+    if( mTimerFd >= 0 )
+    {
+        close( mTimerFd );
+    }
+    if( mEpollFd >= 0 )
+    {
+        close( mEpollFd );
+    }
+    if( mListenFd >= 0 )
+    {
+        close( mListenFd );
+        unlink( mSocketPath.c_str() );
+    }
+}
+
+bool SimulationServer::init( const std::string& socketPath, unsigned numThreads, const int tickDuration )
+{
+    mSocketPath = socketPath;
+    mTickDuration = std::max( tickDuration, 0 );
+
+    sockaddr_un address;
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    if( socketPath.size() >= sizeof( address.sun_path ) )
+    {
+        printf( "Socket path %s is too long!\n", socketPath.c_str() );
+        return false;
+    }
+    strcpy( address.sun_path, socketPath.c_str() );
+
+    // Create listening socket, replacing a stale socket file of an earlier run
+    mListenFd = socket( AF_UNIX, SOCK_STREAM, 0 );
+    if( mListenFd < 0 )
+    {
+        printf( "Could not create socket! Error: %s\n", strerror( errno ) );
+        return false;
+    }
+    unlink( socketPath.c_str() );
+    if( bind( mListenFd, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0 || listen( mListenFd, SOMAXCONN ) < 0 ||
+        !SS_setNonBlocking( mListenFd ) )
+    {
+        printf( "Could not listen at %s! Error: %s\n", socketPath.c_str(), strerror( errno ) );
+        return false;
+    }
+
+    mEpollFd = epoll_create1( 0 );
+    if( mEpollFd < 0 )
+    {
+        printf( "Could not create epoll instance! Error: %s\n", strerror( errno ) );
+        return false;
+    }
+
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u32 = SS_LISTEN_TAG;
+    if( epoll_ctl( mEpollFd, EPOLL_CTL_ADD, mListenFd, &event ) < 0 )
+    {
+        printf( "Could not watch listening socket! Error: %s\n", strerror( errno ) );
+        return false;
+    }
+
+    // Ticks come from a timer in the same epoll loop as the sockets
+    if( mTickDuration > 0 )
+    {
+        mTimerFd = timerfd_create( CLOCK_MONOTONIC, TFD_NONBLOCK );
+        itimerspec interval;
+        interval.it_interval.tv_sec = mTickDuration / 1000;
+        interval.it_interval.tv_nsec = ( mTickDuration % 1000 ) * 1000000L;
+        interval.it_value = interval.it_interval;
+
+        event.events = EPOLLIN;
+        event.data.u32 = SS_TIMER_TAG;
+        if( mTimerFd < 0 || timerfd_settime( mTimerFd, 0, &interval, nullptr ) < 0 || epoll_ctl( mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event ) < 0 )
+        {
+            printf( "Could not create tick timer! Error: %s\n", strerror( errno ) );
+            return false;
+        }
+    }
+
+    // Start worker pool
+    if( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+    mShardDeltas.resize( numThreads );
+    for( unsigned shard = 1; shard < numThreads; ++shard )
+    {
+        mWorkers.push_back( std::thread( &SimulationServer::workerLoop, this, shard ) );
+    }
+
+    return true;
+}
+
+void SimulationServer::run()
+{
+    mRunning = true;
+
+    epoll_event events[ SS_MAX_EVENTS ];
+    while( mRunning )
+    {
+        // Without timer ticks run back to back, so only poll sockets in between
+        int numEvents = epoll_wait( mEpollFd, events, SS_MAX_EVENTS, mTimerFd >= 0 ? -1 : 0 );
+        if( numEvents < 0 )
+        {
+            if( errno == EINTR )
+            {
+                continue;
+            }
+            printf( "Could not wait for events! Error: %s\n", strerror( errno ) );
+            break;
+        }
+
+        bool tickDue = mTimerFd < 0;
+        for( int i = 0; i < numEvents; ++i )
+        {
+            Uint32 tag = events[ i ].data.u32;
+            if( tag == SS_LISTEN_TAG )
+            {
+                acceptClients();
+            }
+            else if( tag == SS_TIMER_TAG )
+            {
+                // Run one tick however many expired, so a slow tick does not cause a burst of catching up
+                Uint64 expirations;
+                if( read( mTimerFd, &expirations, sizeof( expirations ) ) == sizeof( expirations ) )
+                {
+                    tickDue = true;
+                }
+            }
+            else if( mClients[ tag ].fd >= 0 )
+            {
+                bool open = true;
+                if( events[ i ].events & ( EPOLLIN | EPOLLHUP | EPOLLERR ) )
+                {
+                    open = readClient( tag );
+                }
+                if( open && ( events[ i ].events & EPOLLOUT ) )
+                {
+                    open = writeClient( tag );
+                }
+                if( !open )
+                {
+                    closeClient( tag );
+                }
+            }
+        }
+
+        if( tickDue )
+        {
+            tick();
+        }
+
+        flushClients();
+    }
+}
+
+void SimulationServer::stop()
+{
+    mRunning = false;
+}
+
+void SimulationServer::acceptClients()
+{
+    int fd;
+    while( ( fd = accept( mListenFd, nullptr, nullptr ) ) >= 0 )
+    {
+        if( !SS_setNonBlocking( fd ) )
+        {
+            close( fd );
+            continue;
+        }
+
+        int client;
+        if( mFreeClients.empty() )
+        {
+            client = mClients.size();
+            mClients.push_back( Client() );
+        }
+        else
+        {
+            client = mFreeClients.back();
+            mFreeClients.pop_back();
+        }
+
+        Client& newClient = mClients[ client ];
+        newClient.fd = fd;
+        newClient.input.clear();
+        newClient.output.clear();
+        newClient.outputOffset = 0;
+        newClient.sessions.clear();
+        newClient.lastTick = mTick - 1;
+
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u32 = client;
+        if( epoll_ctl( mEpollFd, EPOLL_CTL_ADD, fd, &event ) < 0 )
+        {
+            printf( "Could not watch client socket! Error: %s\n", strerror( errno ) );
+            closeClient( client );
+        }
+    }
+}
+
+bool SimulationServer::readClient( const int client )
+{
+    Client& reader = mClients[ client ];
+
+    // Read until nothing is available or the buffer is full, then handle all whole messages at once. The socket is level
+    // triggered, so whatever is left unread wakes the next poll
+    while( reader.input.size() < SS_MAX_INPUT )
+    {
+        size_t oldSize = reader.input.size();
+        size_t readSize = std::min( size_t( SS_READ_SIZE ), SS_MAX_INPUT - oldSize );
+        reader.input.resize( oldSize + readSize );
+        ssize_t received = recv( reader.fd, reader.input.data() + oldSize, readSize, 0 );
+        reader.input.resize( oldSize + std::max( received, ssize_t( 0 ) ) );
+
+        if( received == 0 )
+        {
+            return false;
+        }
+        if( received < 0 )
+        {
+            if( errno == EAGAIN || errno == EWOULDBLOCK )
+            {
+                break;
+            }
+            if( errno != EINTR )
+            {
+                return false;
+            }
+        }
+    }
+
+    size_t offset = 0;
+    while( offset < reader.input.size() )
+    {
+        Uint8 type = reader.input[ offset ];
+        int bodySize = SIM_getBodySize( type );
+        if( bodySize < 0 )
+        {
+            printf( "Client sent unknown message type %d!\n", type );
+            return false;
+        }
+        if( offset + 1 + bodySize > reader.input.size() )
+        {
+            break;
+        }
+        if( !handleMessage( client, type, mClients[ client ].input.data() + offset + 1 ) )
+        {
+            return false;
+        }
+        offset += 1 + bodySize;
+    }
+
+    // Keep the start of an incomplete message for the next read. A full buffer without a whole message can never complete
+    Client& handled = mClients[ client ];
+    if( offset == 0 && handled.input.size() >= SS_MAX_INPUT )
+    {
+        printf( "Client overflowed its input buffer!\n" );
+        return false;
+    }
+    handled.input.erase( handled.input.begin(), handled.input.begin() + offset );
+
+    return true;
+}
+
+bool SimulationServer::handleMessage( const int client, const Uint8 type, const Uint8* body )
+{
+    switch( type )
+    {
+        case SIM_CREATE_SESSION:
+        {
+            SimCreateSession request;
+            memcpy( &request, body, sizeof( request ) );
+
+            Uint32 sessionId;
+            if( mFreeSessions.empty() )
+            {
+                sessionId = mSessions.size();
+                mSessions.push_back( Session() );
+            }
+            else
+            {
+                sessionId = mFreeSessions.back();
+                mFreeSessions.pop_back();
+            }
+
+            Session& session = mSessions[ sessionId ];
+            session.game.reset( mGenerator, request.seed );
+            session.client = client;
+            session.flap = false;
+            session.sentY = SS_toProtocolY( session.game.getPosY() );
+            mClients[ client ].sessions.push_back( sessionId );
+
+            SimSessionCreated answer = { request.requestId, sessionId, session.sentY };
+            queueMessage( client, SIM_SESSION_CREATED, &answer, sizeof( answer ) );
+            return true;
+        }
+        case SIM_INPUT:
+        {
+            SimInput input;
+            memcpy( &input, body, sizeof( input ) );
+            if( input.sessionId >= mSessions.size() || mSessions[ input.sessionId ].client != client )
+            {
+                printf( "Client sent input for session %u it does not own!\n", input.sessionId );
+                return false;
+            }
+
+            mSessions[ input.sessionId ].flap = true;
+            return true;
+        }
+        case SIM_CLOSE_SESSION:
+        {
+            SimCloseSession request;
+            memcpy( &request, body, sizeof( request ) );
+            if( request.sessionId >= mSessions.size() || mSessions[ request.sessionId ].client != client )
+            {
+                printf( "Client closed session %u it does not own!\n", request.sessionId );
+                return false;
+            }
+
+            std::vector<Uint32>& sessions = mClients[ client ].sessions;
+            sessions.erase( std::find( sessions.begin(), sessions.end(), request.sessionId ) );
+            mSessions[ request.sessionId ].client = -1;
+            mFreeSessions.push_back( request.sessionId );
+            return true;
+        }
+        default:
+            printf( "Client sent server message type %d!\n", type );
+            return false;
+    }
+}
+
+bool SimulationServer::writeClient( const int client )
+{
+    Client& writer = mClients[ client ];
+    while( writer.outputOffset < writer.output.size() )
+    {
+        ssize_t sent = send( writer.fd, writer.output.data() + writer.outputOffset, writer.output.size() - writer.outputOffset, MSG_NOSIGNAL );
+        if( sent < 0 )
+        {
+            if( errno == EAGAIN || errno == EWOULDBLOCK )
+            {
+                break;
+            }
+            if( errno != EINTR )
+            {
+                return false;
+            }
+        }
+        else
+        {
+            writer.outputOffset += sent;
+        }
+    }
+
+    // Wait for the socket to take more only while there is something left
+    bool drained = writer.outputOffset == writer.output.size();
+    if( drained )
+    {
+        writer.output.clear();
+        writer.outputOffset = 0;
+    }
+    else if( writer.output.size() - writer.outputOffset > size_t( MAX_OUTPUT_BUFFER ) )
+    {
+        printf( "Client does not read its output!\n" );
+        return false;
+    }
+
+    epoll_event event;
+    event.events = drained ? EPOLLIN : EPOLLIN | EPOLLOUT;
+    event.data.u32 = client;
+    return epoll_ctl( mEpollFd, EPOLL_CTL_MOD, writer.fd, &event ) == 0;
+}
+
+void SimulationServer::queueMessage( const int client, const Uint8 type, const void* body, const int size )
+{
+    std::vector<Uint8>& output = mClients[ client ].output;
+    if( output.empty() )
+    {
+        mDirtyClients.push_back( client );
+    }
+
+    output.push_back( type );
+    output.insert( output.end(), static_cast<const Uint8*>( body ), static_cast<const Uint8*>( body ) + size );
+}
+
+void SimulationServer::closeClient( const int client )
+{
+    Client& closed = mClients[ client ];
+
+    for( Uint32 sessionId : closed.sessions )
+    {
+        mSessions[ sessionId ].client = -1;
+        mFreeSessions.push_back( sessionId );
+    }
+    closed.sessions.clear();
+
+    epoll_ctl( mEpollFd, EPOLL_CTL_DEL, closed.fd, nullptr );
+    close( closed.fd );
+    closed.fd = -1;
+    closed.output.clear();
+    closed.outputOffset = 0;
+    mFreeClients.push_back( client );
+}
+
+void SimulationServer::tick()
+{
+    ++mTick;
+
+    // Let the workers step their shards while this thread steps shard 0
+    {
+        std::lock_guard<std::mutex> lock( mPoolMutex );
+        mShardsDone = 0;
+        ++mTickGeneration;
+    }
+    mWorkStart.notify_all();
+
+    stepShard( 0 );
+
+    {
+        std::unique_lock<std::mutex> lock( mPoolMutex );
+        mWorkDone.wait( lock, [ this ]{ return mShardsDone == mWorkers.size(); } );
+    }
+
+    // Queue deltas per client, each tick's deltas after its SIM_TICK, to be sent by the next flush
+    SimTick tickMessage = { mTick };
+    for( std::vector<std::pair<int, SimStateDelta> >& deltas : mShardDeltas )
+    {
+        for( const std::pair<int, SimStateDelta>& delta : deltas )
+        {
+            Client& receiver = mClients[ delta.first ];
+            if( receiver.lastTick != mTick )
+            {
+                receiver.lastTick = mTick;
+                queueMessage( delta.first, SIM_TICK, &tickMessage, sizeof( tickMessage ) );
+            }
+            queueMessage( delta.first, SIM_STATE_DELTA, &delta.second, sizeof( delta.second ) );
+        }
+        deltas.clear();
+    }
+}
+
+void SimulationServer::flushClients()
+{
+    // Send everything queued since the last flush with one write per client
+    for( int client : mDirtyClients )
+    {
+        if( mClients[ client ].fd >= 0 && !writeClient( client ) )
+        {
+            closeClient( client );
+        }
+    }
+    mDirtyClients.clear();
+}
+
+void SimulationServer::stepShard( const unsigned shard )
+{
+    const double duration = ( mTickDuration > 0 ? mTickDuration : DEFAULT_TICK_DURATION ) / 1000.0;
+
+    std::vector<std::pair<int, SimStateDelta> >& deltas = mShardDeltas[ shard ];
+    for( size_t i = shard; i < mSessions.size(); i += mShardDeltas.size() )
+    {
+        Session& session = mSessions[ i ];
+        if( session.client < 0 || !session.game.isAlive() || session.game.isFinished() )
+        {
+            continue;
+        }
+
+        SimStateDelta delta;
+        delta.sessionId = i;
+        delta.events = session.flap ? SIM_EVENT_FLAPPED : 0;
+
+        int lastScore = session.game.getScore();
+        if( !session.game.step( mGenerator, session.flap, duration ) )
+        {
+            delta.events |= SIM_EVENT_DIED;
+        }
+        if( session.game.getScore() != lastScore )
+        {
+            delta.events |= SIM_EVENT_SCORED;
+        }
+        if( session.game.isFinished() )
+        {
+            delta.events |= SIM_EVENT_FINISHED;
+        }
+        session.flap = false;
+
+        // Send the difference to what the client has, so rounding errors are corrected in the next delta
+        Sint32 change = SS_toProtocolY( session.game.getPosY() ) - session.sentY;
+        delta.deltaY = Sint16( std::max( -32768, std::min( change, 32767 ) ) );
+        session.sentY += delta.deltaY;
+
+        deltas.push_back( std::make_pair( session.client, delta ) );
+    }
+}
+
+void SimulationServer::workerLoop( const unsigned shard )
+{
+    Uint32 lastGeneration = 0;
+    while( true )
+    {
+        {
+            std::unique_lock<std::mutex> lock( mPoolMutex );
+            mWorkStart.wait( lock, [ & ]{ return mStopping || mTickGeneration != lastGeneration; } );
+            if( mStopping )
+            {
+                return;
+            }
+            lastGeneration = mTickGeneration;
+        }
+
+        stepShard( shard );
+
+        {
+            std::lock_guard<std::mutex> lock( mPoolMutex );
+            ++mShardsDone;
+        }
+        mWorkDone.notify_one();
+    }
+}
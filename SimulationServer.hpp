@@ -0,0 +1,141 @@
+#ifndef _SIMULATIONSERVER_HPP_INCLUDED
+#define _SIMULATIONSERVER_HPP_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+
+#include "HeadlessGame.hpp"
+#include "LevelGenerator.hpp"
+#include "SimulationProtocol.hpp"
+
+// Headless server hosting many independent game sessions for clients connected over a Unix domain socket ( Linux only ).
+// One thread runs an epoll loop for all sockets and the tick timer. Every tick the sessions are split into shards that a
+// fixed pool of worker threads steps in parallel; each shard collects its state deltas in its own buffer, so workers share
+// nothing. Input is applied and output is sent between ticks, batched per client
+class SimulationServer{
+
+public:
+
+    // Default time between ticks ( in milliseconds ), 0 runs ticks back to back
+    static const int DEFAULT_TICK_DURATION = 16;
+
+    // Most bytes queued for a client that does not read before it is disconnected
+    static const int MAX_OUTPUT_BUFFER = 16 * 1024 * 1024;
+
+    // Initializes internal variables
+    SimulationServer();
+
+    // Stops workers and closes sockets
+    ~SimulationServer();
+
+    // Starts listening at socketPath with numThreads threads stepping sessions ( one per core if 0 ). Returns whether
+    // server could be started
+    bool init( const std::string& socketPath, unsigned numThreads = 0, const int tickDuration = DEFAULT_TICK_DURATION );
+
+    // Serves clients until stop is called
+    void run();
+
+    // Makes run return ( safe to call from signal handlers )
+    void stop();
+
+private:
+
+    // Game session owned by a client
+    struct Session{
+        HeadlessGame game;
+        // Index of the owning client ( -1 if session slot is free )
+        int client;
+        // Whether the player flaps in the next tick
+        bool flap;
+        // Y position the client has reconstructed from the deltas ( in SIM_POSITION_SCALE units )
+        Sint32 sentY;
+    };
+
+    // Connected client
+    struct Client{
+        int fd;
+        // Received bytes that do not form a whole message yet
+        std::vector<Uint8> input;
+        // Bytes waiting to be sent, starting at outputOffset
+        std::vector<Uint8> output;
+        size_t outputOffset;
+        // Sessions owned by the client
+        std::vector<Uint32> sessions;
+        // Last tick whose SIM_TICK was queued for the client
+        Uint32 lastTick;
+    };
+
+    // Accepts all pending connections
+    void acceptClients();
+
+    // Reads and handles everything the client sent. Returns false if client has to be disconnected
+    bool readClient( const int client );
+
+    // Handles one message. Returns false if message is invalid
+    bool handleMessage( const int client, const Uint8 type, const Uint8* body );
+
+    // Sends as much of the queued output as the socket takes. Returns false if client has to be disconnected
+    bool writeClient( const int client );
+
+    // Appends message to the output of client
+    void queueMessage( const int client, const Uint8 type, const void* body, const int size );
+
+    // Disconnects client and ends its sessions
+    void closeClient( const int client );
+
+    // Steps every session and queues the deltas
+    void tick();
+
+    // Sends output queued for clients since the last flush
+    void flushClients();
+
+    // Steps sessions of one shard and collects their deltas
+    void stepShard( const unsigned shard );
+
+    // Loop of a worker thread stepping one shard each tick
+    void workerLoop( const unsigned shard );
+
+    // Sockets and timer
+    int mListenFd, mEpollFd, mTimerFd;
+    std::string mSocketPath;
+
+    // Shared by all sessions, only read while stepping
+    LevelGenerator mGenerator;
+
+    // Session slots ( session id is the index ) and free slots
+    std::vector<Session> mSessions;
+    std::vector<Uint32> mFreeSessions;
+
+    // Client slots and free slots
+    std::vector<Client> mClients;
+    std::vector<int> mFreeClients;
+
+    // Clients with output queued since the last flush
+    std::vector<int> mDirtyClients;
+
+    // Deltas ( with the index of the client they go to ) collected by each shard in the current tick
+    std::vector<std::vector<std::pair<int, SimStateDelta> > > mShardDeltas;
+
+    // Worker pool. The epoll thread steps shard 0 itself
+    std::vector<std::thread> mWorkers;
+    std::mutex mPoolMutex;
+    std::condition_variable mWorkStart, mWorkDone;
+    Uint32 mTickGeneration;
+    unsigned mShardsDone;
+    bool mStopping;
+
+    // Current tick and its duration
+    Uint32 mTick;
+    int mTickDuration;
+
+    std::atomic<bool> mRunning;
+};
+
+#endif // _SIMULATIONSERVER_HPP_INCLUDED
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <SDL.h>
+
+#include "Physics.hpp"
+#include "SimulationProtocol.hpp"
+#include "SimulationServer.hpp"
+
+// Server stopped by SIGINT and SIGTERM
+SimulationServer* gServer = nullptr;
+
+void handleSignal( int );
+int runBenchmark( const std::string& socketPath, const int numSessions, const int numTicks );
+void printUsage();
+
+int main( int argc, char** argv )
+{
+    if( argc >= 5 && strcmp( argv[ 1 ], "--bench" ) == 0 )
+    {
+        return runBenchmark( argv[ 2 ], atoi( argv[ 3 ] ), atoi( argv[ 4 ] ) );
+    }
+    else if( argc >= 2 && argv[ 1 ][ 0 ] != '-' )
+    {
+        unsigned numThreads = argc >= 3 ? atoi( argv[ 2 ] ) : 0;
+        int tickDuration = argc >= 4 ? atoi( argv[ 3 ] ) : SimulationServer::DEFAULT_TICK_DURATION;
+
+        SimulationServer server;
+        if( !server.init( argv[ 1 ], numThreads, tickDuration ) )
+        {
+            return 1;
+        }
+
+        gServer = &server;
+        signal( SIGINT, handleSignal );
+        signal( SIGTERM, handleSignal );
+
+        printf( "Serving at %s\n", argv[ 1 ] );
+        server.run();
+
+        gServer = nullptr;
+    }
+    else
+    {
+        printUsage();
+        return 1;
+    }
+
+    return 0;
+}
+
+void handleSignal( int )
+{
+    if( gServer != nullptr )
+    {
+        gServer->stop();
+    }
+}
+
+// Writes all bytes to socket. Returns whether it succeeded
+bool sendAll( const int fd, const std::vector<Uint8>& data )
+{
+    size_t offset = 0;
+    while( offset < data.size() )
+    {
+        ssize_t sent = send( fd, data.data() + offset, data.size() - offset, MSG_NOSIGNAL );
+        if( sent <= 0 )
+        {
+            return false;
+        }
+        offset += sent;
+    }
+
+    return true;
+}
+
+// Appends message to buffer
+void appendMessage( std::vector<Uint8>& buffer, const Uint8 type, const void* body, const int size )
+{
+    buffer.push_back( type );
+    buffer.insert( buffer.end(), static_cast<const Uint8*>( body ), static_cast<const Uint8*>( body ) + size );
+}
+
+// Connects to a running server, plays numSessions sessions for numTicks ticks with a simple policy and checks the stream
+int runBenchmark( const std::string& socketPath, const int numSessions, const int numTicks )
+{
+    int fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+    sockaddr_un address;
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    strncpy( address.sun_path, socketPath.c_str(), sizeof( address.sun_path ) - 1 );
+    if( fd < 0 || connect( fd, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0 )
+    {
+        printf( "Could not connect to %s! Error: %s\n", socketPath.c_str(), strerror( errno ) );
+        return 1;
+    }
+
+    // Create all sessions in one write
+    std::vector<Uint8> output;
+    for( int i = 0; i < numSessions; ++i )
+    {
+        SimCreateSession request = { Uint32( i ), i };
+        appendMessage( output, SIM_CREATE_SESSION, &request, sizeof( request ) );
+    }
+    if( !sendAll( fd, output ) )
+    {
+        printf( "Could not send to server!\n" );
+        close( fd );
+        return 1;
+    }
+
+    // Y position of each session as rebuilt from the deltas ( indexed by session id )
+    std::vector<Sint32> posY;
+    int numCreated = 0, numDeaths = 0, numScores = 0;
+    long numDeltas = 0;
+    Uint32 firstTick = 0, lastTick = 0;
+
+    // Flap whenever the player falls below the middle of the screen
+    const Sint32 flapY = ( SCREEN_HEIGHT / 2 ) * SIM_POSITION_SCALE;
+
+    Uint32 startTicks = SDL_GetTicks();
+    std::vector<Uint8> input;
+    std::vector<Uint8> buffer( 64 * 1024 );
+    while( numCreated < numSessions || ( lastTick - firstTick < Uint32( numTicks ) && numDeaths < numSessions ) )
+    {
+        ssize_t received = recv( fd, buffer.data(), buffer.size(), 0 );
+        if( received <= 0 )
+        {
+            printf( "Server closed connection!\n" );
+            close( fd );
+            return 1;
+        }
+        input.insert( input.end(), buffer.begin(), buffer.begin() + received );
+
+        // Handle whole messages and answer with inputs in one write
+        output.clear();
+        size_t offset = 0;
+        while( offset < input.size() )
+        {
+            int bodySize = SIM_getBodySize( input[ offset ] );
+            if( bodySize < 0 || offset + 1 + bodySize > input.size() )
+            {
+                break;
+            }
+
+            const Uint8* body = input.data() + offset + 1;
+            if( input[ offset ] == SIM_SESSION_CREATED )
+            {
+                SimSessionCreated created;
+                memcpy( &created, body, sizeof( created ) );
+                if( created.sessionId >= posY.size() )
+                {
+                    posY.resize( created.sessionId + 1 );
+                }
+                posY[ created.sessionId ] = created.startY;
+                ++numCreated;
+            }
+            else if( input[ offset ] == SIM_TICK )
+            {
+                SimTick tick;
+                memcpy( &tick, body, sizeof( tick ) );
+                if( firstTick == 0 )
+                {
+                    firstTick = tick.tick;
+                }
+                lastTick = tick.tick;
+            }
+            else if( input[ offset ] == SIM_STATE_DELTA )
+            {
+                SimStateDelta delta;
+                memcpy( &delta, body, sizeof( delta ) );
+                posY[ delta.sessionId ] += delta.deltaY;
+                ++numDeltas;
+
+                if( delta.events & SIM_EVENT_SCORED )
+                {
+                    ++numScores;
+                }
+                if( delta.events & ( SIM_EVENT_DIED | SIM_EVENT_FINISHED ) )
+                {
+                    ++numDeaths;
+                }
+                else if( posY[ delta.sessionId ] > flapY )
+                {
+                    SimInput flap = { delta.sessionId };
+                    appendMessage( output, SIM_INPUT, &flap, sizeof( flap ) );
+                }
+            }
+            offset += 1 + bodySize;
+        }
+        input.erase( input.begin(), input.begin() + offset );
+
+        if( !output.empty() && !sendAll( fd, output ) )
+        {
+            printf( "Could not send to server!\n" );
+            close( fd );
+            return 1;
+        }
+    }
+
+    Uint32 elapsed = std::max( SDL_GetTicks() - startTicks, Uint32( 1 ) );
+    printf( "%d sessions, %u ticks, %ld deltas in %u ms ( %.0f deltas/s ), %d scores, %d deaths\n", numSessions, lastTick - firstTick,
+            numDeltas, elapsed, numDeltas * 1000.0 / elapsed, numScores, numDeaths );
+
+    close( fd );
+    return 0;
+}
+
+void printUsage()
+{
+    printf( "Usage:\n" );
+    printf( "  SimulationServer <socketPath> [threads] [tickMilliseconds]\n" );
+    printf( "  SimulationServer --bench <socketPath> <sessions> <ticks>\n" );
+}
@@ -0,0 +1,54 @@
+#ifndef _SPRITEATLAS_HPP_INCLUDED
+#define _SPRITEATLAS_HPP_INCLUDED
+
+// Generated by AtlasPacker from assets/sprite_sheet.png, do not edit
+
+#include <SDL.h>
+
+// Texture holding every sprite of the game
+const char* const SPRITE_ATLAS_PATH = "assets/sprite_atlas.png";
+const int SPRITE_ATLAS_WIDTH = 511;
+const int SPRITE_ATLAS_HEIGHT = 512;
+
+// Sprites of the atlas
+enum SpriteId{
+    SPRITE_BACKGROUND,
+    SPRITE_PIPE_TOP,
+    SPRITE_PIPE_BOTTOM,
+    SPRITE_BIRD_NEUTRAL,
+    SPRITE_BIRD_UP,
+    SPRITE_BIRD_DOWN,
+    SPRITE_DIGIT_0,
+    SPRITE_DIGIT_1,
+    SPRITE_DIGIT_2,
+    SPRITE_DIGIT_3,
+    SPRITE_DIGIT_4,
+    SPRITE_DIGIT_5,
+    SPRITE_DIGIT_6,
+    SPRITE_DIGIT_7,
+    SPRITE_DIGIT_8,
+    SPRITE_DIGIT_9,
+    SPRITE_TOTAL
+};
+
+// Clip rectangles of the sprites in the atlas ( indexed by SpriteId )
+constexpr SDL_Rect SPRITE_CLIPS[ SPRITE_TOTAL ] = {
+    { 0, 0, 288, 512 }, // SPRITE_BACKGROUND
+    { 289, 0, 52, 320 }, // SPRITE_PIPE_TOP
+    { 342, 0, 52, 320 }, // SPRITE_PIPE_BOTTOM
+    { 420, 74, 34, 24 }, // SPRITE_BIRD_NEUTRAL
+    { 455, 74, 34, 24 }, // SPRITE_BIRD_UP
+    { 420, 99, 34, 24 }, // SPRITE_BIRD_DOWN
+    { 395, 0, 24, 36 }, // SPRITE_DIGIT_0
+    { 495, 0, 16, 36 }, // SPRITE_DIGIT_1
+    { 420, 0, 24, 36 }, // SPRITE_DIGIT_2
+    { 445, 0, 24, 36 }, // SPRITE_DIGIT_3
+    { 470, 0, 24, 36 }, // SPRITE_DIGIT_4
+    { 395, 37, 24, 36 }, // SPRITE_DIGIT_5
+    { 420, 37, 24, 36 }, // SPRITE_DIGIT_6
+    { 445, 37, 24, 36 }, // SPRITE_DIGIT_7
+    { 470, 37, 24, 36 }, // SPRITE_DIGIT_8
+    { 395, 74, 24, 36 }, // SPRITE_DIGIT_9
+};
+
+#endif // _SPRITEATLAS_HPP_INCLUDED
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <cstdio>
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include "Startup.hpp"
+
+// Static initialization runs right before main, close enough to process start for the trace
+static const std::chrono::steady_clock::time_point STARTUP_PROCESS_START = std::chrono::steady_clock::now();
+
+static bool gTraceEnabled = false;
+
+// Thread opening the audio device and whether the device is open ( -1 until known )
+static SDL_Thread* gAudioThread = nullptr;
+static int gAudioOpened = -1;
+
+// Opens audio device. Returns 1 if it was opened
+static int STARTUP_openAudio( void* )
+{
+    if( Mix_OpenAudio( 44100, MIX_DEFAULT_FORMAT, 2, 2048 ) < 0 )
+    {
+        printf( "SDL Mixer could not initialize! Mix_Error: %s\n", Mix_GetError() );
+        return 0;
+    }
+
+    STARTUP_trace( "audio device opened" );
+
+    return 1;
+}
+
+void STARTUP_enableTrace()
+{
+    gTraceEnabled = true;
+}
+
+void STARTUP_trace( const char* event )
+{
+    if( gTraceEnabled )
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - STARTUP_PROCESS_START;
+        printf( "[startup] %9.2f ms  %s\n", elapsed.count(), event );
+        fflush( stdout );
+    }
+}
+
+void STARTUP_openAudioAsync()
+{
+    if( gAudioThread == nullptr && gAudioOpened < 0 )
+    {
+        gAudioThread = SDL_CreateThread( STARTUP_openAudio, "AudioOpen", nullptr );
+
+        // Open on this thread if no thread could be started
+        if( gAudioThread == nullptr )
+        {
+            gAudioOpened = STARTUP_openAudio( nullptr );
+        }
+    }
+}
+
+bool STARTUP_waitForAudio()
+{
+    if( gAudioThread != nullptr )
+    {
+        SDL_WaitThread( gAudioThread, &gAudioOpened );
+        gAudioThread = nullptr;
+    }
+    else if( gAudioOpened < 0 )
+    {
+        gAudioOpened = STARTUP_openAudio( nullptr );
+    }
+
+    return gAudioOpened == 1;
+}
+
+void STARTUP_closeAudio()
+{
+    // Only wait for a pending open, never start one
+    if( gAudioThread != nullptr )
+    {
+        SDL_WaitThread( gAudioThread, &gAudioOpened );
+        gAudioThread = nullptr;
+    }
+
+    if( gAudioOpened == 1 )
+    {
+        Mix_CloseAudio();
+    }
+    gAudioOpened = -1;
+}
@@ -0,0 +1,23 @@
+#ifndef _STARTUP_HPP_INCLUDED
+#define _STARTUP_HPP_INCLUDED
+
+#include <SDL.h>
+
+// Turns on printing of the startup trace ( --startup-trace )
+void STARTUP_enableTrace();
+
+// Prints event with the time since process start if tracing is on
+void STARTUP_trace( const char* event );
+
+// Starts opening the audio device on a background thread so it overlaps window creation and loading. The audio subsystem
+// has to be initialized already
+void STARTUP_openAudioAsync();
+
+// Waits until the audio device is open ( opens it now if STARTUP_openAudioAsync was not called ). Returns whether it was
+// opened
+bool STARTUP_waitForAudio();
+
+// Closes audio device if it was opened
+void STARTUP_closeAudio();
+
+#endif // _STARTUP_HPP_INCLUDED
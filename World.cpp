@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+#include "World.hpp"
+
+static const float WD_DEGREES_TO_RADIANS = float( M_PI / 180.0 );
+
+// Sprites the render batch has room for before its arrays grow
+static const int WD_INITIAL_BATCH_SPRITES = 64;
+
+World::World()
+{
+    mTopPipeClip = { 0, 0, 0, 0 };
+    mBotPipeClip = { 0, 0, 0, 0 };
+
+    mVertices.resize( WD_INITIAL_BATCH_SPRITES * 4 );
+    mIndices.resize( WD_INITIAL_BATCH_SPRITES * 6 );
+}
+
+void World::clear()
+{
+    mMasks.clear();
+    mTransforms.clear();
+    mSprites.clear();
+    mColliders.clear();
+    mScores.clear();
+    mMotions.clear();
+    mFreeEntities.clear();
+}
+
+void World::swap( World& other )
+{
+    mMasks.swap( other.mMasks );
+    mTransforms.swap( other.mTransforms );
+    mSprites.swap( other.mSprites );
+    mColliders.swap( other.mColliders );
+    mScores.swap( other.mScores );
+    mMotions.swap( other.mMotions );
+    mFreeEntities.swap( other.mFreeEntities );
+    std::swap( mTopPipeClip, other.mTopPipeClip );
+    std::swap( mBotPipeClip, other.mBotPipeClip );
+}
+
+Entity World::create()
+{
+    if( !mFreeEntities.empty() )
+    {
+        Entity entity = mFreeEntities.back();
+        mFreeEntities.pop_back();
+        return entity;
+    }
+
+    // Every array grows with the entities, so a component is always at the index of its entity
+    mMasks.push_back( 0 );
+    mTransforms.emplace_back();
+    mSprites.emplace_back();
+    mColliders.emplace_back();
+    mScores.emplace_back();
+    mMotions.emplace_back();
+
+    return mMasks.size() - 1;
+}
+
+void World::destroy( const Entity entity )
+{
+    mMasks[ entity ] = 0;
+    mFreeEntities.push_back( entity );
+}
+
+void World::addTransform( const Entity entity, const TransformComponent& transform )
+{
+    mTransforms[ entity ] = transform;
+    mMasks[ entity ] |= COMPONENT_TRANSFORM;
+}
+
+void World::addSprite( const Entity entity, const SpriteComponent& sprite )
+{
+    mSprites[ entity ] = sprite;
+    mMasks[ entity ] |= COMPONENT_SPRITE;
+}
+
+void World::addCollider( const Entity entity, const ColliderComponent& collider )
+{
+    mColliders[ entity ] = collider;
+    mMasks[ entity ] |= COMPONENT_COLLIDER;
+}
+
+void World::addScore( const Entity entity, const ScoreComponent& score )
+{
+    mScores[ entity ] = score;
+    mMasks[ entity ] |= COMPONENT_SCORE;
+}
+
+void World::addMotion( const Entity entity, const MotionComponent& motion )
+{
+    mMotions[ entity ] = motion;
+    mMasks[ entity ] |= COMPONENT_MOTION;
+}
+
+bool World::has( const Entity entity, const Uint32 mask ) const
+{
+    return ( mMasks[ entity ] & mask ) == mask;
+}
+
+TransformComponent& World::getTransform( const Entity entity )
+{
+    return mTransforms[ entity ];
+}
+
+const TransformComponent& World::getTransform( const Entity entity ) const
+{
+    return mTransforms[ entity ];
+}
+
+const ColliderComponent& World::getCollider( const Entity entity ) const
+{
+    return mColliders[ entity ];
+}
+
+Entity World::addPipes( const std::vector<Pipe>& pipes, const SDL_Rect& topClip, const SDL_Rect& botClip )
+{
+    const SDL_Color white = { 0xff, 0xff, 0xff, 0xff };
+
+    mTopPipeClip = topClip;
+    mBotPipeClip = botClip;
+
+    // Pipe entities are appended so they stay contiguous, freed entities are kept for later
+    std::vector<Entity> freeEntities;
+    freeEntities.swap( mFreeEntities );
+    Entity first = mMasks.size();
+
+    for( std::vector<Pipe>::const_iterator iter = pipes.begin(); iter != pipes.end(); ++iter )
+    {
+        Entity top = create();
+        addSprite( top, { topClip, white } );
+        addScore( top, { 1, false } );
+        placePipeRect( top, iter->getTopRect(), true );
+
+        Entity bot = create();
+        addSprite( bot, { botClip, white } );
+        placePipeRect( bot, iter->getBotRect(), false );
+
+        if( iter->isMoving() )
+        {
+            addMotion( top, { iter->getMotion(), iter->getTopRect().y + iter->getBaseTopHeight(), true } );
+            addMotion( bot, { iter->getMotion(), iter->getBaseBotY(), false } );
+        }
+    }
+
+    mFreeEntities.swap( freeEntities );
+
+    return first;
+}
+
+void World::updateMotion( const Uint32 time, const Entity first, const Entity last )
+{
+    const Uint32 mask = COMPONENT_MOTION | COMPONENT_COLLIDER;
+
+    const int end = getRangeEnd( last );
+    for( int i = std::max( first, 0 ); i < end; ++i )
+    {
+        if( ( mMasks[ i ] & mask ) != mask )
+        {
+            continue;
+        }
+
+        const MotionComponent& motion = mMotions[ i ];
+        int topShift, botShift;
+        Pipe::getGapShift( motion.gap, time, &topShift, &botShift );
+
+        // Top rects grow down to the gap, bottom rects reach from the gap to the bottom of the screen
+        SDL_Rect rect = mColliders[ i ].rect;
+        if( motion.top )
+        {
+            rect.h = motion.baseEdge + topShift - rect.y;
+        }
+        else
+        {
+            rect.y = motion.baseEdge + botShift;
+            rect.h = SCREEN_HEIGHT - rect.y;
+        }
+
+        placePipeRect( i, rect, motion.top );
+    }
+}
+
+int World::updateScores( const double posX, const Entity first, const Entity last )
+{
+    const Uint32 mask = COMPONENT_SCORE | COMPONENT_TRANSFORM;
+
+    int points = 0;
+    const int end = getRangeEnd( last );
+    for( int i = std::max( first, 0 ); i < end; ++i )
+    {
+        ScoreComponent& score = mScores[ i ];
+        if( ( mMasks[ i ] & mask ) == mask && !score.scored && mTransforms[ i ].x < posX )
+        {
+            score.scored = true;
+            points += score.points;
+        }
+    }
+
+    return points;
+}
+
+void World::resetScores( const double posX )
+{
+    const Uint32 mask = COMPONENT_SCORE | COMPONENT_TRANSFORM;
+
+    for( int i = 0; i < int( mMasks.size() ); ++i )
+    {
+        if( ( mMasks[ i ] & mask ) == mask )
+        {
+            mScores[ i ].scored = mTransforms[ i ].x < posX;
+        }
+    }
+}
+
+void World::placePipeRect( const Entity entity, const SDL_Rect& rect, const bool top )
+{
+    addTransform( entity, { float( rect.x ), float( rect.y ), float( rect.w ), float( rect.h ), 0.f } );
+    addCollider( entity, { rect } );
+
+    if( !( mMasks[ entity ] & COMPONENT_SPRITE ) )
+    {
+        return;
+    }
+
+    // Short pipes show the end of the top sprite and the start of the bottom sprite
+    SDL_Rect& clip = mSprites[ entity ].clip;
+    clip = top ? mTopPipeClip : mBotPipeClip;
+    if( rect.h < clip.h )
+    {
+        if( top )
+        {
+            clip.y += clip.h - rect.h;
+        }
+        clip.h = rect.h;
+    }
+}
+
+void World::render( SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& camera, const Entity first, const Entity last )
+{
+    if( texture == nullptr )
+    {
+        return;
+    }
+
+    int textureWidth = 0, textureHeight = 0;
+    SDL_QueryTexture( texture, nullptr, nullptr, &textureWidth, &textureHeight );
+
+    const Uint32 mask = COMPONENT_TRANSFORM | COMPONENT_SPRITE;
+
+    int numQuads = 0;
+    const int end = getRangeEnd( last );
+    for( int i = std::max( first, 0 ); i < end; ++i )
+    {
+        if( ( mMasks[ i ] & mask ) != mask )
+        {
+            continue;
+        }
+
+        // Skip sprites outside of the view ( rotation is ignored, sprites only turn slightly )
+        const TransformComponent& transform = mTransforms[ i ];
+        if( transform.x + transform.w < camera.x || transform.x > camera.x + camera.w ||
+            transform.y + transform.h < camera.y || transform.y > camera.y + camera.h )
+        {
+            continue;
+        }
+
+        if( ( numQuads + 1 ) * 4 > int( mVertices.size() ) )
+        {
+            int numSprites = mVertices.size() / 2;
+            mVertices.resize( numSprites * 4 );
+            mIndices.resize( numSprites * 6 );
+        }
+
+        const SpriteComponent& sprite = mSprites[ i ];
+        const float u0 = float( sprite.clip.x ) / textureWidth, u1 = float( sprite.clip.x + sprite.clip.w ) / textureWidth;
+        const float v0 = float( sprite.clip.y ) / textureHeight, v1 = float( sprite.clip.y + sprite.clip.h ) / textureHeight;
+
+        const float halfWidth = transform.w / 2, halfHeight = transform.h / 2;
+        const float centerX = transform.x - camera.x + halfWidth, centerY = transform.y - camera.y + halfHeight;
+        const float cosAngle = std::cos( transform.angle * WD_DEGREES_TO_RADIANS );
+        const float sinAngle = std::sin( transform.angle * WD_DEGREES_TO_RADIANS );
+
+        // Corners of the rotated quad, clockwise from top left
+        const float cornerX[ 4 ] = { -halfWidth, halfWidth, halfWidth, -halfWidth };
+        const float cornerY[ 4 ] = { -halfHeight, -halfHeight, halfHeight, halfHeight };
+        const float cornerU[ 4 ] = { u0, u1, u1, u0 };
+        const float cornerV[ 4 ] = { v0, v0, v1, v1 };
+
+        SDL_Vertex* quad = &mVertices[ numQuads * 4 ];
+        for( int corner = 0; corner < 4; ++corner )
+        {
+            quad[ corner ].position.x = centerX + cornerX[ corner ] * cosAngle - cornerY[ corner ] * sinAngle;
+            quad[ corner ].position.y = centerY + cornerX[ corner ] * sinAngle + cornerY[ corner ] * cosAngle;
+            quad[ corner ].color = sprite.color;
+            quad[ corner ].tex_coord.x = cornerU[ corner ];
+            quad[ corner ].tex_coord.y = cornerV[ corner ];
+        }
+
+        int* indices = &mIndices[ numQuads * 6 ];
+        indices[ 0 ] = numQuads * 4 + 0;
+        indices[ 1 ] = numQuads * 4 + 1;
+        indices[ 2 ] = numQuads * 4 + 2;
+        indices[ 3 ] = numQuads * 4 + 0;
+        indices[ 4 ] = numQuads * 4 + 2;
+        indices[ 5 ] = numQuads * 4 + 3;
+
+        ++numQuads;
+    }
+
+    if( numQuads > 0 && SDL_RenderGeometry( renderer, texture, mVertices.data(), numQuads * 4, mIndices.data(), numQuads * 6 ) != 0 )
+    {
+        printf( "Could not render sprites! SDL_Error: %s\n", SDL_GetError() );
+    }
+}
+
+int World::getNumEntities() const
+{
+    return mMasks.size();
+}
+
+int World::getRangeEnd( const Entity last ) const
+{
+    return last == INVALID_ENTITY ? int( mMasks.size() ) : std::min( last, int( mMasks.size() ) );
+}
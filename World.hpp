@@ -0,0 +1,175 @@
+#ifndef _WORLD_HPP_INCLUDED
+#define _WORLD_HPP_INCLUDED
+
+#include <algorithm>
+#include <vector>
+
+#include <SDL.h>
+
+#include "LevelGenerator.hpp"
+
+// Entities are indices into the component arrays of a world
+typedef int Entity;
+
+const Entity INVALID_ENTITY = -1;
+
+// Components an entity can have, as bits of its component mask
+enum ComponentFlag{
+    COMPONENT_TRANSFORM = 1 << 0,
+    COMPONENT_SPRITE = 1 << 1,
+    COMPONENT_COLLIDER = 1 << 2,
+    COMPONENT_SCORE = 1 << 3,
+    COMPONENT_MOTION = 1 << 4
+};
+
+// Position and size in world coordinates ( in pixels ) and rotation around the center ( in degrees )
+struct TransformComponent{
+    float x, y;
+    float w, h;
+    float angle;
+};
+
+// Clip of the sprite atlas stretched over the transform rectangle, modulated by color
+struct SpriteComponent{
+    SDL_Rect clip;
+    SDL_Color color;
+};
+
+// Solid rectangle in world coordinates ( in pixels ) the player dies touching. Kept in integers so collision stays exact
+struct ColliderComponent{
+    SDL_Rect rect;
+};
+
+// Points the player gets for passing the left side of the transform and whether he already got them
+struct ScoreComponent{
+    int points;
+    bool scored;
+};
+
+// Moving gap edge of a pipe rect: the bottom of a top rect or the top of a bottom rect, at baseEdge where it was generated
+struct MotionComponent{
+    GapMotion gap;
+    int baseEdge;
+    bool top;
+};
+
+// Entity-component storage for the objects of a level. Every component type lives in its own array indexed by entity, so
+// the motion, collision, scoring and rendering systems walk tightly packed arrays front to back instead of chasing pointers
+// from object to object. Systems take a range of entities so only the ones near the camera are looked at. Entities of
+// destroyed objects are reused before the arrays grow
+class World{
+
+public:
+
+    // Initializes internal variables
+    World();
+
+    // Deallocates memory
+    ~World() = default;
+
+    // Destroys all entities, keeping the memory of the arrays
+    void clear();
+
+    // Exchanges all entities with other world without copying them
+    void swap( World& other );
+
+    // Creates an entity without components
+    Entity create();
+
+    // Removes all components of entity and frees it for reuse
+    void destroy( const Entity entity );
+
+    // Adds components to entity ( replacing ones it already has )
+    void addTransform( const Entity entity, const TransformComponent& transform );
+    void addSprite( const Entity entity, const SpriteComponent& sprite );
+    void addCollider( const Entity entity, const ColliderComponent& collider );
+    void addScore( const Entity entity, const ScoreComponent& score );
+    void addMotion( const Entity entity, const MotionComponent& motion );
+
+    // Gets whether entity has all components of mask
+    bool has( const Entity entity, const Uint32 mask ) const;
+
+    // Gets components of entity. Only valid if the entity has them
+    TransformComponent& getTransform( const Entity entity );
+    const TransformComponent& getTransform( const Entity entity ) const;
+    const ColliderComponent& getCollider( const Entity entity ) const;
+
+    // Creates the top and bottom rect of every pipe as entities with transforms, colliders and sprites cropped the way pipes
+    // are drawn. Top rects are worth a point and moving gaps get motion. Pipe i gets entities first + 2 * i and
+    // first + 2 * i + 1. Returns first
+    Entity addPipes( const std::vector<Pipe>& pipes, const SDL_Rect& topClip, const SDL_Rect& botClip );
+
+    // Motion system: moves every gap edge to where it is at given time since the start of the run ( in milliseconds ),
+    // updating colliders, transforms and sprite clips. Only entities from first up to ( not including ) last are looked at
+    void updateMotion( const Uint32 time, const Entity first = 0, const Entity last = INVALID_ENTITY );
+
+    // Collision system: calls function with the rect of every collider between first and last that overlaps the horizontal
+    // span from begin up to end ( in pixels )
+    template<class Function>
+    void forEachCollider( const double begin, const double end, const Entity first, const Entity last, Function function ) const;
+
+    // Scoring system: marks every score between first and last whose transform starts left of posX as scored. Returns the
+    // points scored by that
+    int updateScores( const double posX, const Entity first = 0, const Entity last = INVALID_ENTITY );
+
+    // Puts every score back to whether posX is past it, as after a restart or rewind
+    void resetScores( const double posX );
+
+    // Rendering system: renders every sprite in view of camera with texture in one batch. Only entities from first up to
+    // ( not including ) last are looked at if given
+    void render( SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& camera, const Entity first = 0,
+                 const Entity last = INVALID_ENTITY );
+
+    // Gets number of entity slots ( alive or free )
+    int getNumEntities() const;
+
+private:
+
+    // Component mask of every entity ( 0 for free entities )
+    std::vector<Uint32> mMasks;
+
+    // Component arrays
+    std::vector<TransformComponent> mTransforms;
+    std::vector<SpriteComponent> mSprites;
+    std::vector<ColliderComponent> mColliders;
+    std::vector<ScoreComponent> mScores;
+    std::vector<MotionComponent> mMotions;
+
+    // Sprite clips pipes are cropped from
+    SDL_Rect mTopPipeClip;
+    SDL_Rect mBotPipeClip;
+
+    // Destroyed entities waiting for reuse
+    std::vector<Entity> mFreeEntities;
+
+    // Vertices ( four per sprite ) and indices ( six per sprite ) of the render batch
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;
+
+    // Moves entity ( a top or bottom rect of a pipe ) to rect, cropping its sprite the way pipes are drawn
+    void placePipeRect( const Entity entity, const SDL_Rect& rect, const bool top );
+
+    // Gets the end of a range of entities ending before last ( all entities if last is INVALID_ENTITY )
+    int getRangeEnd( const Entity last ) const;
+};
+
+template<class Function>
+void World::forEachCollider( const double begin, const double end, const Entity first, const Entity last, Function function ) const
+{
+    const int rangeEnd = getRangeEnd( last );
+    for( int i = std::max( first, 0 ); i < rangeEnd; ++i )
+    {
+        if( !( mMasks[ i ] & COMPONENT_COLLIDER ) )
+        {
+            continue;
+        }
+
+        const SDL_Rect& rect = mColliders[ i ].rect;
+        if( rect.x + rect.w > begin && rect.x < end )
+        {
+            function( rect );
+        }
+    }
+}
+
+#endif // _WORLD_HPP_INCLUDED
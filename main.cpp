@@ -1,5 +1,7 @@
 #include <iostream>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <functional>
@@ -10,17 +12,32 @@
 #include <SDL_ttf.h>
 #include <SDL_mixer.h>
 
+#include "AllocationProfiler.hpp"
 #include "LTexture.hpp"
 #include "LTimer.hpp"
 #include "Game.hpp"
 #include "Player.hpp"
 #include "LevelGenerator.hpp"
+#include "Physics.hpp"
+#include "RollbackSession.hpp"
+#include "Startup.hpp"
 
 bool init_SDL();
 void close_SDL();
 
 int main( int argc, char** argv )
 {
+    for( int i = 1; i < argc; ++i )
+    {
+        if( strcmp( argv[ i ], "--startup-trace" ) == 0 )
+        {
+            STARTUP_enableTrace();
+        }
+    }
+    STARTUP_trace( "main entered" );
+
+    int result = 0;
+
     if( !init_SDL() )
     {
         printf( "Could not initialize SDL!\n" );
@@ -29,19 +46,80 @@ int main( int argc, char** argv )
     {
         Game myGame;
         std::cout << "Game created!\n";
+
+        // Versus against another game process: --versus <player> <localPort> <remotePort> <seed>. Both peers have to be this
+        // game, the RollbackVersus tool simulates in fixed point and would desync
+        int versusPlayer = -1;
+        int versusLocalPort = 0, versusRemotePort = 0, versusSeed = 0;
+
+        for( int i = 1; i < argc; ++i )
+        {
+            if( strcmp( argv[ i ], "--versus" ) == 0 && i + 4 < argc )
+            {
+                versusPlayer = atoi( argv[ i + 1 ] ) != 0 ? 1 : 0;
+                versusLocalPort = atoi( argv[ i + 2 ] );
+                versusRemotePort = atoi( argv[ i + 3 ] );
+                versusSeed = atoi( argv[ i + 4 ] );
+            }
+
+            if( strcmp( argv[ i ], "--moving-obstacles" ) == 0 )
+            {
+                myGame.enableMovingObstacles();
+            }
+
+            if( strcmp( argv[ i ], "--trajectory" ) == 0 )
+            {
+                myGame.enableTrajectoryPreview();
+            }
+
+            PhysicsMode mode;
+            if( strcmp( argv[ i ], "--physics" ) == 0 && i + 1 < argc )
+            {
+                if( PHYS_parseMode( argv[ i + 1 ], mode ) )
+                {
+                    myGame.setPhysicsMode( mode );
+                }
+                else
+                {
+                    printf( "Unknown physics mode %s!\n", argv[ i + 1 ] );
+                }
+            }
+        }
         if( !myGame.init() )
         {
             std::cout << "Could not create game!\n";
         }
         else
         {
-            myGame.run();
+            // Instrumented builds report every frame of play that allocates
+            if( ALLOC_isEnabled() )
+            {
+                ALLOC_setFrameBudget( 0, 0 );
+            }
+
+            if( versusPlayer >= 0 )
+            {
+                RollbackSession session;
+                if( !session.init( versusLocalPort, versusRemotePort, versusPlayer, versusSeed ) || !myGame.runVersus( session ) )
+                {
+                    result = 1;
+                }
+            }
+            else
+            {
+                myGame.run();
+            }
+
+            if( ALLOC_isEnabled() )
+            {
+                ALLOC_printReport();
+            }
         }
     }
 
     close_SDL();
 
-    return 0;
+    return result;
 }
 
 bool init_SDL()
@@ -49,7 +127,8 @@ bool init_SDL()
     // Success flag
     bool success = true;
 
-    // Initialize video rendering, timer and audio
+    // Initialize video rendering, timer and audio. All subsystems start here because SDL_InitSubSystem is not safe to call
+    // from several threads
     if( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_AUDIO ) < 0 )
     {
         printf( "SDL could not initialize! SDL_Error: %s\n", SDL_GetError() );
@@ -57,28 +136,19 @@ bool init_SDL()
     }
     else
     {
-        // Initialize PNG loading
-        int imgFlags = IMG_INIT_PNG | IMG_INIT_JPG;
-        if( ( IMG_Init( imgFlags ) & imgFlags ) != imgFlags )
-        {
-            printf( "Could not initialize PNG and JPEG loading! IMG_Error: %s\n", IMG_GetError() );
-            success = false;
-        }
-        else
-        {
-            if( TTF_Init() == -1 )
-            {
-                printf( "SDL_TTF could not initialize! TTF_Error: %s\n", TTF_GetError() );
-                success = false;
-            }
-        }
+        STARTUP_trace( "SDL initialized" );
+
+        // Opening the audio device is slow, so it runs while the window is created and media is loaded
+        STARTUP_openAudioAsync();
 
-        // Initialize SDL_mixer
-        if( Mix_OpenAudio( 44100, MIX_DEFAULT_FORMAT, 2, 2048 ) < 0 )
+        // Initialize PNG loading ( all assets are PNG, JPEG support is not loaded ). SDL_ttf is left to whoever opens a font
+        int imgFlags = IMG_INIT_PNG;
+        if( ( IMG_Init( imgFlags ) & imgFlags ) != imgFlags )
         {
-            printf( "SDL Mixer could not initialize! Mix_Error: %s\n", Mix_GetError() );
+            printf( "Could not initialize PNG loading! IMG_Error: %s\n", IMG_GetError() );
             success = false;
         }
+        STARTUP_trace( "image loading initialized" );
     }
 
     return success;
@@ -86,8 +156,12 @@ bool init_SDL()
 
 void close_SDL()
 {
+    STARTUP_closeAudio();
     Mix_Quit();
-    TTF_Quit();
+    if( TTF_WasInit() )
+    {
+        TTF_Quit();
+    }
     IMG_Quit();
     SDL_Quit();
 }